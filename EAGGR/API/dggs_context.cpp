@@ -0,0 +1,195 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: C API
+//
+//------------------------------------------------------
+/// @file dggs_context.cpp
+/// 
+/// Implements the EAGGR::API::DggsContext class
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
+
+#include "dggs_context.hpp"
+
+#include "Src/Model/IGrid/IHierarchicalGrid/Aperture4TriangleGrid.hpp"
+#include "Src/Model/IGrid/IOffsetGrid/Aperture3HexagonGrid.hpp"
+#include "Src/Model/IGridIndexer/HierarchicalGridIndexer.hpp"
+#include "Src/Model/IGridIndexer/OffsetGridIndexer.hpp"
+#include "Src/Model/IPolyhedralGlobe/Icosahedron.hpp"
+#include "Src/Model/IProjection/Snyder.hpp"
+#include "Src/EAGGRException.hpp"
+
+namespace EAGGR
+{
+  namespace API
+  {
+    /// Source of context ids (zero is reserved for the null handle).
+    static std::atomic<std::uint64_t> g_nextContextId(1U);
+
+    /// Ids of the contexts that have not been closed, guarded by g_openContextIdsMutex.
+    static std::set<std::uint64_t> g_openContextIds;
+    static std::mutex g_openContextIdsMutex;
+
+    /// Number of contexts closed, so that threads can tell when to discard stale error messages.
+    static std::atomic<std::uint64_t> g_noOfClosedContexts(0U);
+
+    /// Last error message for each handle used on this thread, with the id of the context the
+    /// handle referred to when the error occurred.
+    static thread_local std::map<DGGS_Handle, std::pair<std::uint64_t, std::string> >
+        t_lastErrorMessages;
+
+    /// Number of contexts closed when this thread last discarded stale error messages.
+    static thread_local std::uint64_t t_noOfClosedContextsSeen = 0U;
+
+    DggsContext::DggsContext(const DGGS_Model a_dggsModel)
+        :
+            m_model(a_dggsModel),
+            m_pGlobe(new Model::PolyhedralGlobe::Icosahedron),
+            m_pProjection(new Model::Projection::Snyder(m_pGlobe.get())),
+            m_pGrid(CreateGrid(a_dggsModel)),
+            m_pIndexer(CreateIndexer(a_dggsModel, m_pGrid.get(), m_pGlobe->GetNoOfFaces() - 1U)),
+            m_pConverter(new CoordinateConversion::CoordinateConverter),
+            m_pDggs(new Model::DGGS(m_pProjection.get(), m_pIndexer.get())),
+            m_pNeighbourhood(
+                new Model::CellNeighbourhood(
+                    m_pIndexer.get(),
+                    m_pProjection.get(),
+                    m_pGlobe->GetNoOfFaces())),
+            m_id(g_nextContextId++)
+    {
+      std::lock_guard<std::mutex> lock(g_openContextIdsMutex);
+      g_openContextIds.insert(m_id);
+    }
+
+    DggsContext::~DggsContext()
+    {
+      std::lock_guard<std::mutex> lock(g_openContextIdsMutex);
+      g_openContextIds.erase(m_id);
+      ++g_noOfClosedContexts;
+    }
+
+    const DggsContext& DggsContext::GetContext(const DGGS_Handle a_handle)
+    {
+      return *static_cast<const DggsContext*>(a_handle);
+    }
+
+    void DggsContext::SetLastErrorMessage(
+        const DGGS_Handle a_handle,
+        const std::string& a_errorMessage)
+    {
+      DiscardClosedContextErrors();
+      t_lastErrorMessages[a_handle] = std::make_pair(GetId(a_handle), a_errorMessage);
+    }
+
+    std::string DggsContext::GetLastErrorMessage(const DGGS_Handle a_handle)
+    {
+      DiscardClosedContextErrors();
+
+      std::map<DGGS_Handle, std::pair<std::uint64_t, std::string> >::const_iterator lastError =
+          t_lastErrorMessages.find(a_handle);
+
+      // Ignore messages left by an earlier context that had the same address
+      if (lastError == t_lastErrorMessages.end() || lastError->second.first != GetId(a_handle))
+      {
+        return "";
+      }
+
+      return lastError->second.second;
+    }
+
+    void DggsContext::ClearLastErrorMessage(const DGGS_Handle a_handle)
+    {
+      t_lastErrorMessages.erase(a_handle);
+    }
+
+    Model::Grid::IGrid* DggsContext::CreateGrid(const DGGS_Model a_dggsModel)
+    {
+      switch (a_dggsModel)
+      {
+        case DGGS_ISEA4T:
+          return new Model::Grid::HierarchicalGrid::Aperture4TriangleGrid;
+        case DGGS_ISEA3H:
+          return new Model::Grid::OffsetGrid::Aperture3HexagonGrid;
+        default:
+          throw EAGGRException("Requested DGGS model is not supported.");
+      }
+    }
+
+    Model::GridIndexer::IGridIndexer* DggsContext::CreateIndexer(
+        const DGGS_Model a_dggsModel,
+        Model::Grid::IGrid* a_pGrid,
+        const unsigned short a_maximumFaceIndex)
+    {
+      switch (a_dggsModel)
+      {
+        case DGGS_ISEA4T:
+          return new Model::GridIndexer::HierarchicalGridIndexer(
+              static_cast<Model::Grid::IHierarchicalGrid*>(a_pGrid),
+              a_maximumFaceIndex);
+        case DGGS_ISEA3H:
+          return new Model::GridIndexer::OffsetGridIndexer(
+              static_cast<Model::Grid::IOffsetGrid*>(a_pGrid),
+              a_maximumFaceIndex);
+        default:
+          throw EAGGRException("Requested DGGS model is not supported.");
+      }
+    }
+
+    std::uint64_t DggsContext::GetId(const DGGS_Handle a_handle)
+    {
+      return (a_handle == NULL) ? 0U : GetContext(a_handle).m_id;
+    }
+
+    void DggsContext::DiscardClosedContextErrors()
+    {
+      // Nothing to do unless a context has been closed since the last check
+      if (g_noOfClosedContexts == t_noOfClosedContextsSeen)
+      {
+        return;
+      }
+
+      std::lock_guard<std::mutex> lock(g_openContextIdsMutex);
+      t_noOfClosedContextsSeen = g_noOfClosedContexts;
+
+      std::map<DGGS_Handle, std::pair<std::uint64_t, std::string> >::iterator lastError =
+          t_lastErrorMessages.begin();
+      while (lastError != t_lastErrorMessages.end())
+      {
+        // Messages for a null handle have an id of zero and are kept
+        if (lastError->second.first != 0U
+            && g_openContextIds.find(lastError->second.first) == g_openContextIds.end())
+        {
+          t_lastErrorMessages.erase(lastError++);
+        }
+        else
+        {
+          ++lastError;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,128 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: C API
+//
+//------------------------------------------------------
+/// @file dggs_context.hpp
+/// 
+/// Defines the EAGGR::API::DggsContext class, the object each DGGS handle refers to
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "eaggr_api.h"
+
+#include "Src/Model/CellNeighbourhood.hpp"
+#include "Src/Model/DGGS.hpp"
+#include "Src/Model/IGrid.hpp"
+#include "Src/Model/IGridIndexer.hpp"
+#include "Src/Model/IPolyhedralGlobe.hpp"
+#include "Src/Model/IProjection.hpp"
+#include "Src/CoordinateConversion/CoordinateConverter.hpp"
+
+namespace EAGGR
+{
+  namespace API
+  {
+    /// The objects used by a DGGS model.
+    ///
+    /// A DGGS handle points directly at its context. The context is not modified after it has been
+    /// created, so concurrent calls using the same handle do not need to lock. The last error
+    /// message is stored separately for each thread.
+    class DggsContext
+    {
+      public:
+        /// Constructor - creates the objects used by the requested DGGS model.
+        /// @param a_dggsModel The DGGS model.
+        /// @throws EAGGRException If the DGGS model is not supported.
+        explicit DggsContext(const DGGS_Model a_dggsModel);
+
+        /// Destructor - marks the context as closed, so that error messages left for it on any
+        /// thread are discarded.
+        ~DggsContext();
+
+        /// @param a_handle Handle to the DGGS model (must not be null).
+        /// @return The context the handle refers to.
+        static const DggsContext& GetContext(const DGGS_Handle a_handle);
+
+        /// Stores the last error message for the handle on the calling thread.
+        /// @param a_handle Handle to the DGGS model (may be null).
+        /// @param a_errorMessage The error message.
+        static void SetLastErrorMessage(
+            const DGGS_Handle a_handle,
+            const std::string& a_errorMessage);
+
+        /// @param a_handle Handle to the DGGS model (may be null).
+        /// @return The last error message stored for the handle on the calling thread, or an empty
+        /// string if there is none.
+        static std::string GetLastErrorMessage(const DGGS_Handle a_handle);
+
+        /// Discards the last error message for the handle on the calling thread.
+        /// @param a_handle Handle to the DGGS model (may be null).
+        static void ClearLastErrorMessage(const DGGS_Handle a_handle);
+
+        const DGGS_Model m_model;
+        const std::unique_ptr<Model::PolyhedralGlobe::IPolyhedralGlobe> m_pGlobe;
+        const std::unique_ptr<Model::Projection::IProjection> m_pProjection;
+        const std::unique_ptr<Model::Grid::IGrid> m_pGrid;
+        const std::unique_ptr<Model::GridIndexer::IGridIndexer> m_pIndexer;
+        const std::unique_ptr<const CoordinateConversion::CoordinateConverter> m_pConverter;
+        const std::unique_ptr<const Model::DGGS> m_pDggs;
+        const std::unique_ptr<const Model::CellNeighbourhood> m_pNeighbourhood;
+
+      private:
+        // Prevent copying as the context owns the model objects
+        DggsContext(const DggsContext&);
+        DggsContext& operator=(const DggsContext&);
+
+        /// @param a_dggsModel The DGGS model.
+        /// @return A new grid for the DGGS model.
+        /// @throws EAGGRException If the DGGS model is not supported.
+        static Model::Grid::IGrid* CreateGrid(const DGGS_Model a_dggsModel);
+
+        /// @param a_dggsModel The DGGS model.
+        /// @param a_pGrid The grid created for the DGGS model.
+        /// @param a_maximumFaceIndex The maximum face index of the polyhedral globe.
+        /// @return A new grid indexer for the DGGS model.
+        static Model::GridIndexer::IGridIndexer* CreateIndexer(
+            const DGGS_Model a_dggsModel,
+            Model::Grid::IGrid* a_pGrid,
+            const unsigned short a_maximumFaceIndex);
+
+        /// @param a_handle Handle to the DGGS model (may be null).
+        /// @return The id of the context the handle refers to, or zero for a null handle.
+        static std::uint64_t GetId(const DGGS_Handle a_handle);
+
+        /// Discards the error messages stored on the calling thread for contexts that have been
+        /// closed since the thread last checked. Without this, the messages of handles closed
+        /// on other threads would be kept until the thread exits.
+        static void DiscardClosedContextErrors();
+
+        /// Identifies the context uniquely, even if a later context is created at the same address.
+        const std::uint64_t m_id;
+    };
+  }
+}
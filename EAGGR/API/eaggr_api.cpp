@@ -33,19 +33,29 @@
 #include <sstream>
 #include <iostream>
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 #include "eaggr_api.h"
 
 #include "API/eaggr_api_funcs.hpp"
 #include "API/eaggr_api_exceptions.hpp"
-#include "API/dggs_data_store.hpp"
+#include "API/dggs_context.hpp"
+#include "API/prepared_shape.hpp"
+#include "API/shape_arena.hpp"
 #include "Src/ImportExport/GeoJsonImporter.hpp"
 #include "Src/ImportExport/WktImporter.hpp"
 #include "Src/ImportExport/IShapeExporter.hpp"
 #include "Src/ImportExport/GeoJsonExporter.hpp"
 #include "Src/ImportExport/WktExporter.hpp"
 #include "Src/ImportExport/KmlExporter.hpp"
+#include "Src/Model/ICell/HierarchicalCellCompactor.hpp"
+#include "Src/Model/ICell/HierarchicalCellSet.hpp"
+#include "Src/SpatialAnalysis/Polyfill.hpp"
+#include "Src/SpatialAnalysis/RegionCoverer.hpp"
 #include "Src/SpatialAnalysis/SpatialAnalysis.hpp"
+#include "Src/SpatialAnalysis/SpatialJoin.hpp"
+#include "Src/Utilities/WorkStealingPool.hpp"
 
 using namespace EAGGR;
 using namespace EAGGR::API;
@@ -53,7 +63,7 @@ using namespace EAGGR::SpatialAnalysis;
 
 /// Macro for storing the message for the last error to occur.
 #define SET_ERROR_MESSAGE(a_handle, a_message) \
-  g_dggsDataStore.SetErrorMessage(a_handle, a_message);
+  DggsContext::SetLastErrorMessage(a_handle, a_message);
 
 /// Macro for checking the handle to the DGGS model. Function will return a
 /// DGGS_INVALID_HANDLE code if handle is null.
@@ -78,6 +88,17 @@ using namespace EAGGR::SpatialAnalysis;
     return (DGGS_NULL_POINTER); \
   }
 
+/// Macro for checking the DGGS model is ISEA4T. Function will return a DGGS_NOT_IMPLEMENTED code
+/// for other models.
+#define CHECK_ISEA4T_MODEL(a_handle, a_operation) \
+  if (DggsContext::GetContext(a_handle).m_model != DGGS_ISEA4T) \
+  { \
+    std::stringstream stream; \
+    stream << a_operation << " is only supported for the ISEA4T model."; \
+    SET_ERROR_MESSAGE(a_handle, stream.str()) \
+    return (DGGS_NOT_IMPLEMENTED); \
+  }
+
 /// Macro to prevent any exceptions being thrown by the DLL.
 #define CATCH_ALL(a_handle) \
   catch (EAGGR::EAGGRException & exception) \
@@ -91,9 +112,6 @@ using namespace EAGGR::SpatialAnalysis;
     return (DGGS_UNKNOWN_ERROR); \
   }
 
-/// Global map for storing data so it can be destroyed when the DGGS handle is closed.
-DggsDataStore g_dggsDataStore;
-
 DGGS_ReturnCode EAGGR_GetVersion(char * a_versionString)
 {
   CHECK_POINTER(NULL, a_versionString, "a_versionString");
@@ -124,7 +142,7 @@ DGGS_ReturnCode EAGGR_GetLastErrorMessage(
 
   try
   {
-    std::string & message = g_dggsDataStore.GetLastErrorMessage(a_handle);
+    const std::string message = DggsContext::GetLastErrorMessage(a_handle);
 
     *a_pMessageLength = message.size() * sizeof(char);
     if (*a_pMessageLength > 0U)
@@ -151,37 +169,16 @@ DGGS_ReturnCode EAGGR_OpenDggsHandle(const DGGS_Model a_dggsModel, DGGS_Handle *
 
   CHECK_POINTER(NULL, a_pHandle, "a_pHandle");
 
+  // Ensure the handle is null if the DGGS model cannot be created
+  *a_pHandle = NULL;
+
   try
   {
-    DggsData data;
-
-    // Create the necessary object for the DGGS model
-    data.m_pGlobe = new Model::PolyhedralGlobe::Icosahedron;
-    data.m_pProjection = new Model::Projection::Snyder(data.m_pGlobe);
-    data.m_pConverter = new CoordinateConversion::CoordinateConverter;
-
     switch (a_dggsModel)
     {
       case DGGS_ISEA4T:
-      {
-        Model::Grid::HierarchicalGrid::Aperture4TriangleGrid * triangleGrid =
-            new Model::Grid::HierarchicalGrid::Aperture4TriangleGrid;
-        data.m_pGrid = triangleGrid;
-        data.m_pIndexer = new Model::GridIndexer::HierarchicalGridIndexer(
-            triangleGrid,
-            data.m_pGlobe->GetNoOfFaces() - 1U);
-        break;
-      }
       case DGGS_ISEA3H:
-      {
-        Model::Grid::OffsetGrid::Aperture3HexagonGrid * hexagonGrid =
-            new Model::Grid::OffsetGrid::Aperture3HexagonGrid;
-        data.m_pGrid = hexagonGrid;
-        data.m_pIndexer = new Model::GridIndexer::OffsetGridIndexer(
-            hexagonGrid,
-            data.m_pGlobe->GetNoOfFaces() - 1U);
         break;
-      }
       default:
       {
         SET_ERROR_MESSAGE(*a_pHandle, "Requested DGGS model is not supported.")
@@ -189,14 +186,8 @@ DGGS_ReturnCode EAGGR_OpenDggsHandle(const DGGS_Model a_dggsModel, DGGS_Handle *
       }
     }
 
-    // Create the DGGS model
-    *a_pHandle = static_cast<DGGS_Handle>(new Model::DGGS(data.m_pProjection, data.m_pIndexer));
-
-    // Initialise the last error message to a blank string
-    data.m_lastErrorMesssage = "";
-
-    // Store DGGS data so we can destroy it when the handle is closed
-    g_dggsDataStore.SetDggsData(*a_pHandle, data);
+    // Create the objects for the DGGS model, the handle points directly at them
+    *a_pHandle = static_cast<DGGS_Handle>(new DggsContext(a_dggsModel));
   }
   catch (std::bad_alloc &)
   {
@@ -217,18 +208,10 @@ DGGS_ReturnCode EAGGR_CloseDggsHandle(DGGS_Handle * a_pHandle)
 
   try
   {
-    // Destroy all the objects used by the DGGS model
-    DggsData dggsData = g_dggsDataStore.GetDggsData(*a_pHandle);
-    delete dggsData.m_pGlobe;
-    delete dggsData.m_pProjection;
-    delete dggsData.m_pGrid;
-    delete dggsData.m_pIndexer;
-    delete dggsData.m_pConverter;
+    DggsContext::ClearLastErrorMessage(*a_pHandle);
 
-    g_dggsDataStore.RemoveDggsData(*a_pHandle);
-
-    // Destroy the DGGS model itself
-    delete (Model::DGGS *) *a_pHandle;
+    // Destroy the DGGS model and all the objects it uses
+    delete static_cast<const DggsContext *>(*a_pHandle);
 
     // Set the handle to null so it cannot be used anymore
     *a_pHandle = NULL;
@@ -252,6 +235,8 @@ DGGS_ReturnCode EAGGR_ConvertPointsToDggsCells(
 
   try
   {
+    const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+
     // Iterate through the array of points
     for (unsigned short pointIndex = 0U; pointIndex < a_noOfPoints; pointIndex++)
     {
@@ -262,11 +247,9 @@ DGGS_ReturnCode EAGGR_ConvertPointsToDggsCells(
           a_points[pointIndex].m_accuracy);
 
       // Convert the point and add it to the DGGS cells
-      DggsData dggsData = g_dggsDataStore.GetDggsData(a_handle);
-
       GetDggsCellFromWgs84AccuracyPoint(
           a_handle,
-          dggsData.m_pConverter,
+          dggsContext.m_pConverter.get(),
           &wgs84Point,
           &(a_pDggsCells[pointIndex]));
     }
@@ -276,6 +259,360 @@ DGGS_ReturnCode EAGGR_ConvertPointsToDggsCells(
   return (returnCode);
 }
 
+DGGS_ReturnCode EAGGR_ConvertPointsToDggsCellsParallel(
+    const DGGS_Handle a_handle,
+    const DGGS_LatLongPoint * a_points,
+    const unsigned int a_noOfPoints,
+    DGGS_Cell * a_pDggsCells,
+    const unsigned short a_noOfThreads)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_points, "a_points");
+  CHECK_POINTER(a_handle, a_pDggsCells, "a_dggsCells");
+
+  try
+  {
+    const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+    const Utilities::WorkStealingPool pool(a_noOfThreads);
+
+    pool.ParallelFor(
+        a_noOfPoints,
+        Model::DGGS::m_POINTS_PER_CHUNK,
+        [&dggsContext, a_points, a_pDggsCells](const std::size_t a_begin, const std::size_t a_end)
+        {
+          // Convert the points in this chunk to spherical coordinates (expected by the DGGS class)
+          std::vector < LatLong::SphericalAccuracyPoint > sphericalPoints;
+          sphericalPoints.reserve(a_end - a_begin);
+          for (std::size_t pointIndex = a_begin; pointIndex < a_end; ++pointIndex)
+          {
+            const LatLong::Wgs84AccuracyPoint wgs84Point(
+                a_points[pointIndex].m_latitude,
+                a_points[pointIndex].m_longitude,
+                a_points[pointIndex].m_accuracy);
+            sphericalPoints.push_back(dggsContext.m_pConverter->ConvertWGS84ToSphere(wgs84Point));
+          }
+
+          std::vector < std::unique_ptr<Model::Cell::ICell> > cells(a_end - a_begin);
+          dggsContext.m_pDggs->ConvertLatLongPointsToCells(
+              &sphericalPoints[0],
+              sphericalPoints.size(),
+              &cells[0]);
+
+          // Store the cell IDs in the output array
+          CopyCellIds(cells, &a_pDggsCells[a_begin]);
+        });
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertPointsToFaceCoordinates(
+    const DGGS_Handle a_handle,
+    const DGGS_LatLongPoint * a_points,
+    const unsigned int a_noOfPoints,
+    DGGS_FaceCoordinate * a_pFaceCoordinates,
+    const unsigned short a_noOfThreads)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_points, "a_points");
+  CHECK_POINTER(a_handle, a_pFaceCoordinates, "a_pFaceCoordinates");
+
+  try
+  {
+    const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+    const Utilities::WorkStealingPool pool(a_noOfThreads);
+
+    pool.ParallelFor(
+        a_noOfPoints,
+        Model::DGGS::m_POINTS_PER_CHUNK,
+        [&dggsContext, a_points, a_pFaceCoordinates](
+            const std::size_t a_begin,
+            const std::size_t a_end)
+        {
+          // Convert the points in this chunk to spherical coordinates (expected by the DGGS class)
+          std::vector < LatLong::SphericalAccuracyPoint > sphericalPoints;
+          sphericalPoints.reserve(a_end - a_begin);
+          for (std::size_t pointIndex = a_begin; pointIndex < a_end; ++pointIndex)
+          {
+            const LatLong::Wgs84AccuracyPoint wgs84Point(
+                a_points[pointIndex].m_latitude,
+                a_points[pointIndex].m_longitude,
+                a_points[pointIndex].m_accuracy);
+            sphericalPoints.push_back(dggsContext.m_pConverter->ConvertWGS84ToSphere(wgs84Point));
+          }
+
+          std::vector<Model::FaceCoordinate> faceCoordinates;
+          dggsContext.m_pDggs->ConvertLatLongPointsToFaceCoordinates(
+              &sphericalPoints[0],
+              sphericalPoints.size(),
+              faceCoordinates);
+
+          for (std::size_t pointIndex = 0U; pointIndex < faceCoordinates.size(); ++pointIndex)
+          {
+            DGGS_FaceCoordinate & faceCoordinate = a_pFaceCoordinates[a_begin + pointIndex];
+            faceCoordinate.m_faceIndex = faceCoordinates[pointIndex].GetFaceIndex();
+            faceCoordinate.m_xOffset = faceCoordinates[pointIndex].GetXOffset();
+            faceCoordinate.m_yOffset = faceCoordinates[pointIndex].GetYOffset();
+          }
+        });
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertFaceCoordinatesToDggsCells(
+    const DGGS_Handle a_handle,
+    const DGGS_FaceCoordinate * a_faceCoordinates,
+    const unsigned int a_noOfFaceCoordinates,
+    const double a_accuracy,
+    DGGS_Cell * a_pDggsCells,
+    const unsigned short a_noOfThreads)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_faceCoordinates, "a_faceCoordinates");
+  CHECK_POINTER(a_handle, a_pDggsCells, "a_pDggsCells");
+
+  try
+  {
+    const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+
+    // Check the face indices before any work is shared out
+    if (!AreFaceIndicesValid(a_handle, a_faceCoordinates, a_noOfFaceCoordinates))
+    {
+      return (DGGS_INVALID_PARAM);
+    }
+
+    const Utilities::Maths::Degrees accuracyAngle =
+        LatLong::SphericalAccuracyPoint::SquareMetresToAngleAccuracy(a_accuracy);
+    const Utilities::WorkStealingPool pool(a_noOfThreads);
+
+    pool.ParallelFor(
+        a_noOfFaceCoordinates,
+        Model::DGGS::m_POINTS_PER_CHUNK,
+        [&dggsContext, accuracyAngle, a_faceCoordinates, a_pDggsCells](
+            const std::size_t a_begin,
+            const std::size_t a_end)
+        {
+          std::vector<Model::FaceCoordinate> faceCoordinates;
+          faceCoordinates.reserve(a_end - a_begin);
+          for (std::size_t index = a_begin; index < a_end; ++index)
+          {
+            faceCoordinates.push_back(
+                Model::FaceCoordinate(
+                    a_faceCoordinates[index].m_faceIndex,
+                    a_faceCoordinates[index].m_xOffset,
+                    a_faceCoordinates[index].m_yOffset,
+                    0.0));
+          }
+
+          std::vector < std::unique_ptr<Model::Cell::ICell> > cells(a_end - a_begin);
+          dggsContext.m_pDggs->ConvertFaceCoordinatesToCells(
+              &faceCoordinates[0],
+              faceCoordinates.size(),
+              accuracyAngle,
+              &cells[0]);
+
+          // Store the cell IDs in the output array
+          CopyCellIds(cells, &a_pDggsCells[a_begin]);
+        });
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertPointsToDggsCellsAtResolution(
+    const DGGS_Handle a_handle,
+    const DGGS_LatLongPoint * a_points,
+    const unsigned int a_noOfPoints,
+    const unsigned short a_resolution,
+    DGGS_Cell * a_pDggsCells,
+    const unsigned short a_noOfThreads)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_points, "a_points");
+  CHECK_POINTER(a_handle, a_pDggsCells, "a_pDggsCells");
+
+  try
+  {
+    if (!IsResolutionValid(a_handle, a_resolution))
+    {
+      return (DGGS_INVALID_PARAM);
+    }
+
+    const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+    const Utilities::WorkStealingPool pool(a_noOfThreads);
+
+    pool.ParallelFor(
+        a_noOfPoints,
+        Model::DGGS::m_POINTS_PER_CHUNK,
+        [&dggsContext, a_points, a_resolution, a_pDggsCells](
+            const std::size_t a_begin,
+            const std::size_t a_end)
+        {
+          // Convert the points in this chunk to spherical coordinates (expected by the DGGS
+          // class). The accuracies are not needed, so only the positions are converted.
+          const std::size_t noOfPoints = a_end - a_begin;
+          std::vector < Utilities::Maths::Degrees > latitudes(noOfPoints);
+          std::vector < Utilities::Maths::Degrees > longitudes(noOfPoints);
+          for (std::size_t pointIndex = 0U; pointIndex < noOfPoints; ++pointIndex)
+          {
+            latitudes[pointIndex] = a_points[a_begin + pointIndex].m_latitude;
+            longitudes[pointIndex] = a_points[a_begin + pointIndex].m_longitude;
+          }
+          dggsContext.m_pConverter->ConvertWGS84ToSphere(
+              &latitudes[0],
+              &longitudes[0],
+              noOfPoints,
+              &latitudes[0],
+              &longitudes[0]);
+
+          std::vector < LatLong::SphericalAccuracyPoint > sphericalPoints;
+          sphericalPoints.reserve(noOfPoints);
+          for (std::size_t pointIndex = 0U; pointIndex < noOfPoints; ++pointIndex)
+          {
+            sphericalPoints.push_back(
+                LatLong::SphericalAccuracyPoint(
+                    latitudes[pointIndex],
+                    longitudes[pointIndex],
+                    0.0));
+          }
+
+          std::vector < std::unique_ptr<Model::Cell::ICell> > cells(noOfPoints);
+          dggsContext.m_pDggs->ConvertLatLongPointsToCellsAtResolution(
+              &sphericalPoints[0],
+              sphericalPoints.size(),
+              a_resolution,
+              &cells[0]);
+
+          // Store the cell IDs in the output array
+          CopyCellIds(cells, &a_pDggsCells[a_begin]);
+        });
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertFaceCoordinatesToDggsCellsAtResolution(
+    const DGGS_Handle a_handle,
+    const DGGS_FaceCoordinate * a_faceCoordinates,
+    const unsigned int a_noOfFaceCoordinates,
+    const unsigned short a_resolution,
+    DGGS_Cell * a_pDggsCells,
+    const unsigned short a_noOfThreads)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_faceCoordinates, "a_faceCoordinates");
+  CHECK_POINTER(a_handle, a_pDggsCells, "a_pDggsCells");
+
+  try
+  {
+    const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+
+    // Check the parameters before any work is shared out
+    if (!IsResolutionValid(a_handle, a_resolution)
+        || !AreFaceIndicesValid(a_handle, a_faceCoordinates, a_noOfFaceCoordinates))
+    {
+      return (DGGS_INVALID_PARAM);
+    }
+
+    const Utilities::WorkStealingPool pool(a_noOfThreads);
+
+    pool.ParallelFor(
+        a_noOfFaceCoordinates,
+        Model::DGGS::m_POINTS_PER_CHUNK,
+        [&dggsContext, a_faceCoordinates, a_resolution, a_pDggsCells](
+            const std::size_t a_begin,
+            const std::size_t a_end)
+        {
+          std::vector<Model::FaceCoordinate> faceCoordinates;
+          faceCoordinates.reserve(a_end - a_begin);
+          for (std::size_t index = a_begin; index < a_end; ++index)
+          {
+            faceCoordinates.push_back(
+                Model::FaceCoordinate(
+                    a_faceCoordinates[index].m_faceIndex,
+                    a_faceCoordinates[index].m_xOffset,
+                    a_faceCoordinates[index].m_yOffset,
+                    0.0));
+          }
+
+          std::vector < std::unique_ptr<Model::Cell::ICell> > cells(a_end - a_begin);
+          dggsContext.m_pDggs->ConvertFaceCoordinatesToCellsAtResolution(
+              &faceCoordinates[0],
+              faceCoordinates.size(),
+              a_resolution,
+              &cells[0]);
+
+          // Store the cell IDs in the output array
+          CopyCellIds(cells, &a_pDggsCells[a_begin]);
+        });
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertPointToDggsCellsAtAllResolutions(
+    const DGGS_Handle a_handle,
+    const DGGS_LatLongPoint * a_pPoint,
+    DGGS_Cell * a_pDggsCells,
+    const unsigned short a_maxNoOfCells,
+    unsigned short * a_pNoOfCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pPoint, "a_pPoint");
+  CHECK_POINTER(a_handle, a_pDggsCells, "a_pDggsCells");
+  CHECK_POINTER(a_handle, a_pNoOfCells, "a_pNoOfCells");
+
+  *a_pNoOfCells = 0U;
+
+  try
+  {
+    const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+
+    // Convert to spherical coordinates (expected by the DGGS class)
+    const LatLong::Wgs84AccuracyPoint wgs84Point(
+        a_pPoint->m_latitude,
+        a_pPoint->m_longitude,
+        a_pPoint->m_accuracy);
+    const LatLong::SphericalAccuracyPoint sphericalPoint =
+        dggsContext.m_pConverter->ConvertWGS84ToSphere(wgs84Point);
+
+    std::vector < std::unique_ptr<Model::Cell::ICell> > cells;
+    dggsContext.m_pDggs->ConvertLatLongPointToCellsAtAllResolutions(sphericalPoint, cells);
+
+    if (cells.size() > a_maxNoOfCells)
+    {
+      std::stringstream stream;
+      stream << "Output array is too small for the " << cells.size() << " cells required.";
+      SET_ERROR_MESSAGE(a_handle, stream.str());
+      return (DGGS_INVALID_PARAM);
+    }
+
+    CopyCellIds(cells, a_pDggsCells);
+    *a_pNoOfCells = static_cast<unsigned short>(cells.size());
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
 DGGS_ReturnCode EAGGR_ConvertShapesToDggsShapes(
     const DGGS_Handle a_handle,
     const DGGS_LatLongShape * a_shapes,
@@ -310,11 +647,11 @@ DGGS_ReturnCode EAGGR_ConvertShapesToDggsShapes(
               shape.m_data.m_point.m_accuracy);
 
           // Convert the point and add it to the DGGS shapes
-          DggsData dggsData = g_dggsDataStore.GetDggsData(a_handle);
+          const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
 
           ConvertWgs84PointAndAddToDggsShapes(
               a_handle,
-              dggsData.m_pConverter,
+              dggsContext.m_pConverter.get(),
               &wgs84Point,
               shapeIndex,
               a_pDggsShapes);
@@ -325,22 +662,14 @@ DGGS_ReturnCode EAGGR_ConvertShapesToDggsShapes(
         {
           // Move data into a Wgs84Linestring object
           LatLong::Wgs84Linestring wgs84Linestring;
-          for (unsigned short pointIndex = 0U; pointIndex < shape.m_data.m_linestring.m_noOfPoints;
-              pointIndex++)
-          {
-            const DGGS_LatLongPoint & latLongPoint = shape.m_data.m_linestring.m_points[pointIndex];
-            wgs84Linestring.AddAccuracyPoint(
-                latLongPoint.m_latitude,
-                latLongPoint.m_longitude,
-                latLongPoint.m_accuracy);
-          }
+          ConvertLatLongLinestringToWgs84Linestring(shape.m_data.m_linestring, wgs84Linestring);
 
           // Convert the linestring and add it to the DGGS shapes
-          DggsData dggsData = g_dggsDataStore.GetDggsData(a_handle);
+          const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
 
           ConvertWgs84LinestringAndAddToDggsShapes(
               a_handle,
-              dggsData.m_pConverter,
+              dggsContext.m_pConverter.get(),
               &wgs84Linestring,
               shapeIndex,
               a_pDggsShapes);
@@ -352,42 +681,14 @@ DGGS_ReturnCode EAGGR_ConvertShapesToDggsShapes(
           // Move data into a Wgs84Polygon object
           LatLong::Wgs84Polygon wgs84Polygon;
 
-          for (unsigned short pointIndex = 0U;
-              pointIndex < shape.m_data.m_polygon.m_outerRing.m_noOfPoints; pointIndex++)
-          {
-            const DGGS_LatLongPoint & latLongPoint =
-                shape.m_data.m_polygon.m_outerRing.m_points[pointIndex];
-            wgs84Polygon.AddAccuracyPointToOuterRing(
-                latLongPoint.m_latitude,
-                latLongPoint.m_longitude,
-                latLongPoint.m_accuracy);
-          }
-
-          for (unsigned short ringIndex = 0U; ringIndex < shape.m_data.m_polygon.m_noOfInnerRings;
-              ringIndex++)
-          {
-            wgs84Polygon.CreateInnerRing();
-
-            for (unsigned short pointIndex = 0U;
-                pointIndex < shape.m_data.m_polygon.m_innerRings[ringIndex].m_noOfPoints;
-                pointIndex++)
-            {
-              const DGGS_LatLongPoint & latLongPoint =
-                  shape.m_data.m_polygon.m_innerRings[ringIndex].m_points[pointIndex];
-              wgs84Polygon.AddAccuracyPointToInnerRing(
-                  ringIndex,
-                  latLongPoint.m_latitude,
-                  latLongPoint.m_longitude,
-                  latLongPoint.m_accuracy);
-            }
-          }
+          ConvertLatLongPolygonToWgs84Polygon(shape.m_data.m_polygon, wgs84Polygon);
 
           // Convert the polygon and add it to the DGGS shapes
-          DggsData dggsData = g_dggsDataStore.GetDggsData(a_handle);
+          const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
 
           ConvertWgs84PolygonAndAddToDggsShapes(
               a_handle,
-              dggsData.m_pConverter,
+              dggsContext.m_pConverter.get(),
               &wgs84Polygon,
               shapeIndex,
               a_pDggsShapes);
@@ -431,45 +732,37 @@ DGGS_ReturnCode EAGGR_ConvertShapeStringToDggsShapes(
 
   try
   {
-    ImportExport::AbstractShapeImporter * pShapeImporter = NULL;
+    std::unique_ptr<ImportExport::AbstractShapeImporter> pShapeImporter(
+        CreateShapeImporter(a_string, a_format, a_accuracy));
+    if (!pShapeImporter)
+    {
+      SET_ERROR_MESSAGE(a_handle, "Unrecognised shape string format.");
+      return (DGGS_INVALID_PARAM);
+    }
+
+    // Initialise the pointer so a new allocation is created on the first iteration
+    *a_pDggsShapes = NULL;
+
+    // Count the number of shapes as we add them to the output array
+    *a_pNoOfShapes = 0U;
 
     try
     {
-      // Get the correct shape importer for the string format
-      switch (a_format)
+      // Shapes are read from the string as they are converted, so a failure can occur after some
+      // of the shapes have been added to the output array
+      while (pShapeImporter->HasNext())
       {
-        case (DGGS_WKT_FORMAT):
-        {
-          ImportExport::WktImporter * pWktImporter = new ImportExport::WktImporter(
-              a_string,
-              a_accuracy);
-          pShapeImporter = pWktImporter;
-          break;
-        }
-        case (DGGS_GEO_JSON_FORMAT):
-        {
-          ImportExport::GeoJsonImporter * pGeoJsonImporter = new ImportExport::GeoJsonImporter(
-              a_string,
-              a_accuracy);
-          pShapeImporter = pGeoJsonImporter;
-          break;
-        }
-        default:
+        // The number of shapes must fit in the output count
+        if (*a_pNoOfShapes == USHRT_MAX)
         {
-          SET_ERROR_MESSAGE(a_handle, "Unrecognised shape string format.");
+          ClearDggsShapes(a_handle, a_pDggsShapes, a_pNoOfShapes);
+          SET_ERROR_MESSAGE(
+              a_handle,
+              "String contains too many shapes, use "
+              "EAGGR_ConvertShapeStringToDggsShapesWithCallback().");
           return (DGGS_INVALID_PARAM);
         }
-      }
-
-      // Initialise the pointer so a new allocation is created on the first iteration
-      *a_pDggsShapes = NULL;
-
-      // Count the number of shapes as we add them to the output array
-      *a_pNoOfShapes = 0U;
 
-      // Iterate through the array of shapes
-      while (pShapeImporter->HasNext())
-      {
         LatLong::LatLongShape shape = pShapeImporter->GetNextShape();
 
         // Call the correct method for the shape type
@@ -480,11 +773,11 @@ DGGS_ReturnCode EAGGR_ConvertShapeStringToDggsShapes(
             // Convert the point and add it to the DGGS shapes
             const LatLong::Wgs84AccuracyPoint * pWgs84Point =
                 static_cast<const LatLong::Wgs84AccuracyPoint *>(shape.GetShapeData());
-            DggsData dggsData = g_dggsDataStore.GetDggsData(a_handle);
+            const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
 
             ConvertWgs84PointAndAddToDggsShapes(
                 a_handle,
-                dggsData.m_pConverter,
+                dggsContext.m_pConverter.get(),
                 pWgs84Point,
                 *a_pNoOfShapes,
                 a_pDggsShapes);
@@ -495,11 +788,11 @@ DGGS_ReturnCode EAGGR_ConvertShapeStringToDggsShapes(
             // Convert the linestring and add it to the DGGS shapes
             const LatLong::Wgs84Linestring * pWgs84Linestring =
                 static_cast<const LatLong::Wgs84Linestring *>(shape.GetShapeData());
-            DggsData dggsData = g_dggsDataStore.GetDggsData(a_handle);
+            const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
 
             ConvertWgs84LinestringAndAddToDggsShapes(
                 a_handle,
-                dggsData.m_pConverter,
+                dggsContext.m_pConverter.get(),
                 pWgs84Linestring,
                 *a_pNoOfShapes,
                 a_pDggsShapes);
@@ -510,11 +803,11 @@ DGGS_ReturnCode EAGGR_ConvertShapeStringToDggsShapes(
             // Convert the polygon and add it to the DGGS shapes
             const LatLong::Wgs84Polygon * pWgs84Polygon =
                 static_cast<const LatLong::Wgs84Polygon *>(shape.GetShapeData());
-            DggsData dggsData = g_dggsDataStore.GetDggsData(a_handle);
+            const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
 
             ConvertWgs84PolygonAndAddToDggsShapes(
                 a_handle,
-                dggsData.m_pConverter,
+                dggsContext.m_pConverter.get(),
                 pWgs84Polygon,
                 *a_pNoOfShapes,
                 a_pDggsShapes);
@@ -524,6 +817,7 @@ DGGS_ReturnCode EAGGR_ConvertShapeStringToDggsShapes(
           {
             std::stringstream stream;
             stream << "Type of shape " << (*a_pNoOfShapes) + 1U << " in string is not supported";
+            ClearDggsShapes(a_handle, a_pDggsShapes, a_pNoOfShapes);
             SET_ERROR_MESSAGE(a_handle, stream.str());
             return (DGGS_INVALID_PARAM);
           }
@@ -531,18 +825,11 @@ DGGS_ReturnCode EAGGR_ConvertShapeStringToDggsShapes(
 
         (*a_pNoOfShapes)++;
       }
-
-      // Delete the importer
-      delete pShapeImporter;
     }
     catch (...)
     {
-      if (pShapeImporter != NULL)
-      {
-        // Clean up memory allocated to the importer
-        delete pShapeImporter;
-      }
-
+      // Clean up the shapes converted before the failure
+      ClearDggsShapes(a_handle, a_pDggsShapes, a_pNoOfShapes);
       throw;
     }
   }
@@ -556,40 +843,523 @@ DGGS_ReturnCode EAGGR_ConvertShapeStringToDggsShapes(
   return (returnCode);
 }
 
-DGGS_ReturnCode EAGGR_DeallocateDggsShapes(
+DGGS_ReturnCode EAGGR_CreateShapeArena(
     const DGGS_Handle a_handle,
-    DGGS_Shape ** a_pDggsShapes,
-    const unsigned short a_noOfShapes)
+    const unsigned int a_initialSize,
+    DGGS_ShapeArena * a_pShapeArena)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pShapeArena, "a_pShapeArena");
+
+  try
+  {
+    *a_pShapeArena = new ShapeArena(a_initialSize);
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertShapesToDggsShapesInArena(
+    const DGGS_Handle a_handle,
+    const DGGS_LatLongShape * a_shapes,
+    const unsigned short a_noOfShapes,
+    const DGGS_ShapeArena a_shapeArena,
+    DGGS_Shape ** a_pDggsShapes)
 {
   DGGS_ReturnCode returnCode = DGGS_SUCCESS;
 
   CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_shapes, "a_shapes");
+  CHECK_POINTER(a_handle, a_shapeArena, "a_shapeArena");
   CHECK_POINTER(a_handle, a_pDggsShapes, "a_pDggsShapes");
 
-  // Iterate through the array freeing up the memory for each shape
-  for (unsigned short shapeIndex = 0U; shapeIndex < a_noOfShapes; shapeIndex++)
+  try
   {
-    switch ((*a_pDggsShapes)[shapeIndex].m_type)
+    ShapeArena * pShapeArena = static_cast<ShapeArena*>(a_shapeArena);
+
+    // The number of shapes is known so the array is allocated once
+    DGGS_Shape * pDggsShapes = pShapeArena->Allocate<DGGS_Shape>(a_noOfShapes);
+
+    for (unsigned short shapeIndex = 0U; shapeIndex < a_noOfShapes; shapeIndex++)
     {
-      case DGGS_CELL:
+      if (!ConvertLatLongShapeToDggsShape(
+          a_handle,
+          a_shapes[shapeIndex],
+          pShapeArena,
+          &pDggsShapes[shapeIndex]))
       {
-        // Do nothing - no addition memory is allocated for cells
-        break;
+        std::stringstream stream;
+        stream << "Type of shape " << (shapeIndex + 1U) << " in the input array is not supported";
+        SET_ERROR_MESSAGE(a_handle, stream.str());
+        return (DGGS_INVALID_PARAM);
       }
-      case DGGS_LINESTRING:
-      {
-        // Free memory allocated for cells in the linestring
-        free(static_cast<void *>((*a_pDggsShapes)[shapeIndex].m_data.m_linestring.m_cells));
+    }
 
-        break;
-      }
-      case DGGS_POLYGON:
-      {
-        // Free memory allocated for cells in the outer ring
-        free(
-            static_cast<void *>((*a_pDggsShapes)[shapeIndex].m_data.m_polygon.m_outerRing.m_cells));
+    *a_pDggsShapes = pDggsShapes;
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
 
-        // Free memory allocated for cells in the inner rings
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertShapeStringToDggsShapesInArena(
+    const DGGS_Handle a_handle,
+    const DGGS_ShapeString a_string,
+    const DGGS_ShapeStringFormat a_format,
+    const double a_accuracy,
+    const DGGS_ShapeArena a_shapeArena,
+    DGGS_Shape ** a_pDggsShapes,
+    unsigned short * a_pNoOfShapes)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_string, "a_string");
+  CHECK_POINTER(a_handle, a_shapeArena, "a_shapeArena");
+  CHECK_POINTER(a_handle, a_pDggsShapes, "a_pDggsShapes");
+  CHECK_POINTER(a_handle, a_pNoOfShapes, "a_pNoOfShapes");
+
+  try
+  {
+    ShapeArena * pShapeArena = static_cast<ShapeArena*>(a_shapeArena);
+
+    std::unique_ptr<ImportExport::AbstractShapeImporter> pShapeImporter(
+        CreateShapeImporter(a_string, a_format, a_accuracy));
+    if (!pShapeImporter)
+    {
+      SET_ERROR_MESSAGE(a_handle, "Unrecognised shape string format.");
+      return (DGGS_INVALID_PARAM);
+    }
+
+    // The number of shapes is not known in advance, so the shapes are gathered before the array
+    // is stored in the arena (the cells and rings are stored in the arena as they are converted)
+    std::vector<DGGS_Shape> dggsShapes;
+
+    while (pShapeImporter->HasNext())
+    {
+      // The number of shapes must fit in the output count
+      if (dggsShapes.size() == USHRT_MAX)
+      {
+        SET_ERROR_MESSAGE(
+            a_handle,
+            "String contains too many shapes, use "
+            "EAGGR_ConvertShapeStringToDggsShapesWithCallback().");
+        return (DGGS_INVALID_PARAM);
+      }
+
+      LatLong::LatLongShape shape = pShapeImporter->GetNextShape();
+      dggsShapes.push_back(DGGS_Shape());
+
+      if (!ConvertImportedShapeToDggsShape(a_handle, shape, pShapeArena, &dggsShapes.back()))
+      {
+        std::stringstream stream;
+        stream << "Type of shape " << dggsShapes.size() << " in string is not supported";
+        SET_ERROR_MESSAGE(a_handle, stream.str());
+        return (DGGS_INVALID_PARAM);
+      }
+    }
+
+    DGGS_Shape * pDggsShapes = pShapeArena->Allocate<DGGS_Shape>(dggsShapes.size());
+    std::copy(dggsShapes.begin(), dggsShapes.end(), pDggsShapes);
+
+    *a_pDggsShapes = pDggsShapes;
+    *a_pNoOfShapes = static_cast<unsigned short>(dggsShapes.size());
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertShapesToDggsShapesWithCallback(
+    const DGGS_Handle a_handle,
+    const DGGS_LatLongShape * a_shapes,
+    const unsigned int a_noOfShapes,
+    const DGGS_ShapeCallback a_callback,
+    void * a_pUserData)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_shapes, "a_shapes");
+  CHECK_POINTER(a_handle, a_callback, "a_callback");
+
+  try
+  {
+    // Only one shape is held at a time, and its memory is reused for the next shape
+    ShapeArena shapeArena(0U);
+
+    for (unsigned int shapeIndex = 0U; shapeIndex < a_noOfShapes; shapeIndex++)
+    {
+      DGGS_Shape dggsShape;
+      if (!ConvertLatLongShapeToDggsShape(a_handle, a_shapes[shapeIndex], &shapeArena, &dggsShape))
+      {
+        std::stringstream stream;
+        stream << "Type of shape " << (shapeIndex + 1U) << " in the input array is not supported";
+        SET_ERROR_MESSAGE(a_handle, stream.str());
+        return (DGGS_INVALID_PARAM);
+      }
+
+      if (!a_callback(shapeIndex, &dggsShape, a_pUserData))
+      {
+        break;
+      }
+
+      shapeArena.Reset();
+    }
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertShapeStringToDggsShapesWithCallback(
+    const DGGS_Handle a_handle,
+    const DGGS_ShapeString a_string,
+    const DGGS_ShapeStringFormat a_format,
+    const double a_accuracy,
+    const DGGS_ShapeCallback a_callback,
+    void * a_pUserData,
+    unsigned int * a_pNoOfShapes)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_string, "a_string");
+  CHECK_POINTER(a_handle, a_callback, "a_callback");
+  CHECK_POINTER(a_handle, a_pNoOfShapes, "a_pNoOfShapes");
+
+  try
+  {
+    *a_pNoOfShapes = 0U;
+
+    std::unique_ptr<ImportExport::AbstractShapeImporter> pShapeImporter(
+        CreateShapeImporter(a_string, a_format, a_accuracy));
+    if (!pShapeImporter)
+    {
+      SET_ERROR_MESSAGE(a_handle, "Unrecognised shape string format.");
+      return (DGGS_INVALID_PARAM);
+    }
+
+    // Only one shape is held at a time, and its memory is reused for the next shape
+    ShapeArena shapeArena(0U);
+
+    while (pShapeImporter->HasNext())
+    {
+      LatLong::LatLongShape shape = pShapeImporter->GetNextShape();
+
+      DGGS_Shape dggsShape;
+      if (!ConvertImportedShapeToDggsShape(a_handle, shape, &shapeArena, &dggsShape))
+      {
+        std::stringstream stream;
+        stream << "Type of shape " << (*a_pNoOfShapes) + 1U << " in string is not supported";
+        SET_ERROR_MESSAGE(a_handle, stream.str());
+        return (DGGS_INVALID_PARAM);
+      }
+
+      const bool isContinuing = a_callback(*a_pNoOfShapes, &dggsShape, a_pUserData);
+      (*a_pNoOfShapes)++;
+
+      if (!isContinuing)
+      {
+        break;
+      }
+
+      shapeArena.Reset();
+    }
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ResetShapeArena(
+    const DGGS_Handle a_handle,
+    const DGGS_ShapeArena a_shapeArena)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_shapeArena, "a_shapeArena");
+
+  try
+  {
+    static_cast<ShapeArena*>(a_shapeArena)->Reset();
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ReleaseShapeArena(
+    const DGGS_Handle a_handle,
+    DGGS_ShapeArena * a_pShapeArena)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pShapeArena, "a_pShapeArena");
+
+  try
+  {
+    delete static_cast<ShapeArena*>(*a_pShapeArena);
+    *a_pShapeArena = NULL;
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertPolygonToDggsCells(
+    const DGGS_Handle a_handle,
+    const DGGS_LatLongPolygon * a_pPolygon,
+    const unsigned short a_resolution,
+    DGGS_Cell ** a_pDggsCells,
+    unsigned int * a_pNoOfCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pPolygon, "a_pPolygon");
+  CHECK_POINTER(a_handle, a_pDggsCells, "a_pDggsCells");
+  CHECK_POINTER(a_handle, a_pNoOfCells, "a_pNoOfCells");
+
+  *a_pDggsCells = NULL;
+  *a_pNoOfCells = 0U;
+
+  try
+  {
+    LatLong::Wgs84Polygon wgs84Polygon;
+    ConvertLatLongPolygonToWgs84Polygon(*a_pPolygon, wgs84Polygon);
+
+    // Find the cells covering the polygon
+    const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+    const SpatialAnalysis::Polyfill polyfill(
+        dggsContext.m_pIndexer.get(),
+        dggsContext.m_pProjection.get(),
+        dggsContext.m_pConverter.get(),
+        dggsContext.m_pGlobe->GetNoOfFaces());
+
+    std::vector < std::unique_ptr<Model::Cell::ICell> > cells;
+    polyfill.GetCells(wgs84Polygon, a_resolution, cells);
+
+    CopyCellsToArray(cells, a_pDggsCells, a_pNoOfCells);
+  }
+  catch (MaxCellIdLengthException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_CELL_LENGTH_TOO_LONG);
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertShapeToDggsCovering(
+    const DGGS_Handle a_handle,
+    const DGGS_LatLongShape * a_pShape,
+    const DGGS_CoveringType a_coveringType,
+    const unsigned short a_minResolution,
+    const unsigned short a_maxResolution,
+    const unsigned int a_maxCells,
+    DGGS_Cell ** a_pDggsCells,
+    unsigned int * a_pNoOfCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pShape, "a_pShape");
+  CHECK_POINTER(a_handle, a_pDggsCells, "a_pDggsCells");
+  CHECK_POINTER(a_handle, a_pNoOfCells, "a_pNoOfCells");
+
+  *a_pDggsCells = NULL;
+  *a_pNoOfCells = 0U;
+
+  try
+  {
+    const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+    const SpatialAnalysis::RegionCoverer coverer(
+        dggsContext.m_pIndexer.get(),
+        dggsContext.m_pProjection.get(),
+        dggsContext.m_pConverter.get(),
+        dggsContext.m_pGlobe->GetNoOfFaces(),
+        a_minResolution,
+        a_maxResolution,
+        a_maxCells);
+    const SpatialAnalysis::CoveringType coveringType = ConvertCoveringType(a_coveringType);
+
+    std::vector < std::unique_ptr<Model::Cell::ICell> > cells;
+    switch (a_pShape->m_type)
+    {
+      case DGGS_LAT_LONG_LINESTRING:
+      {
+        LatLong::Wgs84Linestring wgs84Linestring;
+        ConvertLatLongLinestringToWgs84Linestring(a_pShape->m_data.m_linestring, wgs84Linestring);
+        coverer.GetCovering(wgs84Linestring, coveringType, cells);
+        break;
+      }
+      case DGGS_LAT_LONG_POLYGON:
+      {
+        LatLong::Wgs84Polygon wgs84Polygon;
+        ConvertLatLongPolygonToWgs84Polygon(a_pShape->m_data.m_polygon, wgs84Polygon);
+        coverer.GetCovering(wgs84Polygon, coveringType, cells);
+        break;
+      }
+      default:
+      {
+        SET_ERROR_MESSAGE(a_handle, "Coverings can only be found for linestrings and polygons.");
+        return (DGGS_INVALID_PARAM);
+      }
+    }
+
+    CopyCellsToArray(cells, a_pDggsCells, a_pNoOfCells);
+  }
+  catch (MaxCellIdLengthException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_CELL_LENGTH_TOO_LONG);
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertBoundingBoxToDggsCovering(
+    const DGGS_Handle a_handle,
+    const double a_minLatitude,
+    const double a_minLongitude,
+    const double a_maxLatitude,
+    const double a_maxLongitude,
+    const DGGS_CoveringType a_coveringType,
+    const unsigned short a_minResolution,
+    const unsigned short a_maxResolution,
+    const unsigned int a_maxCells,
+    DGGS_Cell ** a_pDggsCells,
+    unsigned int * a_pNoOfCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pDggsCells, "a_pDggsCells");
+  CHECK_POINTER(a_handle, a_pNoOfCells, "a_pNoOfCells");
+
+  *a_pDggsCells = NULL;
+  *a_pNoOfCells = 0U;
+
+  try
+  {
+    const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+    const SpatialAnalysis::RegionCoverer coverer(
+        dggsContext.m_pIndexer.get(),
+        dggsContext.m_pProjection.get(),
+        dggsContext.m_pConverter.get(),
+        dggsContext.m_pGlobe->GetNoOfFaces(),
+        a_minResolution,
+        a_maxResolution,
+        a_maxCells);
+
+    std::vector < std::unique_ptr<Model::Cell::ICell> > cells;
+    coverer.GetCovering(
+        a_minLatitude,
+        a_minLongitude,
+        a_maxLatitude,
+        a_maxLongitude,
+        ConvertCoveringType(a_coveringType),
+        cells);
+
+    CopyCellsToArray(cells, a_pDggsCells, a_pNoOfCells);
+  }
+  catch (MaxCellIdLengthException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_CELL_LENGTH_TOO_LONG);
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_DeallocateDggsShapes(
+    const DGGS_Handle a_handle,
+    DGGS_Shape ** a_pDggsShapes,
+    const unsigned short a_noOfShapes)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pDggsShapes, "a_pDggsShapes");
+
+  // Iterate through the array freeing up the memory for each shape
+  for (unsigned short shapeIndex = 0U; shapeIndex < a_noOfShapes; shapeIndex++)
+  {
+    switch ((*a_pDggsShapes)[shapeIndex].m_type)
+    {
+      case DGGS_CELL:
+      {
+        // Do nothing - no addition memory is allocated for cells
+        break;
+      }
+      case DGGS_LINESTRING:
+      {
+        // Free memory allocated for cells in the linestring
+        free(static_cast<void *>((*a_pDggsShapes)[shapeIndex].m_data.m_linestring.m_cells));
+
+        break;
+      }
+      case DGGS_POLYGON:
+      {
+        // Free memory allocated for cells in the outer ring
+        free(
+            static_cast<void *>((*a_pDggsShapes)[shapeIndex].m_data.m_polygon.m_outerRing.m_cells));
+
+        // Free memory allocated for cells in the inner rings
         const unsigned short noOfInnerRings =
             (*a_pDggsShapes)[shapeIndex].m_data.m_polygon.m_noOfInnerRings;
         for (unsigned short ringIndex = 0U; ringIndex < noOfInnerRings; ringIndex++)
@@ -618,6 +1388,23 @@ DGGS_ReturnCode EAGGR_DeallocateDggsShapes(
   return (returnCode);
 }
 
+DGGS_ReturnCode EAGGR_DeallocateDggsCells(const DGGS_Handle a_handle, DGGS_Cell ** a_pDggsCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pDggsCells, "a_pDggsCells");
+
+  // Free up memory used for the array
+  if (*a_pDggsCells != NULL)
+  {
+    free(static_cast<void *>(*a_pDggsCells));
+    *a_pDggsCells = NULL;
+  }
+
+  return (returnCode);
+}
+
 DGGS_ReturnCode EAGGR_DeallocateString(const DGGS_Handle a_handle, char ** a_pDggsString)
 {
   DGGS_ReturnCode returnCode = DGGS_SUCCESS;
@@ -649,30 +1436,50 @@ DGGS_ReturnCode EAGGR_ConvertDggsCellsToPoints(
 
   try
   {
-    // Iterate through the array of DGGS cells
+    const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+
+    // Create the ICell objects expected by the DGGS class
+    std::vector < std::unique_ptr<Model::Cell::ICell> > cells;
+    cells.reserve(a_noOfCells);
     for (unsigned short cellIndex = 0U; cellIndex < a_noOfCells; cellIndex++)
     {
       // Check cell ID does not exceed the maximum length
       CheckCellIdLength(a_cells[cellIndex]);
 
-      // Create an ICell object expected by the DGGS class
-      DggsData dggsData = g_dggsDataStore.GetDggsData(a_handle);
+      cells.push_back(dggsContext.m_pIndexer->CreateCell(a_cells[cellIndex]));
+    }
 
-      std::unique_ptr < Model::Cell::ICell > cell = dggsData.m_pIndexer->CreateCell(
-          a_cells[cellIndex]);
+    // Convert the DGGS cells to spherical lat/long points in bulk
+    std::vector < LatLong::SphericalAccuracyPoint > sphericalPoints;
+    dggsContext.m_pDggs->ConvertCellsToLatLongPoints(cells, sphericalPoints);
 
-      // Convert DGGS cell to a spherical lat/long point
-      LatLong::SphericalAccuracyPoint sphericalPoint =
-          static_cast<Model::DGGS *>(a_handle)->ConvertCellToLatLongPoint(*cell);
+    // Convert the spherical coordinates to WGS84 in bulk
+    std::vector < Utilities::Maths::Degrees > latitudes(a_noOfCells);
+    std::vector < Utilities::Maths::Degrees > longitudes(a_noOfCells);
+    for (unsigned short cellIndex = 0U; cellIndex < a_noOfCells; cellIndex++)
+    {
+      latitudes[cellIndex] = sphericalPoints[cellIndex].GetLatitude();
+      longitudes[cellIndex] = sphericalPoints[cellIndex].GetLongitude();
+    }
 
-      // Convert the spherical coordinates to WGS84
-      const LatLong::Wgs84AccuracyPoint wgs84Point = dggsData.m_pConverter->ConvertSphereToWGS84(
-          sphericalPoint);
+    if (a_noOfCells > 0U)
+    {
+      dggsContext.m_pConverter->ConvertSphereToWGS84(
+          &latitudes[0],
+          &longitudes[0],
+          a_noOfCells,
+          &latitudes[0],
+          &longitudes[0]);
+    }
 
+    for (unsigned short cellIndex = 0U; cellIndex < a_noOfCells; cellIndex++)
+    {
       // Move data into the output LatLongPoint structure
-      a_points[cellIndex].m_latitude = wgs84Point.GetLatitude();
-      a_points[cellIndex].m_longitude = wgs84Point.GetLongitude();
-      a_points[cellIndex].m_accuracy = wgs84Point.GetAccuracy();
+      a_points[cellIndex].m_latitude = latitudes[cellIndex];
+      a_points[cellIndex].m_longitude = longitudes[cellIndex];
+      a_points[cellIndex].m_accuracy =
+          LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(
+              sphericalPoints[cellIndex].GetAccuracy());
     }
   }
   catch (MaxCellIdLengthException & exception)
@@ -732,6 +1539,8 @@ DGGS_ReturnCode EAGGR_ConvertDggsCellsToShapeString(
       // Shape array does not allocate memory for the data so we also need another array for this
       std::vector < LatLong::Wgs84AccuracyPoint > points;
 
+      const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+
       // Iterate through the array of DGGS cells
       for (unsigned short cellIndex = 0U; cellIndex < a_noOfCells; cellIndex++)
       {
@@ -739,17 +1548,15 @@ DGGS_ReturnCode EAGGR_ConvertDggsCellsToShapeString(
         CheckCellIdLength(a_cells[cellIndex]);
 
         // Create an ICell object expected by the DGGS class
-        DggsData dggsData = g_dggsDataStore.GetDggsData(a_handle);
-
-        std::unique_ptr < Model::Cell::ICell > cell = dggsData.m_pIndexer->CreateCell(
+        std::unique_ptr < Model::Cell::ICell > cell = dggsContext.m_pIndexer->CreateCell(
             a_cells[cellIndex]);
 
         // Convert DGGS cell to a spherical lat/long point
         LatLong::SphericalAccuracyPoint sphericalPoint =
-            static_cast<Model::DGGS *>(a_handle)->ConvertCellToLatLongPoint(*cell);
+            dggsContext.m_pDggs->ConvertCellToLatLongPoint(*cell);
 
         // Convert the spherical coordinates to WGS84 and store the point
-        points.push_back(dggsData.m_pConverter->ConvertSphereToWGS84(sphericalPoint));
+        points.push_back(dggsContext.m_pConverter->ConvertSphereToWGS84(sphericalPoint));
       }
 
       // Add lat/long points to the shape vector.
@@ -849,20 +1656,20 @@ DGGS_ReturnCode EAGGR_ConvertDggsCellOutlineToShapeString(
       CheckCellIdLength(a_cell);
 
       // Create an ICell object expected by the DGGS class
-      DggsData dggsData = g_dggsDataStore.GetDggsData(a_handle);
+      const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
 
-      std::unique_ptr < Model::Cell::ICell > cell = dggsData.m_pIndexer->CreateCell(a_cell);
+      std::unique_ptr < Model::Cell::ICell > cell = dggsContext.m_pIndexer->CreateCell(a_cell);
 
       // Get vertices in spherical coordinates
       std::vector < LatLong::SphericalAccuracyPoint > sphericalPoints;
-      static_cast<Model::DGGS *>(a_handle)->GetCellVertices(*cell, sphericalPoints);
+      dggsContext.m_pDggs->GetCellVertices(*cell, sphericalPoints);
 
       // Convert the spherical coordinates to WGS84 and add to the polygon
       for (std::vector<LatLong::SphericalAccuracyPoint>::const_iterator iter =
           sphericalPoints.begin(); iter != sphericalPoints.end(); ++iter)
       {
-        LatLong::Wgs84AccuracyPoint wgsAccuracyPoint = dggsData.m_pConverter->ConvertSphereToWGS84(
-            *iter);
+        LatLong::Wgs84AccuracyPoint wgsAccuracyPoint =
+            dggsContext.m_pConverter->ConvertSphereToWGS84(*iter);
         polygon.AddAccuracyPointToOuterRing(
             wgsAccuracyPoint.GetLatitude(),
             wgsAccuracyPoint.GetLongitude(),
@@ -903,10 +1710,398 @@ DGGS_ReturnCode EAGGR_ConvertDggsCellOutlineToShapeString(
   }
   catch (MemoryAllocationException & exception)
   {
-    SET_ERROR_MESSAGE(a_handle, exception.what());
-    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertDggsCellsToPackedCells(
+    const DGGS_Handle a_handle,
+    const DGGS_Cell * a_cells,
+    const unsigned int a_noOfCells,
+    DGGS_PackedCell * a_pPackedCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_cells, "a_cells");
+  CHECK_POINTER(a_handle, a_pPackedCells, "a_pPackedCells");
+
+  try
+  {
+    const Model::DGGS * dggs = DggsContext::GetContext(a_handle).m_pDggs.get();
+
+    // Iterate through the array of DGGS cells
+    for (unsigned int cellIndex = 0U; cellIndex < a_noOfCells; cellIndex++)
+    {
+      // Check cell ID does not exceed the maximum length
+      CheckCellIdLength(a_cells[cellIndex]);
+
+      std::unique_ptr < Model::Cell::ICell > cell = dggs->CreateCell(a_cells[cellIndex]);
+
+      a_pPackedCells[cellIndex] = cell->GetPackedCellId();
+    }
+  }
+  catch (MaxCellIdLengthException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_CELL_LENGTH_TOO_LONG);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ConvertPackedCellsToDggsCells(
+    const DGGS_Handle a_handle,
+    const DGGS_PackedCell * a_packedCells,
+    const unsigned int a_noOfCells,
+    DGGS_Cell * a_pDggsCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_packedCells, "a_packedCells");
+  CHECK_POINTER(a_handle, a_pDggsCells, "a_pDggsCells");
+
+  try
+  {
+    if (!ArePackedCellsValid(a_handle, a_packedCells, a_noOfCells, "a_packedCells"))
+    {
+      return (DGGS_INVALID_PARAM);
+    }
+
+    const Model::DGGS * dggs = DggsContext::GetContext(a_handle).m_pDggs.get();
+
+    // Iterate through the array of packed cells
+    for (unsigned int cellIndex = 0U; cellIndex < a_noOfCells; cellIndex++)
+    {
+      std::unique_ptr < Model::Cell::ICell > cell = dggs->CreateCell(a_packedCells[cellIndex]);
+      const Model::Cell::DggsCellId cellId = cell->GetCellId();
+
+      // Check cell ID does not exceed the maximum length
+      CheckCellIdLength(cellId.c_str());
+
+      // Copy data to the output string
+      static_cast<void>(strncpy(
+          a_pDggsCells[cellIndex],
+          cellId.c_str(),
+          EAGGR_MAX_CELL_STRING_LENGTH));
+    }
+  }
+  catch (MaxCellIdLengthException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_CELL_LENGTH_TOO_LONG);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_CompactPackedCells(
+    const DGGS_Handle a_handle,
+    const DGGS_PackedCell * a_packedCells,
+    const unsigned int a_noOfCells,
+    DGGS_PackedCell * a_pCompactedCells,
+    unsigned int * a_pNoOfCompactedCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_packedCells, "a_packedCells");
+  CHECK_POINTER(a_handle, a_pCompactedCells, "a_pCompactedCells");
+  CHECK_POINTER(a_handle, a_pNoOfCompactedCells, "a_pNoOfCompactedCells");
+  CHECK_ISEA4T_MODEL(a_handle, "Cell compaction");
+
+  *a_pNoOfCompactedCells = 0U;
+
+  try
+  {
+    if (!ArePackedCellsValid(a_handle, a_packedCells, a_noOfCells, "a_packedCells"))
+    {
+      return (DGGS_INVALID_PARAM);
+    }
+
+    const std::vector<Model::Cell::DggsPackedCellId> cells(
+        a_packedCells,
+        a_packedCells + a_noOfCells);
+    std::vector<Model::Cell::DggsPackedCellId> compactedCells;
+    Model::Cell::HierarchicalCellCompactor::Compact(cells, compactedCells);
+
+    std::copy(compactedCells.begin(), compactedCells.end(), a_pCompactedCells);
+    *a_pNoOfCompactedCells = static_cast<unsigned int>(compactedCells.size());
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_UncompactPackedCells(
+    const DGGS_Handle a_handle,
+    const DGGS_PackedCell * a_packedCells,
+    const unsigned int a_noOfCells,
+    const unsigned short a_resolution,
+    DGGS_PackedCell ** a_pUncompactedCells,
+    unsigned int * a_pNoOfUncompactedCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_packedCells, "a_packedCells");
+  CHECK_POINTER(a_handle, a_pUncompactedCells, "a_pUncompactedCells");
+  CHECK_POINTER(a_handle, a_pNoOfUncompactedCells, "a_pNoOfUncompactedCells");
+  CHECK_ISEA4T_MODEL(a_handle, "Cell uncompaction");
+
+  *a_pUncompactedCells = NULL;
+  *a_pNoOfUncompactedCells = 0U;
+
+  try
+  {
+    if (!ArePackedCellsValid(a_handle, a_packedCells, a_noOfCells, "a_packedCells"))
+    {
+      return (DGGS_INVALID_PARAM);
+    }
+
+    const std::vector<Model::Cell::DggsPackedCellId> cells(
+        a_packedCells,
+        a_packedCells + a_noOfCells);
+    std::vector<Model::Cell::DggsPackedCellId> uncompactedCells;
+    Model::Cell::HierarchicalCellCompactor::Uncompact(cells, a_resolution, uncompactedCells);
+
+    CopyPackedCellsToArray(uncompactedCells, a_pUncompactedCells, a_pNoOfUncompactedCells);
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_UnionPackedCells(
+    const DGGS_Handle a_handle,
+    const DGGS_PackedCell * a_packedCells,
+    const unsigned int a_noOfCells,
+    const DGGS_PackedCell * a_otherPackedCells,
+    const unsigned int a_noOfOtherCells,
+    DGGS_PackedCell ** a_pUnionCells,
+    unsigned int * a_pNoOfUnionCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_packedCells, "a_packedCells");
+  CHECK_POINTER(a_handle, a_otherPackedCells, "a_otherPackedCells");
+  CHECK_POINTER(a_handle, a_pUnionCells, "a_pUnionCells");
+  CHECK_POINTER(a_handle, a_pNoOfUnionCells, "a_pNoOfUnionCells");
+  CHECK_ISEA4T_MODEL(a_handle, "Cell set union");
+
+  *a_pUnionCells = NULL;
+  *a_pNoOfUnionCells = 0U;
+
+  try
+  {
+    if (!ArePackedCellsValid(a_handle, a_packedCells, a_noOfCells, "a_packedCells")
+        || !ArePackedCellsValid(
+            a_handle,
+            a_otherPackedCells,
+            a_noOfOtherCells,
+            "a_otherPackedCells"))
+    {
+      return (DGGS_INVALID_PARAM);
+    }
+
+    const Model::Cell::HierarchicalCellSet cellSet(std::vector<Model::Cell::DggsPackedCellId>(
+        a_packedCells,
+        a_packedCells + a_noOfCells));
+    const Model::Cell::HierarchicalCellSet otherCellSet(
+        std::vector<Model::Cell::DggsPackedCellId>(
+            a_otherPackedCells,
+            a_otherPackedCells + a_noOfOtherCells));
+
+    CopyPackedCellsToArray(
+        cellSet.Union(otherCellSet).GetCells(),
+        a_pUnionCells,
+        a_pNoOfUnionCells);
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_IntersectPackedCells(
+    const DGGS_Handle a_handle,
+    const DGGS_PackedCell * a_packedCells,
+    const unsigned int a_noOfCells,
+    const DGGS_PackedCell * a_otherPackedCells,
+    const unsigned int a_noOfOtherCells,
+    DGGS_PackedCell ** a_pIntersectionCells,
+    unsigned int * a_pNoOfIntersectionCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_packedCells, "a_packedCells");
+  CHECK_POINTER(a_handle, a_otherPackedCells, "a_otherPackedCells");
+  CHECK_POINTER(a_handle, a_pIntersectionCells, "a_pIntersectionCells");
+  CHECK_POINTER(a_handle, a_pNoOfIntersectionCells, "a_pNoOfIntersectionCells");
+  CHECK_ISEA4T_MODEL(a_handle, "Cell set intersection");
+
+  *a_pIntersectionCells = NULL;
+  *a_pNoOfIntersectionCells = 0U;
+
+  try
+  {
+    if (!ArePackedCellsValid(a_handle, a_packedCells, a_noOfCells, "a_packedCells")
+        || !ArePackedCellsValid(
+            a_handle,
+            a_otherPackedCells,
+            a_noOfOtherCells,
+            "a_otherPackedCells"))
+    {
+      return (DGGS_INVALID_PARAM);
+    }
+
+    const Model::Cell::HierarchicalCellSet cellSet(std::vector<Model::Cell::DggsPackedCellId>(
+        a_packedCells,
+        a_packedCells + a_noOfCells));
+    const Model::Cell::HierarchicalCellSet otherCellSet(
+        std::vector<Model::Cell::DggsPackedCellId>(
+            a_otherPackedCells,
+            a_otherPackedCells + a_noOfOtherCells));
+
+    CopyPackedCellsToArray(
+        cellSet.Intersection(otherCellSet).GetCells(),
+        a_pIntersectionCells,
+        a_pNoOfIntersectionCells);
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_SubtractPackedCells(
+    const DGGS_Handle a_handle,
+    const DGGS_PackedCell * a_packedCells,
+    const unsigned int a_noOfCells,
+    const DGGS_PackedCell * a_otherPackedCells,
+    const unsigned int a_noOfOtherCells,
+    DGGS_PackedCell ** a_pDifferenceCells,
+    unsigned int * a_pNoOfDifferenceCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_packedCells, "a_packedCells");
+  CHECK_POINTER(a_handle, a_otherPackedCells, "a_otherPackedCells");
+  CHECK_POINTER(a_handle, a_pDifferenceCells, "a_pDifferenceCells");
+  CHECK_POINTER(a_handle, a_pNoOfDifferenceCells, "a_pNoOfDifferenceCells");
+  CHECK_ISEA4T_MODEL(a_handle, "Cell set difference");
+
+  *a_pDifferenceCells = NULL;
+  *a_pNoOfDifferenceCells = 0U;
+
+  try
+  {
+    if (!ArePackedCellsValid(a_handle, a_packedCells, a_noOfCells, "a_packedCells")
+        || !ArePackedCellsValid(
+            a_handle,
+            a_otherPackedCells,
+            a_noOfOtherCells,
+            "a_otherPackedCells"))
+    {
+      return (DGGS_INVALID_PARAM);
+    }
+
+    const Model::Cell::HierarchicalCellSet cellSet(std::vector<Model::Cell::DggsPackedCellId>(
+        a_packedCells,
+        a_packedCells + a_noOfCells));
+    const Model::Cell::HierarchicalCellSet otherCellSet(
+        std::vector<Model::Cell::DggsPackedCellId>(
+            a_otherPackedCells,
+            a_otherPackedCells + a_noOfOtherCells));
+
+    CopyPackedCellsToArray(
+        cellSet.Difference(otherCellSet).GetCells(),
+        a_pDifferenceCells,
+        a_pNoOfDifferenceCells);
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_PackedCellsContain(
+    const DGGS_Handle a_handle,
+    const DGGS_PackedCell * a_packedCells,
+    const unsigned int a_noOfCells,
+    const DGGS_PackedCell * a_testCells,
+    const unsigned int a_noOfTestCells,
+    bool * a_pResults)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_packedCells, "a_packedCells");
+  CHECK_POINTER(a_handle, a_testCells, "a_testCells");
+  CHECK_POINTER(a_handle, a_pResults, "a_pResults");
+  CHECK_ISEA4T_MODEL(a_handle, "Cell set membership");
+
+  try
+  {
+    if (!ArePackedCellsValid(a_handle, a_packedCells, a_noOfCells, "a_packedCells")
+        || !ArePackedCellsValid(a_handle, a_testCells, a_noOfTestCells, "a_testCells"))
+    {
+      return (DGGS_INVALID_PARAM);
+    }
+
+    const Model::Cell::HierarchicalCellSet cellSet(std::vector<Model::Cell::DggsPackedCellId>(
+        a_packedCells,
+        a_packedCells + a_noOfCells));
+
+    cellSet.Contains(a_testCells, a_noOfTestCells, a_pResults);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_DeallocatePackedCells(
+    const DGGS_Handle a_handle,
+    DGGS_PackedCell ** a_pPackedCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pPackedCells, "a_pPackedCells");
+
+  // Free up memory used for the array
+  if (*a_pPackedCells != NULL)
+  {
+    free(static_cast<void *>(*a_pPackedCells));
+    *a_pPackedCells = NULL;
   }
-  CATCH_ALL(a_handle)
 
   return (returnCode);
 }
@@ -930,9 +2125,9 @@ DGGS_ReturnCode EAGGR_GetDggsCellParents(
 
     // Get the parent(s) of the cell using its ID
     std::vector < std::unique_ptr<Model::Cell::ICell> > parents;
-    std::unique_ptr < Model::Cell::ICell > cell = static_cast<Model::DGGS *>(a_handle)->CreateCell(
-        a_cell);
-    static_cast<Model::DGGS *>(a_handle)->GetParents(*cell, parents);
+    const Model::DGGS * dggs = DggsContext::GetContext(a_handle).m_pDggs.get();
+    std::unique_ptr < Model::Cell::ICell > cell = dggs->CreateCell(a_cell);
+    dggs->GetParents(*cell, parents);
 
     // Set the number of parent cells
     *a_pNoOfParents = parents.size();
@@ -980,9 +2175,9 @@ DGGS_ReturnCode EAGGR_GetDggsCellChildren(
 
     // Get the children of the cell using its ID
     std::vector < std::unique_ptr<Model::Cell::ICell> > children;
-    std::unique_ptr < Model::Cell::ICell > cell = static_cast<Model::DGGS *>(a_handle)->CreateCell(
-        a_cell);
-    static_cast<Model::DGGS *>(a_handle)->GetChildren(*cell, children);
+    const Model::DGGS * dggs = DggsContext::GetContext(a_handle).m_pDggs.get();
+    std::unique_ptr < Model::Cell::ICell > cell = dggs->CreateCell(a_cell);
+    dggs->GetChildren(*cell, children);
 
     // Set the number of child cells
     *a_pNoOfChildren = children.size();
@@ -1030,9 +2225,9 @@ DGGS_ReturnCode EAGGR_GetDggsCellSiblings(
 
     // Get the sibling(s) of the cell using its ID
     std::vector < std::unique_ptr<Model::Cell::ICell> > siblings;
-    std::unique_ptr < Model::Cell::ICell > cell = static_cast<Model::DGGS *>(a_handle)->CreateCell(
-        a_cell);
-    static_cast<Model::DGGS *>(a_handle)->GetSiblings(*cell, siblings);
+    const Model::DGGS * dggs = DggsContext::GetContext(a_handle).m_pDggs.get();
+    std::unique_ptr < Model::Cell::ICell > cell = dggs->CreateCell(a_cell);
+    dggs->GetSiblings(*cell, siblings);
 
     // Set the number of sibling cells
     *a_pNoOfSiblings = siblings.size();
@@ -1061,6 +2256,95 @@ DGGS_ReturnCode EAGGR_GetDggsCellSiblings(
   return (returnCode);
 }
 
+DGGS_ReturnCode EAGGR_GetDggsCellNeighbours(
+    const DGGS_Handle a_handle,
+    const DGGS_Cell a_cell,
+    DGGS_Cell * a_neighbourCells,
+    unsigned short * a_pNoOfNeighbours)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_neighbourCells, "a_neighbourCells");
+  CHECK_POINTER(a_handle, a_pNoOfNeighbours, "a_pNoOfNeighbours");
+
+  try
+  {
+    // Check cell ID length does not exceed the maximum length
+    CheckCellIdLength(a_cell);
+
+    // Get the neighbour(s) of the cell using its ID
+    std::vector < std::unique_ptr<Model::Cell::ICell> > neighbours;
+    const DggsContext& context = DggsContext::GetContext(a_handle);
+    std::unique_ptr < Model::Cell::ICell > cell = context.m_pDggs->CreateCell(a_cell);
+    context.m_pNeighbourhood->GetNeighbours(*cell, neighbours);
+
+    // Set the number of neighbouring cells
+    *a_pNoOfNeighbours = neighbours.size();
+
+    // Copy the neighbouring cell IDs into the output array
+    for (std::size_t neighbourIndex = 0U; neighbourIndex < neighbours.size(); ++neighbourIndex)
+    {
+      // Check cell ID of the neighbours does not exceed the maximum length
+      CheckCellIdLength(neighbours[neighbourIndex]->GetCellId().c_str());
+
+      // Copy data to the output string
+      static_cast<void>(strncpy(
+          a_neighbourCells[neighbourIndex],
+          neighbours[neighbourIndex]->GetCellId().c_str(),
+          EAGGR_MAX_CELL_STRING_LENGTH));
+    }
+  }
+  catch (MaxCellIdLengthException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_CELL_LENGTH_TOO_LONG);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_GetDggsCellKRing(
+    const DGGS_Handle a_handle,
+    const DGGS_Cell a_cell,
+    const unsigned short a_k,
+    DGGS_Cell ** a_pKRingCells,
+    unsigned int * a_pNoOfCells)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pKRingCells, "a_pKRingCells");
+  CHECK_POINTER(a_handle, a_pNoOfCells, "a_pNoOfCells");
+
+  try
+  {
+    // Check cell ID length does not exceed the maximum length
+    CheckCellIdLength(a_cell);
+
+    std::vector < std::unique_ptr<Model::Cell::ICell> > cells;
+    const DggsContext& context = DggsContext::GetContext(a_handle);
+    std::unique_ptr < Model::Cell::ICell > cell = context.m_pDggs->CreateCell(a_cell);
+    context.m_pNeighbourhood->GetKRing(*cell, a_k, cells);
+
+    CopyCellsToArray(cells, a_pKRingCells, a_pNoOfCells);
+  }
+  catch (MaxCellIdLengthException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_CELL_LENGTH_TOO_LONG);
+  }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
 DGGS_ReturnCode EAGGR_GetBoundingDggsCell(
     const DGGS_Handle a_handle,
     const DGGS_Cell * a_cells,
@@ -1079,7 +2363,7 @@ DGGS_ReturnCode EAGGR_GetBoundingDggsCell(
 
     unsigned short minimumResolution = USHRT_MAX;
 
-    Model::DGGS* handle = static_cast<Model::DGGS *>(a_handle);
+    const Model::DGGS* handle = DggsContext::GetContext(a_handle).m_pDggs.get();
 
     // Create the cells from the supplied cell ids and record the lowest resolution value
     for (unsigned short cellIndex = 0U; cellIndex < a_noOfCells; ++cellIndex)
@@ -1103,7 +2387,7 @@ DGGS_ReturnCode EAGGR_GetBoundingDggsCell(
         handle->GetParents(*(cells[cellIndex]), parentCells);
 
         unsigned int bestParentIndex = GetBestCellParentIndex(
-            handle,
+            a_handle,
             parentCells,
             originalCellShape);
 
@@ -1125,7 +2409,7 @@ DGGS_ReturnCode EAGGR_GetBoundingDggsCell(
         handle->GetParents(*(cells[cellIndex]), parentCells);
 
         unsigned int bestParentIndex = GetBestCellParentIndex(
-            handle,
+            a_handle,
             parentCells,
             originalCellShape);
 
@@ -1178,9 +2462,11 @@ DGGS_ReturnCode EAGGR_CreateDggsKmlFile(
   try
   {
     // Create the exporter to produce the KML file
-    DggsData dggsData = g_dggsDataStore.GetDggsData(a_handle);
+    const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
 
-    ImportExport::KmlExporter exporter(dggsData.m_pProjection, dggsData.m_pIndexer);
+    ImportExport::KmlExporter exporter(
+        dggsContext.m_pProjection.get(),
+        dggsContext.m_pIndexer.get());
 
     // Add the DGGS cells to the KML exporter
     for (unsigned short cellIndex = 0U; cellIndex < a_noOfCells; cellIndex++)
@@ -1189,7 +2475,7 @@ DGGS_ReturnCode EAGGR_CreateDggsKmlFile(
       CheckCellIdLength(a_cells[cellIndex]);
 
       // Create an ICell object expected by the exporter
-      std::unique_ptr < Model::Cell::ICell > cell = dggsData.m_pIndexer->CreateCell(
+      std::unique_ptr < Model::Cell::ICell > cell = dggsContext.m_pIndexer->CreateCell(
           a_cells[cellIndex]);
 
       // Include the cell in the KML file
@@ -1223,134 +2509,303 @@ DGGS_ReturnCode EAGGR_CompareShapes(
 
   try
   {
-    // Convert the point and add it to the DGGS cells
-    DggsData dggsData = g_dggsDataStore.GetDggsData(a_handle);
+    const PreparedShape baseShape(a_handle, *a_baseShape);
+    *a_shapeComparisonResult = baseShape.Compare(
+        a_handle,
+        *a_comparisonShape,
+        ConvertAnalysisType(a_spatialAnalysisType));
+  }
+  catch (MaxCellIdLengthException & exception)
+  {
 
-    std::unique_ptr < EAGGR::SpatialAnalysis::SpatialAnalysis > baseShapeAnalysis;
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_CELL_LENGTH_TOO_LONG);
+  }
+  CATCH_ALL(a_handle)
 
-    DGGS_ShapeType baseShapeType = a_baseShape->m_type;
-    switch (baseShapeType)
-    {
-      case DGGS_CELL:
-      {
-        //Check cell ID length does not exceed the maximum length
-        CheckCellIdLength(a_baseShape->m_data.m_cell);
+  return (returnCode);
+}
 
-        std::unique_ptr < EAGGR::Model::Cell::ICell > baseCell =
-            static_cast<Model::DGGS *>(a_handle)->CreateCell(a_baseShape->m_data.m_cell);
+DGGS_ReturnCode EAGGR_RelateShapes(
+    const DGGS_Handle a_handle,
+    const DGGS_Shape * a_baseShape,
+    const DGGS_Shape * a_comparisonShape,
+    DGGS_RelationMatrix a_relationMatrix)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
 
-        baseShapeAnalysis = std::unique_ptr < EAGGR::SpatialAnalysis::SpatialAnalysis
-            > (new EAGGR::SpatialAnalysis::SpatialAnalysis(
-                std::move(baseCell),
-                dggsData.m_pIndexer,
-                dggsData.m_pProjection));
-        break;
-      }
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_baseShape, "a_baseShape");
+  CHECK_POINTER(a_handle, a_comparisonShape, "a_comparisonShape");
+  CHECK_POINTER(a_handle, a_relationMatrix, "a_relationMatrix");
 
-      case DGGS_LINESTRING:
-      {
-        std::vector < std::unique_ptr<EAGGR::Model::Cell::ICell> > baseLinestring;
+  try
+  {
+    const PreparedShape baseShape(a_handle, *a_baseShape);
+    const RelationMatrix relationMatrix = baseShape.Relate(a_handle, *a_comparisonShape);
+    CopyRelationMatrix(relationMatrix, a_relationMatrix);
+  }
+  catch (MaxCellIdLengthException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_CELL_LENGTH_TOO_LONG);
+  }
+  CATCH_ALL(a_handle)
 
-        ConvertLinestringToVector(a_handle, a_baseShape->m_data.m_linestring, baseLinestring);
+  return (returnCode);
+}
 
-        baseShapeAnalysis = std::unique_ptr < EAGGR::SpatialAnalysis::SpatialAnalysis
-            > (new EAGGR::SpatialAnalysis::SpatialAnalysis(
-                std::move(baseLinestring),
-                dggsData.m_pIndexer,
-                dggsData.m_pProjection));
-        break;
-      }
+DGGS_ReturnCode EAGGR_RelationMatrixMatches(
+    const DGGS_Handle a_handle,
+    const DGGS_AnalysisType a_spatialAnalysisType,
+    const DGGS_RelationMatrix a_relationMatrix,
+    bool * a_shapeComparisonResult)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
 
-      case DGGS_POLYGON:
-      {
-        std::vector < std::unique_ptr<EAGGR::Model::Cell::ICell> > basePolygonOuterRing;
-        std::vector < std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> >
-            > basePolygonInnerRings;
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_relationMatrix, "a_relationMatrix");
+  CHECK_POINTER(a_handle, a_shapeComparisonResult, "a_shapeComparisonResult");
 
-        ConvertPolygonToVectors(
-            a_handle,
-            a_baseShape->m_data.m_polygon,
-            basePolygonOuterRing,
-            basePolygonInnerRings);
-
-        baseShapeAnalysis = std::unique_ptr < EAGGR::SpatialAnalysis::SpatialAnalysis
-            > (new EAGGR::SpatialAnalysis::SpatialAnalysis(
-                std::move(basePolygonOuterRing),
-                std::move(basePolygonInnerRings),
-                dggsData.m_pIndexer,
-                dggsData.m_pProjection));
-        break;
-      }
+  try
+  {
+    // Only read up to the expected length in case the matrix is not terminated
+    const RelationMatrix relationMatrix(std::string(
+        a_relationMatrix,
+        strnlen(a_relationMatrix, EAGGR_RELATION_MATRIX_LENGTH)));
 
-      default:
-        throw EAGGRException("Unsupported base shape type.");
-    }
+    *a_shapeComparisonResult = relationMatrix.Matches(ConvertAnalysisType(a_spatialAnalysisType));
+  }
+  CATCH_ALL(a_handle)
 
-    DGGS_ShapeType comparisonShapeType = a_comparisonShape->m_type;
-    AnalysisType analysisType = ConvertAnalysisType(a_spatialAnalysisType);
+  return (returnCode);
+}
 
-    switch (comparisonShapeType)
-    {
-      case DGGS_CELL:
-      {
-        //Check cell ID length does not exceed the maximum length
-        CheckCellIdLength(a_comparisonShape->m_data.m_cell);
+DGGS_ReturnCode EAGGR_PrepareShape(
+    const DGGS_Handle a_handle,
+    const DGGS_Shape * a_baseShape,
+    DGGS_PreparedShape * a_pPreparedShape)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
 
-        std::unique_ptr < EAGGR::Model::Cell::ICell > comparisonCell =
-            static_cast<Model::DGGS *>(a_handle)->CreateCell(a_comparisonShape->m_data.m_cell);
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_baseShape, "a_baseShape");
+  CHECK_POINTER(a_handle, a_pPreparedShape, "a_pPreparedShape");
 
-        *a_shapeComparisonResult = baseShapeAnalysis->Analyse(
-            std::move(comparisonCell),
-            analysisType);
-        break;
-      }
+  try
+  {
+    *a_pPreparedShape = new PreparedShape(a_handle, *a_baseShape);
+  }
+  catch (MaxCellIdLengthException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_CELL_LENGTH_TOO_LONG);
+  }
+  CATCH_ALL(a_handle)
 
-      case DGGS_LINESTRING:
-      {
-        std::vector < std::unique_ptr<EAGGR::Model::Cell::ICell> > comparisonLinestring;
+  return (returnCode);
+}
 
-        ConvertLinestringToVector(
-            a_handle,
-            a_comparisonShape->m_data.m_linestring,
-            comparisonLinestring);
+DGGS_ReturnCode EAGGR_ComparePreparedShape(
+    const DGGS_Handle a_handle,
+    const DGGS_AnalysisType a_spatialAnalysisType,
+    const DGGS_PreparedShape a_preparedShape,
+    const DGGS_Shape * a_comparisonShape,
+    bool * a_shapeComparisonResult)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
 
-        *a_shapeComparisonResult = baseShapeAnalysis->Analyse(
-            std::move(comparisonLinestring),
-            analysisType);
-        break;
-      }
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_preparedShape, "a_preparedShape");
+  CHECK_POINTER(a_handle, a_comparisonShape, "a_comparisonShape");
+  CHECK_POINTER(a_handle, a_shapeComparisonResult, "a_shapeComparisonResult");
 
-      case DGGS_POLYGON:
-      {
-        std::vector < std::unique_ptr<EAGGR::Model::Cell::ICell> > comparisonPolygonOuterRing;
-        std::vector < std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> >
-            > comparisonPolygonInnerRings;
+  try
+  {
+    const PreparedShape& preparedShape = *static_cast<const PreparedShape*>(a_preparedShape);
 
-        ConvertPolygonToVectors(
-            a_handle,
-            a_comparisonShape->m_data.m_polygon,
-            comparisonPolygonOuterRing,
-            comparisonPolygonInnerRings);
-
-        *a_shapeComparisonResult = baseShapeAnalysis->Analyse(
-            std::move(comparisonPolygonOuterRing),
-            std::move(comparisonPolygonInnerRings),
-            analysisType);
-        break;
-      }
+    // The cells of the comparison shape are created using the model the shape was prepared with
+    if (&preparedShape.GetContext() != &DggsContext::GetContext(a_handle))
+    {
+      SET_ERROR_MESSAGE(a_handle, "Prepared shape was created with a different DGGS handle.");
+      return (DGGS_INVALID_PARAM);
+    }
 
-      default:
-        throw EAGGRException("Unsupported comparison shape type.");
+    *a_shapeComparisonResult = preparedShape.Compare(
+        a_handle,
+        *a_comparisonShape,
+        ConvertAnalysisType(a_spatialAnalysisType));
+  }
+  catch (MaxCellIdLengthException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_CELL_LENGTH_TOO_LONG);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_RelatePreparedShape(
+    const DGGS_Handle a_handle,
+    const DGGS_PreparedShape a_preparedShape,
+    const DGGS_Shape * a_comparisonShape,
+    DGGS_RelationMatrix a_relationMatrix)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_preparedShape, "a_preparedShape");
+  CHECK_POINTER(a_handle, a_comparisonShape, "a_comparisonShape");
+  CHECK_POINTER(a_handle, a_relationMatrix, "a_relationMatrix");
+
+  try
+  {
+    const PreparedShape& preparedShape = *static_cast<const PreparedShape*>(a_preparedShape);
+
+    // The cells of the comparison shape are created using the model the shape was prepared with
+    if (&preparedShape.GetContext() != &DggsContext::GetContext(a_handle))
+    {
+      SET_ERROR_MESSAGE(a_handle, "Prepared shape was created with a different DGGS handle.");
+      return (DGGS_INVALID_PARAM);
     }
+
+    const RelationMatrix relationMatrix = preparedShape.Relate(a_handle, *a_comparisonShape);
+    CopyRelationMatrix(relationMatrix, a_relationMatrix);
   }
   catch (MaxCellIdLengthException & exception)
   {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_CELL_LENGTH_TOO_LONG);
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_ReleasePreparedShape(
+    const DGGS_Handle a_handle,
+    DGGS_PreparedShape * a_pPreparedShape)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pPreparedShape, "a_pPreparedShape");
+
+  try
+  {
+    delete static_cast<PreparedShape*>(*a_pPreparedShape);
+    *a_pPreparedShape = NULL;
+  }
+  CATCH_ALL(a_handle)
+
+  return (returnCode);
+}
+
+DGGS_ReturnCode EAGGR_CompareShapeSets(
+    const DGGS_Handle a_handle,
+    const DGGS_AnalysisType a_spatialAnalysisType,
+    const DGGS_Shape * a_baseShapes,
+    const unsigned int a_noOfBaseShapes,
+    const DGGS_Shape * a_comparisonShapes,
+    const unsigned int a_noOfComparisonShapes,
+    DGGS_ShapePair ** a_pShapePairs,
+    unsigned int * a_pNoOfShapePairs,
+    const unsigned short a_noOfThreads)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pShapePairs, "a_pShapePairs");
+  CHECK_POINTER(a_handle, a_pNoOfShapePairs, "a_pNoOfShapePairs");
+
+  *a_pShapePairs = NULL;
+  *a_pNoOfShapePairs = 0U;
+
+  if (a_noOfBaseShapes > 0U)
+  {
+    CHECK_POINTER(a_handle, a_baseShapes, "a_baseShapes");
+  }
+  if (a_noOfComparisonShapes > 0U)
+  {
+    CHECK_POINTER(a_handle, a_comparisonShapes, "a_comparisonShapes");
+  }
+
+  try
+  {
+    const AnalysisType analysisType = ConvertAnalysisType(a_spatialAnalysisType);
+    const Utilities::WorkStealingPool pool(a_noOfThreads);
+
+    std::vector<std::unique_ptr<PreparedShape> > baseShapes(a_noOfBaseShapes);
+    std::vector<std::unique_ptr<PreparedShape> > comparisonShapes(a_noOfComparisonShapes);
+    std::vector<const EAGGR::SpatialAnalysis::SpatialAnalysis *> baseAnalyses(a_noOfBaseShapes);
+    std::vector<const EAGGR::SpatialAnalysis::SpatialAnalysis *> comparisonAnalyses(
+        a_noOfComparisonShapes);
+
+    pool.ParallelFor(
+        static_cast<std::size_t>(a_noOfBaseShapes) + a_noOfComparisonShapes,
+        1U,
+        [a_handle, a_baseShapes, a_noOfBaseShapes, a_comparisonShapes, &baseShapes,
+            &comparisonShapes, &baseAnalyses, &comparisonAnalyses](
+            const std::size_t a_begin,
+            const std::size_t a_end)
+        {
+          for (std::size_t shapeIndex = a_begin; shapeIndex < a_end; ++shapeIndex)
+          {
+            if (shapeIndex < a_noOfBaseShapes)
+            {
+              baseShapes[shapeIndex].reset(new PreparedShape(a_handle, a_baseShapes[shapeIndex]));
+              baseAnalyses[shapeIndex] = &baseShapes[shapeIndex]->GetAnalysis();
+            }
+            else
+            {
+              const std::size_t comparisonIndex = shapeIndex - a_noOfBaseShapes;
+              comparisonShapes[comparisonIndex].reset(
+                  new PreparedShape(a_handle, a_comparisonShapes[comparisonIndex]));
+              comparisonAnalyses[comparisonIndex] =
+                  &comparisonShapes[comparisonIndex]->GetAnalysis();
+            }
+          }
+        });
+
+    const SpatialJoin spatialJoin(baseAnalyses, comparisonAnalyses, pool);
 
+    std::vector<SpatialJoin::ShapePair> pairs;
+    spatialJoin.FindPairs(analysisType, pairs);
+
+    CopyShapePairsToArray(pairs, a_pShapePairs, a_pNoOfShapePairs);
+  }
+  catch (MaxCellIdLengthException & exception)
+  {
     SET_ERROR_MESSAGE(a_handle, exception.what());
     return (DGGS_CELL_LENGTH_TOO_LONG);
   }
+  catch (MemoryAllocationException & exception)
+  {
+    SET_ERROR_MESSAGE(a_handle, exception.what());
+    return (DGGS_MEMORY_ALLOCATION_FAILURE);
+  }
   CATCH_ALL(a_handle)
 
   return (returnCode);
 }
 
+DGGS_ReturnCode EAGGR_DeallocateShapePairs(
+    const DGGS_Handle a_handle,
+    DGGS_ShapePair ** a_pShapePairs)
+{
+  DGGS_ReturnCode returnCode = DGGS_SUCCESS;
+
+  CHECK_DGGS_HANDLE(a_handle);
+  CHECK_POINTER(a_handle, a_pShapePairs, "a_pShapePairs");
+
+  // Free up memory used for the array
+  if (*a_pShapePairs != NULL)
+  {
+    free(static_cast<void *>(*a_pShapePairs));
+    *a_pShapePairs = NULL;
+  }
+
+  return (returnCode);
+}
+
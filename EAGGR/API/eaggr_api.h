@@ -34,6 +34,8 @@
 #ifndef EAGGR_API_H
 #define EAGGR_API_H
 
+#include <stdint.h>
+
 /* Enumerated Types */
 
 /**
@@ -117,6 +119,27 @@ typedef enum
   DGGS_WITHIN
 } DGGS_AnalysisType;
 
+/**
+ * Length of the string holding a relation matrix, including the null terminator.
+ */
+#define EAGGR_RELATION_MATRIX_LENGTH 10U
+
+/**
+ * DE-9IM matrix describing how two shapes relate. Holds nine characters in row order, giving the
+ * dimension ('0', '1' or '2') of the intersection of the interior, boundary and exterior of the
+ * base shape with those of the comparison shape, or 'F' if they do not intersect.
+ */
+typedef char DGGS_RelationMatrix[EAGGR_RELATION_MATRIX_LENGTH];
+
+/**
+ * Different covering types supported by the library.
+ */
+typedef enum
+{
+  DGGS_EXTERIOR_COVERING, /** Cells that together contain the whole shape. */
+  DGGS_INTERIOR_COVERING /** Cells that lie entirely inside the shape. */
+} DGGS_CoveringType;
+
 /* Type definitions for converting lat / long shapes from a string. */
 
 /**
@@ -131,6 +154,17 @@ typedef char * DGGS_ShapeString;
  */
 typedef void * DGGS_Handle;
 
+/**
+ * Handle to a shape prepared for comparison with other shapes. Must only be used with the DGGS
+ * handle it was prepared with.
+ */
+typedef void * DGGS_PreparedShape;
+
+/**
+ * Handle to an arena that holds the memory for DGGS shapes, which is all released at once.
+ */
+typedef void * DGGS_ShapeArena;
+
 /* Type definitions for storing shapes as lat / long points */
 
 /**
@@ -194,6 +228,14 @@ typedef struct
  */
 typedef char DGGS_Cell[EAGGR_MAX_CELL_STRING_LENGTH];
 
+/**
+ * Fixed-width integer defining a DGGS cell. Packed cells at the same
+ * resolution sort in the same order as their string equivalents. Functions
+ * taking packed cells return DGGS_INVALID_PARAM if a packed cell cannot be
+ * decoded, e.g. if its face index or resolution is out of range.
+ */
+typedef uint64_t DGGS_PackedCell;
+
 /* Type definitions for outputting shapes as DGGS cells */
 
 /**
@@ -235,6 +277,36 @@ typedef struct
     DGGS_ShapeLocation m_location;
 } DGGS_Shape;
 
+/**
+ * Structure identifying a pair of shapes by their indices in the arrays of base shapes and
+ * comparison shapes.
+ */
+typedef struct
+{
+    unsigned int m_baseShapeIndex;
+    unsigned int m_comparisonShapeIndex;
+} DGGS_ShapePair;
+
+/**
+ * Position of a lat / long point projected on to a face of the polyhedral globe. Face coordinates
+ * do not depend on the DGGS model, so can be converted to cells of any model at any accuracy.
+ */
+typedef struct
+{
+    unsigned short m_faceIndex;
+    double m_xOffset;
+    double m_yOffset;
+} DGGS_FaceCoordinate;
+
+/**
+ * Function called for each shape converted by the streaming conversion functions. The shape and
+ * its cells are only valid until the function returns. Returns false to stop the conversion.
+ */
+typedef bool (*DGGS_ShapeCallback)(const unsigned int a_shapeIndex, /**<IN - Index of the shape in the input. */
+const DGGS_Shape * a_pDggsShape, /**<IN - The shape defined by DGGS cells. */
+void * a_pUserData /**<IN - The user data passed to the conversion function. */
+);
+
 /* Constants for the number of parents and children of a DGGS cell */
 
 /**
@@ -252,6 +324,11 @@ static const unsigned short EAGGR_MAX_CHILD_CELLS = 7U;
  */
 static const unsigned short EAGGR_MAX_SIBLING_CELLS = 15U;
 
+/**
+ * Maximum number of neighbours a DGGS cell can have.
+ */
+static const unsigned short EAGGR_MAX_NEIGHBOUR_CELLS = 12U;
+
 /* Constants for version information */
 
 /**
@@ -318,6 +395,89 @@ extern "C"
   DGGS_Cell * a_pDggsCells /**<IN - Array of DGGS cells. */
   );
 
+  /**
+   * Converts an array of points in lat / long coordinates into an array of DGGS cells, sharing the
+   * points between a number of threads. Gives the same cells as EAGGR_ConvertPointsToDggsCells().
+   * @note If an error occurs some of the cells may already have been written to the output array.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertPointsToDggsCellsParallel(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_LatLongPoint * a_points, /**<IN - Array of lat / long points. */
+  const unsigned int a_noOfPoints, /**<IN - Number of points in the input array (and cells in the output array). */
+  DGGS_Cell * a_pDggsCells, /**<OUT - Array of DGGS cells, populated in the same order as the points. */
+  const unsigned short a_noOfThreads /**<IN - Number of threads to use, including the calling thread (zero uses the number of hardware threads). */
+  );
+
+  /**
+   * Projects an array of points in lat / long coordinates on to the faces of the polyhedral globe,
+   * sharing the points between a number of threads. The face coordinates can then be converted to
+   * cells at several accuracies, or for several DGGS models, without projecting the points again.
+   * The accuracies of the points are not used.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertPointsToFaceCoordinates(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_LatLongPoint * a_points, /**<IN - Array of lat / long points. */
+  const unsigned int a_noOfPoints, /**<IN - Number of points in the input array (and face coordinates in the output array). */
+  DGGS_FaceCoordinate * a_pFaceCoordinates, /**<OUT - Array of face coordinates, populated in the same order as the points. */
+  const unsigned short a_noOfThreads /**<IN - Number of threads to use, including the calling thread (zero uses the number of hardware threads). */
+  );
+
+  /**
+   * Converts an array of face coordinates into an array of DGGS cells at a single accuracy,
+   * sharing the face coordinates between a number of threads. Gives the same cells as
+   * EAGGR_ConvertPointsToDggsCells() for the points the face coordinates were projected from,
+   * with the accuracy of every point set to a_accuracy.
+   * @note If an error occurs some of the cells may already have been written to the output array.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertFaceCoordinatesToDggsCells(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_FaceCoordinate * a_faceCoordinates, /**<IN - Array of face coordinates output by EAGGR_ConvertPointsToFaceCoordinates(). */
+  const unsigned int a_noOfFaceCoordinates, /**<IN - Number of face coordinates in the input array (and cells in the output array). */
+  const double a_accuracy, /**<IN - Defines an area of accuracy (in meters squared) to use for every face coordinate. */
+  DGGS_Cell * a_pDggsCells, /**<OUT - Array of DGGS cells, populated in the same order as the face coordinates. */
+  const unsigned short a_noOfThreads /**<IN - Number of threads to use, including the calling thread (zero uses the number of hardware threads). */
+  );
+
+  /**
+   * Converts an array of points in lat / long coordinates into an array of DGGS cells at the
+   * specified resolution, sharing the points between a number of threads. The accuracies of the
+   * points are ignored. Returns DGGS_INVALID_PARAM if the resolution is greater than 40, the finest
+   * resolution of a cell.
+   * @note If an error occurs some of the cells may already have been written to the output array.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertPointsToDggsCellsAtResolution(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_LatLongPoint * a_points, /**<IN - Array of lat / long points. */
+  const unsigned int a_noOfPoints, /**<IN - Number of points in the input array (and cells in the output array). */
+  const unsigned short a_resolution, /**<IN - Resolution of the DGGS cells. */
+  DGGS_Cell * a_pDggsCells, /**<OUT - Array of DGGS cells, populated in the same order as the points. */
+  const unsigned short a_noOfThreads /**<IN - Number of threads to use, including the calling thread (zero uses the number of hardware threads). */
+  );
+
+  /**
+   * Converts an array of face coordinates into an array of DGGS cells at the specified
+   * resolution, sharing the face coordinates between a number of threads. Gives the same cells as
+   * EAGGR_ConvertPointsToDggsCellsAtResolution() for the points the face coordinates were
+   * projected from.
+   * @note If an error occurs some of the cells may already have been written to the output array.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertFaceCoordinatesToDggsCellsAtResolution(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_FaceCoordinate * a_faceCoordinates, /**<IN - Array of face coordinates output by EAGGR_ConvertPointsToFaceCoordinates(). */
+  const unsigned int a_noOfFaceCoordinates, /**<IN - Number of face coordinates in the input array (and cells in the output array). */
+  const unsigned short a_resolution, /**<IN - Resolution of the DGGS cells. */
+  DGGS_Cell * a_pDggsCells, /**<OUT - Array of DGGS cells, populated in the same order as the face coordinates. */
+  const unsigned short a_noOfThreads /**<IN - Number of threads to use, including the calling thread (zero uses the number of hardware threads). */
+  );
+
+  /**
+   * Converts a point in lat / long coordinates into the DGGS cells containing it at every
+   * resolution, from the whole face down to the resolution given by the accuracy of the point.
+   * The point is only projected once. The last cell is the cell given by
+   * EAGGR_ConvertPointsToDggsCells().
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertPointToDggsCellsAtAllResolutions(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_LatLongPoint * a_pPoint, /**<IN - Lat / long point. */
+  DGGS_Cell * a_pDggsCells, /**<OUT - Array of DGGS cells, populated with the cell at each resolution (coarsest first). */
+  const unsigned short a_maxNoOfCells, /**<IN - Number of cells the output array can hold. */
+  unsigned short * a_pNoOfCells /**<OUT - Number of cells written to the output array (one more than the resolution of the last cell). */
+  );
+
   /**
    * Converts an array of shapes in lat / long coordinates into an array of
    * shapes defined by DGGS cells.
@@ -329,7 +489,11 @@ extern "C"
   );
 
   /**
-   * Converts a shape string into an array of shapes defined by DGGS cells.
+   * Converts a shape string into an array of shapes defined by DGGS cells. Returns
+   * DGGS_INVALID_PARAM if the string contains more than 65535 shapes, which can be converted with
+   * EAGGR_ConvertShapeStringToDggsShapesWithCallback().
+   * @note If an error occurs the shapes already converted are freed, the output array is set to
+   * NULL and the number of shapes is set to zero.
    */
   EXPORT DGGS_ReturnCode EAGGR_ConvertShapeStringToDggsShapes(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
   const DGGS_ShapeString a_string, /**<IN - String containing shape information in one of the supported formats. */
@@ -339,6 +503,138 @@ extern "C"
   unsigned short * a_pNoOfShapes /**<OUT - Number of shapes found in the input string (and the length of the output array). */
   );
 
+  /**
+   * Creates an arena to convert shapes into. The shapes, linestrings and rings converted into the
+   * arena are handed out from a few large blocks of memory rather than being allocated separately,
+   * and are all released together by EAGGR_ResetShapeArena() or EAGGR_ReleaseShapeArena(). The
+   * arena grows as needed and may be used for shapes from any DGGS handle, but not from several
+   * threads at once.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_CreateShapeArena(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const unsigned int a_initialSize, /**<IN - Size of the first block of memory in bytes (zero uses a default size). */
+  DGGS_ShapeArena * a_pShapeArena /**<OUT - Handle to the arena. Must be released using EAGGR_ReleaseShapeArena(). */
+  );
+
+  /**
+   * Converts an array of shapes in lat / long coordinates into an array of shapes defined by DGGS
+   * cells, which is stored in an arena. Gives the same shapes as EAGGR_ConvertShapesToDggsShapes().
+   * @note If an error occurs the memory used so far stays in the arena until it is reset.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertShapesToDggsShapesInArena(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_LatLongShape * a_shapes, /**<IN - Array of shapes defined by lat / long coordinates. */
+  const unsigned short a_noOfShapes, /**<IN - Number of shapes in the input array (and output array). */
+  const DGGS_ShapeArena a_shapeArena, /**<IN - Arena to store the DGGS shapes in. */
+  DGGS_Shape ** a_pDggsShapes /**<OUT - Pointer to an array of DGGS shapes, with the same number of elements as the input array. The array is valid until the arena is reset or released. */
+  );
+
+  /**
+   * Converts a shape string into an array of shapes defined by DGGS cells, which is stored in an
+   * arena. Gives the same shapes as EAGGR_ConvertShapeStringToDggsShapes(), including its limit of
+   * 65535 shapes.
+   * @note If an error occurs the memory used so far stays in the arena until it is reset.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertShapeStringToDggsShapesInArena(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_ShapeString a_string, /**<IN - String containing shape information in one of the supported formats. */
+  const DGGS_ShapeStringFormat a_format, /**<IN - Format used for the string, e.g. WKT. */
+  const double a_accuracy, /**<IN - Defines an area of accuracy (in meters squared) to use for every point in the string. */
+  const DGGS_ShapeArena a_shapeArena, /**<IN - Arena to store the DGGS shapes in. */
+  DGGS_Shape ** a_pDggsShapes, /**<OUT - Pointer to an array containing the input shapes defined by DGGS cells. The array is valid until the arena is reset or released. */
+  unsigned short * a_pNoOfShapes /**<OUT - Number of shapes found in the input string (and the length of the output array). */
+  );
+
+  /**
+   * Converts an array of shapes in lat / long coordinates into shapes defined by DGGS cells,
+   * passing each shape to a callback as soon as it is converted instead of storing them all. Only
+   * one converted shape is held in memory at a time. Gives the same shapes as
+   * EAGGR_ConvertShapesToDggsShapes().
+   * @note If an error occurs the callback will already have been called for the earlier shapes.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertShapesToDggsShapesWithCallback(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_LatLongShape * a_shapes, /**<IN - Array of shapes defined by lat / long coordinates. */
+  const unsigned int a_noOfShapes, /**<IN - Number of shapes in the input array. */
+  const DGGS_ShapeCallback a_callback, /**<IN - Function called with each converted shape, in the order of the input array. */
+  void * a_pUserData /**<IN - Pointer passed to each call of the callback. */
+  );
+
+  /**
+   * Converts a shape string into shapes defined by DGGS cells, passing each shape to a callback as
+   * soon as it is converted instead of storing them all. The whole string is parsed before the
+   * first shape is converted, but only one converted shape is held in memory at a time and there
+   * is no limit on the number of shapes. Gives the same shapes as
+   * EAGGR_ConvertShapeStringToDggsShapes().
+   * @note If an error occurs the callback will already have been called for the earlier shapes.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertShapeStringToDggsShapesWithCallback(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_ShapeString a_string, /**<IN - String containing shape information in one of the supported formats. */
+  const DGGS_ShapeStringFormat a_format, /**<IN - Format used for the string, e.g. WKT. */
+  const double a_accuracy, /**<IN - Defines an area of accuracy (in meters squared) to use for every point in the string. */
+  const DGGS_ShapeCallback a_callback, /**<IN - Function called with each converted shape, in the order of the string. */
+  void * a_pUserData, /**<IN - Pointer passed to each call of the callback. */
+  unsigned int * a_pNoOfShapes /**<OUT - Number of shapes passed to the callback. */
+  );
+
+  /**
+   * Releases all of the shapes stored in an arena at once. The arena keeps its memory for the next
+   * shapes converted into it.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ResetShapeArena(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_ShapeArena a_shapeArena /**<IN - The arena to reset. */
+  );
+
+  /**
+   * Releases an arena and all of the shapes stored in it.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ReleaseShapeArena(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  DGGS_ShapeArena * a_pShapeArena /**<IN - Pointer to the handle for the arena. The handle is set to NULL once released. */
+  );
+
+  /**
+   * Finds the DGGS cells at a resolution that cover a polygon in lat / long coordinates. The cells
+   * output are those whose interiors intersect the polygon, excluding the areas inside its inner
+   * rings. Each cell is output once. The edges of the polygon are straight lines in lat / long.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertPolygonToDggsCells(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_LatLongPolygon * a_pPolygon, /**<IN - Polygon defined by lat / long coordinates. */
+  const unsigned short a_resolution, /**<IN - Resolution of the output cells. */
+  DGGS_Cell ** a_pDggsCells, /**<OUT - Pointer to an array of the DGGS cells covering the polygon. Memory allocated to this pointer must be freed using EAGGR_DeallocateDggsCells(). */
+  unsigned int * a_pNoOfCells /**<OUT - Number of cells in the output array. */
+  );
+
+  /**
+   * Approximates a linestring or polygon in lat / long coordinates with a limited number of DGGS
+   * cells of mixed resolution. An exterior covering contains the whole shape and an interior
+   * covering lies entirely inside it (the interior covering of a linestring is empty). The
+   * covering only exceeds the maximum number of cells if the shape needs more cells at the minimum
+   * resolution. The edges of the shape are straight lines in lat / long.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertShapeToDggsCovering(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const DGGS_LatLongShape * a_pShape, /**<IN - Linestring or polygon defined by lat / long coordinates. */
+  const DGGS_CoveringType a_coveringType, /**<IN - Whether to find an exterior or interior covering. */
+  const unsigned short a_minResolution, /**<IN - Coarsest resolution of the output cells. */
+  const unsigned short a_maxResolution, /**<IN - Finest resolution of the output cells. */
+  const unsigned int a_maxCells, /**<IN - Number of cells the covering should not exceed. */
+  DGGS_Cell ** a_pDggsCells, /**<OUT - Pointer to an array of the DGGS cells covering the shape. Memory allocated to this pointer must be freed using EAGGR_DeallocateDggsCells(). */
+  unsigned int * a_pNoOfCells /**<OUT - Number of cells in the output array. */
+  );
+
+  /**
+   * Approximates a lat / long bounding box with a limited number of DGGS cells of mixed
+   * resolution. See EAGGR_ConvertShapeToDggsCovering(). A box whose maximum longitude is less
+   * than its minimum longitude crosses the antimeridian.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertBoundingBoxToDggsCovering(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  const double a_minLatitude, /**<IN - Southern edge of the box. */
+  const double a_minLongitude, /**<IN - Western edge of the box. */
+  const double a_maxLatitude, /**<IN - Northern edge of the box. */
+  const double a_maxLongitude, /**<IN - Eastern edge of the box. */
+  const DGGS_CoveringType a_coveringType, /**<IN - Whether to find an exterior or interior covering. */
+  const unsigned short a_minResolution, /**<IN - Coarsest resolution of the output cells. */
+  const unsigned short a_maxResolution, /**<IN - Finest resolution of the output cells. */
+  const unsigned int a_maxCells, /**<IN - Number of cells the covering should not exceed. */
+  DGGS_Cell ** a_pDggsCells, /**<OUT - Pointer to an array of the DGGS cells covering the box. Memory allocated to this pointer must be freed using EAGGR_DeallocateDggsCells(). */
+  unsigned int * a_pNoOfCells /**<OUT - Number of cells in the output array. */
+  );
+
   /**
    * Deallocates the memory used by an array of DGGS shapes.
    */
@@ -347,6 +643,14 @@ extern "C"
   const unsigned short a_noOfShapes /**<IN - Number of shapes in the array. */
   );
 
+  /**
+   * Deallocates the memory used by an array of DGGS cells that is allocated and returned by
+   * functions on the API.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_DeallocateDggsCells(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  DGGS_Cell ** a_pDggsCells /**<IN - The array of cells to deallocate. */
+  );
+
   /**
    * Deallocates the memory used by a string. Use to free memory used by strings that are allocated and
    * returned by functions on the API.
@@ -386,6 +690,109 @@ extern "C"
   DGGS_ShapeString * a_pString /**<OUT - String defining the DGGS cells in lat / long coordinates. Memory needs to be freed by client. */
   );
 
+  /**
+   * Converts an array of DGGS cells into an array of packed integer cells.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertDggsCellsToPackedCells(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_Cell * a_cells, /**<IN - Array of DGGS cells. */
+  const unsigned int a_noOfCells, /**<IN - Number of cells in the input array (and the output array). */
+  DGGS_PackedCell * a_pPackedCells /**<OUT - Array of packed cells. */
+  );
+
+  /**
+   * Converts an array of packed integer cells into an array of DGGS cells.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ConvertPackedCellsToDggsCells(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_PackedCell * a_packedCells, /**<IN - Array of packed cells. */
+  const unsigned int a_noOfCells, /**<IN - Number of cells in the input array (and the output array). */
+  DGGS_Cell * a_pDggsCells /**<OUT - Array of DGGS cells. */
+  );
+
+  /**
+   * Replaces every complete group of four sibling cells with their parent, repeating until no
+   * complete group remains. Duplicate cells and cells inside another input cell are removed. Only
+   * supported for the ISEA4T model.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_CompactPackedCells(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_PackedCell * a_packedCells, /**<IN - Array of packed cells in ascending order, at any resolutions. */
+  const unsigned int a_noOfCells, /**<IN - Number of cells in the input array. */
+  DGGS_PackedCell * a_pCompactedCells, /**<OUT - Array of the compacted cells in ascending order. Must have room for a_noOfCells cells. */
+  unsigned int * a_pNoOfCompactedCells /**<OUT - Number of cells in the output array. */
+  );
+
+  /**
+   * Replaces each packed cell with its descendants at a resolution. The output is in ascending
+   * order if the input is in ascending order and no cell is inside another. Only supported for the
+   * ISEA4T model.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_UncompactPackedCells(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_PackedCell * a_packedCells, /**<IN - Array of packed cells. */
+  const unsigned int a_noOfCells, /**<IN - Number of cells in the input array. */
+  const unsigned short a_resolution, /**<IN - Resolution of the output cells. Must not be coarser than any input cell. */
+  DGGS_PackedCell ** a_pUncompactedCells, /**<OUT - Pointer to an array of the descendant cells. Memory allocated to this pointer must be freed using EAGGR_DeallocatePackedCells(). */
+  unsigned int * a_pNoOfUncompactedCells /**<OUT - Number of cells in the output array. */
+  );
+
+  /**
+   * Finds the cells covering the area covered by either of two sets of packed cells. A cell covers
+   * all of its descendants. Only supported for the ISEA4T model.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_UnionPackedCells(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_PackedCell * a_packedCells, /**<IN - Array of packed cells in any order, at any resolutions. */
+  const unsigned int a_noOfCells, /**<IN - Number of cells in the first array. */
+  const DGGS_PackedCell * a_otherPackedCells, /**<IN - Second array of packed cells in any order, at any resolutions. */
+  const unsigned int a_noOfOtherCells, /**<IN - Number of cells in the second array. */
+  DGGS_PackedCell ** a_pUnionCells, /**<OUT - Pointer to an array of the compacted cells of the union in ascending order. Memory allocated to this pointer must be freed using EAGGR_DeallocatePackedCells(). */
+  unsigned int * a_pNoOfUnionCells /**<OUT - Number of cells in the output array. */
+  );
+
+  /**
+   * Finds the cells covering the area covered by both of two sets of packed cells. A cell covers
+   * all of its descendants. Only supported for the ISEA4T model.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_IntersectPackedCells(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_PackedCell * a_packedCells, /**<IN - Array of packed cells in any order, at any resolutions. */
+  const unsigned int a_noOfCells, /**<IN - Number of cells in the first array. */
+  const DGGS_PackedCell * a_otherPackedCells, /**<IN - Second array of packed cells in any order, at any resolutions. */
+  const unsigned int a_noOfOtherCells, /**<IN - Number of cells in the second array. */
+  DGGS_PackedCell ** a_pIntersectionCells, /**<OUT - Pointer to an array of the compacted cells of the intersection in ascending order. Memory allocated to this pointer must be freed using EAGGR_DeallocatePackedCells(). */
+  unsigned int * a_pNoOfIntersectionCells /**<OUT - Number of cells in the output array. */
+  );
+
+  /**
+   * Finds the cells covering the area covered by the first set of packed cells and not by the
+   * second. A cell covers all of its descendants. Only supported for the ISEA4T model.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_SubtractPackedCells(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_PackedCell * a_packedCells, /**<IN - Array of packed cells in any order, at any resolutions. */
+  const unsigned int a_noOfCells, /**<IN - Number of cells in the first array. */
+  const DGGS_PackedCell * a_otherPackedCells, /**<IN - Second array of packed cells in any order, at any resolutions. */
+  const unsigned int a_noOfOtherCells, /**<IN - Number of cells in the second array. */
+  DGGS_PackedCell ** a_pDifferenceCells, /**<OUT - Pointer to an array of the compacted cells of the difference in ascending order. Memory allocated to this pointer must be freed using EAGGR_DeallocatePackedCells(). */
+  unsigned int * a_pNoOfDifferenceCells /**<OUT - Number of cells in the output array. */
+  );
+
+  /**
+   * Tests whether each of a batch of packed cells is in a set of packed cells or inside one of its
+   * cells. A batch in ascending order is tested in a single pass over the set. Only supported for
+   * the ISEA4T model.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_PackedCellsContain(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_PackedCell * a_packedCells, /**<IN - Array of the packed cells in the set, in any order, at any resolutions. */
+  const unsigned int a_noOfCells, /**<IN - Number of cells in the set. */
+  const DGGS_PackedCell * a_testCells, /**<IN - Array of the packed cells to test. */
+  const unsigned int a_noOfTestCells, /**<IN - Number of cells to test. */
+  bool * a_pResults /**<OUT - Flag for each test cell, set if the set contains the cell. Must have room for a_noOfTestCells flags. */
+  );
+
+  /**
+   * Deallocates the memory used by an array of packed cells that is allocated and returned by
+   * functions on the API.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_DeallocatePackedCells(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  DGGS_PackedCell ** a_pPackedCells /**<IN - The array of packed cells to deallocate. */
+  );
+
   /* Functions for handling DGGS cells */
 
   /**
@@ -420,6 +827,32 @@ extern "C"
   unsigned short * a_pNoOfSiblings /**<OUT - Number of sibling cells (depends on the grid system being used). */
   );
 
+  /**
+   * Outputs the neighbours of the specified cell. The neighbouring cells are
+   * defined as those cells in the same resolution that share an edge or a
+   * vertex with the specified cell, including cells on other faces of the
+   * polyhedral globe. The neighbours of a resolution 0 cell are the faces that
+   * share a vertex with its face.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_GetDggsCellNeighbours(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_Cell a_cell, /**<IN - DGGS cell to find the neighbours of. */
+  DGGS_Cell * a_neighbourCells, /**<OUT - Neighbouring cells. Must have space for EAGGR_MAX_NEIGHBOUR_CELLS cells. */
+  unsigned short * a_pNoOfNeighbours /**<OUT - Number of neighbouring cells (depends on the grid system being used and the location of the cell). */
+  );
+
+  /**
+   * Outputs the cells within a number of neighbour steps of the specified
+   * cell. The output starts with the specified cell, followed by each ring of
+   * neighbours in turn. Cells whose centres lie on a face edge or vertex are
+   * output on the lowest indexed face that they lie on.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_GetDggsCellKRing(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_Cell a_cell, /**<IN - DGGS cell at the centre of the rings. */
+  const unsigned short a_k, /**<IN - Number of rings of neighbours to output. */
+  DGGS_Cell ** a_pKRingCells, /**<OUT - Pointer to an array of the cells in the rings. Memory allocated to this pointer must be freed using EAGGR_DeallocateDggsCells(). */
+  unsigned int * a_pNoOfCells /**<OUT - Number of cells in the output array. */
+  );
+
   /**
    * Outputs the highest resolution cell that contains all the given cells.
    */
@@ -449,6 +882,91 @@ extern "C"
   bool * a_shapeComparisonResult /**<OUT - flag indicating the result of the shape comparison. */
   );
 
+  /**
+   * Outputs the DE-9IM matrix describing how two shapes relate. Any number of comparisons can be
+   * evaluated from the matrix using EAGGR_RelationMatrixMatches(), which is quicker than comparing
+   * the shapes for each of them.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_RelateShapes(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_Shape * a_baseShape, /**<IN - Base shape for the comparison. */
+  const DGGS_Shape * a_comparisonShape, /**<IN - Shape to be compared with the base shape. */
+  DGGS_RelationMatrix a_relationMatrix /**<OUT - The relation matrix of the base shape and the comparison shape. */
+  );
+
+  /**
+   * Outputs the result of a shape comparison found from the relation matrix of the shapes. Gives
+   * the same result as EAGGR_CompareShapes() with the shapes the matrix was found for.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_RelationMatrixMatches(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_AnalysisType a_spatialAnalysisType, /**<IN - The type of shape comparison to be performed. */
+  const DGGS_RelationMatrix a_relationMatrix, /**<IN - The relation matrix of the shapes. */
+  bool * a_shapeComparisonResult /**<OUT - flag indicating the result of the shape comparison. */
+  );
+
+  /**
+   * Prepares a base shape for comparison with many other shapes. The geometry of the base shape
+   * is created when it is first needed and is kept for later comparisons. The prepared shape may
+   * be compared from several threads at once and must be released before the DGGS handle is
+   * closed.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_PrepareShape(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_Shape * a_baseShape, /**<IN - Base shape for the comparisons. */
+  DGGS_PreparedShape * a_pPreparedShape /**<OUT - Handle to the prepared shape. Must be released using EAGGR_ReleasePreparedShape(). */
+  );
+
+  /**
+   * Outputs the result of comparing a prepared base shape with another shape. Gives the same
+   * result as EAGGR_CompareShapes() with the shape the prepared shape was created from.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ComparePreparedShape(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model the shape was prepared with */
+  const DGGS_AnalysisType a_spatialAnalysisType, /**<IN - The type of shape comparison to be performed. */
+  const DGGS_PreparedShape a_preparedShape, /**<IN - Prepared base shape for the comparison. */
+  const DGGS_Shape * a_comparisonShape, /**<IN - Shape to be compared with the base shape. */
+  bool * a_shapeComparisonResult /**<OUT - flag indicating the result of the shape comparison. */
+  );
+
+  /**
+   * Outputs the DE-9IM matrix describing how a prepared base shape and another shape relate.
+   * Gives the same result as EAGGR_RelateShapes() with the shape the prepared shape was created
+   * from.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_RelatePreparedShape(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model the shape was prepared with */
+  const DGGS_PreparedShape a_preparedShape, /**<IN - Prepared base shape for the comparison. */
+  const DGGS_Shape * a_comparisonShape, /**<IN - Shape to be compared with the base shape. */
+  DGGS_RelationMatrix a_relationMatrix /**<OUT - The relation matrix of the base shape and the comparison shape. */
+  );
+
+  /**
+   * Releases the memory used by a prepared shape.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_ReleasePreparedShape(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model the shape was prepared with */
+  DGGS_PreparedShape * a_pPreparedShape /**<IN - Pointer to the handle for the prepared shape. The handle is set to NULL once released. */
+  );
+
+  /**
+   * Compares every shape of one array with every shape of another and outputs the pairs for which
+   * the comparison is true. Gives the same pairs as calling EAGGR_CompareShapes() for each pair,
+   * but only compares shapes whose bounding boxes meet and shares the work between a number of
+   * threads.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_CompareShapeSets(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model */
+  const DGGS_AnalysisType a_spatialAnalysisType, /**<IN - The type of shape comparison to be performed. */
+  const DGGS_Shape * a_baseShapes, /**<IN - Array of base shapes for the comparisons. */
+  const unsigned int a_noOfBaseShapes, /**<IN - Number of shapes in the array of base shapes. */
+  const DGGS_Shape * a_comparisonShapes, /**<IN - Array of shapes to be compared with the base shapes. */
+  const unsigned int a_noOfComparisonShapes, /**<IN - Number of shapes in the array of comparison shapes. */
+  DGGS_ShapePair ** a_pShapePairs, /**<OUT - Pointer to an array of the pairs of shapes for which the comparison is true, in order of base shape and then comparison shape. Memory allocated to this pointer must be freed using EAGGR_DeallocateShapePairs(). */
+  unsigned int * a_pNoOfShapePairs, /**<OUT - Number of pairs in the output array. */
+  const unsigned short a_noOfThreads /**<IN - Number of threads to use, including the calling thread (zero uses the number of hardware threads). */
+  );
+
+  /**
+   * Deallocates the memory used by an array of shape pairs.
+   */
+  EXPORT DGGS_ReturnCode EAGGR_DeallocateShapePairs(const DGGS_Handle a_handle, /**<IN - Handle for the DGGS model. */
+  DGGS_ShapePair ** a_pShapePairs /**<IN - The array of shape pairs to deallocate. */
+  );
+
 #ifdef __cplusplus
 }
 #endif
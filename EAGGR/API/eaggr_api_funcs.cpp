@@ -27,6 +27,8 @@
 /// or can be found at <http://www.gnu.org/licenses/>.
 //------------------------------------------------------
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <cstdlib>
 #include <cstring>
@@ -36,8 +38,13 @@
 #include "API/eaggr_api_funcs.hpp"
 
 #include "API/eaggr_api_exceptions.hpp"
+#include "API/dggs_context.hpp"
+#include "Src/ImportExport/GeoJsonImporter.hpp"
+#include "Src/ImportExport/WktImporter.hpp"
 #include "Src/LatLong/SphericalAccuracyPoint.hpp"
 #include "Src/Model/DGGS.hpp"
+#include "Src/Model/ICell/HierarchicalCellValue.hpp"
+#include "Src/Model/ICell/OffsetCell.hpp"
 #include "Src/EAGGRException.hpp"
 
 namespace EAGGR
@@ -52,8 +59,20 @@ namespace EAGGR
         const DGGS_Handle a_handle,
         const CoordinateConversion::CoordinateConverter * a_pConverter,
         const LatLong::Wgs84Linestring * a_pWgs84Linestring,
+        ShapeArena * a_pArena,
         DGGS_Linestring * a_pDggsLinestring);
 
+    /// @param a_pArena Arena to allocate the memory from, or null to allocate it using malloc().
+    /// @param a_count The number of objects to allocate memory for.
+    /// @param a_errorMessage Message for the exception thrown if the allocation fails.
+    /// @return Memory for the objects.
+    /// @throws MemoryAllocationException If the memory could not be allocated.
+    template<typename T>
+    static T * AllocateShapeMemory(
+        ShapeArena * a_pArena,
+        const size_t a_count,
+        const char * a_errorMessage);
+
     void ConvertWgs84PointAndAddToDggsShapes(
         const DGGS_Handle a_handle,
         const CoordinateConversion::CoordinateConverter * a_pConverter,
@@ -64,22 +83,71 @@ namespace EAGGR
       // Allocate memory for the shape
       UpdateDggsShapesMemoryAllocation(a_pDggsShapes, a_shapeIndex);
 
+      ConvertWgs84PointToDggsShape(
+          a_handle,
+          a_pConverter,
+          a_pWgs84Point,
+          &((*a_pDggsShapes)[a_shapeIndex]));
+    }
+
+    void ConvertWgs84LinestringAndAddToDggsShapes(
+        const DGGS_Handle a_handle,
+        const CoordinateConversion::CoordinateConverter * a_pConverter,
+        const LatLong::Wgs84Linestring * a_pWgs84Linestring,
+        const unsigned short a_shapeIndex,
+        DGGS_Shape ** a_pDggsShapes)
+    {
+      // Allocate memory for the shape
+      UpdateDggsShapesMemoryAllocation(a_pDggsShapes, a_shapeIndex);
+
+      ConvertWgs84LinestringToDggsShape(
+          a_handle,
+          a_pConverter,
+          a_pWgs84Linestring,
+          NULL,
+          &((*a_pDggsShapes)[a_shapeIndex]));
+    }
+
+    void ConvertWgs84PolygonAndAddToDggsShapes(
+        const DGGS_Handle a_handle,
+        const CoordinateConversion::CoordinateConverter * a_pConverter,
+        const LatLong::Wgs84Polygon * a_pWgs84Polygon,
+        const unsigned short a_shapeIndex,
+        DGGS_Shape ** a_pDggsShapes)
+    {
+      // Allocate memory for the shape
+      UpdateDggsShapesMemoryAllocation(a_pDggsShapes, a_shapeIndex);
+
+      ConvertWgs84PolygonToDggsShape(
+          a_handle,
+          a_pConverter,
+          a_pWgs84Polygon,
+          NULL,
+          &((*a_pDggsShapes)[a_shapeIndex]));
+    }
+
+    void ConvertWgs84PointToDggsShape(
+        const DGGS_Handle a_handle,
+        const CoordinateConversion::CoordinateConverter * a_pConverter,
+        const LatLong::Wgs84AccuracyPoint * a_pWgs84Point,
+        DGGS_Shape * a_pDggsShape)
+    {
       // Convert to spherical coordinates (expected by the DGGS class)
       const LatLong::SphericalAccuracyPoint sphericalPoint = a_pConverter->ConvertWGS84ToSphere(
           *a_pWgs84Point);
 
       // Convert the point to a cell
       std::unique_ptr < Model::Cell::ICell > pCell =
-          static_cast<Model::DGGS *>(a_handle)->ConvertLatLongPointToCell(sphericalPoint);
+          DggsContext::GetContext(a_handle).m_pDggs->ConvertLatLongPointToCell(sphericalPoint);
 
       // Check cell ID does not exceed the maximum length
       const Model::Cell::DggsCellId cellId = pCell->GetCellId();
       CheckCellIdLength(cellId.c_str());
 
-      // Store the cell data in the output array
-      (*a_pDggsShapes)[a_shapeIndex].m_type = DGGS_CELL;
+      // Store the cell data in the output shape
+      a_pDggsShape->m_type = DGGS_CELL;
       static_cast<void>(strncpy(
-          (*a_pDggsShapes)[a_shapeIndex].m_data.m_cell,
+          a_pDggsShape->m_data.m_cell,
           cellId.c_str(),
           EAGGR_MAX_CELL_STRING_LENGTH));
 
@@ -87,13 +155,13 @@ namespace EAGGR
       switch (pCell->GetCellLocation())
       {
         case Model::Cell::FACE:
-          (*a_pDggsShapes)[a_shapeIndex].m_location = DGGS_ONE_FACE;
+          a_pDggsShape->m_location = DGGS_ONE_FACE;
           break;
         case Model::Cell::EDGE:
-          (*a_pDggsShapes)[a_shapeIndex].m_location = DGGS_TWO_FACES;
+          a_pDggsShape->m_location = DGGS_TWO_FACES;
           break;
         case Model::Cell::VERTEX:
-          (*a_pDggsShapes)[a_shapeIndex].m_location = DGGS_MANY_FACES;
+          a_pDggsShape->m_location = DGGS_MANY_FACES;
           break;
         default:
           std::stringstream stream;
@@ -102,64 +170,55 @@ namespace EAGGR
       }
     }
 
-    void ConvertWgs84LinestringAndAddToDggsShapes(
+    void ConvertWgs84LinestringToDggsShape(
         const DGGS_Handle a_handle,
         const CoordinateConversion::CoordinateConverter * a_pConverter,
         const LatLong::Wgs84Linestring * a_pWgs84Linestring,
-        const unsigned short a_shapeIndex,
-        DGGS_Shape ** a_pDggsShapes)
+        ShapeArena * a_pArena,
+        DGGS_Shape * a_pDggsShape)
     {
-      // Allocate memory for the shape
-      UpdateDggsShapesMemoryAllocation(a_pDggsShapes, a_shapeIndex);
-
       // Set the shape type
-      (*a_pDggsShapes)[a_shapeIndex].m_type = DGGS_LINESTRING;
+      a_pDggsShape->m_type = DGGS_LINESTRING;
 
       // Convert linestring to a DGGS linestring
       GetDggsLinestringFromWgs84Linestring(
           a_handle,
           a_pConverter,
           a_pWgs84Linestring,
-          &((*a_pDggsShapes)[a_shapeIndex].m_data.m_linestring));
+          a_pArena,
+          &(a_pDggsShape->m_data.m_linestring));
 
       // Cell location only applies to cells, and not linestrings
-      (*a_pDggsShapes)[a_shapeIndex].m_location = DGGS_NO_LOCATION;
+      a_pDggsShape->m_location = DGGS_NO_LOCATION;
     }
 
-    void ConvertWgs84PolygonAndAddToDggsShapes(
+    void ConvertWgs84PolygonToDggsShape(
         const DGGS_Handle a_handle,
         const CoordinateConversion::CoordinateConverter * a_pConverter,
         const LatLong::Wgs84Polygon * a_pWgs84Polygon,
-        const unsigned short a_shapeIndex,
-        DGGS_Shape ** a_pDggsShapes)
+        ShapeArena * a_pArena,
+        DGGS_Shape * a_pDggsShape)
     {
-      // Allocate memory for the shape
-      UpdateDggsShapesMemoryAllocation(a_pDggsShapes, a_shapeIndex);
-
       // Set the shape type
-      (*a_pDggsShapes)[a_shapeIndex].m_type = DGGS_POLYGON;
+      a_pDggsShape->m_type = DGGS_POLYGON;
 
       // Convert outer ring to a DGGS linestring
       GetDggsLinestringFromWgs84Linestring(
           a_handle,
           a_pConverter,
           a_pWgs84Polygon->GetOuterRing(),
-          &((*a_pDggsShapes)[a_shapeIndex].m_data.m_polygon.m_outerRing));
+          a_pArena,
+          &(a_pDggsShape->m_data.m_polygon.m_outerRing));
 
       // Set the number of inner rings in the polygon
       const unsigned short noOfInnerRings = a_pWgs84Polygon->GetNumberOfInnerRings();
-      (*a_pDggsShapes)[a_shapeIndex].m_data.m_polygon.m_noOfInnerRings = noOfInnerRings;
+      a_pDggsShape->m_data.m_polygon.m_noOfInnerRings = noOfInnerRings;
 
       // Allocate memory for the linestrings of the inner rings
-      (*a_pDggsShapes)[a_shapeIndex].m_data.m_polygon.m_innerRings =
-          static_cast<DGGS_Linestring *>(malloc(noOfInnerRings * sizeof(DGGS_Linestring)));
-
-      // Check memory allocation was successful
-      if ((*a_pDggsShapes)[a_shapeIndex].m_data.m_polygon.m_innerRings == NULL)
-      {
-        throw MemoryAllocationException(
-            "Failed to allocate memory for the inner rings of the DGGS polygon");
-      }
+      a_pDggsShape->m_data.m_polygon.m_innerRings = AllocateShapeMemory<DGGS_Linestring>(
+          a_pArena,
+          noOfInnerRings,
+          "Failed to allocate memory for the inner rings of the DGGS polygon");
 
       // Loop through and convert each inner ring of the polygon
       for (unsigned short ringIndex = 0U; ringIndex < noOfInnerRings; ringIndex++)
@@ -169,11 +228,134 @@ namespace EAGGR
             a_handle,
             a_pConverter,
             a_pWgs84Polygon->GetInnerRing(ringIndex),
-            &((*a_pDggsShapes)[a_shapeIndex].m_data.m_polygon.m_innerRings[ringIndex]));
+            a_pArena,
+            &(a_pDggsShape->m_data.m_polygon.m_innerRings[ringIndex]));
       }
 
       // Cell location only applies to cells, and not polygons
-      (*a_pDggsShapes)[a_shapeIndex].m_location = DGGS_NO_LOCATION;
+      a_pDggsShape->m_location = DGGS_NO_LOCATION;
+    }
+
+    ImportExport::AbstractShapeImporter * CreateShapeImporter(
+        const DGGS_ShapeString a_string,
+        const DGGS_ShapeStringFormat a_format,
+        const double a_accuracy)
+    {
+      switch (a_format)
+      {
+        case DGGS_WKT_FORMAT:
+          return new ImportExport::WktImporter(a_string, a_accuracy);
+        case DGGS_GEO_JSON_FORMAT:
+          return new ImportExport::GeoJsonImporter(a_string, a_accuracy);
+        default:
+          return NULL;
+      }
+    }
+
+    void ClearDggsShapes(
+        const DGGS_Handle a_handle,
+        DGGS_Shape ** a_pDggsShapes,
+        unsigned short * a_pNoOfShapes)
+    {
+      // The array is null if nothing was converted or if growing it failed
+      if (*a_pDggsShapes != NULL)
+      {
+        static_cast<void>(EAGGR_DeallocateDggsShapes(a_handle, a_pDggsShapes, *a_pNoOfShapes));
+      }
+
+      *a_pDggsShapes = NULL;
+      *a_pNoOfShapes = 0U;
+    }
+
+    bool ConvertLatLongShapeToDggsShape(
+        const DGGS_Handle a_handle,
+        const DGGS_LatLongShape & a_shape,
+        ShapeArena * a_pArena,
+        DGGS_Shape * a_pDggsShape)
+    {
+      const CoordinateConversion::CoordinateConverter * pConverter =
+          DggsContext::GetContext(a_handle).m_pConverter.get();
+
+      switch (a_shape.m_type)
+      {
+        case DGGS_LAT_LONG_POINT:
+        {
+          const LatLong::Wgs84AccuracyPoint wgs84Point(
+              a_shape.m_data.m_point.m_latitude,
+              a_shape.m_data.m_point.m_longitude,
+              a_shape.m_data.m_point.m_accuracy);
+
+          ConvertWgs84PointToDggsShape(a_handle, pConverter, &wgs84Point, a_pDggsShape);
+          return true;
+        }
+        case DGGS_LAT_LONG_LINESTRING:
+        {
+          LatLong::Wgs84Linestring wgs84Linestring;
+          ConvertLatLongLinestringToWgs84Linestring(a_shape.m_data.m_linestring, wgs84Linestring);
+
+          ConvertWgs84LinestringToDggsShape(
+              a_handle,
+              pConverter,
+              &wgs84Linestring,
+              a_pArena,
+              a_pDggsShape);
+          return true;
+        }
+        case DGGS_LAT_LONG_POLYGON:
+        {
+          LatLong::Wgs84Polygon wgs84Polygon;
+          ConvertLatLongPolygonToWgs84Polygon(a_shape.m_data.m_polygon, wgs84Polygon);
+
+          ConvertWgs84PolygonToDggsShape(
+              a_handle,
+              pConverter,
+              &wgs84Polygon,
+              a_pArena,
+              a_pDggsShape);
+          return true;
+        }
+        default:
+          return false;
+      }
+    }
+
+    bool ConvertImportedShapeToDggsShape(
+        const DGGS_Handle a_handle,
+        LatLong::LatLongShape & a_shape,
+        ShapeArena * a_pArena,
+        DGGS_Shape * a_pDggsShape)
+    {
+      const CoordinateConversion::CoordinateConverter * pConverter =
+          DggsContext::GetContext(a_handle).m_pConverter.get();
+
+      switch (a_shape.GetShapeType())
+      {
+        case LatLong::WGS84_ACCURACY_POINT:
+          ConvertWgs84PointToDggsShape(
+              a_handle,
+              pConverter,
+              static_cast<const LatLong::Wgs84AccuracyPoint *>(a_shape.GetShapeData()),
+              a_pDggsShape);
+          return true;
+        case LatLong::WGS84_LINESTRING:
+          ConvertWgs84LinestringToDggsShape(
+              a_handle,
+              pConverter,
+              static_cast<const LatLong::Wgs84Linestring *>(a_shape.GetShapeData()),
+              a_pArena,
+              a_pDggsShape);
+          return true;
+        case LatLong::WGS84_POLYGON:
+          ConvertWgs84PolygonToDggsShape(
+              a_handle,
+              pConverter,
+              static_cast<const LatLong::Wgs84Polygon *>(a_shape.GetShapeData()),
+              a_pArena,
+              a_pDggsShape);
+          return true;
+        default:
+          return false;
+      }
     }
 
     void CheckCellIdLength(const DGGS_Cell a_cell)
@@ -291,10 +473,33 @@ namespace EAGGR
       }
     }
 
+    template<typename T>
+    static T * AllocateShapeMemory(
+        ShapeArena * a_pArena,
+        const size_t a_count,
+        const char * a_errorMessage)
+    {
+      if (a_pArena != NULL)
+      {
+        return a_pArena->Allocate<T>(a_count);
+      }
+
+      T * pMemory = static_cast<T *>(malloc(a_count * sizeof(T)));
+
+      // Check memory allocation was successful
+      if (pMemory == NULL)
+      {
+        throw MemoryAllocationException(a_errorMessage);
+      }
+
+      return pMemory;
+    }
+
     static void GetDggsLinestringFromWgs84Linestring(
         const DGGS_Handle a_handle,
         const CoordinateConversion::CoordinateConverter * a_pConverter,
         const LatLong::Wgs84Linestring * a_pWgs84Linestring,
+        ShapeArena * a_pArena,
         DGGS_Linestring * a_pDggsLinestring)
     {
       // Set the number of cells in the linestring
@@ -302,14 +507,10 @@ namespace EAGGR
       a_pDggsLinestring->m_noOfCells = noOfCells;
 
       // Allocate memory for the cells in the linestring
-      a_pDggsLinestring->m_cells = static_cast<DGGS_Cell *>(malloc(noOfCells * sizeof(DGGS_Cell)));
-
-      // Check memory allocation was successful
-      if (a_pDggsLinestring->m_cells == NULL)
-      {
-        throw MemoryAllocationException(
-            "Failed to allocate memory for the cells in a DGGS linestring");
-      }
+      a_pDggsLinestring->m_cells = AllocateShapeMemory<DGGS_Cell>(
+          a_pArena,
+          noOfCells,
+          "Failed to allocate memory for the cells in a DGGS linestring");
 
       // Convert and add each cell to the DGGS linestring
       const unsigned short noOfPoints = a_pWgs84Linestring->GetNumberOfPoints();
@@ -335,7 +536,7 @@ namespace EAGGR
 
       // Convert the point to a cell
       std::unique_ptr < Model::Cell::ICell > pCell =
-          static_cast<Model::DGGS *>(a_handle)->ConvertLatLongPointToCell(sphericalPoint);
+          DggsContext::GetContext(a_handle).m_pDggs->ConvertLatLongPointToCell(sphericalPoint);
 
       // Check cell ID does not exceed the maximum length
       const Model::Cell::DggsCellId cellId = pCell->GetCellId();
@@ -374,6 +575,19 @@ namespace EAGGR
       }
     }
 
+    EAGGR::SpatialAnalysis::CoveringType ConvertCoveringType(const DGGS_CoveringType a_coveringType)
+    {
+      switch (a_coveringType)
+      {
+        case DGGS_CoveringType::DGGS_EXTERIOR_COVERING:
+          return EAGGR::SpatialAnalysis::CoveringType::EXTERIOR_COVERING;
+        case DGGS_CoveringType::DGGS_INTERIOR_COVERING:
+          return EAGGR::SpatialAnalysis::CoveringType::INTERIOR_COVERING;
+        default:
+          throw EAGGRException("Unrecognised covering type.");
+      }
+    }
+
     void ConvertLinestringToVector(
         const DGGS_Handle a_handle,
         const DGGS_Linestring a_linestring,
@@ -387,7 +601,7 @@ namespace EAGGR
         CheckCellIdLength(a_linestring.m_cells[cellIndex]);
 
         std::unique_ptr < EAGGR::Model::Cell::ICell > cell =
-            static_cast<Model::DGGS *>(a_handle)->CreateCell(a_linestring.m_cells[cellIndex]);
+            DggsContext::GetContext(a_handle).m_pDggs->CreateCell(a_linestring.m_cells[cellIndex]);
 
         a_pDggsLinestring.push_back(std::move(cell));
       }
@@ -413,5 +627,250 @@ namespace EAGGR
             a_pDggsPolygonInnerRings[ringIndex]);
       }
     }
+
+    void ConvertLatLongPolygonToWgs84Polygon(
+        const DGGS_LatLongPolygon & a_latLongPolygon,
+        LatLong::Wgs84Polygon & a_wgs84Polygon)
+    {
+      for (unsigned short pointIndex = 0U; pointIndex < a_latLongPolygon.m_outerRing.m_noOfPoints;
+          pointIndex++)
+      {
+        const DGGS_LatLongPoint & latLongPoint = a_latLongPolygon.m_outerRing.m_points[pointIndex];
+        a_wgs84Polygon.AddAccuracyPointToOuterRing(
+            latLongPoint.m_latitude,
+            latLongPoint.m_longitude,
+            latLongPoint.m_accuracy);
+      }
+
+      for (unsigned short ringIndex = 0U; ringIndex < a_latLongPolygon.m_noOfInnerRings;
+          ringIndex++)
+      {
+        a_wgs84Polygon.CreateInnerRing();
+
+        for (unsigned short pointIndex = 0U;
+            pointIndex < a_latLongPolygon.m_innerRings[ringIndex].m_noOfPoints; pointIndex++)
+        {
+          const DGGS_LatLongPoint & latLongPoint =
+              a_latLongPolygon.m_innerRings[ringIndex].m_points[pointIndex];
+          a_wgs84Polygon.AddAccuracyPointToInnerRing(
+              ringIndex,
+              latLongPoint.m_latitude,
+              latLongPoint.m_longitude,
+              latLongPoint.m_accuracy);
+        }
+      }
+    }
+
+    void ConvertLatLongLinestringToWgs84Linestring(
+        const DGGS_LatLongLinestring & a_latLongLinestring,
+        LatLong::Wgs84Linestring & a_wgs84Linestring)
+    {
+      for (unsigned short pointIndex = 0U; pointIndex < a_latLongLinestring.m_noOfPoints;
+          pointIndex++)
+      {
+        const DGGS_LatLongPoint & latLongPoint = a_latLongLinestring.m_points[pointIndex];
+        a_wgs84Linestring.AddAccuracyPoint(
+            latLongPoint.m_latitude,
+            latLongPoint.m_longitude,
+            latLongPoint.m_accuracy);
+      }
+    }
+
+    void CopyCellsToArray(
+        const std::vector<std::unique_ptr<Model::Cell::ICell> > & a_cells,
+        DGGS_Cell ** a_pDggsCells,
+        unsigned int * a_pNoOfCells)
+    {
+      *a_pDggsCells = NULL;
+      *a_pNoOfCells = 0U;
+
+      if (a_cells.empty())
+      {
+        return;
+      }
+
+      // Allocate memory for the output array
+      DGGS_Cell * pDggsCells = static_cast<DGGS_Cell *>(malloc(a_cells.size() * sizeof(DGGS_Cell)));
+      if (pDggsCells == NULL)
+      {
+        throw MemoryAllocationException("Failed to allocate memory for the DGGS cell array");
+      }
+
+      try
+      {
+        CopyCellIds(a_cells, pDggsCells);
+      }
+      catch (...)
+      {
+        free(static_cast<void *>(pDggsCells));
+        throw;
+      }
+
+      *a_pDggsCells = pDggsCells;
+      *a_pNoOfCells = static_cast<unsigned int>(a_cells.size());
+    }
+
+    void CopyCellIds(
+        const std::vector<std::unique_ptr<Model::Cell::ICell> > & a_cells,
+        DGGS_Cell * a_pDggsCells)
+    {
+      for (std::size_t cellIndex = 0U; cellIndex < a_cells.size(); ++cellIndex)
+      {
+        const Model::Cell::DggsCellId cellId = a_cells[cellIndex]->GetCellId();
+        CheckCellIdLength(cellId.c_str());
+        static_cast<void>(strncpy(
+            a_pDggsCells[cellIndex],
+            cellId.c_str(),
+            EAGGR_MAX_CELL_STRING_LENGTH));
+      }
+    }
+
+    bool ArePackedCellsValid(
+        const DGGS_Handle a_handle,
+        const DGGS_PackedCell * a_packedCells,
+        const unsigned int a_noOfCells,
+        const char * a_arrayName)
+    {
+      const DggsContext& dggsContext = DggsContext::GetContext(a_handle);
+      const unsigned short maximumFaceIndex = dggsContext.m_pGlobe->GetNoOfFaces() - 1U;
+
+      for (unsigned int index = 0U; index < a_noOfCells; ++index)
+      {
+        try
+        {
+          // Decoding the cell checks the packed cell, without allocating memory
+          if (dggsContext.m_model == DGGS_ISEA4T)
+          {
+            static_cast<void>(Model::Cell::HierarchicalCellValue(a_packedCells[index]));
+          }
+          else
+          {
+            static_cast<void>(Model::Cell::OffsetCell(a_packedCells[index], maximumFaceIndex));
+          }
+        }
+        catch (EAGGRException &)
+        {
+          std::stringstream stream;
+          stream << "Packed cell " << index + 1U << " in '" << a_arrayName << "' is not valid.";
+          DggsContext::SetLastErrorMessage(a_handle, stream.str());
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    bool AreFaceIndicesValid(
+        const DGGS_Handle a_handle,
+        const DGGS_FaceCoordinate * a_faceCoordinates,
+        const unsigned int a_noOfFaceCoordinates)
+    {
+      const Model::FaceIndex noOfFaces = DggsContext::GetContext(a_handle).m_pGlobe->GetNoOfFaces();
+      for (unsigned int index = 0U; index < a_noOfFaceCoordinates; ++index)
+      {
+        if (a_faceCoordinates[index].m_faceIndex >= noOfFaces)
+        {
+          std::stringstream stream;
+          stream << "Face index of face coordinate " << index + 1U << " is not valid.";
+          DggsContext::SetLastErrorMessage(a_handle, stream.str());
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    bool IsResolutionValid(const DGGS_Handle a_handle, const unsigned short a_resolution)
+    {
+      if (a_resolution > Model::Cell::ICell::m_MAX_RESOLUTION_LEVEL)
+      {
+        std::stringstream stream;
+        stream << "Resolution " << a_resolution << " is greater than the upper limit ("
+            << Model::Cell::ICell::m_MAX_RESOLUTION_LEVEL << ").";
+        DggsContext::SetLastErrorMessage(a_handle, stream.str());
+        return false;
+      }
+
+      return true;
+    }
+
+    void CopyPackedCellsToArray(
+        const std::vector<Model::Cell::DggsPackedCellId> & a_cells,
+        DGGS_PackedCell ** a_pPackedCells,
+        unsigned int * a_pNoOfCells)
+    {
+      *a_pPackedCells = NULL;
+      *a_pNoOfCells = 0U;
+
+      if (a_cells.size() > std::numeric_limits<unsigned int>::max())
+      {
+        throw EAGGRException("Too many cells to return in one array.");
+      }
+
+      if (a_cells.empty())
+      {
+        return;
+      }
+
+      // Allocate memory for the output array
+      DGGS_PackedCell * pPackedCells = static_cast<DGGS_PackedCell *>(malloc(
+          a_cells.size() * sizeof(DGGS_PackedCell)));
+      if (pPackedCells == NULL)
+      {
+        throw MemoryAllocationException("Failed to allocate memory for the packed cell array");
+      }
+
+      std::copy(a_cells.begin(), a_cells.end(), pPackedCells);
+      *a_pPackedCells = pPackedCells;
+      *a_pNoOfCells = static_cast<unsigned int>(a_cells.size());
+    }
+
+    void CopyShapePairsToArray(
+        const std::vector<SpatialAnalysis::SpatialJoin::ShapePair> & a_pairs,
+        DGGS_ShapePair ** a_pShapePairs,
+        unsigned int * a_pNoOfShapePairs)
+    {
+      *a_pShapePairs = NULL;
+      *a_pNoOfShapePairs = 0U;
+
+      if (a_pairs.size() > std::numeric_limits<unsigned int>::max())
+      {
+        throw EAGGRException("Too many shape pairs to return in one array.");
+      }
+
+      if (a_pairs.empty())
+      {
+        return;
+      }
+
+      // Allocate memory for the output array
+      DGGS_ShapePair * pShapePairs = static_cast<DGGS_ShapePair *>(malloc(
+          a_pairs.size() * sizeof(DGGS_ShapePair)));
+      if (pShapePairs == NULL)
+      {
+        throw MemoryAllocationException("Failed to allocate memory for the shape pair array");
+      }
+
+      // The indices fit as the number of shapes in each array is an unsigned int
+      for (std::size_t pairIndex = 0U; pairIndex < a_pairs.size(); ++pairIndex)
+      {
+        pShapePairs[pairIndex].m_baseShapeIndex =
+            static_cast<unsigned int>(a_pairs[pairIndex].first);
+        pShapePairs[pairIndex].m_comparisonShapeIndex =
+            static_cast<unsigned int>(a_pairs[pairIndex].second);
+      }
+
+      *a_pShapePairs = pShapePairs;
+      *a_pNoOfShapePairs = static_cast<unsigned int>(a_pairs.size());
+    }
+
+    void CopyRelationMatrix(
+        const SpatialAnalysis::RelationMatrix & a_relationMatrix,
+        DGGS_RelationMatrix a_dggsRelationMatrix)
+    {
+      const std::string & matrix = a_relationMatrix.GetMatrix();
+      std::copy(matrix.begin(), matrix.end(), a_dggsRelationMatrix);
+      a_dggsRelationMatrix[matrix.size()] = TERMINATING_CHAR;
+    }
   }
 }
@@ -32,11 +32,17 @@
 #include <memory>
 
 #include "API/eaggr_api.h"
+#include "API/shape_arena.hpp"
 #include "Src/CoordinateConversion/CoordinateConverter.hpp"
+#include "Src/ImportExport/AbstractShapeImporter.hpp"
+#include "Src/LatLong/LatLongShape.hpp"
 #include "Src/LatLong/Wgs84Linestring.hpp"
 #include "Src/LatLong/Wgs84Polygon.hpp"
 #include "Src/Model/ICell.hpp"
+#include "Src/SpatialAnalysis/RegionCoverer.hpp"
+#include "Src/SpatialAnalysis/RelationMatrix.hpp"
 #include "Src/SpatialAnalysis/SpatialAnalysis.hpp"
+#include "Src/SpatialAnalysis/SpatialJoin.hpp"
 
 namespace EAGGR
 {
@@ -87,6 +93,90 @@ namespace EAGGR
         const unsigned short a_shapeIndex,
         DGGS_Shape ** a_pDggsShapes);
 
+    /// Converts a lat/long point to a DGGS cell.
+    /// @param a_handle Handle for the DGGS model.
+    /// @param a_pConverter Converter for changing WGS84 coordinates to spherical.
+    /// @param a_pWgs84Point WGS84 latitude and longitude point with an associated accuracy.
+    /// @param a_pDggsShape Shape to store the cell in.
+    void ConvertWgs84PointToDggsShape(
+        const DGGS_Handle a_handle,
+        const CoordinateConversion::CoordinateConverter * a_pConverter,
+        const LatLong::Wgs84AccuracyPoint * a_pWgs84Point,
+        DGGS_Shape * a_pDggsShape);
+
+    /// Converts a lat/long linestring to a linestring of DGGS cells.
+    /// @param a_handle Handle for the DGGS model.
+    /// @param a_pConverter Converter for changing WGS84 coordinates to spherical.
+    /// @param a_pWgs84Linestring Linestring of WGS84 latitude and longitude points.
+    /// @param a_pArena Arena to allocate the cells from, or null to allocate them using malloc().
+    /// @param a_pDggsShape Shape to store the linestring in.
+    void ConvertWgs84LinestringToDggsShape(
+        const DGGS_Handle a_handle,
+        const CoordinateConversion::CoordinateConverter * a_pConverter,
+        const LatLong::Wgs84Linestring * a_pWgs84Linestring,
+        ShapeArena * a_pArena,
+        DGGS_Shape * a_pDggsShape);
+
+    /// Converts a lat/long polygon to a polygon of DGGS cells.
+    /// @param a_handle Handle for the DGGS model.
+    /// @param a_pConverter Converter for changing WGS84 coordinates to spherical.
+    /// @param a_pWgs84Polygon Polygon made up of WGS84 linestrings.
+    /// @param a_pArena Arena to allocate the cells and inner rings from, or null to allocate them
+    /// using malloc().
+    /// @param a_pDggsShape Shape to store the polygon in.
+    void ConvertWgs84PolygonToDggsShape(
+        const DGGS_Handle a_handle,
+        const CoordinateConversion::CoordinateConverter * a_pConverter,
+        const LatLong::Wgs84Polygon * a_pWgs84Polygon,
+        ShapeArena * a_pArena,
+        DGGS_Shape * a_pDggsShape);
+
+    /// @param a_string String containing shape information.
+    /// @param a_format Format used for the string.
+    /// @param a_accuracy Accuracy to use for every point in the string in metres squared.
+    /// @return A new importer for the string, or null if the format is not supported.
+    /// @throws EAGGRException If the string is not valid.
+    ImportExport::AbstractShapeImporter * CreateShapeImporter(
+        const DGGS_ShapeString a_string,
+        const DGGS_ShapeStringFormat a_format,
+        const double a_accuracy);
+
+    /// Frees the shapes converted before a shape string failed to convert, and clears the outputs
+    /// so that the caller is not left with a partial array.
+    /// @param a_handle Handle for the DGGS model.
+    /// @param a_pDggsShapes Array of the shapes converted so far, set to null on return.
+    /// @param a_pNoOfShapes Number of shapes converted so far, set to zero on return.
+    void ClearDggsShapes(
+        const DGGS_Handle a_handle,
+        DGGS_Shape ** a_pDggsShapes,
+        unsigned short * a_pNoOfShapes);
+
+    /// Converts a shape in lat/long coordinates to a DGGS shape.
+    /// @param a_handle Handle for the DGGS model.
+    /// @param a_shape Shape defined by lat / long coordinates.
+    /// @param a_pArena Arena to allocate the cells and rings from, or null to allocate them using
+    /// malloc().
+    /// @param a_pDggsShape Shape to store the result in.
+    /// @return False if the type of the shape is not supported, otherwise true.
+    bool ConvertLatLongShapeToDggsShape(
+        const DGGS_Handle a_handle,
+        const DGGS_LatLongShape & a_shape,
+        ShapeArena * a_pArena,
+        DGGS_Shape * a_pDggsShape);
+
+    /// Converts a shape read by a shape importer to a DGGS shape.
+    /// @param a_handle Handle for the DGGS model.
+    /// @param a_shape Shape defined by WGS84 coordinates.
+    /// @param a_pArena Arena to allocate the cells and rings from, or null to allocate them using
+    /// malloc().
+    /// @param a_pDggsShape Shape to store the result in.
+    /// @return False if the type of the shape is not supported, otherwise true.
+    bool ConvertImportedShapeToDggsShape(
+        const DGGS_Handle a_handle,
+        LatLong::LatLongShape & a_shape,
+        ShapeArena * a_pArena,
+        DGGS_Shape * a_pDggsShape);
+
     /// Check cell ID does not exceed the maximum length.
     /// @param a_cell DGGS cell ID string.
     void CheckCellIdLength(const DGGS_Cell a_cell);
@@ -130,6 +220,13 @@ namespace EAGGR
     EAGGR::SpatialAnalysis::AnalysisType ConvertAnalysisType(
         const DGGS_AnalysisType a_analysisType);
 
+    /// Converts from a DGGS_CoveringType to EAGGR::SpatialAnalysis::CoveringType enumerations
+    /// @param a_coveringType The covering type to convert
+    /// @return The corresponding covering type in the C++ domain
+    /// @throws EAGGRException if the supplied covering type is not valid
+    EAGGR::SpatialAnalysis::CoveringType ConvertCoveringType(
+        const DGGS_CoveringType a_coveringType);
+
     /// Converts a DGGS_Linestring to a vector
     /// @param a_handle Handle for the DGGS model.
     /// @param a_linestring The DGGS linestring to convert.
@@ -150,5 +247,99 @@ namespace EAGGR
         const DGGS_Polygon a_polygon,
         std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_pDggsPolygonOuterRing,
         std::vector<std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > > & a_pDggsPolygonInnerRings);
+
+    /// Converts a DGGS_LatLongPolygon into a Wgs84Polygon
+    /// @param a_latLongPolygon The lat / long polygon to convert.
+    /// @param a_wgs84Polygon The polygon to add the rings to. Must not have any points or inner rings.
+    void ConvertLatLongPolygonToWgs84Polygon(
+        const DGGS_LatLongPolygon & a_latLongPolygon,
+        LatLong::Wgs84Polygon & a_wgs84Polygon);
+
+    /// Converts a DGGS_LatLongLinestring into a Wgs84Linestring
+    /// @param a_latLongLinestring The lat / long linestring to convert.
+    /// @param a_wgs84Linestring The linestring to add the points to. Must not have any points.
+    void ConvertLatLongLinestringToWgs84Linestring(
+        const DGGS_LatLongLinestring & a_latLongLinestring,
+        LatLong::Wgs84Linestring & a_wgs84Linestring);
+
+    /// Copies the IDs of cells into an array allocated for the API output
+    /// @param a_cells The cells to copy.
+    /// @param a_pDggsCells Set to the allocated array, or NULL if there are no cells.
+    /// @param a_pNoOfCells Set to the number of cells in the array.
+    /// @throws MemoryAllocationException if the array cannot be allocated.
+    /// @throws MaxCellIdLengthException if a cell ID is too long for a DGGS_Cell. No array is
+    /// output in this case.
+    void CopyCellsToArray(
+        const std::vector<std::unique_ptr<Model::Cell::ICell> > & a_cells,
+        DGGS_Cell ** a_pDggsCells,
+        unsigned int * a_pNoOfCells);
+
+    /// Copies the IDs of cells into an array supplied to the API
+    /// @param a_cells The cells to copy.
+    /// @param a_pDggsCells The array to copy the IDs to, with an element for each cell.
+    /// @throws MaxCellIdLengthException if a cell ID is too long for a DGGS_Cell.
+    void CopyCellIds(
+        const std::vector<std::unique_ptr<Model::Cell::ICell> > & a_cells,
+        DGGS_Cell * a_pDggsCells);
+
+    /// Checks that the packed cells can be decoded for the DGGS model of the handle
+    /// @param a_handle Handle for the DGGS model, whose last error message is set if a packed cell
+    /// is not valid.
+    /// @param a_packedCells The packed cells to check.
+    /// @param a_noOfCells The number of packed cells in the array.
+    /// @param a_arrayName Name of the array argument, for the error message.
+    /// @return True if every packed cell is valid, otherwise false.
+    bool ArePackedCellsValid(
+        const DGGS_Handle a_handle,
+        const DGGS_PackedCell * a_packedCells,
+        const unsigned int a_noOfCells,
+        const char * a_arrayName);
+
+    /// Checks that the face coordinates are on faces of the polyhedral globe
+    /// @param a_handle Handle for the DGGS model, whose last error message is set if a face index
+    /// is not valid.
+    /// @param a_faceCoordinates The face coordinates to check.
+    /// @param a_noOfFaceCoordinates The number of face coordinates in the array.
+    /// @return True if every face index is valid, otherwise false.
+    bool AreFaceIndicesValid(
+        const DGGS_Handle a_handle,
+        const DGGS_FaceCoordinate * a_faceCoordinates,
+        const unsigned int a_noOfFaceCoordinates);
+
+    /// Checks that a resolution does not exceed the upper limit for a cell
+    /// @param a_handle Handle for the DGGS model, whose last error message is set if the
+    /// resolution is not valid.
+    /// @param a_resolution The resolution to check.
+    /// @return True if the resolution is valid, otherwise false.
+    bool IsResolutionValid(const DGGS_Handle a_handle, const unsigned short a_resolution);
+
+    /// Copies packed cell IDs into an array allocated for the API output
+    /// @param a_cells The packed cell IDs to copy.
+    /// @param a_pPackedCells Set to the allocated array, or NULL if there are no cells.
+    /// @param a_pNoOfCells Set to the number of cells in the array.
+    /// @throws MemoryAllocationException if the array cannot be allocated.
+    /// @throws EAGGRException if there are too many cells to return in one array.
+    void CopyPackedCellsToArray(
+        const std::vector<Model::Cell::DggsPackedCellId> & a_cells,
+        DGGS_PackedCell ** a_pPackedCells,
+        unsigned int * a_pNoOfCells);
+
+    /// Copies pairs of shape indices into an array allocated for the API output
+    /// @param a_pairs The pairs of shape indices to copy.
+    /// @param a_pShapePairs Set to the allocated array, or NULL if there are no pairs.
+    /// @param a_pNoOfShapePairs Set to the number of pairs in the array.
+    /// @throws MemoryAllocationException if the array cannot be allocated.
+    /// @throws EAGGRException if there are too many pairs to return in one array.
+    void CopyShapePairsToArray(
+        const std::vector<SpatialAnalysis::SpatialJoin::ShapePair> & a_pairs,
+        DGGS_ShapePair ** a_pShapePairs,
+        unsigned int * a_pNoOfShapePairs);
+
+    /// Copies a relation matrix into the string used by the API
+    /// @param a_relationMatrix The relation matrix to copy.
+    /// @param a_dggsRelationMatrix Set to the entries of the matrix followed by a null terminator.
+    void CopyRelationMatrix(
+        const SpatialAnalysis::RelationMatrix & a_relationMatrix,
+        DGGS_RelationMatrix a_dggsRelationMatrix);
   }
 }
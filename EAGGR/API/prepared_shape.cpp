@@ -0,0 +1,213 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: C API
+//
+//------------------------------------------------------
+/// @file prepared_shape.cpp
+/// 
+/// Implements the EAGGR::API::PreparedShape class
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <vector>
+
+#include "prepared_shape.hpp"
+
+#include "API/eaggr_api_funcs.hpp"
+#include "Src/SpatialAnalysis/CellTopology.hpp"
+#include "Src/EAGGRException.hpp"
+
+namespace EAGGR
+{
+  namespace API
+  {
+    PreparedShape::PreparedShape(const DGGS_Handle a_handle, const DGGS_Shape & a_shape)
+        :
+            m_context(DggsContext::GetContext(a_handle))
+    {
+      switch (a_shape.m_type)
+      {
+        case DGGS_CELL:
+        {
+          //Check cell ID length does not exceed the maximum length
+          CheckCellIdLength(a_shape.m_data.m_cell);
+
+          // Keep a copy of the cell so that pairs of cells can be compared using the grid
+          m_pCell = m_context.m_pDggs->CreateCell(a_shape.m_data.m_cell);
+
+          m_pAnalysis = std::unique_ptr<SpatialAnalysis::SpatialAnalysis>(
+              new SpatialAnalysis::SpatialAnalysis(
+                  m_context.m_pDggs->CreateCell(a_shape.m_data.m_cell),
+                  m_context.m_pIndexer.get(),
+                  m_context.m_pProjection.get()));
+          break;
+        }
+
+        case DGGS_LINESTRING:
+        {
+          std::vector<std::unique_ptr<Model::Cell::ICell> > linestring;
+
+          ConvertLinestringToVector(a_handle, a_shape.m_data.m_linestring, linestring);
+
+          m_pAnalysis = std::unique_ptr<SpatialAnalysis::SpatialAnalysis>(
+              new SpatialAnalysis::SpatialAnalysis(
+                  linestring,
+                  m_context.m_pIndexer.get(),
+                  m_context.m_pProjection.get()));
+          break;
+        }
+
+        case DGGS_POLYGON:
+        {
+          std::vector<std::unique_ptr<Model::Cell::ICell> > outerRing;
+          std::vector<std::vector<std::unique_ptr<Model::Cell::ICell> > > innerRings;
+
+          ConvertPolygonToVectors(a_handle, a_shape.m_data.m_polygon, outerRing, innerRings);
+
+          m_pAnalysis = std::unique_ptr<SpatialAnalysis::SpatialAnalysis>(
+              new SpatialAnalysis::SpatialAnalysis(
+                  outerRing,
+                  innerRings,
+                  m_context.m_pIndexer.get(),
+                  m_context.m_pProjection.get()));
+          break;
+        }
+
+        default:
+          throw EAGGRException("Unsupported base shape type.");
+      }
+    }
+
+    const DggsContext& PreparedShape::GetContext() const
+    {
+      return (m_context);
+    }
+
+    const SpatialAnalysis::SpatialAnalysis& PreparedShape::GetAnalysis() const
+    {
+      return (*m_pAnalysis);
+    }
+
+    bool PreparedShape::Compare(
+        const DGGS_Handle a_handle,
+        const DGGS_Shape & a_comparisonShape,
+        const SpatialAnalysis::AnalysisType a_analysisType) const
+    {
+      switch (a_comparisonShape.m_type)
+      {
+        case DGGS_CELL:
+        {
+          //Check cell ID length does not exceed the maximum length
+          CheckCellIdLength(a_comparisonShape.m_data.m_cell);
+
+          std::unique_ptr<Model::Cell::ICell> comparisonCell =
+              m_context.m_pDggs->CreateCell(a_comparisonShape.m_data.m_cell);
+
+          // Compare pairs of cells using the grid structure where possible, which avoids
+          // creating the cell outlines
+          if (m_pCell)
+          {
+            const SpatialAnalysis::CellTopology cellTopology(
+                m_context.m_pIndexer.get(),
+                m_context.m_pNeighbourhood.get());
+
+            bool result = false;
+            if (cellTopology.Analyse(*m_pCell, *comparisonCell, a_analysisType, result))
+            {
+              return (result);
+            }
+          }
+
+          return (m_pAnalysis->Analyse(std::move(comparisonCell), a_analysisType));
+        }
+
+        case DGGS_LINESTRING:
+        {
+          std::vector<std::unique_ptr<Model::Cell::ICell> > linestring;
+
+          ConvertLinestringToVector(a_handle, a_comparisonShape.m_data.m_linestring, linestring);
+
+          return (m_pAnalysis->Analyse(linestring, a_analysisType));
+        }
+
+        case DGGS_POLYGON:
+        {
+          std::vector<std::unique_ptr<Model::Cell::ICell> > outerRing;
+          std::vector<std::vector<std::unique_ptr<Model::Cell::ICell> > > innerRings;
+
+          ConvertPolygonToVectors(
+              a_handle,
+              a_comparisonShape.m_data.m_polygon,
+              outerRing,
+              innerRings);
+
+          return (m_pAnalysis->Analyse(outerRing, innerRings, a_analysisType));
+        }
+
+        default:
+          throw EAGGRException("Unsupported comparison shape type.");
+      }
+    }
+
+    SpatialAnalysis::RelationMatrix PreparedShape::Relate(
+        const DGGS_Handle a_handle,
+        const DGGS_Shape & a_comparisonShape) const
+    {
+      switch (a_comparisonShape.m_type)
+      {
+        case DGGS_CELL:
+        {
+          //Check cell ID length does not exceed the maximum length
+          CheckCellIdLength(a_comparisonShape.m_data.m_cell);
+
+          return (m_pAnalysis->Relate(
+              m_context.m_pDggs->CreateCell(a_comparisonShape.m_data.m_cell)));
+        }
+
+        case DGGS_LINESTRING:
+        {
+          std::vector<std::unique_ptr<Model::Cell::ICell> > linestring;
+
+          ConvertLinestringToVector(a_handle, a_comparisonShape.m_data.m_linestring, linestring);
+
+          return (m_pAnalysis->Relate(linestring));
+        }
+
+        case DGGS_POLYGON:
+        {
+          std::vector<std::unique_ptr<Model::Cell::ICell> > outerRing;
+          std::vector<std::vector<std::unique_ptr<Model::Cell::ICell> > > innerRings;
+
+          ConvertPolygonToVectors(
+              a_handle,
+              a_comparisonShape.m_data.m_polygon,
+              outerRing,
+              innerRings);
+
+          return (m_pAnalysis->Relate(outerRing, innerRings));
+        }
+
+        default:
+          throw EAGGRException("Unsupported comparison shape type.");
+      }
+    }
+  }
+}
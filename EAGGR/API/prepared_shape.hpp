@@ -0,0 +1,100 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: C API
+//
+//------------------------------------------------------
+/// @file prepared_shape.hpp
+/// 
+/// Defines the EAGGR::API::PreparedShape class, the object each prepared shape handle refers to
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "eaggr_api.h"
+
+#include "API/dggs_context.hpp"
+#include "Src/Model/ICell.hpp"
+#include "Src/SpatialAnalysis/RelationMatrix.hpp"
+#include "Src/SpatialAnalysis/SpatialAnalysis.hpp"
+
+namespace EAGGR
+{
+  namespace API
+  {
+    /// A base shape prepared for comparison with other shapes.
+    ///
+    /// The shape's geometry is created by SpatialAnalysis when it is first needed and is kept
+    /// for later comparisons. Pairs of cells are compared using the grid structure where possible
+    /// (see SpatialAnalysis::CellTopology). The prepared shape is not modified by comparisons
+    /// other than to create its geometry, which is done once even if several threads need it.
+    class PreparedShape
+    {
+      public:
+        /// Constructor
+        /// @param a_handle Handle to the DGGS model.
+        /// @param a_shape The base shape.
+        /// @throws EAGGRException If the shape type is not supported or the shape is invalid.
+        /// @throws MaxCellIdLengthException If a cell id is too long.
+        PreparedShape(const DGGS_Handle a_handle, const DGGS_Shape & a_shape);
+
+        /// @return The context of the DGGS model the shape was prepared with.
+        const DggsContext& GetContext() const;
+
+        /// @return The analysis of the base shape.
+        const SpatialAnalysis::SpatialAnalysis& GetAnalysis() const;
+
+        /// @param a_handle Handle to the DGGS model the shape was prepared with.
+        /// @param a_comparisonShape The shape to compare with the base shape.
+        /// @param a_analysisType The type of comparison.
+        /// @return The result of the comparison.
+        /// @throws EAGGRException If the shape type is not supported or the shape is invalid.
+        /// @throws MaxCellIdLengthException If a cell id is too long.
+        bool Compare(
+            const DGGS_Handle a_handle,
+            const DGGS_Shape & a_comparisonShape,
+            const SpatialAnalysis::AnalysisType a_analysisType) const;
+
+        /// @param a_handle Handle to the DGGS model the shape was prepared with.
+        /// @param a_comparisonShape The shape to compare with the base shape.
+        /// @return The DE-9IM matrix of the base shape and the comparison shape.
+        /// @throws EAGGRException If the shape type is not supported or the shape is invalid.
+        /// @throws MaxCellIdLengthException If a cell id is too long.
+        SpatialAnalysis::RelationMatrix Relate(
+            const DGGS_Handle a_handle,
+            const DGGS_Shape & a_comparisonShape) const;
+
+      private:
+        // Prevent copying as the prepared shape owns its geometry
+        PreparedShape(const PreparedShape&);
+        PreparedShape& operator=(const PreparedShape&);
+
+        const DggsContext& m_context;
+
+        /// The base cell if the base shape is a cell, otherwise null.
+        std::unique_ptr<Model::Cell::ICell> m_pCell;
+
+        std::unique_ptr<SpatialAnalysis::SpatialAnalysis> m_pAnalysis;
+    };
+  }
+}
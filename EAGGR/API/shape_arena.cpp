@@ -0,0 +1,106 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: C API
+//
+//------------------------------------------------------
+/// @file shape_arena.cpp
+/// 
+/// Implements the EAGGR::API::ShapeArena class
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <algorithm>
+#include <new>
+
+#include "shape_arena.hpp"
+
+#include "API/eaggr_api_exceptions.hpp"
+
+namespace EAGGR
+{
+  namespace API
+  {
+    const size_t ShapeArena::m_DEFAULT_BLOCK_SIZE = 64U * 1024U;
+
+    ShapeArena::ShapeArena(const size_t a_blockSize)
+        :
+            m_used(0U)
+    {
+      AddBlock(a_blockSize == 0U ? m_DEFAULT_BLOCK_SIZE : a_blockSize);
+    }
+
+    void ShapeArena::Reset()
+    {
+      // Merge the blocks so that the same shapes fit in one block next time
+      if (m_blocks.size() > 1U)
+      {
+        const size_t capacity = GetCapacity();
+        m_blocks.clear();
+        m_blockSizes.clear();
+        AddBlock(capacity);
+      }
+
+      m_used = 0U;
+    }
+
+    size_t ShapeArena::GetCapacity() const
+    {
+      size_t capacity = 0U;
+      for (size_t blockIndex = 0U; blockIndex < m_blockSizes.size(); ++blockIndex)
+      {
+        capacity += m_blockSizes[blockIndex];
+      }
+
+      return capacity;
+    }
+
+    void* ShapeArena::AllocateBytes(const size_t a_size, const size_t a_alignment)
+    {
+      // The blocks are aligned for any type, so only the offset into the block needs aligning
+      size_t offset = (m_used + a_alignment - 1U) / a_alignment * a_alignment;
+
+      if (m_blocks.empty() || offset + a_size > m_blockSizes.back())
+      {
+        // Grow the arena geometrically so that the number of blocks stays small
+        AddBlock(std::max(GetCapacity(), a_size));
+        offset = 0U;
+      }
+
+      m_used = offset + a_size;
+
+      return m_blocks.back().get() + offset;
+    }
+
+    void ShapeArena::AddBlock(const size_t a_size)
+    {
+      std::unique_ptr<char[]> pBlock(new (std::nothrow) char[a_size]);
+
+      if (!pBlock)
+      {
+        throw MemoryAllocationException("Failed to allocate memory for the shape arena");
+      }
+
+      m_blocks.push_back(std::move(pBlock));
+      m_blockSizes.push_back(a_size);
+      m_used = 0U;
+    }
+  }
+}
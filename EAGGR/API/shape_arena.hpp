@@ -0,0 +1,97 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: C API
+//
+//------------------------------------------------------
+/// @file shape_arena.hpp
+/// 
+/// Defines the EAGGR::API::ShapeArena class, the object each shape arena handle refers to
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace EAGGR
+{
+  namespace API
+  {
+    /// Memory for DGGS shapes that are all released at once.
+    ///
+    /// Memory is handed out from large blocks, so converting shapes into the arena does not
+    /// allocate memory for each shape, linestring or ring. The blocks are kept when the arena is
+    /// reset and are merged into a single block, so filling the arena again with the same shapes
+    /// does not allocate memory. The arena is not thread safe.
+    class ShapeArena
+    {
+      public:
+        /// Constructor
+        /// @param a_blockSize The size of the first block of memory in bytes (zero uses a default
+        /// size).
+        explicit ShapeArena(const size_t a_blockSize);
+
+        /// @param a_count The number of objects to allocate memory for.
+        /// @return Memory for the objects, which is valid until the arena is reset or destroyed.
+        /// The objects are not constructed.
+        /// @throws MemoryAllocationException If the memory could not be allocated.
+        template<typename T>
+        T* Allocate(const size_t a_count)
+        {
+          return static_cast<T*>(AllocateBytes(a_count * sizeof(T), alignof(T)));
+        }
+
+        /// Releases all of the memory handed out by the arena so that it can be used again.
+        /// @throws MemoryAllocationException If the merged block could not be allocated.
+        void Reset();
+
+        /// @return The total size of the blocks of memory held by the arena in bytes.
+        size_t GetCapacity() const;
+
+      private:
+        // Prevent copying as the arena owns its memory
+        ShapeArena(const ShapeArena&);
+        ShapeArena& operator=(const ShapeArena&);
+
+        /// @param a_size The number of bytes to allocate.
+        /// @param a_alignment The alignment required for the memory.
+        /// @return Memory of the requested size and alignment.
+        /// @throws MemoryAllocationException If the memory could not be allocated.
+        void* AllocateBytes(const size_t a_size, const size_t a_alignment);
+
+        /// Adds a new block of memory to the arena, which becomes the block memory is handed out
+        /// from.
+        /// @param a_size The size of the block in bytes.
+        /// @throws MemoryAllocationException If the memory could not be allocated.
+        void AddBlock(const size_t a_size);
+
+        static const size_t m_DEFAULT_BLOCK_SIZE;
+
+        std::vector<std::unique_ptr<char[]> > m_blocks;
+        std::vector<size_t> m_blockSizes;
+
+        /// The number of bytes handed out from the last block.
+        size_t m_used;
+    };
+  }
+}
@@ -27,6 +27,7 @@
 /// or can be found at <http://www.gnu.org/licenses/>.
 //------------------------------------------------------
 
+#include <cmath>
 #include <sstream>
 
 #include "CoordinateConverter.hpp"
@@ -39,19 +40,34 @@ namespace EAGGR
   namespace CoordinateConversion
   {
     CoordinateConverter::CoordinateConverter()
+        :
+            m_method(CLOSED_FORM),
+            m_eccentricitySquared(
+                (2.0 - 1.0 / m_WGS84_INVERSE_FLATTENING) / m_WGS84_INVERSE_FLATTENING),
+            m_wgs84CoordinateSystem(NULL),
+            m_sphereCoordinateSystem(NULL)
     {
-      m_wgs84CoordinateSystem = pj_init_plus("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs");
-
-      if (m_wgs84CoordinateSystem == NULL)
-      {
-        throw EAGGRException("Failed to create WGS84 coordinate system.");
-      }
-
-      m_sphereCoordinateSystem = pj_init_plus("+proj=longlat +ellps=sphere +datum=WGS84 +no_defs");
+    }
 
-      if (m_sphereCoordinateSystem == NULL)
+    CoordinateConverter::CoordinateConverter(const ConversionMethod a_method)
+        :
+            m_method(a_method),
+            m_eccentricitySquared(
+                (2.0 - 1.0 / m_WGS84_INVERSE_FLATTENING) / m_WGS84_INVERSE_FLATTENING),
+            m_wgs84CoordinateSystem(NULL),
+            m_sphereCoordinateSystem(NULL)
+    {
+      switch (m_method)
       {
-        throw EAGGRException("Failed to create spherical coordinate system.");
+        case CLOSED_FORM:
+          break;
+        case PROJ4:
+          InitialiseProj4();
+          break;
+        default:
+          std::stringstream stream;
+          stream << "Invalid coordinate conversion method " << a_method;
+          throw EAGGRException(stream.str());
       }
     }
 
@@ -71,93 +87,227 @@ namespace EAGGR
     EAGGR::LatLong::SphericalAccuracyPoint CoordinateConverter::ConvertWGS84ToSphere(
         const EAGGR::LatLong::Wgs84AccuracyPoint a_wgs84Point) const
     {
-      EAGGR::Utilities::Maths::Radians latitudeRadians = a_wgs84Point.GetLatitudeInRadians();
-      EAGGR::Utilities::Maths::Radians longitudeRadians = a_wgs84Point.GetLongitudeInRadians();
+      EAGGR::Utilities::Maths::Radians convertedLatitude;
+      EAGGR::Utilities::Maths::Radians convertedLongitude;
+
+      ConvertWGS84ToSphere(
+          a_wgs84Point.GetLatitudeInRadians(),
+          a_wgs84Point.GetLongitudeInRadians(),
+          convertedLatitude,
+          convertedLongitude);
 
-      EAGGR::Utilities::Maths::Radians convertedLatitude = latitudeRadians;
-      EAGGR::Utilities::Maths::Radians convertedLongitude = longitudeRadians;
+      return EAGGR::LatLong::SphericalAccuracyPoint(
+          RADIANS_IN_DEG(convertedLatitude),
+          RADIANS_IN_DEG(convertedLongitude),
+          EAGGR::LatLong::SphericalAccuracyPoint::SquareMetresToAngleAccuracy(
+              a_wgs84Point.GetAccuracy()));
+    }
+
+    EAGGR::LatLong::Wgs84AccuracyPoint CoordinateConverter::ConvertSphereToWGS84(
+        const EAGGR::LatLong::SphericalAccuracyPoint a_spherePoint) const
+    {
+      EAGGR::Utilities::Maths::Radians convertedLatitude;
+      EAGGR::Utilities::Maths::Radians convertedLongitude;
 
-      // Initially assume a height of zero and perform the conversion
-      double z = 0.0;
+      ConvertSphereToWGS84(
+          a_spherePoint.GetLatitudeInRadians(),
+          a_spherePoint.GetLongitudeInRadians(),
+          convertedLatitude,
+          convertedLongitude);
 
-      int returnCode = pj_transform(
-          m_wgs84CoordinateSystem,
-          m_sphereCoordinateSystem,
-          m_NUM_POINTS_TO_CONVERT,
-          m_POINT_OFFSET,
-          &convertedLongitude,
-          &convertedLatitude,
-          &z);
+      return EAGGR::LatLong::Wgs84AccuracyPoint(
+          RADIANS_IN_DEG(convertedLatitude),
+          RADIANS_IN_DEG(convertedLongitude),
+          EAGGR::LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(
+              a_spherePoint.GetAccuracy()));
+    }
 
-      if (returnCode != 0)
+    void CoordinateConverter::ConvertWGS84ToSphere(
+        const Utilities::Maths::Degrees* a_pLatitudes,
+        const Utilities::Maths::Degrees* a_pLongitudes,
+        const std::size_t a_noOfPoints,
+        Utilities::Maths::Degrees* a_pSphereLatitudes,
+        Utilities::Maths::Degrees* a_pSphereLongitudes) const
+    {
+      for (std::size_t pointIndex = 0U; pointIndex < a_noOfPoints; ++pointIndex)
       {
-        char* error = pj_strerrno(returnCode);
-        std::stringstream stream;
-        stream << "Coordinate transformation error: " << error;
-        throw EAGGRException(stream.str());
+        EAGGR::Utilities::Maths::Radians convertedLatitude;
+        EAGGR::Utilities::Maths::Radians convertedLongitude;
+
+        ConvertWGS84ToSphere(
+            DEGREES_IN_RAD(a_pLatitudes[pointIndex]),
+            DEGREES_IN_RAD(a_pLongitudes[pointIndex]),
+            convertedLatitude,
+            convertedLongitude);
+
+        a_pSphereLatitudes[pointIndex] = RADIANS_IN_DEG(convertedLatitude);
+        a_pSphereLongitudes[pointIndex] = RADIANS_IN_DEG(convertedLongitude);
       }
+    }
 
-      // First conversion provides a height offset with an offset in the latitude/longitude values
-      // Need to perform the conversion again on the original lat/long using the negated height offset
-      // This provides the correct lat/long to a good approximation.
-      convertedLatitude = latitudeRadians;
-      convertedLongitude = longitudeRadians;
-      z = -z;
-
-      returnCode = pj_transform(
-          m_wgs84CoordinateSystem,
-          m_sphereCoordinateSystem,
-          m_NUM_POINTS_TO_CONVERT,
-          m_POINT_OFFSET,
-          &convertedLongitude,
-          &convertedLatitude,
-          &z);
-
-      if (returnCode != 0)
+    void CoordinateConverter::ConvertSphereToWGS84(
+        const Utilities::Maths::Degrees* a_pLatitudes,
+        const Utilities::Maths::Degrees* a_pLongitudes,
+        const std::size_t a_noOfPoints,
+        Utilities::Maths::Degrees* a_pWgs84Latitudes,
+        Utilities::Maths::Degrees* a_pWgs84Longitudes) const
+    {
+      for (std::size_t pointIndex = 0U; pointIndex < a_noOfPoints; ++pointIndex)
       {
-        char* error = pj_strerrno(returnCode);
-        std::stringstream stream;
-        stream << "Coordinate transformation error: " << error;
-        throw EAGGRException(stream.str());
+        EAGGR::Utilities::Maths::Radians convertedLatitude;
+        EAGGR::Utilities::Maths::Radians convertedLongitude;
+
+        ConvertSphereToWGS84(
+            DEGREES_IN_RAD(a_pLatitudes[pointIndex]),
+            DEGREES_IN_RAD(a_pLongitudes[pointIndex]),
+            convertedLatitude,
+            convertedLongitude);
+
+        a_pWgs84Latitudes[pointIndex] = RADIANS_IN_DEG(convertedLatitude);
+        a_pWgs84Longitudes[pointIndex] = RADIANS_IN_DEG(convertedLongitude);
       }
+    }
 
-      return EAGGR::LatLong::SphericalAccuracyPoint(
-          RADIANS_IN_DEG(convertedLatitude),
-          RADIANS_IN_DEG(convertedLongitude),
-          EAGGR::LatLong::SphericalAccuracyPoint::SquareMetresToAngleAccuracy(
-              a_wgs84Point.GetAccuracy()));
+    void CoordinateConverter::InitialiseProj4()
+    {
+      m_wgs84CoordinateSystem = pj_init_plus("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs");
+
+      if (m_wgs84CoordinateSystem == NULL)
+      {
+        throw EAGGRException("Failed to create WGS84 coordinate system.");
+      }
+
+      m_sphereCoordinateSystem = pj_init_plus("+proj=longlat +ellps=sphere +datum=WGS84 +no_defs");
+
+      if (m_sphereCoordinateSystem == NULL)
+      {
+        pj_free(m_wgs84CoordinateSystem);
+        throw EAGGRException("Failed to create spherical coordinate system.");
+      }
     }
 
-    EAGGR::LatLong::Wgs84AccuracyPoint CoordinateConverter::ConvertSphereToWGS84(
-        const EAGGR::LatLong::SphericalAccuracyPoint a_spherePoint) const
+    void CoordinateConverter::ConvertWGS84ToSphere(
+        const Utilities::Maths::Radians a_latitude,
+        const Utilities::Maths::Radians a_longitude,
+        Utilities::Maths::Radians &a_sphereLatitude,
+        Utilities::Maths::Radians &a_sphereLongitude) const
+    {
+      if (m_method == PROJ4)
+      {
+        a_sphereLatitude = a_latitude;
+        a_sphereLongitude = a_longitude;
+
+        // Initially assume a height of zero and perform the conversion
+        double z = 0.0;
+
+        CheckProj4ReturnCode(
+            pj_transform(
+                m_wgs84CoordinateSystem,
+                m_sphereCoordinateSystem,
+                m_NUM_POINTS_TO_CONVERT,
+                m_POINT_OFFSET,
+                &a_sphereLongitude,
+                &a_sphereLatitude,
+                &z));
+
+        // First conversion provides a height offset with an offset in the latitude/longitude values
+        // Need to perform the conversion again on the original lat/long using the negated height offset
+        // This provides the correct lat/long to a good approximation.
+        a_sphereLatitude = a_latitude;
+        a_sphereLongitude = a_longitude;
+        z = -z;
+
+        CheckProj4ReturnCode(
+            pj_transform(
+                m_wgs84CoordinateSystem,
+                m_sphereCoordinateSystem,
+                m_NUM_POINTS_TO_CONVERT,
+                m_POINT_OFFSET,
+                &a_sphereLongitude,
+                &a_sphereLatitude,
+                &z));
+        return;
+      }
+
+      const double sinLatitude = sin(a_latitude);
+      const double cosLatitude = cos(a_latitude);
+
+      // Radius of curvature in the prime vertical
+      const double primeVerticalRadius = m_WGS84_SEMI_MAJOR_AXIS
+          / sqrt(1.0 - m_eccentricitySquared * sinLatitude * sinLatitude);
+
+      // Height of the point on the ellipsoid above the sphere
+      const double polarRadius = primeVerticalRadius * (1.0 - m_eccentricitySquared);
+      const double height = hypot(primeVerticalRadius * cosLatitude, polarRadius * sinLatitude)
+          - m_SPHERE_RADIUS;
+
+      // Move the point down the ellipsoid normal by that height, which takes it to the sphere to a
+      // good approximation, and find its geocentric latitude
+      const double distanceFromAxis = (primeVerticalRadius - height) * cosLatitude;
+      a_sphereLatitude = atan2((polarRadius - height) * sinLatitude, distanceFromAxis);
+      a_sphereLongitude = (distanceFromAxis < m_POLAR_AXIS_TOLERANCE * m_SPHERE_RADIUS) ?
+          0.0 : a_longitude;
+    }
+
+    void CoordinateConverter::ConvertSphereToWGS84(
+        const Utilities::Maths::Radians a_latitude,
+        const Utilities::Maths::Radians a_longitude,
+        Utilities::Maths::Radians &a_wgs84Latitude,
+        Utilities::Maths::Radians &a_wgs84Longitude) const
     {
-      double latitudeRadians = a_spherePoint.GetLatitudeInRadians();
-      double longitudeRadians = a_spherePoint.GetLongitudeInRadians();
+      if (m_method == PROJ4)
+      {
+        a_wgs84Latitude = a_latitude;
+        a_wgs84Longitude = a_longitude;
+
+        double z = 0.0;
+
+        CheckProj4ReturnCode(
+            pj_transform(
+                m_sphereCoordinateSystem,
+                m_wgs84CoordinateSystem,
+                m_NUM_POINTS_TO_CONVERT,
+                m_POINT_OFFSET,
+                &a_wgs84Longitude,
+                &a_wgs84Latitude,
+                &z));
+        return;
+      }
+
+      // Geocentric position of the point on the sphere
+      const double distanceFromAxis = m_SPHERE_RADIUS * cos(a_latitude);
+      const double z = m_SPHERE_RADIUS * sin(a_latitude);
 
-      double z = 0.0;
+      // Geodetic latitude using the closed-form solution of Vermeille (2002), "Direct
+      // transformation from geocentric coordinates to geodetic coordinates", Journal of Geodesy 76
+      const double eccentricityFourth = m_eccentricitySquared * m_eccentricitySquared;
+      const double p = (distanceFromAxis * distanceFromAxis)
+          / (m_WGS84_SEMI_MAJOR_AXIS * m_WGS84_SEMI_MAJOR_AXIS);
+      const double q = ((1.0 - m_eccentricitySquared) * z * z)
+          / (m_WGS84_SEMI_MAJOR_AXIS * m_WGS84_SEMI_MAJOR_AXIS);
+      const double r = (p + q - eccentricityFourth) / 6.0;
+      const double s = eccentricityFourth * p * q / (4.0 * r * r * r);
+      const double t = cbrt(1.0 + s + sqrt(s * (2.0 + s)));
+      const double u = r * (1.0 + t + 1.0 / t);
+      const double v = sqrt(u * u + eccentricityFourth * q);
+      const double w = m_eccentricitySquared * (u + v - q) / (2.0 * v);
+      const double k = sqrt(u + v + w * w) - w;
+      const double d = k * distanceFromAxis / (k + m_eccentricitySquared);
 
-      int returnCode = pj_transform(
-          m_sphereCoordinateSystem,
-          m_wgs84CoordinateSystem,
-          m_NUM_POINTS_TO_CONVERT,
-          m_POINT_OFFSET,
-          &longitudeRadians,
-          &latitudeRadians,
-          &z);
+      a_wgs84Latitude = 2.0 * atan2(z, d + hypot(d, z));
+      a_wgs84Longitude = (distanceFromAxis < m_POLAR_AXIS_TOLERANCE * m_WGS84_SEMI_MAJOR_AXIS) ?
+          0.0 : a_longitude;
+    }
 
-      if (returnCode != 0)
+    void CoordinateConverter::CheckProj4ReturnCode(const int a_returnCode)
+    {
+      if (a_returnCode != 0)
       {
-        char* error = pj_strerrno(returnCode);
+        char* error = pj_strerrno(a_returnCode);
         std::stringstream stream;
         stream << "Coordinate transformation error: " << error;
         throw EAGGRException(stream.str());
       }
-
-      return EAGGR::LatLong::Wgs84AccuracyPoint(
-          RADIANS_IN_DEG(latitudeRadians),
-          RADIANS_IN_DEG(longitudeRadians),
-          EAGGR::LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(
-              a_spherePoint.GetAccuracy()));
     }
   }
 }
@@ -29,22 +29,44 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "proj_api.h"
 
 #include "Src/LatLong/SphericalAccuracyPoint.hpp"
 #include "Src/LatLong/Wgs84AccuracyPoint.hpp"
+#include "Src/Utilities/Maths.hpp"
 
 namespace EAGGR
 {
   namespace CoordinateConversion
   {
+    /// Methods available for converting between WGS84 and Spherical Earth coordinates.
+    enum ConversionMethod
+    {
+      /// Closed-form ellipsoid to sphere mapping evaluated within the library.
+      CLOSED_FORM,
+      /// Transformation performed by proj4 (retained for validation).
+      PROJ4
+    };
+
     /// Class to provide ability to convert between WGS84 and Spherical Earth coordinates.
+    ///
+    /// A WGS84 point is mapped to the sphere by moving it along the ellipsoid normal by its height
+    /// above the sphere, matching the two-step proj4 transformation used by previous versions. The
+    /// reverse mapping finds the WGS84 geodetic latitude of the point on the sphere using
+    /// Vermeille's exact closed-form solution. Longitudes are unchanged by either mapping. The
+    /// closed-form results agree with proj4 to within 1e-12 degrees.
     class CoordinateConverter
     {
       public:
-        /// Constructor
+        /// Constructor - uses the closed-form conversion.
         CoordinateConverter();
 
+        /// Constructor
+        /// @param a_method The method used to convert between the coordinate systems.
+        explicit CoordinateConverter(const ConversionMethod a_method);
+
         /// Destructor
         ///
         /// Frees the memory allocated to the member variables by proj4
@@ -62,14 +84,89 @@ namespace EAGGR
         EAGGR::LatLong::Wgs84AccuracyPoint ConvertSphereToWGS84(
             const EAGGR::LatLong::SphericalAccuracyPoint a_spherePoint) const;
 
+        /// Converts an array of WGS84 latitudes and longitudes to Spherical Earth coordinates.
+        /// The output arrays may be the same as the input arrays.
+        /// @param a_pLatitudes The WGS84 latitude of each point.
+        /// @param a_pLongitudes The WGS84 longitude of each point.
+        /// @param a_noOfPoints The number of points to convert.
+        /// @param a_pSphereLatitudes Output array for the spherical latitude of each point.
+        /// @param a_pSphereLongitudes Output array for the spherical longitude of each point.
+        void ConvertWGS84ToSphere(
+            const Utilities::Maths::Degrees* a_pLatitudes,
+            const Utilities::Maths::Degrees* a_pLongitudes,
+            const std::size_t a_noOfPoints,
+            Utilities::Maths::Degrees* a_pSphereLatitudes,
+            Utilities::Maths::Degrees* a_pSphereLongitudes) const;
+
+        /// Converts an array of Spherical Earth latitudes and longitudes to WGS84 coordinates.
+        /// The output arrays may be the same as the input arrays.
+        /// @param a_pLatitudes The spherical latitude of each point.
+        /// @param a_pLongitudes The spherical longitude of each point.
+        /// @param a_noOfPoints The number of points to convert.
+        /// @param a_pWgs84Latitudes Output array for the WGS84 latitude of each point.
+        /// @param a_pWgs84Longitudes Output array for the WGS84 longitude of each point.
+        void ConvertSphereToWGS84(
+            const Utilities::Maths::Degrees* a_pLatitudes,
+            const Utilities::Maths::Degrees* a_pLongitudes,
+            const std::size_t a_noOfPoints,
+            Utilities::Maths::Degrees* a_pWgs84Latitudes,
+            Utilities::Maths::Degrees* a_pWgs84Longitudes) const;
+
       private:
         // Prevent copying of class to prevent destructor freeing the projection members
         CoordinateConverter(const CoordinateConverter&);
         CoordinateConverter& operator=(const CoordinateConverter&);
 
+        /// Creates the proj4 coordinate systems.
+        void InitialiseProj4();
+
+        /// Converts a WGS84 latitude and longitude to Spherical Earth coordinates.
+        /// @param a_latitude The WGS84 latitude.
+        /// @param a_longitude The WGS84 longitude.
+        /// @param a_sphereLatitude Output variable for the spherical latitude.
+        /// @param a_sphereLongitude Output variable for the spherical longitude.
+        void ConvertWGS84ToSphere(
+            const Utilities::Maths::Radians a_latitude,
+            const Utilities::Maths::Radians a_longitude,
+            Utilities::Maths::Radians &a_sphereLatitude,
+            Utilities::Maths::Radians &a_sphereLongitude) const;
+
+        /// Converts a Spherical Earth latitude and longitude to WGS84 coordinates.
+        /// @param a_latitude The spherical latitude.
+        /// @param a_longitude The spherical longitude.
+        /// @param a_wgs84Latitude Output variable for the WGS84 latitude.
+        /// @param a_wgs84Longitude Output variable for the WGS84 longitude.
+        void ConvertSphereToWGS84(
+            const Utilities::Maths::Radians a_latitude,
+            const Utilities::Maths::Radians a_longitude,
+            Utilities::Maths::Radians &a_wgs84Latitude,
+            Utilities::Maths::Radians &a_wgs84Longitude) const;
+
+        /// Throws an exception if a proj4 transformation failed.
+        /// @param a_returnCode The code returned by pj_transform.
+        static void CheckProj4ReturnCode(const int a_returnCode);
+
         static const long m_NUM_POINTS_TO_CONVERT = 1;
         static const int m_POINT_OFFSET = 1;
 
+        /// WGS84 semi-major axis in metres.
+        static constexpr double m_WGS84_SEMI_MAJOR_AXIS = 6378137.0;
+
+        /// WGS84 inverse flattening.
+        static constexpr double m_WGS84_INVERSE_FLATTENING = 298.257223563;
+
+        /// Radius in metres of the sphere (proj4 'sphere' ellipsoid).
+        static constexpr double m_SPHERE_RADIUS = 6370997.0;
+
+        /// Points closer than this fraction of the radius to the polar axis are treated as lying
+        /// on the axis and assigned a longitude of zero (as proj4 does).
+        static constexpr double m_POLAR_AXIS_TOLERANCE = 1e-12;
+
+        const ConversionMethod m_method;
+
+        /// Square of the WGS84 eccentricity.
+        const double m_eccentricitySquared;
+
         projPJ m_wgs84CoordinateSystem;
         projPJ m_sphereCoordinateSystem;
     };
@@ -42,68 +42,141 @@ namespace EAGGR
 {
   namespace ImportExport
   {
+    /// @param a_pGeometry The geometry to check.
+    /// @return True if the geometry is a collection of geometries; false otherwise.
+    static bool IsGeometryCollection(const OGRGeometry* const a_pGeometry)
+    {
+      switch (wkbFlatten(a_pGeometry->getGeometryType()))
+      {
+        case wkbGeometryCollection:
+        case wkbMultiPoint:
+        case wkbMultiLineString:
+        case wkbMultiPolygon:
+          return true;
+        default:
+          return false;
+      }
+    }
+
     AbstractShapeImporter::AbstractShapeImporter(const double a_accuracy)
-        : m_shapeIndex(0U), m_accuracy(a_accuracy)
+        : m_pNextGeometry(NULL), m_accuracy(a_accuracy)
     {
     }
 
     AbstractShapeImporter::~AbstractShapeImporter()
     {
-      // Delete all the pointers to the shape objects
-      for (std::vector<LatLongShape>::const_iterator iter = m_shapes.begin();
-          iter != m_shapes.end(); ++iter)
-      {
-        LatLongShape llShape = *iter;
-        const IShape* pShape = llShape.GetShapeData();
-        delete pShape;
-      }
+      DeleteShape();
     }
 
     LatLongShape AbstractShapeImporter::GetNextShape()
     {
-      LatLongShape & shape = m_shapes[m_shapeIndex];
-      ++m_shapeIndex;
-      return shape;
+      if (m_pNextGeometry == NULL)
+      {
+        throw EAGGRException("No more shapes in shape string importer.");
+      }
+
+      // The previous shape is no longer needed
+      DeleteShape();
+
+      m_pShape.reset(new LatLongShape(CreateShape(m_pNextGeometry)));
+
+      FindNextGeometry();
+
+      return *m_pShape;
     }
 
     bool AbstractShapeImporter::HasNext() const
     {
-      return m_shapeIndex < m_shapes.size();
+      return m_pNextGeometry != NULL;
     }
 
-    void AbstractShapeImporter::ExtractShapesFromGeometry(const OGRGeometry* const a_pGeometry)
+    void AbstractShapeImporter::SetGeometry(OGRGeometry* const a_pGeometry)
     {
-      OGRwkbGeometryType geometryType = wkbFlatten(a_pGeometry->getGeometryType());
+      m_pGeometry.reset(a_pGeometry);
+      m_collections.clear();
+      m_pNextGeometry = NULL;
 
-      // If the geometry is a collection of geometries
-      switch (geometryType)
+      // The geometry is treated as a collection containing just that geometry
+      if (IsGeometryCollection(a_pGeometry))
       {
-        case wkbGeometryCollection:
-        case wkbMultiPoint:
-        case wkbMultiLineString:
-        case wkbMultiPolygon:
+        m_collections.push_back(
+            std::make_pair(static_cast<const OGRGeometryCollection*>(a_pGeometry), 0));
+        FindNextGeometry();
+      }
+      else
+      {
+        m_pNextGeometry = a_pGeometry;
+      }
+    }
+
+    void AbstractShapeImporter::FindNextGeometry()
+    {
+      m_pNextGeometry = NULL;
+
+      // Walk the collections depth first until a geometry that is not a collection is found
+      while (!m_collections.empty())
+      {
+        std::pair<const OGRGeometryCollection*, int> & collection = m_collections.back();
+
+        if (collection.second >= collection.first->getNumGeometries())
         {
-          const OGRGeometryCollection* pGeometryCollection =
-              static_cast<const OGRGeometryCollection*>(a_pGeometry);
+          m_collections.pop_back();
+          continue;
+        }
 
-          // Loop over the geometries and call this method iteratively to extract the shapes from each
-          for (int geometryIndex = 0; geometryIndex < pGeometryCollection->getNumGeometries();
-              ++geometryIndex)
-          {
-            ExtractShapesFromGeometry(pGeometryCollection->getGeometryRef(geometryIndex));
-          }
+        const OGRGeometry* pGeometry = collection.first->getGeometryRef(collection.second);
+        ++collection.second;
+
+        if (IsGeometryCollection(pGeometry))
+        {
+          m_collections.push_back(
+              std::make_pair(static_cast<const OGRGeometryCollection*>(pGeometry), 0));
+        }
+        else
+        {
+          m_pNextGeometry = pGeometry;
           break;
         }
+      }
+    }
+
+    void AbstractShapeImporter::DeleteShape()
+    {
+      if (!m_pShape)
+      {
+        return;
+      }
+
+      // IShape has no virtual destructor, so the shape is deleted as its own type
+      switch (m_pShape->GetShapeType())
+      {
+        case WGS84_ACCURACY_POINT:
+          delete static_cast<const Wgs84AccuracyPoint*>(m_pShape->GetShapeData());
+          break;
+        case WGS84_LINESTRING:
+          delete static_cast<const Wgs84Linestring*>(m_pShape->GetShapeData());
+          break;
+        case WGS84_POLYGON:
+          delete static_cast<const Wgs84Polygon*>(m_pShape->GetShapeData());
+          break;
+      }
+
+      m_pShape.reset();
+    }
+
+    LatLongShape AbstractShapeImporter::CreateShape(const OGRGeometry* const a_pGeometry) const
+    {
+      OGRwkbGeometryType geometryType = wkbFlatten(a_pGeometry->getGeometryType());
+
+      switch (geometryType)
+      {
         case wkbPoint:
         {
           const OGRPoint* pPoint = static_cast<const OGRPoint*>(a_pGeometry);
 
-          LatLongShape shape(
+          return LatLongShape(
               WGS84_ACCURACY_POINT,
               new LatLong::Wgs84AccuracyPoint(pPoint->getY(), pPoint->getX(), m_accuracy));
-
-          m_shapes.push_back(shape);
-          break;
         }
         case wkbLineString:
         {
@@ -118,10 +191,7 @@ namespace EAGGR
             pWgs84Linestring->AddAccuracyPoint(pPoint.getY(), pPoint.getX(), m_accuracy);
           }
 
-          LatLongShape shape(WGS84_LINESTRING, pWgs84Linestring);
-
-          m_shapes.push_back(shape);
-          break;
+          return LatLongShape(WGS84_LINESTRING, pWgs84Linestring);
         }
         case wkbPolygon:
         {
@@ -155,11 +225,7 @@ namespace EAGGR
             }
           }
 
-          // Add polygon to the shapes vector
-          LatLongShape shape(WGS84_POLYGON, pWgs84Polygon);
-          m_shapes.push_back(shape);
-
-          break;
+          return LatLongShape(WGS84_POLYGON, pWgs84Polygon);
         }
         default:
           std::stringstream stream;
@@ -29,7 +29,9 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Src/LatLong/LatLongShape.hpp"
@@ -40,31 +42,56 @@ namespace EAGGR
 {
   namespace ImportExport
   {
-    /// Base class for shape data importers
+    /// Base class for shape data importers.
+    ///
+    /// The shapes are created one at a time from the imported geometry as they are requested, so
+    /// only one shape is held in memory at once however many the geometry contains.
     class AbstractShapeImporter
     {
       public:
-        /// Set the accuracy for the shapes and initialise the shape iterator to zero.
+        /// Set the accuracy for the shapes.
         /// @param a_accuracy The angle defining the accuracy of the points in metres squared.
         AbstractShapeImporter(const double a_accuracy);
 
-        /// Frees all memory allocated to the shape objects.
+        /// Frees all memory allocated to the geometry and the current shape object.
         virtual ~AbstractShapeImporter();
 
-        /// @return The next available shape object.
+        /// @return The next available shape object, which is valid until the next shape is
+        /// requested or the importer is destroyed.
+        /// @throws EAGGRException If the geometry of the shape is not supported.
         virtual EAGGR::LatLong::LatLongShape GetNextShape();
 
         /// @return True if there are more shapes available; false otherwise.
         virtual bool HasNext() const;
 
       protected:
-        /// Extracts all of the supported shapes from the supplied geometry.
-        /// @param a_pGeometry The geometry to extract shapes from.
-        void ExtractShapesFromGeometry(const OGRGeometry* const a_pGeometry);
+        /// Sets the geometry to extract the shapes from.
+        /// @param a_pGeometry The geometry, which the importer takes ownership of.
+        void SetGeometry(OGRGeometry* const a_pGeometry);
 
       private:
-        std::vector<EAGGR::LatLong::LatLongShape> m_shapes;
-        unsigned short m_shapeIndex;
+        /// Moves on to the next geometry that is not a collection, if there is one.
+        void FindNextGeometry();
+
+        /// @param a_pGeometry A point, linestring or polygon geometry.
+        /// @return A new shape object for the geometry.
+        /// @throws EAGGRException If the geometry is not supported.
+        EAGGR::LatLong::LatLongShape CreateShape(const OGRGeometry* const a_pGeometry) const;
+
+        /// Frees the memory allocated to the current shape object.
+        void DeleteShape();
+
+        std::unique_ptr<OGRGeometry> m_pGeometry;
+
+        /// The collections being iterated over, each with the index of its next geometry.
+        std::vector<std::pair<const OGRGeometryCollection*, int> > m_collections;
+
+        /// The geometry of the next shape, or null if there are no more shapes.
+        const OGRGeometry* m_pNextGeometry;
+
+        /// The last shape returned, if any.
+        std::unique_ptr<EAGGR::LatLong::LatLongShape> m_pShape;
+
         const double m_accuracy;
     };
   }
@@ -59,10 +59,8 @@ namespace EAGGR
         throw EAGGRException(stream.str());
       }
 
-      // Get all of the supported shapes from the geometry
-      ExtractShapesFromGeometry(pGeometry);
-
-      delete pGeometry;
+      // The shapes are extracted from the geometry as they are requested
+      SetGeometry(pGeometry);
     }
   }
 }
@@ -0,0 +1,393 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Model
+//
+//------------------------------------------------------
+/// @file CellNeighbourhood.cpp
+/// 
+/// Implements the EAGGR::Model::CellNeighbourhood class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <cmath>
+#include <set>
+#include <sstream>
+
+#include "CellNeighbourhood.hpp"
+#include "Src/EAGGRException.hpp"
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    /// Offsets of the vertices of every face triangle (top, left, then right) in the plane of the
+    /// face, as a fraction of the face edge length.
+    static const double FACE_VERTEX_X[] =
+    { 0.0, -0.5, 0.5 };
+    static const double FACE_VERTEX_Y[] =
+    { sqrt(3.0) / 3.0, -sqrt(3.0) / 6.0, -sqrt(3.0) / 6.0 };
+
+    /// Largest distance between the unit vectors to two face vertices that are the same vertex.
+    static const double VERTEX_MATCH_TOLERANCE = 1e-6;
+
+    CellNeighbourhood::CellNeighbourhood(
+        const GridIndexer::IGridIndexer * const a_gridIndexer,
+        const Projection::IProjection * const a_projection,
+        const FaceIndex a_noOfFaces)
+        : m_gridIndexer(a_gridIndexer), m_noOfFaces(a_noOfFaces)
+    {
+      // Unit vectors from the centre of the globe to each face vertex
+      std::vector<double> vertexX(a_noOfFaces * m_NO_OF_FACE_EDGES);
+      std::vector<double> vertexY(a_noOfFaces * m_NO_OF_FACE_EDGES);
+      std::vector<double> vertexZ(a_noOfFaces * m_NO_OF_FACE_EDGES);
+      for (FaceIndex faceIndex = 0U; faceIndex < a_noOfFaces; ++faceIndex)
+      {
+        for (unsigned short vertex = 0U; vertex < m_NO_OF_FACE_EDGES; ++vertex)
+        {
+          const LatLong::SphericalAccuracyPoint point = a_projection->GetLatLongPoint(
+              FaceCoordinate(faceIndex, FACE_VERTEX_X[vertex], FACE_VERTEX_Y[vertex], 0.0));
+          const double latitude = point.GetLatitudeInRadians();
+          const double longitude = point.GetLongitudeInRadians();
+
+          const unsigned int index = faceIndex * m_NO_OF_FACE_EDGES + vertex;
+          vertexX[index] = cos(latitude) * cos(longitude);
+          vertexY[index] = cos(latitude) * sin(longitude);
+          vertexZ[index] = sin(latitude);
+        }
+      }
+
+      // Maps each face vertex to the matching vertex on another face (or NO_MATCH)
+      const unsigned short NO_MATCH = m_NO_OF_FACE_EDGES;
+      std::vector<unsigned short> matches(m_NO_OF_FACE_EDGES);
+
+      m_faceEdges.resize(a_noOfFaces * m_NO_OF_FACE_EDGES);
+      m_vertexNeighbours.resize(a_noOfFaces);
+      for (FaceIndex faceIndex = 0U; faceIndex < a_noOfFaces; ++faceIndex)
+      {
+        unsigned short noOfSharedEdges = 0U;
+
+        for (FaceIndex otherFace = 0U; otherFace < a_noOfFaces; ++otherFace)
+        {
+          if (otherFace == faceIndex)
+          {
+            continue;
+          }
+
+          unsigned short noOfMatches = 0U;
+          for (unsigned short vertex = 0U; vertex < m_NO_OF_FACE_EDGES; ++vertex)
+          {
+            const unsigned int index = faceIndex * m_NO_OF_FACE_EDGES + vertex;
+            matches[vertex] = NO_MATCH;
+
+            for (unsigned short otherVertex = 0U; otherVertex < m_NO_OF_FACE_EDGES; ++otherVertex)
+            {
+              const unsigned int otherIndex = otherFace * m_NO_OF_FACE_EDGES + otherVertex;
+              const double distance = sqrt(
+                  pow(vertexX[index] - vertexX[otherIndex], 2)
+                      + pow(vertexY[index] - vertexY[otherIndex], 2)
+                      + pow(vertexZ[index] - vertexZ[otherIndex], 2));
+
+              if (distance < VERTEX_MATCH_TOLERANCE)
+              {
+                matches[vertex] = otherVertex;
+                ++noOfMatches;
+              }
+            }
+          }
+
+          if (noOfMatches > 0U)
+          {
+            m_vertexNeighbours[faceIndex].push_back(otherFace);
+          }
+
+          if (noOfMatches != 2U)
+          {
+            continue;
+          }
+
+          // The shared edge is opposite the vertex that has no match
+          unsigned short edge = 0U;
+          while (matches[edge] != NO_MATCH)
+          {
+            ++edge;
+          }
+
+          const unsigned short start = (edge + 1U) % m_NO_OF_FACE_EDGES;
+          const unsigned short end = (edge + 2U) % m_NO_OF_FACE_EDGES;
+          const unsigned short otherStart = matches[start];
+          const unsigned short otherEnd = matches[end];
+
+          // Unit vectors along the edge and perpendicular to it in the plane of each face
+          const double edgeLength = sqrt(
+              pow(FACE_VERTEX_X[end] - FACE_VERTEX_X[start], 2)
+                  + pow(FACE_VERTEX_Y[end] - FACE_VERTEX_Y[start], 2));
+          const double alongX = (FACE_VERTEX_X[end] - FACE_VERTEX_X[start]) / edgeLength;
+          const double alongY = (FACE_VERTEX_Y[end] - FACE_VERTEX_Y[start]) / edgeLength;
+          const double otherAlongX = (FACE_VERTEX_X[otherEnd] - FACE_VERTEX_X[otherStart])
+              / edgeLength;
+          const double otherAlongY = (FACE_VERTEX_Y[otherEnd] - FACE_VERTEX_Y[otherStart])
+              / edgeLength;
+
+          // The face is unfolded so that its opposite vertex lands on the far side of the edge
+          // from the adjacent face's opposite vertex. Faces may be mirrored relative to each
+          // other, in which case the perpendicular direction is reversed.
+          const unsigned short otherOpposite = 3U - otherStart - otherEnd;
+          const double oppositeSide = -alongY * (FACE_VERTEX_X[edge] - FACE_VERTEX_X[start])
+              + alongX * (FACE_VERTEX_Y[edge] - FACE_VERTEX_Y[start]);
+          const double otherOppositeSide = -otherAlongY
+              * (FACE_VERTEX_X[otherOpposite] - FACE_VERTEX_X[otherStart])
+              + otherAlongX * (FACE_VERTEX_Y[otherOpposite] - FACE_VERTEX_Y[otherStart]);
+          const double sign = (oppositeSide * otherOppositeSide < 0.0) ? 1.0 : -1.0;
+
+          FaceEdge& faceEdge = m_faceEdges[faceIndex * m_NO_OF_FACE_EDGES + edge];
+          faceEdge.m_adjacentFace = otherFace;
+          faceEdge.m_xx = otherAlongX * alongX + sign * otherAlongY * alongY;
+          faceEdge.m_xy = otherAlongX * alongY - sign * otherAlongY * alongX;
+          faceEdge.m_yx = otherAlongY * alongX - sign * otherAlongX * alongY;
+          faceEdge.m_yy = otherAlongY * alongY + sign * otherAlongX * alongX;
+          faceEdge.m_xShift = FACE_VERTEX_X[otherStart]
+              - (faceEdge.m_xx * FACE_VERTEX_X[start] + faceEdge.m_xy * FACE_VERTEX_Y[start]);
+          faceEdge.m_yShift = FACE_VERTEX_Y[otherStart]
+              - (faceEdge.m_yx * FACE_VERTEX_X[start] + faceEdge.m_yy * FACE_VERTEX_Y[start]);
+
+          ++noOfSharedEdges;
+        }
+
+        if (noOfSharedEdges != m_NO_OF_FACE_EDGES)
+        {
+          std::stringstream stream;
+          stream << "Face " << faceIndex << " shares " << noOfSharedEdges
+              << " edges with other faces.";
+          throw EAGGRException(stream.str());
+        }
+      }
+    }
+
+    std::unique_ptr<Cell::ICell> CellNeighbourhood::GetCanonicalCell(
+        const Cell::ICell & a_cell) const
+    {
+      return GetCellOnFace(m_gridIndexer->GetFaceCoordinate(a_cell));
+    }
+
+    void CellNeighbourhood::GetNeighbours(
+        const Cell::ICell & a_cell,
+        std::vector<std::unique_ptr<Cell::ICell> >& a_neighbourCells) const
+    {
+      a_neighbourCells.clear();
+
+      // Neighbours are only added once and never include the cell itself, including any copy of
+      // it on another face
+      std::set<Cell::DggsCellId> cellIds;
+      cellIds.insert(a_cell.GetCellId());
+      cellIds.insert(GetCanonicalCell(a_cell)->GetCellId());
+
+      if (a_cell.GetResolution() == 0U)
+      {
+        const std::vector<FaceIndex>& faces = m_vertexNeighbours[a_cell.GetFaceIndex()];
+        for (std::vector<FaceIndex>::const_iterator face = faces.begin(); face != faces.end();
+            ++face)
+        {
+          a_neighbourCells.push_back(m_gridIndexer->GetCell(FaceCoordinate(*face, 0.0, 0.0, 1.0)));
+        }
+        return;
+      }
+
+      std::vector<FaceCoordinate> neighbourCoordinates;
+      m_gridIndexer->GetNeighbourCoordinates(a_cell, neighbourCoordinates);
+
+      for (std::vector<FaceCoordinate>::const_iterator coordinate = neighbourCoordinates.begin();
+          coordinate != neighbourCoordinates.end(); ++coordinate)
+      {
+        std::unique_ptr<Cell::ICell> neighbour = GetCellOnFace(*coordinate);
+        if (cellIds.insert(neighbour->GetCellId()).second)
+        {
+          a_neighbourCells.push_back(std::move(neighbour));
+        }
+      }
+    }
+
+    void CellNeighbourhood::GetKRing(
+        const Cell::ICell & a_cell,
+        const unsigned short a_k,
+        std::vector<std::unique_ptr<Cell::ICell> >& a_cells) const
+    {
+      a_cells.clear();
+
+      // The cell is moved onto its own face first so that it is not found again as a neighbour
+      std::set<Cell::DggsCellId> cellIds;
+      a_cells.push_back(GetCanonicalCell(a_cell));
+      cellIds.insert(a_cells.front()->GetCellId());
+
+      // Each ring is made of the unvisited neighbours of the previous ring
+      std::size_t ringStart = 0U;
+      std::vector<std::unique_ptr<Cell::ICell> > neighbours;
+      for (unsigned short ring = 0U; ring < a_k; ++ring)
+      {
+        const std::size_t ringEnd = a_cells.size();
+        for (std::size_t cellIndex = ringStart; cellIndex < ringEnd; ++cellIndex)
+        {
+          GetNeighbours(*a_cells[cellIndex], neighbours);
+          for (std::vector<std::unique_ptr<Cell::ICell> >::iterator neighbour = neighbours.begin();
+              neighbour != neighbours.end(); ++neighbour)
+          {
+            if (cellIds.insert((*neighbour)->GetCellId()).second)
+            {
+              a_cells.push_back(std::move(*neighbour));
+            }
+          }
+        }
+        ringStart = ringEnd;
+      }
+    }
+
+    FaceCoordinate CellNeighbourhood::MoveOntoFace(const FaceCoordinate a_faceCoordinate) const
+    {
+      FaceIndex faceIndex = a_faceCoordinate.GetFaceIndex();
+      double xOffset = a_faceCoordinate.GetXOffset();
+      double yOffset = a_faceCoordinate.GetYOffset();
+      const double tolerance = m_EDGE_TOLERANCE * sqrt(a_faceCoordinate.GetAccuracy());
+
+      if (faceIndex >= m_noOfFaces)
+      {
+        std::stringstream stream;
+        stream << "Unknown face index (" << faceIndex << ")";
+        throw EAGGRException(stream.str());
+      }
+
+      // Repeatedly cross the edge that the point is furthest outside
+      double distances[m_NO_OF_FACE_EDGES];
+      for (unsigned short crossing = 0U; ; ++crossing)
+      {
+        GetDistancesToEdges(xOffset, yOffset, distances);
+
+        unsigned short furthestEdge = 0U;
+        for (unsigned short edge = 1U; edge < m_NO_OF_FACE_EDGES; ++edge)
+        {
+          if (distances[edge] < distances[furthestEdge])
+          {
+            furthestEdge = edge;
+          }
+        }
+
+        if (distances[furthestEdge] >= -tolerance)
+        {
+          break;
+        }
+
+        if (crossing == m_MAX_FACE_CROSSINGS)
+        {
+          std::stringstream stream;
+          stream << "Point (" << a_faceCoordinate.GetXOffset() << ", "
+              << a_faceCoordinate.GetYOffset() << ") is too far from face "
+              << a_faceCoordinate.GetFaceIndex() << ".";
+          throw EAGGRException(stream.str());
+        }
+
+        CrossEdge(furthestEdge, faceIndex, xOffset, yOffset);
+      }
+
+      // Visit every face that a point on an edge or vertex lies on and keep the lowest indexed
+      FaceIndex bestFaceIndex = faceIndex;
+      double bestXOffset = xOffset;
+      double bestYOffset = yOffset;
+      std::vector<FaceCoordinate> unvisited(
+          1U,
+          FaceCoordinate(faceIndex, xOffset, yOffset, a_faceCoordinate.GetAccuracy()));
+      std::set<FaceIndex> visitedFaces;
+      visitedFaces.insert(faceIndex);
+
+      while (!unvisited.empty())
+      {
+        const FaceCoordinate coordinate = unvisited.back();
+        unvisited.pop_back();
+
+        if (coordinate.GetFaceIndex() < bestFaceIndex)
+        {
+          bestFaceIndex = coordinate.GetFaceIndex();
+          bestXOffset = coordinate.GetXOffset();
+          bestYOffset = coordinate.GetYOffset();
+        }
+
+        GetDistancesToEdges(coordinate.GetXOffset(), coordinate.GetYOffset(), distances);
+        for (unsigned short edge = 0U; edge < m_NO_OF_FACE_EDGES; ++edge)
+        {
+          if (fabs(distances[edge]) <= tolerance)
+          {
+            faceIndex = coordinate.GetFaceIndex();
+            xOffset = coordinate.GetXOffset();
+            yOffset = coordinate.GetYOffset();
+            CrossEdge(edge, faceIndex, xOffset, yOffset);
+
+            if (visitedFaces.insert(faceIndex).second)
+            {
+              unvisited.push_back(
+                  FaceCoordinate(faceIndex, xOffset, yOffset, a_faceCoordinate.GetAccuracy()));
+            }
+          }
+        }
+      }
+
+      return FaceCoordinate(
+          bestFaceIndex,
+          bestXOffset,
+          bestYOffset,
+          a_faceCoordinate.GetAccuracy());
+    }
+
+    void CellNeighbourhood::GetDistancesToEdges(
+        const double a_xOffset,
+        const double a_yOffset,
+        double* a_pDistances)
+    {
+      // The inner radius of a face triangle with unit edge length
+      static const double INNER_RADIUS = sqrt(3.0) / 6.0;
+      static const double SIN_60 = sqrt(3.0) / 2.0;
+
+      a_pDistances[0] = INNER_RADIUS + a_yOffset;
+      a_pDistances[1] = INNER_RADIUS - (SIN_60 * a_xOffset + 0.5 * a_yOffset);
+      a_pDistances[2] = INNER_RADIUS - (-SIN_60 * a_xOffset + 0.5 * a_yOffset);
+    }
+
+    void CellNeighbourhood::CrossEdge(
+        const unsigned short a_edge,
+        FaceIndex& a_faceIndex,
+        double& a_xOffset,
+        double& a_yOffset) const
+    {
+      const FaceEdge& faceEdge = m_faceEdges[a_faceIndex * m_NO_OF_FACE_EDGES + a_edge];
+
+      const double xOffset = faceEdge.m_xx * a_xOffset + faceEdge.m_xy * a_yOffset
+          + faceEdge.m_xShift;
+      const double yOffset = faceEdge.m_yx * a_xOffset + faceEdge.m_yy * a_yOffset
+          + faceEdge.m_yShift;
+
+      a_faceIndex = faceEdge.m_adjacentFace;
+      a_xOffset = xOffset;
+      a_yOffset = yOffset;
+    }
+
+    std::unique_ptr<Cell::ICell> CellNeighbourhood::GetCellOnFace(
+        const FaceCoordinate a_faceCoordinate) const
+    {
+      return m_gridIndexer->GetCell(MoveOntoFace(a_faceCoordinate));
+    }
+  }
+}
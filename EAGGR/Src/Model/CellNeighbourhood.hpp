@@ -0,0 +1,157 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Model
+//
+//------------------------------------------------------
+/// @file CellNeighbourhood.hpp
+/// 
+/// Implements the EAGGR::Model::CellNeighbourhood class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "Src/Model/FaceCoordinate.hpp"
+#include "Src/Model/FaceTypes.hpp"
+#include "Src/Model/ICell.hpp"
+#include "Src/Model/IGridIndexer.hpp"
+#include "Src/Model/IProjection.hpp"
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    /// Finds the neighbours of cells, including those on other faces of the polyhedral globe.
+    ///
+    /// The neighbours of a cell are found on the grid of its own face (see
+    /// IGridIndexer::GetNeighbourCoordinates()) and any that lie beyond the face edges are moved
+    /// onto the face that contains them. Neighbouring faces are joined by unfolding them about
+    /// their shared edge, which is found once from the projection of the face vertices, so no
+    /// points are projected to or from lat / long when finding neighbours.
+    ///
+    /// Cells whose centres lie on a face edge or vertex are returned on the lowest indexed face
+    /// that they lie on.
+    class CellNeighbourhood
+    {
+      public:
+        /// Constructor
+        /// @param a_gridIndexer The grid indexer of the DGGS.
+        /// @param a_projection The projection of the DGGS, used to find which face edges meet.
+        /// @param a_noOfFaces The number of faces on the polyhedral globe.
+        /// @throws EAGGRException If a face edge is not shared with exactly one other face.
+        CellNeighbourhood(
+            const GridIndexer::IGridIndexer * const a_gridIndexer,
+            const Projection::IProjection * const a_projection,
+            const FaceIndex a_noOfFaces);
+
+        /// Gets the copy of a cell on the lowest indexed face that its centre lies on. Cells whose
+        /// centres lie on a face edge or vertex have a different id on each of those faces.
+        /// @param a_cell The cell to find.
+        /// @return The cell on the lowest indexed face that its centre lies on.
+        std::unique_ptr<Cell::ICell> GetCanonicalCell(const Cell::ICell & a_cell) const;
+
+        /// Gets the cells at the same resolution that share an edge or a vertex with a cell.
+        /// Resolution 0 cells cover a whole face, so their neighbours are the faces that share a
+        /// vertex with the cell's face.
+        /// @param a_cell The cell to get the neighbours for.
+        /// @param a_neighbourCells Populated with the neighbouring cells. Each cell appears once
+        /// and the supplied cell is not included.
+        void GetNeighbours(
+            const Cell::ICell & a_cell,
+            std::vector<std::unique_ptr<Cell::ICell> >& a_neighbourCells) const;
+
+        /// Gets the cells within a number of neighbour steps of a cell.
+        /// @param a_cell The cell at the centre of the rings.
+        /// @param a_k The number of rings of neighbours to include.
+        /// @param a_cells Populated with the cell itself followed by each ring of neighbours in
+        /// turn, nearest first. Each cell appears once.
+        void GetKRing(
+            const Cell::ICell & a_cell,
+            const unsigned short a_k,
+            std::vector<std::unique_ptr<Cell::ICell> >& a_cells) const;
+
+        /// Moves a coordinate that may lie beyond the edges of its face onto the face that
+        /// contains it. Coordinates on a face edge or vertex are moved to the lowest indexed face
+        /// that they lie on.
+        /// @param a_faceCoordinate The coordinate in the plane of its face.
+        /// @return The equivalent coordinate on the face that contains it.
+        /// @throws EAGGRException If the coordinate is too far from its face to be moved.
+        FaceCoordinate MoveOntoFace(const FaceCoordinate a_faceCoordinate) const;
+
+      private:
+        /// The mapping from the plane of a face to the plane of the face across one of its edges.
+        struct FaceEdge
+        {
+            /// The face across the edge.
+            FaceIndex m_adjacentFace;
+
+            /// Matrix and shift that take a point in the plane of the face to the plane of the
+            /// adjacent face.
+            double m_xx;
+            double m_xy;
+            double m_yx;
+            double m_yy;
+            double m_xShift;
+            double m_yShift;
+        };
+
+        /// Gets the distance of a point inside each edge of the face triangle. Edges are numbered
+        /// by the vertex opposite them (top, left, then right). Negative distances are outside the
+        /// face.
+        static void GetDistancesToEdges(
+            const double a_xOffset,
+            const double a_yOffset,
+            double* a_pDistances);
+
+        /// Moves a point in the plane of a face into the plane of the face across an edge.
+        void CrossEdge(
+            const unsigned short a_edge,
+            FaceIndex& a_faceIndex,
+            double& a_xOffset,
+            double& a_yOffset) const;
+
+        /// @return The cell at the supplied coordinate after it is moved onto its face.
+        std::unique_ptr<Cell::ICell> GetCellOnFace(const FaceCoordinate a_faceCoordinate) const;
+
+        const GridIndexer::IGridIndexer * const m_gridIndexer;
+        const FaceIndex m_noOfFaces;
+
+        /// The edges of each face, indexed by face index then edge number.
+        std::vector<FaceEdge> m_faceEdges;
+
+        /// The faces that share a vertex with each face.
+        std::vector<std::vector<FaceIndex> > m_vertexNeighbours;
+
+        /// Number of edges of each face.
+        static const unsigned short m_NO_OF_FACE_EDGES = 3U;
+
+        /// The greatest number of face edges crossed to reach the face containing a point.
+        static const unsigned short m_MAX_FACE_CROSSINGS = 4U;
+
+        /// Distance from a face edge, as a fraction of the square root of the cell accuracy,
+        /// within which a point is treated as lying on the edge.
+        static constexpr double m_EDGE_TOLERANCE = 1e-6;
+    };
+  }
+}
@@ -47,6 +47,11 @@ namespace EAGGR
       return (m_gridIndexer->CreateCell(a_cellId));
     }
 
+    std::unique_ptr<ICell> DGGS::CreateCell(const DggsPackedCellId a_packedCellId) const
+    {
+      return (m_gridIndexer->CreateCell(a_packedCellId));
+    }
+
     std::unique_ptr<ICell> DGGS::ConvertLatLongPointToCell(
         const LatLong::SphericalAccuracyPoint a_point) const
     {
@@ -55,6 +60,160 @@ namespace EAGGR
       return (m_gridIndexer->GetCell(faceCoord));
     }
 
+    std::unique_ptr<ICell> DGGS::ConvertLatLongPointToCellAtResolution(
+        const LatLong::SphericalAccuracyPoint a_point,
+        const unsigned short a_resolution) const
+    {
+      const FaceCoordinate faceCoord = m_projection->GetFaceCoordinate(a_point);
+
+      return (m_gridIndexer->GetCellAtResolution(faceCoord, a_resolution));
+    }
+
+    void DGGS::ConvertLatLongPointToCellsAtAllResolutions(
+        const LatLong::SphericalAccuracyPoint a_point,
+        std::vector<std::unique_ptr<Cell::ICell> >& a_cells) const
+    {
+      const FaceCoordinate faceCoord = m_projection->GetFaceCoordinate(a_point);
+
+      m_gridIndexer->GetCellsAtAllResolutions(faceCoord, a_cells);
+    }
+
+    void DGGS::ConvertLatLongPointsToCells(
+        const LatLong::SphericalAccuracyPoint* a_pPoints,
+        const std::size_t a_noOfPoints,
+        std::unique_ptr<Cell::ICell>* a_pCells) const
+    {
+      if (a_noOfPoints == 0U)
+      {
+        return;
+      }
+
+      std::vector<FaceCoordinate> faceCoordinates;
+      ConvertLatLongPointsToFaceCoordinates(a_pPoints, a_noOfPoints, faceCoordinates);
+
+      for (std::size_t point = 0U; point < a_noOfPoints; ++point)
+      {
+        a_pCells[point] = m_gridIndexer->GetCell(faceCoordinates[point]);
+      }
+    }
+
+    void DGGS::ConvertLatLongPointsToCells(
+        const LatLong::SphericalAccuracyPoint* a_pPoints,
+        const std::size_t a_noOfPoints,
+        std::unique_ptr<Cell::ICell>* a_pCells,
+        const Utilities::WorkStealingPool& a_pool) const
+    {
+      a_pool.ParallelFor(
+          a_noOfPoints,
+          m_POINTS_PER_CHUNK,
+          [this, a_pPoints, a_pCells](const std::size_t a_begin, const std::size_t a_end)
+          {
+            ConvertLatLongPointsToCells(a_pPoints + a_begin, a_end - a_begin, a_pCells + a_begin);
+          });
+    }
+
+    void DGGS::ConvertLatLongPointsToCellsAtResolution(
+        const LatLong::SphericalAccuracyPoint* a_pPoints,
+        const std::size_t a_noOfPoints,
+        const unsigned short a_resolution,
+        std::unique_ptr<Cell::ICell>* a_pCells) const
+    {
+      if (a_noOfPoints == 0U)
+      {
+        return;
+      }
+
+      std::vector<FaceCoordinate> faceCoordinates;
+      ConvertLatLongPointsToFaceCoordinates(a_pPoints, a_noOfPoints, faceCoordinates);
+
+      ConvertFaceCoordinatesToCellsAtResolution(
+          &faceCoordinates[0],
+          faceCoordinates.size(),
+          a_resolution,
+          a_pCells);
+    }
+
+    void DGGS::ConvertLatLongPointsToFaceCoordinates(
+        const LatLong::SphericalAccuracyPoint* a_pPoints,
+        const std::size_t a_noOfPoints,
+        std::vector<FaceCoordinate>& a_faceCoordinates) const
+    {
+      if (a_noOfPoints == 0U)
+      {
+        return;
+      }
+
+      // Split the points into separate arrays for the projection
+      std::vector < Utilities::Maths::Degrees > latitudes(a_noOfPoints);
+      std::vector < Utilities::Maths::Degrees > longitudes(a_noOfPoints);
+      std::vector < Utilities::Maths::Degrees > accuracies(a_noOfPoints);
+      for (std::size_t point = 0U; point < a_noOfPoints; ++point)
+      {
+        latitudes[point] = a_pPoints[point].GetLatitude();
+        longitudes[point] = a_pPoints[point].GetLongitude();
+        accuracies[point] = a_pPoints[point].GetAccuracy();
+      }
+
+      std::vector < FaceIndex > faceIndices(a_noOfPoints);
+      std::vector<double> xOffsets(a_noOfPoints);
+      std::vector<double> yOffsets(a_noOfPoints);
+      std::vector<double> accuracyAreas(a_noOfPoints);
+      m_projection->GetFaceCoordinates(
+          &latitudes[0],
+          &longitudes[0],
+          &accuracies[0],
+          a_noOfPoints,
+          &faceIndices[0],
+          &xOffsets[0],
+          &yOffsets[0],
+          &accuracyAreas[0]);
+
+      a_faceCoordinates.reserve(a_faceCoordinates.size() + a_noOfPoints);
+      for (std::size_t point = 0U; point < a_noOfPoints; ++point)
+      {
+        a_faceCoordinates.push_back(
+            FaceCoordinate(
+                faceIndices[point],
+                xOffsets[point],
+                yOffsets[point],
+                accuracyAreas[point]));
+      }
+    }
+
+    void DGGS::ConvertFaceCoordinatesToCells(
+        const FaceCoordinate* a_pFaceCoordinates,
+        const std::size_t a_noOfFaceCoordinates,
+        const Utilities::Maths::Degrees a_accuracyAngle,
+        std::unique_ptr<Cell::ICell>* a_pCells) const
+    {
+      // The accuracy is the same for every point, so it is only converted once
+      const double faceAccuracy = m_projection->GetFaceAccuracy(a_accuracyAngle);
+
+      for (std::size_t point = 0U; point < a_noOfFaceCoordinates; ++point)
+      {
+        a_pCells[point] = m_gridIndexer->GetCell(
+            FaceCoordinate(
+                a_pFaceCoordinates[point].GetFaceIndex(),
+                a_pFaceCoordinates[point].GetXOffset(),
+                a_pFaceCoordinates[point].GetYOffset(),
+                faceAccuracy));
+      }
+    }
+
+    void DGGS::ConvertFaceCoordinatesToCellsAtResolution(
+        const FaceCoordinate* a_pFaceCoordinates,
+        const std::size_t a_noOfFaceCoordinates,
+        const unsigned short a_resolution,
+        std::unique_ptr<Cell::ICell>* a_pCells) const
+    {
+      for (std::size_t point = 0U; point < a_noOfFaceCoordinates; ++point)
+      {
+        a_pCells[point] = m_gridIndexer->GetCellAtResolution(
+            a_pFaceCoordinates[point],
+            a_resolution);
+      }
+    }
+
     LatLong::SphericalAccuracyPoint DGGS::ConvertCellToLatLongPoint(const ICell & a_cell) const
     {
       const FaceCoordinate faceCoord = m_gridIndexer->GetFaceCoordinate(a_cell);
@@ -62,6 +221,23 @@ namespace EAGGR
       return (m_projection->GetLatLongPoint(faceCoord));
     }
 
+    void DGGS::ConvertCellsToLatLongPoints(
+        const std::vector<std::unique_ptr<Cell::ICell> >& a_cells,
+        std::vector<LatLong::SphericalAccuracyPoint>& a_points) const
+    {
+      a_points.clear();
+
+      std::vector < FaceCoordinate > faceCoordinates;
+      faceCoordinates.reserve(a_cells.size());
+      for (std::vector<std::unique_ptr<Cell::ICell> >::const_iterator iter = a_cells.begin();
+          iter != a_cells.end(); ++iter)
+      {
+        faceCoordinates.push_back(m_gridIndexer->GetFaceCoordinate(**iter));
+      }
+
+      ConvertFaceCoordinatesToLatLongPoints(faceCoordinates, a_points);
+    }
+
     void DGGS::GetParents(
         const Cell::ICell& a_cell,
         std::vector<std::unique_ptr<Cell::ICell> >& a_parentCells) const
@@ -148,10 +324,53 @@ namespace EAGGR
       std::list < FaceCoordinate > cellFaceCoordinates;
       m_gridIndexer->GetCellVertices(a_cell, cellFaceCoordinates);
 
-      for (std::list<FaceCoordinate>::const_iterator iter = cellFaceCoordinates.begin();
-          iter != cellFaceCoordinates.end(); ++iter)
+      const std::vector<FaceCoordinate> vertexFaceCoordinates(
+          cellFaceCoordinates.begin(),
+          cellFaceCoordinates.end());
+      ConvertFaceCoordinatesToLatLongPoints(vertexFaceCoordinates, a_cellVertices);
+    }
+
+    void DGGS::ConvertFaceCoordinatesToLatLongPoints(
+        const std::vector<FaceCoordinate>& a_faceCoordinates,
+        std::vector<LatLong::SphericalAccuracyPoint>& a_points) const
+    {
+      const std::size_t noOfPoints = a_faceCoordinates.size();
+      if (noOfPoints == 0U)
+      {
+        return;
+      }
+
+      // Split the face coordinates into separate arrays for the projection
+      std::vector < FaceIndex > faceIndices(noOfPoints);
+      std::vector<double> xOffsets(noOfPoints);
+      std::vector<double> yOffsets(noOfPoints);
+      std::vector<double> accuracyAreas(noOfPoints);
+      for (std::size_t point = 0U; point < noOfPoints; ++point)
+      {
+        faceIndices[point] = a_faceCoordinates[point].GetFaceIndex();
+        xOffsets[point] = a_faceCoordinates[point].GetXOffset();
+        yOffsets[point] = a_faceCoordinates[point].GetYOffset();
+        accuracyAreas[point] = a_faceCoordinates[point].GetAccuracy();
+      }
+
+      std::vector < Utilities::Maths::Degrees > latitudes(noOfPoints);
+      std::vector < Utilities::Maths::Degrees > longitudes(noOfPoints);
+      std::vector < Utilities::Maths::Degrees > accuracies(noOfPoints);
+      m_projection->GetLatLongPoints(
+          &faceIndices[0],
+          &xOffsets[0],
+          &yOffsets[0],
+          &accuracyAreas[0],
+          noOfPoints,
+          &latitudes[0],
+          &longitudes[0],
+          &accuracies[0]);
+
+      a_points.reserve(a_points.size() + noOfPoints);
+      for (std::size_t point = 0U; point < noOfPoints; ++point)
       {
-        a_cellVertices.push_back(m_projection->GetLatLongPoint(*iter));
+        a_points.push_back(
+            LatLong::SphericalAccuracyPoint(latitudes[point], longitudes[point], accuracies[point]));
       }
     }
   }
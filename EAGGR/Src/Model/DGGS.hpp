@@ -33,6 +33,7 @@
 #include "Src/Model/ICell.hpp"
 #include "Src/Model/IProjection.hpp"
 #include "Src/Model/IGridIndexer.hpp"
+#include "Src/Utilities/WorkStealingPool.hpp"
 
 namespace EAGGR
 {
@@ -50,13 +51,108 @@ namespace EAGGR
         /// Creates a cell in the DGGS using a cell Id.
         std::unique_ptr<Cell::ICell> CreateCell(const Cell::DggsCellId & a_cellId) const;
 
+        /// Creates a cell in the DGGS using a packed cell Id.
+        std::unique_ptr<Cell::ICell> CreateCell(const Cell::DggsPackedCellId a_packedCellId) const;
+
         /// Converts a lat / long point to a cell in the DGGS.
         std::unique_ptr<Cell::ICell> ConvertLatLongPointToCell(
             const LatLong::SphericalAccuracyPoint a_point) const;
 
+        /// Converts a lat / long point to the cell in the DGGS at the specified resolution,
+        /// ignoring the accuracy of the point.
+        /// @param a_point The point to convert.
+        /// @param a_resolution The resolution of the cell.
+        /// @return The cell containing the point.
+        std::unique_ptr<Cell::ICell> ConvertLatLongPointToCellAtResolution(
+            const LatLong::SphericalAccuracyPoint a_point,
+            const unsigned short a_resolution) const;
+
+        /// Converts a lat / long point to the cells containing it at every resolution, from the
+        /// whole face down to the resolution given by the accuracy of the point. The point is
+        /// projected once.
+        /// @param a_point The point to convert.
+        /// @param a_cells A vector that will be populated with the cells (coarsest first).
+        void ConvertLatLongPointToCellsAtAllResolutions(
+            const LatLong::SphericalAccuracyPoint a_point,
+            std::vector<std::unique_ptr<Cell::ICell> >& a_cells) const;
+
+        /// Converts lat / long points to cells in the DGGS, projecting them in bulk.
+        /// @param a_pPoints Array of points to convert.
+        /// @param a_noOfPoints The number of points in the array.
+        /// @param a_pCells Array to be populated with the cell for each point.
+        void ConvertLatLongPointsToCells(
+            const LatLong::SphericalAccuracyPoint* a_pPoints,
+            const std::size_t a_noOfPoints,
+            std::unique_ptr<Cell::ICell>* a_pCells) const;
+
+        /// Converts lat / long points to cells in the DGGS, sharing the points between the threads
+        /// of the supplied pool. Gives the same results as the single threaded overload.
+        /// @param a_pPoints Array of points to convert.
+        /// @param a_noOfPoints The number of points in the array.
+        /// @param a_pCells Array to be populated with the cell for each point.
+        /// @param a_pool The pool of threads to convert the points on.
+        void ConvertLatLongPointsToCells(
+            const LatLong::SphericalAccuracyPoint* a_pPoints,
+            const std::size_t a_noOfPoints,
+            std::unique_ptr<Cell::ICell>* a_pCells,
+            const Utilities::WorkStealingPool& a_pool) const;
+
+        /// Converts lat / long points to cells in the DGGS at the specified resolution, projecting
+        /// them in bulk. The accuracies of the points are ignored.
+        /// @param a_pPoints Array of points to convert.
+        /// @param a_noOfPoints The number of points in the array.
+        /// @param a_resolution The resolution of the cells.
+        /// @param a_pCells Array to be populated with the cell for each point.
+        void ConvertLatLongPointsToCellsAtResolution(
+            const LatLong::SphericalAccuracyPoint* a_pPoints,
+            const std::size_t a_noOfPoints,
+            const unsigned short a_resolution,
+            std::unique_ptr<Cell::ICell>* a_pCells) const;
+
+        /// Projects lat / long points on to the faces of the polyhedral globe in bulk, appending
+        /// the face coordinates to a_faceCoordinates. The face coordinates do not depend on the
+        /// grid, so they can be indexed by any DGGS with the same projection, at any accuracy.
+        /// @param a_pPoints Array of points to project.
+        /// @param a_noOfPoints The number of points in the array.
+        /// @param a_faceCoordinates Vector the face coordinate of each point is appended to.
+        void ConvertLatLongPointsToFaceCoordinates(
+            const LatLong::SphericalAccuracyPoint* a_pPoints,
+            const std::size_t a_noOfPoints,
+            std::vector<FaceCoordinate>& a_faceCoordinates) const;
+
+        /// Finds the cells containing points that have already been projected, at a single
+        /// accuracy in place of the accuracies of the face coordinates. Gives the same cells as
+        /// converting the lat / long points with that accuracy.
+        /// @param a_pFaceCoordinates Array of face coordinates to index.
+        /// @param a_noOfFaceCoordinates The number of face coordinates in the array.
+        /// @param a_accuracyAngle The angle defining the accuracy of the cells.
+        /// @param a_pCells Array to be populated with the cell for each face coordinate.
+        void ConvertFaceCoordinatesToCells(
+            const FaceCoordinate* a_pFaceCoordinates,
+            const std::size_t a_noOfFaceCoordinates,
+            const Utilities::Maths::Degrees a_accuracyAngle,
+            std::unique_ptr<Cell::ICell>* a_pCells) const;
+
+        /// Finds the cells containing points that have already been projected, at the specified
+        /// resolution. The accuracies of the face coordinates are ignored.
+        /// @param a_pFaceCoordinates Array of face coordinates to index.
+        /// @param a_noOfFaceCoordinates The number of face coordinates in the array.
+        /// @param a_resolution The resolution of the cells.
+        /// @param a_pCells Array to be populated with the cell for each face coordinate.
+        void ConvertFaceCoordinatesToCellsAtResolution(
+            const FaceCoordinate* a_pFaceCoordinates,
+            const std::size_t a_noOfFaceCoordinates,
+            const unsigned short a_resolution,
+            std::unique_ptr<Cell::ICell>* a_pCells) const;
+
         /// Converts a cell in the DGGS to a lat / long point.
         LatLong::SphericalAccuracyPoint ConvertCellToLatLongPoint(const Cell::ICell & a_cell) const;
 
+        /// Converts cells in the DGGS to lat / long points, projecting them in bulk.
+        void ConvertCellsToLatLongPoints(
+            const std::vector<std::unique_ptr<Cell::ICell> >& a_cells,
+            std::vector<LatLong::SphericalAccuracyPoint>& a_points) const;
+
         /// Populates a_parentCells with the parent cells of the given cell.
         void GetParents(
             const Cell::ICell& a_cell,
@@ -77,7 +173,15 @@ namespace EAGGR
             const Cell::ICell& a_cell,
             std::vector<LatLong::SphericalAccuracyPoint>& a_cellVertices) const;
 
+        /// The number of points converted together by each thread.
+        static const std::size_t m_POINTS_PER_CHUNK = 1024U;
+
       private:
+        /// Projects face coordinates to lat / long points in bulk, appending them to a_points.
+        void ConvertFaceCoordinatesToLatLongPoints(
+            const std::vector<FaceCoordinate>& a_faceCoordinates,
+            std::vector<LatLong::SphericalAccuracyPoint>& a_points) const;
+
         /// Projection to use for transforming points to and from the cells in
         /// the DGGS.
         const Projection::IProjection * m_projection;
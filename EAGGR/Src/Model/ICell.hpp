@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <list>
 
@@ -43,6 +44,9 @@ namespace EAGGR
     {
       typedef std::string DggsCellId;
 
+      /// Fixed-width integer representation of a DGGS cell id.
+      typedef std::uint64_t DggsPackedCellId;
+
       /// Enum for location of cell on the polyhedron face.
       enum CellLocation
       {
@@ -62,6 +66,9 @@ namespace EAGGR
           /// @return The Id of the DGGS cell
           virtual DggsCellId GetCellId() const = 0;
 
+          /// @return The Id of the DGGS cell packed into a fixed-width integer
+          virtual DggsPackedCellId GetPackedCellId() const = 0;
+
           /// @return The index of the face the DGGS cell is located on
           virtual unsigned short GetFaceIndex() const = 0;
 
@@ -78,7 +85,6 @@ namespace EAGGR
           /// @return The location of the cell on the face (inside, on edge, on vertex).
           virtual CellLocation GetCellLocation() const = 0;
 
-        protected:
           /// The maximum resolution level supported by the DGGS.
           /// This is set at the level which allows for the largest long value to be written
           /// for an offset coordinate.  If the resolution is bigger than this then the
@@ -161,6 +161,43 @@ namespace EAGGR
         }
       }
 
+      HierarchicalCell::HierarchicalCell(
+          const DggsPackedCellId a_packedCellId,
+          const unsigned short a_maximumFaceIndex,
+          const unsigned short a_maximumCellIndex)
+          : m_faceIndex(0U), // Set face index and resolution to defaults
+          m_resolution(0U), // They will be updated inside the constructor
+          m_cellIndices(), m_maximumCellIndex(a_maximumCellIndex), m_orientation(Grid::STANDARD)
+      {
+        if (m_maximumCellIndex > HierarchicalCellValue::m_MAXIMUM_CELL_INDEX)
+        {
+          std::stringstream stream;
+          stream << "Packed cell IDs require a maximum cell index of "
+              << HierarchicalCellValue::m_MAXIMUM_CELL_INDEX << " or less (maximum = "
+              << m_maximumCellIndex << ")";
+          throw EAGGRException(stream.str());
+        }
+
+        const HierarchicalCellValue cellValue(a_packedCellId);
+
+        m_faceIndex = cellValue.GetFaceIndex();
+        m_resolution = cellValue.GetResolution();
+
+        // Check face index is valid
+        if (m_faceIndex > a_maximumFaceIndex)
+        {
+          std::stringstream stream;
+          stream << "Face index, '" << m_faceIndex << "', exceeds maximum (maximum = "
+              << a_maximumFaceIndex << ")";
+          throw EAGGRException(stream.str());
+        }
+
+        for (unsigned short resolutionLevel = 1; resolutionLevel <= m_resolution; ++resolutionLevel)
+        {
+          m_cellIndices.push_back(cellValue.GetCellIndex(resolutionLevel));
+        }
+      }
+
       DggsCellId HierarchicalCell::GetCellId() const
       {
         std::stringstream cellId;
@@ -180,6 +217,42 @@ namespace EAGGR
         return cellId.str();
       }
 
+      DggsPackedCellId HierarchicalCell::GetPackedCellId() const
+      {
+        if (m_maximumCellIndex > HierarchicalCellValue::m_MAXIMUM_CELL_INDEX)
+        {
+          std::stringstream stream;
+          stream << "Packed cell IDs require a maximum cell index of "
+              << HierarchicalCellValue::m_MAXIMUM_CELL_INDEX << " or less (maximum = "
+              << m_maximumCellIndex << ")";
+          throw EAGGRException(stream.str());
+        }
+
+        if (m_resolution > HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL)
+        {
+          std::stringstream stream;
+          stream << "Unable to pack cell at resolution " << m_resolution
+              << " as it is greater than the upper limit ("
+              << HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL << ").";
+          throw EAGGRException(stream.str());
+        }
+
+        return GetCellValue().GetPackedCellId();
+      }
+
+      HierarchicalCellValue HierarchicalCell::GetCellValue() const
+      {
+        // Face index has already been validated by the constructor
+        HierarchicalCellValue cellValue(m_faceIndex, m_faceIndex);
+
+        for (unsigned short index = 0; index < m_resolution; ++index)
+        {
+          cellValue = cellValue.GetChild(m_cellIndices[index]);
+        }
+
+        return cellValue;
+      }
+
       unsigned short HierarchicalCell::GetFaceIndex() const
       {
         return m_faceIndex;
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "Src/Model/ICell.hpp"
+#include "Src/Model/ICell/HierarchicalCellValue.hpp"
 
 namespace EAGGR
 {
@@ -40,6 +41,9 @@ namespace EAGGR
     namespace Cell
     {
       /// Represents a DGGS cell that is identified by a hierarchy of cells at each resolution.
+      ///
+      /// The packed form of the cell id is described by HierarchicalCellValue and is limited to
+      /// resolution 29.
       class HierarchicalCell: virtual public ICell
       {
         public:
@@ -63,8 +67,23 @@ namespace EAGGR
               const unsigned short a_maximumFaceIndex,
               const unsigned short a_maximumCellIndex);
 
+          /// Constructor
+          /// @param a_packedCellId The packed cell id representing the cell data.
+          /// @param a_maximumFaceIndex The maximum allowed face index value.
+          /// @param a_maximumCellIndex The maximum allowed cell index value.
+          HierarchicalCell(
+              const DggsPackedCellId a_packedCellId,
+              const unsigned short a_maximumFaceIndex,
+              const unsigned short a_maximumCellIndex);
+
           virtual DggsCellId GetCellId() const;
 
+          virtual DggsPackedCellId GetPackedCellId() const;
+
+          /// @return The cell as a trivially copyable value.
+          /// @throws EAGGRException If the cell cannot be represented by a packed cell id.
+          HierarchicalCellValue GetCellValue() const;
+
           virtual unsigned short GetFaceIndex() const;
           virtual unsigned short GetResolution() const;
 
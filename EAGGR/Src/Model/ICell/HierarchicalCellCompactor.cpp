@@ -0,0 +1,159 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Cell
+//
+//------------------------------------------------------
+/// @file HierarchicalCellCompactor.cpp
+/// 
+/// Implements the EAGGR::Model::Cell::HierarchicalCellCompactor class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <sstream>
+
+#include "HierarchicalCellCompactor.hpp"
+#include "HierarchicalCellValue.hpp"
+#include "Src/EAGGRException.hpp"
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Cell
+    {
+      void HierarchicalCellCompactor::Compact(
+          const std::vector<DggsPackedCellId>& a_cells,
+          std::vector<DggsPackedCellId>& a_compactedCells)
+      {
+        a_compactedCells.clear();
+
+        // The output is used as a stack. It only ever holds cells in ascending order, none of
+        // which is inside another.
+        for (std::size_t cellIndex = 0U; cellIndex < a_cells.size(); ++cellIndex)
+        {
+          if (cellIndex > 0U && a_cells[cellIndex] < a_cells[cellIndex - 1U])
+          {
+            std::stringstream stream;
+            stream << "Cells must be in ascending order of packed cell ID ('"
+                << a_cells[cellIndex] << "' follows '" << a_cells[cellIndex - 1U] << "')";
+            throw EAGGRException(stream.str());
+          }
+
+          HierarchicalCellValue cell(a_cells[cellIndex]);
+
+          // Skip cells inside the previous cell
+          if (!a_compactedCells.empty()
+              && HierarchicalCellValue(a_compactedCells.back()).Contains(cell))
+          {
+            continue;
+          }
+
+          // Discard previous cells inside this cell
+          while (!a_compactedCells.empty()
+              && cell.Contains(HierarchicalCellValue(a_compactedCells.back())))
+          {
+            a_compactedCells.pop_back();
+          }
+
+          // Siblings are adjacent in the output, so the cell completes a group if the three
+          // previous cells have the same parent. Each replacement may complete a group of the
+          // parent's siblings.
+          while (a_compactedCells.size() >= 3U && cell.GetResolution() > 0U)
+          {
+            const DggsPackedCellId parentId = cell.GetParent().GetPackedCellId();
+
+            bool isGroupComplete = true;
+            for (std::size_t siblingIndex = a_compactedCells.size() - 3U;
+                siblingIndex < a_compactedCells.size(); ++siblingIndex)
+            {
+              const HierarchicalCellValue sibling(a_compactedCells[siblingIndex]);
+              isGroupComplete = isGroupComplete
+                  && sibling.GetResolution() == cell.GetResolution()
+                  && sibling.GetParent().GetPackedCellId() == parentId;
+            }
+
+            if (!isGroupComplete)
+            {
+              break;
+            }
+
+            a_compactedCells.resize(a_compactedCells.size() - 3U);
+            cell = HierarchicalCellValue(parentId);
+          }
+
+          a_compactedCells.push_back(cell.GetPackedCellId());
+        }
+      }
+
+      void HierarchicalCellCompactor::Uncompact(
+          const std::vector<DggsPackedCellId>& a_cells,
+          const unsigned short a_resolution,
+          std::vector<DggsPackedCellId>& a_uncompactedCells)
+      {
+        a_uncompactedCells.clear();
+
+        if (a_resolution > HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL)
+        {
+          std::stringstream stream;
+          stream << "Resolution, '" << a_resolution << "', exceeds the maximum resolution of a "
+              << "packed cell ID (" << HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL << ")";
+          throw EAGGRException(stream.str());
+        }
+
+        for (std::vector<DggsPackedCellId>::const_iterator cellId = a_cells.begin();
+            cellId != a_cells.end(); ++cellId)
+        {
+          const HierarchicalCellValue cell(*cellId);
+
+          if (cell.GetResolution() > a_resolution)
+          {
+            std::stringstream stream;
+            stream << "Cell '" << *cellId << "' at resolution " << cell.GetResolution()
+                << " cannot be expanded to resolution " << a_resolution;
+            throw EAGGRException(stream.str());
+          }
+
+          // The descendants at the resolution are evenly spaced through the cell's range, starting
+          // from the descendant with every cell index zero
+          HierarchicalCellValue firstDescendant(cell);
+          while (firstDescendant.GetResolution() < a_resolution)
+          {
+            firstDescendant = firstDescendant.GetChild(0U);
+          }
+
+          // The lowest set bit is the resolution marker and the last cell index is above it
+          const DggsPackedCellId firstDescendantId = firstDescendant.GetPackedCellId();
+          const DggsPackedCellId step = (firstDescendantId & (~firstDescendantId + 1U)) << 1U;
+          const DggsPackedCellId noOfDescendants = static_cast<DggsPackedCellId>(1U)
+              << (2U * (a_resolution - cell.GetResolution()));
+
+          DggsPackedCellId descendantId = firstDescendantId;
+          for (DggsPackedCellId descendantIndex = 0U; descendantIndex < noOfDescendants;
+              ++descendantIndex)
+          {
+            a_uncompactedCells.push_back(descendantId);
+            descendantId += step;
+          }
+        }
+      }
+    }
+  }
+}
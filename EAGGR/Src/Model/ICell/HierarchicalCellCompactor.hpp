@@ -0,0 +1,77 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Cell
+//
+//------------------------------------------------------
+/// @file HierarchicalCellCompactor.hpp
+/// 
+/// Implements the EAGGR::Model::Cell::HierarchicalCellCompactor class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "Src/Model/ICell.hpp"
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Cell
+    {
+      /// Compacts sets of hierarchical cells, held as sorted packed cell ids, by replacing every
+      /// complete group of sibling cells with their parent, and expands compacted sets again.
+      ///
+      /// The descendants of a cell occupy a contiguous range of packed ids (see
+      /// HierarchicalCellValue), so both operations take a single pass over sorted ids and run in
+      /// time linear in the number of cells read and written.
+      class HierarchicalCellCompactor
+      {
+        public:
+          /// Replaces every complete group of four sibling cells with their parent, repeating
+          /// until no complete group remains. Duplicate cells and cells inside another cell of the
+          /// input are removed.
+          /// @param a_cells Packed ids of the cells in ascending order, at any resolutions.
+          /// @param a_compactedCells Populated with the packed ids of the compacted cells in
+          /// ascending order.
+          /// @throws EAGGRException If the cells are not in ascending order or a packed id is
+          /// invalid.
+          static void Compact(
+              const std::vector<DggsPackedCellId>& a_cells,
+              std::vector<DggsPackedCellId>& a_compactedCells);
+
+          /// Replaces each cell with its descendants at a resolution. The output is in ascending
+          /// order if the input is in ascending order and no cell is inside another.
+          /// @param a_cells Packed ids of the cells.
+          /// @param a_resolution The resolution of the output cells.
+          /// @param a_uncompactedCells Populated with the packed ids of the descendants.
+          /// @throws EAGGRException If a cell is at a finer resolution than a_resolution, the
+          /// resolution cannot be represented in a packed id or a packed id is invalid.
+          static void Uncompact(
+              const std::vector<DggsPackedCellId>& a_cells,
+              const unsigned short a_resolution,
+              std::vector<DggsPackedCellId>& a_uncompactedCells);
+      };
+    }
+  }
+}
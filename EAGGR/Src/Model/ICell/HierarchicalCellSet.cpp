@@ -0,0 +1,270 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Cell
+//
+//------------------------------------------------------
+/// @file HierarchicalCellSet.cpp
+/// 
+/// Implements the EAGGR::Model::Cell::HierarchicalCellSet class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <algorithm>
+#include <iterator>
+
+#include "HierarchicalCellSet.hpp"
+#include "HierarchicalCellCompactor.hpp"
+#include "HierarchicalCellSetSimd.hpp"
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Cell
+    {
+      HierarchicalCellSet::HierarchicalCellSet()
+      {
+      }
+
+      HierarchicalCellSet::HierarchicalCellSet(const std::vector<DggsPackedCellId>& a_cells)
+      {
+        std::vector<DggsPackedCellId> sortedCells(a_cells);
+        std::sort(sortedCells.begin(), sortedCells.end());
+
+        HierarchicalCellCompactor::Compact(sortedCells, m_cells);
+      }
+
+      const std::vector<DggsPackedCellId>& HierarchicalCellSet::GetCells() const
+      {
+        return m_cells;
+      }
+
+      bool HierarchicalCellSet::IsEmpty() const
+      {
+        return m_cells.empty();
+      }
+
+      bool HierarchicalCellSet::Contains(const DggsPackedCellId a_cell) const
+      {
+        bool result = false;
+        Contains(&a_cell, 1U, &result);
+        return result;
+      }
+
+      void HierarchicalCellSet::Contains(
+          const DggsPackedCellId * a_cells,
+          const std::size_t a_noOfCells,
+          bool * a_pResults) const
+      {
+        // Selected once, as it depends only on the CPU
+        static const HierarchicalCellSetSimd::ContainsKernel CONTAINS_KERNEL =
+            HierarchicalCellSetSimd::SelectContainsKernel();
+
+        const bool isAscending = std::is_sorted(a_cells, a_cells + a_noOfCells);
+
+        // Unsorted batches are searched for with the vector kernel when the CPU supports one
+        if (!isAscending && CONTAINS_KERNEL != NULL && !m_cells.empty())
+        {
+          for (std::size_t cellIndex = 0U; cellIndex < a_noOfCells; ++cellIndex)
+          {
+            // Checks the packed id is valid
+            static_cast<void>(HierarchicalCellValue(a_cells[cellIndex]));
+          }
+
+          CONTAINS_KERNEL(&m_cells[0], m_cells.size(), a_cells, a_noOfCells, a_pResults);
+          return;
+        }
+
+        std::vector<DggsPackedCellId>::const_iterator storedCell = m_cells.begin();
+        for (std::size_t cellIndex = 0U; cellIndex < a_noOfCells; ++cellIndex)
+        {
+          // Checks the packed id is valid
+          const HierarchicalCellValue cell(a_cells[cellIndex]);
+
+          // The stored ranges are disjoint and ascending, so the only range that can contain the
+          // cell is the first one that does not end before it. For an ascending batch that range
+          // is never before the range found for the previous cell.
+          if (isAscending)
+          {
+            while (storedCell != m_cells.end() && IsRangeBefore(*storedCell, a_cells[cellIndex]))
+            {
+              ++storedCell;
+            }
+          }
+          else
+          {
+            storedCell = std::lower_bound(
+                m_cells.begin(),
+                m_cells.end(),
+                a_cells[cellIndex],
+                IsRangeBefore);
+          }
+
+          a_pResults[cellIndex] = storedCell != m_cells.end()
+              && HierarchicalCellValue(*storedCell).Contains(cell);
+        }
+      }
+
+      HierarchicalCellSet HierarchicalCellSet::Union(const HierarchicalCellSet & a_other) const
+      {
+        std::vector<DggsPackedCellId> mergedCells;
+        mergedCells.reserve(m_cells.size() + a_other.m_cells.size());
+        std::merge(
+            m_cells.begin(),
+            m_cells.end(),
+            a_other.m_cells.begin(),
+            a_other.m_cells.end(),
+            std::back_inserter(mergedCells));
+
+        // Compacting removes cells inside cells of the other set and replaces sibling groups
+        // completed by cells from both sets
+        HierarchicalCellSet result;
+        HierarchicalCellCompactor::Compact(mergedCells, result.m_cells);
+
+        return result;
+      }
+
+      HierarchicalCellSet HierarchicalCellSet::Intersection(
+          const HierarchicalCellSet & a_other) const
+      {
+        HierarchicalCellSet result;
+
+        // Two cells either overlap with one inside the other or are disjoint. The output is
+        // already compact: a complete sibling group in it would mean one of the inputs also held
+        // that complete group.
+        std::vector<DggsPackedCellId>::const_iterator cell = m_cells.begin();
+        std::vector<DggsPackedCellId>::const_iterator otherCell = a_other.m_cells.begin();
+        while (cell != m_cells.end() && otherCell != a_other.m_cells.end())
+        {
+          const HierarchicalCellValue cellValue(*cell);
+          const HierarchicalCellValue otherCellValue(*otherCell);
+
+          if (cellValue.Contains(otherCellValue))
+          {
+            result.m_cells.push_back(*otherCell);
+            ++otherCell;
+          }
+          else if (otherCellValue.Contains(cellValue))
+          {
+            result.m_cells.push_back(*cell);
+            ++cell;
+          }
+          else if (cellValue.GetRangeMax() < otherCellValue.GetRangeMin())
+          {
+            ++cell;
+          }
+          else
+          {
+            ++otherCell;
+          }
+        }
+
+        return result;
+      }
+
+      HierarchicalCellSet HierarchicalCellSet::Difference(
+          const HierarchicalCellSet & a_other) const
+      {
+        HierarchicalCellSet result;
+
+        std::vector<DggsPackedCellId>::const_iterator otherCell = a_other.m_cells.begin();
+        for (std::vector<DggsPackedCellId>::const_iterator cell = m_cells.begin();
+            cell != m_cells.end(); ++cell)
+        {
+          const HierarchicalCellValue cellValue(*cell);
+
+          // Skip the cells of the other set that end before this cell
+          while (otherCell != a_other.m_cells.end()
+              && HierarchicalCellValue(*otherCell).GetRangeMax() < cellValue.GetRangeMin())
+          {
+            ++otherCell;
+          }
+
+          // The other set covers the whole cell. The covering cell may cover later cells too.
+          if (otherCell != a_other.m_cells.end()
+              && HierarchicalCellValue(*otherCell).Contains(cellValue))
+          {
+            continue;
+          }
+
+          // Any other cells overlapping this cell are inside it
+          std::vector<DggsPackedCellId>::const_iterator lastOtherCell = otherCell;
+          while (lastOtherCell != a_other.m_cells.end()
+              && cellValue.Contains(HierarchicalCellValue(*lastOtherCell)))
+          {
+            ++lastOtherCell;
+          }
+
+          if (lastOtherCell == otherCell)
+          {
+            result.m_cells.push_back(*cell);
+          }
+          else
+          {
+            result.AddUncoveredParts(cellValue, otherCell, lastOtherCell);
+            otherCell = lastOtherCell;
+          }
+        }
+
+        return result;
+      }
+
+      void HierarchicalCellSet::AddUncoveredParts(
+          const HierarchicalCellValue & a_cell,
+          std::vector<DggsPackedCellId>::const_iterator a_firstCell,
+          const std::vector<DggsPackedCellId>::const_iterator a_lastCell)
+      {
+        // The removed cells are inside a_cell, so it is not at the maximum resolution. The parts
+        // added are compact as at least one child of every split cell is not added whole.
+        for (unsigned short childIndex = 0U;
+            childIndex <= HierarchicalCellValue::m_MAXIMUM_CELL_INDEX; ++childIndex)
+        {
+          const HierarchicalCellValue child = a_cell.GetChild(childIndex);
+
+          std::vector<DggsPackedCellId>::const_iterator lastChildCell = a_firstCell;
+          while (lastChildCell != a_lastCell
+              && child.Contains(HierarchicalCellValue(*lastChildCell)))
+          {
+            ++lastChildCell;
+          }
+
+          if (lastChildCell == a_firstCell)
+          {
+            m_cells.push_back(child.GetPackedCellId());
+          }
+          else if (*a_firstCell != child.GetPackedCellId())
+          {
+            AddUncoveredParts(child, a_firstCell, lastChildCell);
+          }
+
+          a_firstCell = lastChildCell;
+        }
+      }
+
+      bool HierarchicalCellSet::IsRangeBefore(
+          const DggsPackedCellId a_storedCell,
+          const DggsPackedCellId a_cell)
+      {
+        return HierarchicalCellValue(a_storedCell).GetRangeMax() < a_cell;
+      }
+    }
+  }
+}
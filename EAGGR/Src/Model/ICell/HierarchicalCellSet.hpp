@@ -0,0 +1,123 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Cell
+//
+//------------------------------------------------------
+/// @file HierarchicalCellSet.hpp
+/// 
+/// Implements the EAGGR::Model::Cell::HierarchicalCellSet class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Src/Model/ICell.hpp"
+#include "Src/Model/ICell/HierarchicalCellValue.hpp"
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Cell
+    {
+      /// Set of hierarchical cells held as sorted packed cell ids, where a cell covers all of its
+      /// descendants.
+      ///
+      /// The cells are stored compacted (see HierarchicalCellCompactor), so no cell is inside
+      /// another and every region has exactly one representation. As the descendants of a cell
+      /// occupy a contiguous range of packed ids, the stored cells are disjoint ranges in
+      /// ascending order and the set operations are linear merges of the two cell lists.
+      class HierarchicalCellSet
+      {
+        public:
+          /// Default constructor - creates an empty set.
+          HierarchicalCellSet();
+
+          /// Constructor
+          /// @param a_cells Packed ids of the cells in any order, at any resolutions. Duplicate
+          /// cells and cells inside another cell are allowed.
+          /// @throws EAGGRException If a packed id is invalid.
+          explicit HierarchicalCellSet(const std::vector<DggsPackedCellId>& a_cells);
+
+          /// @return Packed ids of the compacted cells in ascending order.
+          const std::vector<DggsPackedCellId>& GetCells() const;
+
+          /// @return True if the set contains no cells.
+          bool IsEmpty() const;
+
+          /// @param a_cell Packed id of the cell to test.
+          /// @return True if the cell is in the set or is inside a cell in the set.
+          /// @throws EAGGRException If the packed id is invalid.
+          bool Contains(const DggsPackedCellId a_cell) const;
+
+          /// Tests a batch of cells for membership. A batch in ascending order is tested in a
+          /// single pass over the set, otherwise each cell is found by binary search. The
+          /// searches run on a vector kernel (see HierarchicalCellSetSimd) if the CPU supports one.
+          /// @param a_cells Packed ids of the cells to test.
+          /// @param a_noOfCells The number of cells to test.
+          /// @param a_pResults Populated with a flag for each cell, set if the cell is in the set
+          /// or is inside a cell in the set. Must have room for a_noOfCells flags.
+          /// @throws EAGGRException If a packed id is invalid.
+          void Contains(
+              const DggsPackedCellId * a_cells,
+              const std::size_t a_noOfCells,
+              bool * a_pResults) const;
+
+          /// @param a_other The set to combine with this set.
+          /// @return The set of the area covered by either set.
+          HierarchicalCellSet Union(const HierarchicalCellSet & a_other) const;
+
+          /// @param a_other The set to intersect with this set.
+          /// @return The set of the area covered by both sets.
+          HierarchicalCellSet Intersection(const HierarchicalCellSet & a_other) const;
+
+          /// @param a_other The set to remove from this set.
+          /// @return The set of the area covered by this set and not by a_other.
+          HierarchicalCellSet Difference(const HierarchicalCellSet & a_other) const;
+
+        private:
+          /// Adds the parts of a cell not covered by a run of cells inside it to the set. The cell
+          /// is split into its children and each child is added whole, skipped or split again.
+          /// @param a_cell The cell to split.
+          /// @param a_firstCell The first cell to remove, which must be inside a_cell.
+          /// @param a_lastCell One past the last cell to remove. All the cells in the run must be
+          /// inside a_cell and in ascending order.
+          void AddUncoveredParts(
+              const HierarchicalCellValue & a_cell,
+              std::vector<DggsPackedCellId>::const_iterator a_firstCell,
+              const std::vector<DggsPackedCellId>::const_iterator a_lastCell);
+
+          /// Compared with a cell's packed id to find the stored cell whose range contains it.
+          /// @param a_storedCell Packed id of a stored cell.
+          /// @param a_cell Packed id of the cell being searched for.
+          /// @return True if the range of the stored cell ends before the cell.
+          static bool IsRangeBefore(
+              const DggsPackedCellId a_storedCell,
+              const DggsPackedCellId a_cell);
+
+          std::vector<DggsPackedCellId> m_cells;
+      };
+    }
+  }
+}
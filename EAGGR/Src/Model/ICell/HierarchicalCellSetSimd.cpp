@@ -0,0 +1,74 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Cell
+//
+//------------------------------------------------------
+/// @file HierarchicalCellSetSimd.cpp
+/// 
+/// Selects the vector kernel of the hierarchical cell set membership test at runtime.
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include "HierarchicalCellSetSimd.hpp"
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Cell
+    {
+      namespace HierarchicalCellSetSimd
+      {
+        ContainsKernel SelectContainsKernel()
+        {
+#if EAGGR_CELL_SET_SIMD
+          if (IsAvx512Supported())
+          {
+            return (&ContainsAvx512);
+          }
+
+          if (IsAvx2Supported())
+          {
+            return (&ContainsAvx2);
+          }
+#endif
+
+          // The caller falls back to the scalar path
+          return (NULL);
+        }
+
+#if EAGGR_CELL_SET_SIMD
+        bool IsAvx2Supported()
+        {
+          // Also checks that the operating system saves the AVX registers
+          __builtin_cpu_init();
+          return (__builtin_cpu_supports("avx2"));
+        }
+
+        bool IsAvx512Supported()
+        {
+          __builtin_cpu_init();
+          return (__builtin_cpu_supports("avx512f"));
+        }
+#endif
+      }
+    }
+  }
+}
@@ -0,0 +1,101 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Cell
+//
+//------------------------------------------------------
+/// @file HierarchicalCellSetSimd.hpp
+/// 
+/// Declares the vector kernels of the hierarchical cell set membership test.
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+
+#include "Src/Model/ICell.hpp"
+
+// As for the Snyder projection kernels, the instruction set is selected with GCC function
+// attributes and the kernels are not built for Windows (GCC bug 54412).
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(_WIN32)
+#define EAGGR_CELL_SET_SIMD 1
+#else
+#define EAGGR_CELL_SET_SIMD 0
+#endif
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Cell
+    {
+      /// Vector kernels for testing a batch of cells for membership of a hierarchical cell set,
+      /// and the runtime selection between them.
+      ///
+      /// Each vector of cells runs a branch-free binary search over the stored cells together,
+      /// gathering the stored cell for each lane. The number of steps only depends on the number
+      /// of stored cells, so no lane waits for another.
+      namespace HierarchicalCellSetSimd
+      {
+        /// Tests cells for membership of a set of compacted cells.
+        /// @param a_pStoredCells Packed ids of the cells in the set, in ascending order with
+        /// disjoint ranges.
+        /// @param a_noOfStoredCells The number of cells in the set, which must not be zero.
+        /// @param a_pCells Validated packed ids of the cells to test.
+        /// @param a_noOfCells The number of cells to test.
+        /// @param a_pResults Output array for the flag of each cell, set if the cell is inside a
+        /// stored cell.
+        typedef void (*ContainsKernel)(
+            const DggsPackedCellId * a_pStoredCells,
+            const std::size_t a_noOfStoredCells,
+            const DggsPackedCellId * a_pCells,
+            const std::size_t a_noOfCells,
+            bool * a_pResults);
+
+        /// @return The fastest membership kernel supported by the CPU, or NULL if none is.
+        ContainsKernel SelectContainsKernel();
+
+#if EAGGR_CELL_SET_SIMD
+        /// @return True if the CPU and operating system support the AVX2 kernel.
+        bool IsAvx2Supported();
+
+        /// @return True if the CPU and operating system support the AVX-512 kernel.
+        bool IsAvx512Supported();
+
+        /// Membership kernel using AVX2 instructions, four cells at a time.
+        void ContainsAvx2(
+            const DggsPackedCellId * a_pStoredCells,
+            const std::size_t a_noOfStoredCells,
+            const DggsPackedCellId * a_pCells,
+            const std::size_t a_noOfCells,
+            bool * a_pResults);
+
+        /// Membership kernel using AVX-512 instructions, eight cells at a time.
+        void ContainsAvx512(
+            const DggsPackedCellId * a_pStoredCells,
+            const std::size_t a_noOfStoredCells,
+            const DggsPackedCellId * a_pCells,
+            const std::size_t a_noOfCells,
+            bool * a_pResults);
+#endif
+      }
+    }
+  }
+}
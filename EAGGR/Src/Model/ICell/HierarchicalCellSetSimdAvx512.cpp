@@ -0,0 +1,92 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Cell
+//
+//------------------------------------------------------
+/// @file HierarchicalCellSetSimdAvx512.cpp
+/// 
+/// Implements the AVX-512 kernel of the hierarchical cell set membership test.
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include "HierarchicalCellSetSimd.hpp"
+
+#if EAGGR_CELL_SET_SIMD
+
+#include <immintrin.h>
+
+#define EAGGR_SIMD_FUNCTION static inline __attribute__((always_inline, target("avx512f")))
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Cell
+    {
+      namespace HierarchicalCellSetSimd
+      {
+        namespace
+        {
+          typedef DggsPackedCellId Vector __attribute__((vector_size(64)));
+          typedef long long VectorMask __attribute__((vector_size(64)));
+
+          EAGGR_SIMD_FUNCTION Vector Gather(
+              const DggsPackedCellId * a_pStoredCells,
+              const Vector a_indices)
+          {
+            // The masked form avoids an undefined source operand
+            return (reinterpret_cast<Vector>(_mm512_mask_i64gather_epi64(
+                reinterpret_cast<__m512i>(a_indices),
+                0xFF,
+                reinterpret_cast<__m512i>(a_indices),
+                a_pStoredCells,
+                sizeof(DggsPackedCellId))));
+          }
+        }
+      }
+    }
+  }
+}
+
+#include "HierarchicalCellSetSimdKernel.hpp"
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Cell
+    {
+      namespace HierarchicalCellSetSimd
+      {
+        __attribute__((target("avx512f"))) void ContainsAvx512(
+            const DggsPackedCellId * a_pStoredCells,
+            const std::size_t a_noOfStoredCells,
+            const DggsPackedCellId * a_pCells,
+            const std::size_t a_noOfCells,
+            bool * a_pResults)
+        {
+          ContainsCells(a_pStoredCells, a_noOfStoredCells, a_pCells, a_noOfCells, a_pResults);
+        }
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,126 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Cell
+//
+//------------------------------------------------------
+/// @file HierarchicalCellSetSimdKernel.hpp
+/// 
+/// Vector kernel of the hierarchical cell set membership test, shared by the instruction set
+/// specific translation units.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+// This file is included by one translation unit per instruction set, which must first define
+// in the anonymous namespace below:
+//  - Vector, a GCC vector of unsigned 64 bit integers, and VectorMask, the matching vector of
+//    signed 64 bit integers
+//  - EAGGR_SIMD_FUNCTION, the attributes of an inlined function for the instruction set
+//  - Gather(const DggsPackedCellId*, Vector), the stored cell at each index
+// Everything here has internal linkage, so each instruction set gets its own copy.
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Cell
+    {
+      namespace HierarchicalCellSetSimd
+      {
+        namespace
+        {
+          /// Number of cells processed together.
+          const std::size_t LANES = sizeof(Vector) / sizeof(DggsPackedCellId);
+
+          /// @return The smallest packed id of each cell or any of its descendants, found by
+          /// clearing the resolution marker and setting the lowest bit.
+          EAGGR_SIMD_FUNCTION Vector GetRangeMin(const Vector a_cells)
+          {
+            return ((a_cells & (a_cells - 1U)) + 1U);
+          }
+
+          /// @return The largest packed id of each cell or any of its descendants, found by
+          /// setting every bit below the resolution marker.
+          EAGGR_SIMD_FUNCTION Vector GetRangeMax(const Vector a_cells)
+          {
+            return (a_cells | (a_cells - 1U));
+          }
+
+          /// @return A mask with the lanes set for the cells inside a stored cell.
+          EAGGR_SIMD_FUNCTION VectorMask ContainsVector(
+              const DggsPackedCellId * a_pStoredCells,
+              const std::size_t a_noOfStoredCells,
+              const Vector a_cells)
+          {
+            // Find the last stored cell whose range starts at or before each cell. The stored
+            // ranges are disjoint and ascending, so it is the only one that can contain the cell.
+            Vector first = { };
+            for (std::size_t noOfCandidates = a_noOfStoredCells; noOfCandidates > 1U;
+                noOfCandidates -= noOfCandidates / 2U)
+            {
+              const Vector middle = first + static_cast<DggsPackedCellId>(noOfCandidates / 2U);
+              const Vector storedCells = Gather(a_pStoredCells, middle);
+              first = (GetRangeMin(storedCells) <= a_cells) ? middle : first;
+            }
+
+            const Vector storedCells = Gather(a_pStoredCells, first);
+            return ((GetRangeMin(storedCells) <= a_cells) & (a_cells <= GetRangeMax(storedCells)));
+          }
+
+          EAGGR_SIMD_FUNCTION void ContainsCells(
+              const DggsPackedCellId * a_pStoredCells,
+              const std::size_t a_noOfStoredCells,
+              const DggsPackedCellId * a_pCells,
+              const std::size_t a_noOfCells,
+              bool * a_pResults)
+          {
+            for (std::size_t firstCell = 0U; firstCell < a_noOfCells; firstCell += LANES)
+            {
+              const std::size_t noOfLanes = std::min(LANES, a_noOfCells - firstCell);
+
+              // The lanes after the last cell repeat it
+              Vector cells;
+              std::memcpy(&cells, &a_pCells[firstCell], noOfLanes * sizeof(DggsPackedCellId));
+              for (std::size_t lane = noOfLanes; lane < LANES; ++lane)
+              {
+                cells[lane] = cells[noOfLanes - 1U];
+              }
+
+              const VectorMask isContained = ContainsVector(
+                  a_pStoredCells,
+                  a_noOfStoredCells,
+                  cells);
+
+              for (std::size_t lane = 0U; lane < noOfLanes; ++lane)
+              {
+                a_pResults[firstCell + lane] = (isContained[lane] != 0);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
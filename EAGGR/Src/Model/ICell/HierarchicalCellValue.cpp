@@ -0,0 +1,229 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Cell
+//
+//------------------------------------------------------
+/// @file HierarchicalCellValue.cpp
+/// 
+/// Implements the EAGGR::Model::Cell::HierarchicalCellValue class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <sstream>
+
+#include "HierarchicalCellValue.hpp"
+#include "Src/EAGGRException.hpp"
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Cell
+    {
+      HierarchicalCellValue::HierarchicalCellValue()
+          : m_packedCellId(static_cast<DggsPackedCellId>(1U) << (m_FACE_INDEX_SHIFT - 1U))
+      {
+      }
+
+      HierarchicalCellValue::HierarchicalCellValue(
+          const unsigned short a_faceIndex,
+          const unsigned short a_maximumFaceIndex)
+          : m_packedCellId(0U)
+      {
+        // Check face index is valid
+        if (a_faceIndex > a_maximumFaceIndex
+            || a_faceIndex >= (1U << (64U - m_FACE_INDEX_SHIFT)))
+        {
+          std::stringstream stream;
+          stream << "Face index, '" << a_faceIndex << "', exceeds maximum (maximum = "
+              << a_maximumFaceIndex << ")";
+          throw EAGGRException(stream.str());
+        }
+
+        // Face index followed by the resolution marker for resolution 0
+        m_packedCellId = (static_cast<DggsPackedCellId>(a_faceIndex) << m_FACE_INDEX_SHIFT)
+            | (static_cast<DggsPackedCellId>(1U) << (m_FACE_INDEX_SHIFT - 1U));
+      }
+
+      HierarchicalCellValue::HierarchicalCellValue(const DggsPackedCellId a_packedCellId)
+          : m_packedCellId(a_packedCellId)
+      {
+        if (GetFaceIndex() > m_MAXIMUM_FACE_INDEX)
+        {
+          std::stringstream stream;
+          stream << "Invalid packed cell ID, '" << a_packedCellId << "', face index "
+              << GetFaceIndex() << " exceeds maximum (maximum = " << m_MAXIMUM_FACE_INDEX << ")";
+          throw EAGGRException(stream.str());
+        }
+
+        const DggsPackedCellId cellIndexBits = m_packedCellId
+            & ((static_cast<DggsPackedCellId>(1U) << m_FACE_INDEX_SHIFT) - 1U);
+
+        if (cellIndexBits == 0U)
+        {
+          std::stringstream stream;
+          stream << "Invalid packed cell ID, '" << a_packedCellId
+              << "', does not contain a resolution marker";
+          throw EAGGRException(stream.str());
+        }
+
+        if ((GetMarkerPosition() % m_CELL_INDEX_BITS) != 0U)
+        {
+          std::stringstream stream;
+          stream << "Invalid packed cell ID, '" << a_packedCellId
+              << "', resolution marker is misaligned";
+          throw EAGGRException(stream.str());
+        }
+      }
+
+      DggsPackedCellId HierarchicalCellValue::GetPackedCellId() const
+      {
+        return m_packedCellId;
+      }
+
+      unsigned short HierarchicalCellValue::GetFaceIndex() const
+      {
+        return static_cast<unsigned short>(m_packedCellId >> m_FACE_INDEX_SHIFT);
+      }
+
+      unsigned short HierarchicalCellValue::GetResolution() const
+      {
+        return static_cast<unsigned short>((m_FACE_INDEX_SHIFT - 1U - GetMarkerPosition())
+            / m_CELL_INDEX_BITS);
+      }
+
+      unsigned short HierarchicalCellValue::GetCellIndex(const unsigned int a_resolutionLevel) const
+      {
+        if (a_resolutionLevel < 1)
+        {
+          std::stringstream stream;
+          stream << "Minimum resolution allowed is 1 (attempted to use " << a_resolutionLevel
+              << ")";
+          throw EAGGRException(stream.str());
+        }
+
+        if (a_resolutionLevel > GetResolution())
+        {
+          std::stringstream stream;
+          stream << "Maximum resolution allowed is " << GetResolution() << " (attempted to use "
+              << a_resolutionLevel << ")";
+          throw EAGGRException(stream.str());
+        }
+
+        const unsigned int shift = m_FACE_INDEX_SHIFT - (a_resolutionLevel * m_CELL_INDEX_BITS);
+
+        return static_cast<unsigned short>((m_packedCellId >> shift) & m_MAXIMUM_CELL_INDEX);
+      }
+
+      DggsPackedCellId HierarchicalCellValue::GetCellIndexBits() const
+      {
+        // Shift out the face index, then clear the resolution marker
+        const unsigned int faceIndexBits = 64U - m_FACE_INDEX_SHIFT;
+        const DggsPackedCellId marker = static_cast<DggsPackedCellId>(1U)
+            << (GetMarkerPosition() + faceIndexBits);
+
+        return (m_packedCellId << faceIndexBits) & ~marker;
+      }
+
+      HierarchicalCellValue HierarchicalCellValue::GetParent() const
+      {
+        const unsigned int markerPosition = GetMarkerPosition();
+
+        if (markerPosition == m_FACE_INDEX_SHIFT - 1U)
+        {
+          throw EAGGRException("Unable to get the parent of a resolution 0 cell.");
+        }
+
+        // Clear the last cell index and the old marker, then move the marker up one level
+        HierarchicalCellValue parent(*this);
+        const unsigned int parentMarkerPosition = markerPosition + m_CELL_INDEX_BITS;
+        parent.m_packedCellId &= ~((static_cast<DggsPackedCellId>(1U) << parentMarkerPosition)
+            - 1U);
+        parent.m_packedCellId |= static_cast<DggsPackedCellId>(1U) << parentMarkerPosition;
+
+        return parent;
+      }
+
+      HierarchicalCellValue HierarchicalCellValue::GetChild(const unsigned short a_cellIndex) const
+      {
+        if (a_cellIndex > m_MAXIMUM_CELL_INDEX)
+        {
+          std::stringstream stream;
+          stream << "Cell index, '" << a_cellIndex << "', exceeds maximum (maximum = "
+              << m_MAXIMUM_CELL_INDEX << ")";
+          throw EAGGRException(stream.str());
+        }
+
+        const unsigned int markerPosition = GetMarkerPosition();
+
+        if (markerPosition == 0U)
+        {
+          std::stringstream stream;
+          stream << "Unable to create cell at resolution " << (m_MAX_RESOLUTION_LEVEL + 1U)
+              << " as it is greater than the upper limit (" << m_MAX_RESOLUTION_LEVEL << ").";
+          throw EAGGRException(stream.str());
+        }
+
+        // The cell index replaces the old marker and the new marker follows it
+        HierarchicalCellValue child(*this);
+        const unsigned int childMarkerPosition = markerPosition - m_CELL_INDEX_BITS;
+        child.m_packedCellId &= ~(static_cast<DggsPackedCellId>(1U) << markerPosition);
+        child.m_packedCellId |= static_cast<DggsPackedCellId>(a_cellIndex)
+            << (childMarkerPosition + 1U);
+        child.m_packedCellId |= static_cast<DggsPackedCellId>(1U) << childMarkerPosition;
+
+        return child;
+      }
+
+      DggsPackedCellId HierarchicalCellValue::GetRangeMin() const
+      {
+        // The descendants differ from the cell only in the bits below the resolution marker
+        const DggsPackedCellId marker = static_cast<DggsPackedCellId>(1U) << GetMarkerPosition();
+        return m_packedCellId - (marker - 1U);
+      }
+
+      DggsPackedCellId HierarchicalCellValue::GetRangeMax() const
+      {
+        const DggsPackedCellId marker = static_cast<DggsPackedCellId>(1U) << GetMarkerPosition();
+        return m_packedCellId + (marker - 1U);
+      }
+
+      bool HierarchicalCellValue::Contains(const HierarchicalCellValue & a_cell) const
+      {
+        return a_cell.m_packedCellId >= GetRangeMin() && a_cell.m_packedCellId <= GetRangeMax();
+      }
+
+      unsigned int HierarchicalCellValue::GetMarkerPosition() const
+      {
+#if defined(__GNUC__)
+        return static_cast<unsigned int>(__builtin_ctzll(m_packedCellId));
+#else
+        unsigned int markerPosition = 0U;
+        while (((m_packedCellId >> markerPosition) & 1U) == 0U)
+        {
+          ++markerPosition;
+        }
+        return markerPosition;
+#endif
+      }
+    }
+  }
+}
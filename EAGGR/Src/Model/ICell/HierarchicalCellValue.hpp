@@ -0,0 +1,121 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Cell
+//
+//------------------------------------------------------
+/// @file HierarchicalCellValue.hpp
+/// 
+/// Implements the EAGGR::Model::Cell::HierarchicalCellValue class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include "Src/Model/ICell.hpp"
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Cell
+    {
+      /// Trivially copyable representation of a hierarchical cell, stored as its packed cell id.
+      ///
+      /// The face index occupies the top 5 bits, followed by 2 bits per resolution level (most
+      /// significant first). The bit immediately after the last cell index is set to mark the
+      /// resolution and all lower bits are zero. Cells at the same resolution sort in the same
+      /// order as their string ids, and the descendants of a cell occupy a contiguous range of
+      /// packed ids. Values can be stored in caller-provided buffers and none of the methods
+      /// allocate memory.
+      class HierarchicalCellValue
+      {
+        public:
+          /// Default constructor - creates the resolution 0 cell on face 0.
+          HierarchicalCellValue();
+
+          /// Constructor for the resolution 0 cell covering a face.
+          /// @param a_faceIndex The index of the polyhedron face.
+          /// @param a_maximumFaceIndex The maximum allowed face index value.
+          HierarchicalCellValue(
+              const unsigned short a_faceIndex,
+              const unsigned short a_maximumFaceIndex);
+
+          /// Constructor
+          /// @param a_packedCellId The packed cell id.
+          /// @throws EAGGRException If the packed cell id does not contain a valid resolution marker
+          /// or face index.
+          explicit HierarchicalCellValue(const DggsPackedCellId a_packedCellId);
+
+          /// @return The packed cell id.
+          DggsPackedCellId GetPackedCellId() const;
+
+          /// @return The index of the face the cell is located on.
+          unsigned short GetFaceIndex() const;
+
+          /// @return The resolution level of the cell.
+          unsigned short GetResolution() const;
+
+          /// @param a_resolutionLevel Resolution of the required cell index.
+          /// @return Requested cell index.
+          unsigned short GetCellIndex(const unsigned int a_resolutionLevel) const;
+
+          /// @return The cell index of every resolution level, 2 bits each, with the resolution 1
+          /// index in the most significant bits. All bits after the last cell index are clear.
+          DggsPackedCellId GetCellIndexBits() const;
+
+          /// @return The cell in the resolution above that contains this cell.
+          HierarchicalCellValue GetParent() const;
+
+          /// @param a_cellIndex The index of the child within this cell.
+          /// @return The child cell in the resolution below.
+          HierarchicalCellValue GetChild(const unsigned short a_cellIndex) const;
+
+          /// @return The smallest packed cell id of the cell or any of its descendants.
+          DggsPackedCellId GetRangeMin() const;
+
+          /// @return The largest packed cell id of the cell or any of its descendants.
+          DggsPackedCellId GetRangeMax() const;
+
+          /// @param a_cell The cell to test.
+          /// @return True if a_cell is this cell or one of its descendants.
+          bool Contains(const HierarchicalCellValue & a_cell) const;
+
+          /// The highest resolution that can be represented in a packed cell id.
+          static const unsigned short m_MAX_RESOLUTION_LEVEL = 29U;
+
+          /// The highest cell index that can be represented in a packed cell id.
+          static const unsigned short m_MAXIMUM_CELL_INDEX = 3U;
+
+          /// The highest face index of a packed cell id (the last face of the icosahedron).
+          static const unsigned short m_MAXIMUM_FACE_INDEX = 19U;
+
+        private:
+          /// @return The bit position of the resolution marker.
+          unsigned int GetMarkerPosition() const;
+
+          DggsPackedCellId m_packedCellId;
+
+          static const unsigned int m_FACE_INDEX_SHIFT = 59U;
+          static const unsigned int m_CELL_INDEX_BITS = 2U;
+      };
+    }
+  }
+}
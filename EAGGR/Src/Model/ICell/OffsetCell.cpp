@@ -142,6 +142,52 @@ namespace EAGGR
         }
       }
 
+      OffsetCell::OffsetCell(
+          const DggsPackedCellId a_packedCellId,
+          const unsigned short a_maximumFaceIndex)
+          :
+              m_faceIndex(0U), // Set to default values
+              m_resolution(0U),
+              m_rowCoordinate(0L),
+              m_columnCoordinate(0L),
+              m_orientation(Grid::STANDARD),
+              m_cellLocation(UNKNOWN)
+      {
+        // The most significant bit is reserved and must be clear
+        if ((a_packedCellId >> (m_PACKED_FACE_INDEX_SHIFT + m_PACKED_FACE_INDEX_BITS)) != 0U)
+        {
+          std::stringstream errorStream;
+          errorStream << "Invalid packed cell ID, '" << a_packedCellId
+              << "', reserved bit is set";
+          throw EAGGRException(errorStream.str());
+        }
+
+        m_faceIndex = static_cast<unsigned short>(a_packedCellId >> m_PACKED_FACE_INDEX_SHIFT);
+        if (m_faceIndex > a_maximumFaceIndex)
+        {
+          std::stringstream errorStream;
+          errorStream << "Face index, '" << m_faceIndex << "', exceeds maximum (maximum = "
+              << a_maximumFaceIndex << ")";
+          throw EAGGRException(errorStream.str());
+        }
+
+        m_resolution = static_cast<unsigned short>((a_packedCellId >> m_PACKED_RESOLUTION_SHIFT)
+            & ((1U << m_PACKED_RESOLUTION_BITS) - 1U));
+        if (m_resolution > m_MAX_RESOLUTION_LEVEL)
+        {
+          std::stringstream stream;
+          stream << "Resolution " << m_resolution << ", exceeds upper limit (limit = "
+              << m_MAX_RESOLUTION_LEVEL << ").";
+          throw EAGGRException(stream.str());
+        }
+
+        const DggsPackedCellId coordinateMask = (static_cast<DggsPackedCellId>(1U)
+            << m_PACKED_COORDINATE_BITS) - 1U;
+
+        m_rowCoordinate = ZigZagDecode((a_packedCellId >> m_PACKED_ROW_SHIFT) & coordinateMask);
+        m_columnCoordinate = ZigZagDecode(a_packedCellId & coordinateMask);
+      }
+
       DggsCellId OffsetCell::GetCellId() const
       {
         std::stringstream cellId;
@@ -164,6 +210,28 @@ namespace EAGGR
         return cellId.str();
       }
 
+      DggsPackedCellId OffsetCell::GetPackedCellId() const
+      {
+        const DggsPackedCellId coordinateMask = (static_cast<DggsPackedCellId>(1U)
+            << m_PACKED_COORDINATE_BITS) - 1U;
+
+        const DggsPackedCellId row = ZigZagEncode(m_rowCoordinate);
+        const DggsPackedCellId column = ZigZagEncode(m_columnCoordinate);
+
+        if (row > coordinateMask || column > coordinateMask)
+        {
+          std::stringstream stream;
+          stream << "Unable to pack cell with offset coordinates (" << m_rowCoordinate
+              << m_SEPARATOR << m_columnCoordinate << ") as they exceed " << m_PACKED_COORDINATE_BITS
+              << " bits.";
+          throw EAGGRException(stream.str());
+        }
+
+        return (static_cast<DggsPackedCellId>(m_faceIndex) << m_PACKED_FACE_INDEX_SHIFT)
+            | (static_cast<DggsPackedCellId>(m_resolution) << m_PACKED_RESOLUTION_SHIFT)
+            | (row << m_PACKED_ROW_SHIFT) | column;
+      }
+
       unsigned short OffsetCell::GetFaceIndex() const
       {
         return m_faceIndex;
@@ -194,6 +262,20 @@ namespace EAGGR
         m_orientation = a_orientation;
       }
 
+      DggsPackedCellId OffsetCell::ZigZagEncode(const long a_coordinate)
+      {
+        // Interleave positive and negative values so small magnitudes use the fewest bits
+        const std::int64_t coordinate = a_coordinate;
+        return (static_cast<DggsPackedCellId>(coordinate) << 1U)
+            ^ static_cast<DggsPackedCellId>(coordinate >> 63);
+      }
+
+      long OffsetCell::ZigZagDecode(const DggsPackedCellId a_value)
+      {
+        return static_cast<long>(static_cast<std::int64_t>(a_value >> 1U)
+            ^ -static_cast<std::int64_t>(a_value & 1U));
+      }
+
       CellLocation OffsetCell::GetCellLocation() const
       {
         return m_cellLocation;
@@ -38,6 +38,11 @@ namespace EAGGR
     namespace Cell
     {
       /// Represents a DGGS cell that is identified by a row and column coordinate at each resolution
+      ///
+      /// The packed form of the cell id leaves the most significant bit clear (so the value also
+      /// fits in a signed 64-bit integer) and then stores the face index in 5 bits, the resolution
+      /// in 6 bits and the zig-zag encoded row and column coordinates in 26 bits each. Cells with
+      /// coordinates that do not fit (beyond approximately resolution 32) cannot be packed.
       class OffsetCell: virtual public ICell
       {
         public:
@@ -63,8 +68,16 @@ namespace EAGGR
           /// @throws DGGSException If the input string is not a valid cell ID.
           OffsetCell(const DggsCellId& a_cellId, const unsigned short a_maximumFaceIndex);
 
+          /// Constructor
+          /// @param a_packedCellId The packed cell id representing the cell data.
+          /// @param a_maximumFaceIndex The maximum face index value the cell can have.
+          /// @throws DGGSException If the input value is not a valid packed cell ID.
+          OffsetCell(const DggsPackedCellId a_packedCellId, const unsigned short a_maximumFaceIndex);
+
           virtual DggsCellId GetCellId() const;
 
+          virtual DggsPackedCellId GetPackedCellId() const;
+
           virtual unsigned short GetFaceIndex() const;
           virtual unsigned short GetResolution() const;
 
@@ -79,11 +92,26 @@ namespace EAGGR
 
         private:
 
+          /// @param a_coordinate Signed offset coordinate.
+          /// @return The coordinate mapped onto an unsigned value using zig-zag encoding.
+          static DggsPackedCellId ZigZagEncode(const long a_coordinate);
+
+          /// @param a_value Zig-zag encoded coordinate.
+          /// @return The signed offset coordinate.
+          static long ZigZagDecode(const DggsPackedCellId a_value);
+
           static const short m_FACE_INDEX_LENGTH = 2;
           static const short m_RESOLUTION_LENGTH = 2;
 
           static const char m_SEPARATOR = ',';
 
+          static const unsigned int m_PACKED_FACE_INDEX_SHIFT = 58U;
+          static const unsigned int m_PACKED_RESOLUTION_SHIFT = 52U;
+          static const unsigned int m_PACKED_ROW_SHIFT = 26U;
+          static const unsigned int m_PACKED_FACE_INDEX_BITS = 5U;
+          static const unsigned int m_PACKED_RESOLUTION_BITS = 6U;
+          static const unsigned int m_PACKED_COORDINATE_BITS = 26U;
+
           unsigned short m_faceIndex;
           unsigned short m_resolution;
           long m_rowCoordinate;
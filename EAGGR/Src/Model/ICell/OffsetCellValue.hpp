@@ -0,0 +1,52 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Cell
+//
+//------------------------------------------------------
+/// @file OffsetCellValue.hpp
+/// 
+/// Implements the EAGGR::Model::Cell::OffsetCellValue structure.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include "Src/Model/ICell.hpp"
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Cell
+    {
+      /// Trivially copyable representation of an offset cell. Values can be stored in
+      /// caller-provided buffers without any heap allocation.
+      struct OffsetCellValue
+      {
+          unsigned short m_faceIndex;
+          unsigned short m_resolution;
+          long m_rowId;
+          long m_columnId;
+          CellLocation m_cellLocation;
+      };
+    }
+  }
+}
@@ -34,6 +34,7 @@
 #include "Src/Model/IGrid.hpp"
 #include "Src/Model/IGrid/CellPartition.hpp"
 #include "Src/Model/ICell/HierarchicalCell.hpp"
+#include "Src/Model/ICell/HierarchicalCellValue.hpp"
 
 namespace EAGGR
 {
@@ -64,6 +65,18 @@ namespace EAGGR
               const FaceCoordinate a_locationOnFace,
               CellPartition* a_pSubCellPartition) const = 0;
 
+          /// Finds the partition index at every resolution level of the cell containing the
+          /// supplied point, descending from the whole face to the requested resolution.
+          /// @param a_locationOnFace The location of the point on the polyhedron face.
+          /// @param a_resolution The resolution level of the cell to find.
+          /// @param a_pCellIndices Output array, of at least a_resolution elements, for the cell
+          /// index at each resolution level (coarsest first).
+          virtual void
+          GetCellIndices(
+              const FaceCoordinate a_locationOnFace,
+              const unsigned short a_resolution,
+              unsigned short* a_pCellIndices) const = 0;
+
           /// Finds the offset of the supplied cell from the centre of the polyhedron face
           /// @param a_cell The cell to get the location on the face for.
           /// @param a_xOffset Output variable for the x offset of the cell as a fraction of the whole face.
@@ -74,11 +87,72 @@ namespace EAGGR
               double &a_xOffset,
               double &a_yOffset) const = 0;
 
+          /// Finds the offset of the supplied cell value from the centre of the polyhedron face
+          /// @param a_cell The cell to get the location on the face for.
+          /// @param a_xOffset Output variable for the x offset of the cell as a fraction of the whole face.
+          /// @param a_yOffset Output variable for the y offset of the cell as a fraction of the whole face.
+          virtual void
+          GetFaceOffset(
+              const Cell::HierarchicalCellValue a_cell,
+              double &a_xOffset,
+              double &a_yOffset) const = 0;
+
           /// Gets the orientation of the supplied cell.
           /// @param a_cell The cell to get the orientation for.
           /// @return The orientation of the cell.
           virtual Grid::ShapeOrientation GetOrientation(
               const Cell::HierarchicalCell & a_cell) const = 0;
+
+          /// Gets the orientation of the supplied cell value.
+          /// @param a_cell The cell to get the orientation for.
+          /// @return The orientation of the cell.
+          virtual Grid::ShapeOrientation GetOrientation(
+              const Cell::HierarchicalCellValue a_cell) const = 0;
+
+          /// Finds the offset from the centre of the polyhedron face and the orientation of the
+          /// supplied cell value in a single pass over its cell indices.
+          /// @param a_cell The cell to get the location on the face and orientation for.
+          /// @param a_xOffset Output variable for the x offset of the cell as a fraction of the whole face.
+          /// @param a_yOffset Output variable for the y offset of the cell as a fraction of the whole face.
+          /// @param a_orientation Output variable for the orientation of the cell.
+          virtual void GetFaceOffsetAndOrientation(
+              const Cell::HierarchicalCellValue a_cell,
+              double &a_xOffset,
+              double &a_yOffset,
+              Grid::ShapeOrientation &a_orientation) const = 0;
+
+          /// Finds the vertices of the supplied cell value.
+          /// @param a_cell The cell to get the vertices for.
+          /// @param a_pXOffsets Output array, of at least m_MAX_NUM_VERTICES elements, for the x
+          /// offset of each vertex as a fraction of the whole face.
+          /// @param a_pYOffsets Output array, of at least m_MAX_NUM_VERTICES elements, for the y
+          /// offset of each vertex as a fraction of the whole face.
+          /// @return The number of vertices written to the output arrays.
+          virtual unsigned short GetVertexOffsets(
+              const Cell::HierarchicalCellValue a_cell,
+              double* a_pXOffsets,
+              double* a_pYOffsets) const = 0;
+
+          /// Finds the centres of the cells that share an edge or a vertex with the supplied cell,
+          /// treating the face grid as if it continued beyond the face edges. Centres beyond the
+          /// face edges belong to cells on a neighbouring face.
+          /// @param a_cell The cell to get the neighbours for.
+          /// @param a_pXOffsets Output array, of at least m_MAX_NUM_NEIGHBOURS elements, for the x
+          /// offset of each neighbour centre as a fraction of the whole face.
+          /// @param a_pYOffsets Output array, of at least m_MAX_NUM_NEIGHBOURS elements, for the y
+          /// offset of each neighbour centre as a fraction of the whole face.
+          /// @return The number of neighbour centres written to the output arrays, edge neighbours
+          /// first.
+          virtual unsigned short GetNeighbourOffsets(
+              const Cell::HierarchicalCell & a_cell,
+              double* a_pXOffsets,
+              double* a_pYOffsets) const = 0;
+
+          /// The maximum number of vertices of a cell in any hierarchical grid.
+          static const unsigned short m_MAX_NUM_VERTICES = 3U;
+
+          /// The maximum number of neighbours of a cell in any hierarchical grid.
+          static const unsigned short m_MAX_NUM_NEIGHBOURS = 12U;
       };
     }
   }
@@ -27,6 +27,8 @@
 /// or can be found at <http://www.gnu.org/licenses/>.
 //------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 #include <string>
 #include <sstream>
@@ -43,6 +45,27 @@ namespace EAGGR
     {
       namespace HierarchicalGrid
       {
+        Aperture4TriangleGrid::Aperture4TriangleGrid()
+        {
+          // Precompute the offset and orientation change for every group of cell indices
+          const unsigned int groupBits = m_CELL_INDICES_PER_GROUP * 2U;
+          for (unsigned short group = 0U; group < m_NO_OF_CELL_INDEX_GROUPS; ++group)
+          {
+            std::int64_t xLattice = 0;
+            std::int64_t yLattice = 0;
+            short orientation = 1;
+
+            for (unsigned int indexBit = groupBits; indexBit > 0U; indexBit -= 2U)
+            {
+              MoveToChildLattice((group >> (indexBit - 2U)) & 3U, xLattice, yLattice, orientation);
+            }
+
+            m_cellIndexGroups[group].m_xOffset = static_cast<short>(xLattice);
+            m_cellIndexGroups[group].m_yOffset = static_cast<short>(yLattice);
+            m_cellIndexGroups[group].m_isRotated = (orientation == -1);
+          }
+        }
+
         unsigned short Aperture4TriangleGrid::GetResolutionFromAccuracy(
             const double a_accuracy) const
         {
@@ -113,31 +136,31 @@ namespace EAGGR
           }
 
           // Calculate the centre of sub-triangles
-          std::vector < CartesianPoint > subTriangleCentres;
-
           CartesianPoint shapeCentre = a_cellPartition.GetPartitionCentre();
 
           // Middle triangle (same as parent)
           const CartesianPoint middleTriangleCentre(shapeCentre.GetX(), shapeCentre.GetY());
-          subTriangleCentres.push_back(middleTriangleCentre);
 
           // Top triangle
           const CartesianPoint topTriangleCentre(
               shapeCentre.GetX(),
               shapeCentre.GetY() + (shapeOrientation * triangleHeight / 3.0));
-          subTriangleCentres.push_back(topTriangleCentre);
 
           // Left triangle
           const CartesianPoint leftTriangleCentre(
               shapeCentre.GetX() - (0.25 * triangleWidth),
               shapeCentre.GetY() - (shapeOrientation * triangleHeight / 6.0));
-          subTriangleCentres.push_back(leftTriangleCentre);
 
           // Right triangle
           const CartesianPoint rightTriangleCentre(
               shapeCentre.GetX() + (0.25 * triangleWidth),
               shapeCentre.GetY() - (shapeOrientation * triangleHeight / 6.0));
-          subTriangleCentres.push_back(rightTriangleCentre);
+
+          // Held in a fixed size array (in partition index order) to avoid heap allocation
+          const CartesianPoint subTriangleCentres[] =
+          { middleTriangleCentre, topTriangleCentre, leftTriangleCentre, rightTriangleCentre };
+          const unsigned short noOfSubTriangles = sizeof(subTriangleCentres)
+              / sizeof(subTriangleCentres[0]);
 
           // Create a Cartesian point from the face coordinate (used for distance calculations)
           const CartesianPoint location(
@@ -147,8 +170,7 @@ namespace EAGGR
           // Find the closest sub-triangle centre
           unsigned short closestSubTriangle = 0U;
           double distanceToClosestCentre = HUGE_VAL;
-          for (std::vector<CartesianPoint>::size_type triangleIndex = 0;
-              triangleIndex != subTriangleCentres.size(); triangleIndex++)
+          for (unsigned short triangleIndex = 0U; triangleIndex < noOfSubTriangles; triangleIndex++)
           {
             const double distance = subTriangleCentres[triangleIndex].GetDistanceToPoint(location);
             if (distance < distanceToClosestCentre)
@@ -183,11 +205,90 @@ namespace EAGGR
           }
         }
 
+        void Aperture4TriangleGrid::GetCellIndices(
+            const FaceCoordinate a_locationOnFace,
+            const unsigned short a_resolution,
+            unsigned short* a_pCellIndices) const
+        {
+          const std::int64_t unit = m_LATTICE_UNIT;
+          const std::int64_t half = unit / 2;
+
+          // Transform the point once into the lattice frame of the face triangle, i.e. its
+          // distance from the edge opposite each vertex as a fixed point fraction of the triangle
+          // height (top vertex, then left, then right). These always sum to one unit.
+          const double topFraction = a_locationOnFace.GetYOffset() / m_HEIGHT_TO_EDGE_RATIO
+              + (1.0 / 3.0);
+          const double baseFraction = 0.5 * (1.0 - topFraction);
+
+          // Indexed by cell index, index 0 (the middle triangle) is unused
+          std::int64_t lattice[] =
+          {
+              0,
+              std::llround(topFraction * unit),
+              std::llround((baseFraction - a_locationOnFace.GetXOffset()) * unit),
+              std::llround((baseFraction + a_locationOnFace.GetXOffset()) * unit) };
+
+          // Points just outside the face are moved onto its edge
+          for (unsigned short vertex = 1U; vertex <= 3U; ++vertex)
+          {
+            if (lattice[vertex] < 0)
+            {
+              lattice[vertex] = 0;
+            }
+            else if (lattice[vertex] > unit)
+            {
+              lattice[vertex] = unit;
+            }
+          }
+
+          for (unsigned short resolutionLevel = 0U; resolutionLevel < a_resolution;
+              ++resolutionLevel)
+          {
+            // A point more than half way towards a vertex lies in the corner triangle at that
+            // vertex, otherwise it lies in the middle triangle. Points on the boundary belong to
+            // the middle triangle, matching the lowest index preference of GetFacePartition.
+            unsigned short cellIndex = 0U;
+            for (unsigned short vertex = 1U; vertex <= 3U; ++vertex)
+            {
+              if (lattice[vertex] > half && lattice[vertex] > lattice[cellIndex])
+              {
+                cellIndex = vertex;
+              }
+            }
+
+            a_pCellIndices[resolutionLevel] = cellIndex;
+
+            // Rescale the lattice coordinates to the frame of the sub-triangle
+            if (cellIndex == 0U)
+            {
+              // The middle triangle is upside-down so its left and right vertices swap over
+              const std::int64_t left = lattice[2];
+              lattice[1] = unit - 2 * lattice[1];
+              lattice[2] = unit - 2 * lattice[3];
+              lattice[3] = unit - 2 * left;
+            }
+            else
+            {
+              for (unsigned short vertex = 1U; vertex <= 3U; ++vertex)
+              {
+                lattice[vertex] = (vertex == cellIndex) ? 2 * lattice[vertex] - unit
+                    : std::min(2 * lattice[vertex], unit);
+              }
+            }
+          }
+        }
+
         void Aperture4TriangleGrid::GetFaceOffset(
             const Cell::HierarchicalCell & a_cell,
             double &a_xOffset,
             double &a_yOffset) const
         {
+          if (a_cell.GetResolution() <= Cell::HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL)
+          {
+            GetFaceOffset(a_cell.GetCellValue(), a_xOffset, a_yOffset);
+            return;
+          }
+
           double xOffset = 0.0;
           double yOffset = 0.0;
 
@@ -201,34 +302,13 @@ namespace EAGGR
           for (unsigned short resolutionLevel = 0; resolutionLevel < a_cell.GetResolution();
               ++resolutionLevel)
           {
-            const unsigned short cellIndex = a_cell.GetCellIndex(resolutionLevel + 1);
-            switch (cellIndex)
-            {
-              case 0:
-                // Child cell centre is the same as the parent but orientation changes
-                orientation *= -1;
-                break;
-              case 1:
-                // Child X coordinate is the same as the parent; y coordinate is offset by 1/3 * triangle height
-                yOffset += orientation * triangleHeight / 3.0;
-                break;
-              case 2:
-                // Child X coordinate is a quarter of the triangle width to the left
-                // Child Y coordinate is 1/6 of the triangle height below the parent
-                xOffset -= triangleWidth / 4.0;
-                yOffset -= orientation * triangleHeight / 6.0;
-                break;
-              case 3:
-                // Child X coordinate is a quarter of the triangle width to the right
-                // Child Y coordinate is 1/6 of the triangle height below the parent
-                xOffset += triangleWidth / 4.0;
-                yOffset -= orientation * triangleHeight / 6.0;
-                break;
-              default:
-                std::stringstream stream;
-                stream << "Invalid partition index " << cellIndex;
-                throw EAGGRException(stream.str());
-            }
+            MoveToChildCentre(
+                a_cell.GetCellIndex(resolutionLevel + 1),
+                triangleWidth,
+                triangleHeight,
+                orientation,
+                xOffset,
+                yOffset);
 
             // Width and height scale by 2 on each resolution level
             triangleWidth /= 2.0;
@@ -239,6 +319,15 @@ namespace EAGGR
           a_yOffset = yOffset;
         }
 
+        void Aperture4TriangleGrid::GetFaceOffset(
+            const Cell::HierarchicalCellValue a_cell,
+            double &a_xOffset,
+            double &a_yOffset) const
+        {
+          ShapeOrientation orientation;
+          GetFaceOffsetAndOrientation(a_cell, a_xOffset, a_yOffset, orientation);
+        }
+
         unsigned short Aperture4TriangleGrid::GetNumChildren() const
         {
           // All cells have four children in this grid
@@ -270,6 +359,28 @@ namespace EAGGR
                 "Cell in Aperture4TriangleGrid GetCellVertices is not a hierarchical cell.");
           }
 
+          if (a_cell.GetResolution() <= Cell::HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL)
+          {
+            double xOffsets[m_MAX_NUM_VERTICES];
+            double yOffsets[m_MAX_NUM_VERTICES];
+            const unsigned short noOfVertices = GetVertexOffsets(
+                cell->GetCellValue(),
+                xOffsets,
+                yOffsets);
+
+            const double accuracy = GetAccuracyFromResolution(a_cell.GetResolution());
+            for (unsigned short vertex = 0U; vertex < noOfVertices; ++vertex)
+            {
+              a_cellVertices.push_back(
+                  FaceCoordinate(
+                      a_cell.GetFaceIndex(),
+                      xOffsets[vertex],
+                      yOffsets[vertex],
+                      accuracy));
+            }
+            return;
+          }
+
           double xOffset;
           double yOffset;
 
@@ -337,6 +448,11 @@ namespace EAGGR
         ShapeOrientation Aperture4TriangleGrid::GetOrientation(
             const Cell::HierarchicalCell & a_cell) const
         {
+          if (a_cell.GetResolution() <= Cell::HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL)
+          {
+            return GetOrientation(a_cell.GetCellValue());
+          }
+
           ShapeOrientation orientation = STANDARD;
 
           for (unsigned short resolutionLevel = 0; resolutionLevel < a_cell.GetResolution();
@@ -376,6 +492,202 @@ namespace EAGGR
 
           return orientation;
         }
+
+        ShapeOrientation Aperture4TriangleGrid::GetOrientation(
+            const Cell::HierarchicalCellValue a_cell) const
+        {
+          double xOffset;
+          double yOffset;
+          ShapeOrientation orientation;
+          GetFaceOffsetAndOrientation(a_cell, xOffset, yOffset, orientation);
+
+          return orientation;
+        }
+
+        void Aperture4TriangleGrid::GetFaceOffsetAndOrientation(
+            const Cell::HierarchicalCellValue a_cell,
+            double &a_xOffset,
+            double &a_yOffset,
+            ShapeOrientation &a_orientation) const
+        {
+          const unsigned short resolution = a_cell.GetResolution();
+          Cell::DggsPackedCellId cellIndexBits = a_cell.GetCellIndexBits();
+
+          // Offsets are accumulated exactly in lattice units (see MoveToChildLattice)
+          std::int64_t xLattice = 0;
+          std::int64_t yLattice = 0;
+
+          // Orientation 1 for standard; -1 for inverted
+          short orientation = 1;
+
+          // Decode whole groups of cell indices with a single table lookup each
+          const unsigned int groupBits = m_CELL_INDICES_PER_GROUP * 2U;
+          const std::int64_t groupScale = static_cast<std::int64_t>(1) << m_CELL_INDICES_PER_GROUP;
+          const unsigned short noOfGroups = resolution / m_CELL_INDICES_PER_GROUP;
+          for (unsigned short groupIndex = 0U; groupIndex < noOfGroups; ++groupIndex)
+          {
+            const CellIndexGroup& group = m_cellIndexGroups[cellIndexBits >> (64U - groupBits)];
+            cellIndexBits <<= groupBits;
+
+            xLattice = xLattice * groupScale + group.m_xOffset;
+            yLattice = yLattice * groupScale + orientation * group.m_yOffset;
+
+            if (group.m_isRotated)
+            {
+              orientation = -orientation;
+            }
+          }
+
+          // Decode any remaining cell indices one at a time
+          for (unsigned short resolutionLevel = noOfGroups * m_CELL_INDICES_PER_GROUP;
+              resolutionLevel < resolution; ++resolutionLevel)
+          {
+            MoveToChildLattice(cellIndexBits >> 62U, xLattice, yLattice, orientation);
+            cellIndexBits <<= 2U;
+          }
+
+          a_xOffset = ldexp(static_cast<double>(xLattice), -(resolution + 1));
+          a_yOffset = ldexp(static_cast<double>(yLattice) * m_HEIGHT_TO_EDGE_RATIO / 3.0,
+              -resolution);
+          a_orientation = (orientation == 1) ? STANDARD : ROTATED;
+        }
+
+        unsigned short Aperture4TriangleGrid::GetVertexOffsets(
+            const Cell::HierarchicalCellValue a_cell,
+            double* a_pXOffsets,
+            double* a_pYOffsets) const
+        {
+          double xOffset;
+          double yOffset;
+          ShapeOrientation shapeOrientation;
+          GetFaceOffsetAndOrientation(a_cell, xOffset, yOffset, shapeOrientation);
+
+          const double orientation = (shapeOrientation == STANDARD) ? 1.0 : -1.0;
+
+          // Calculate the width and height of the triangle at the correct resolution
+          const double triangleWidth = ldexp(1.0, -a_cell.GetResolution());
+          const double triangleHeight = m_HEIGHT_TO_EDGE_RATIO * triangleWidth;
+
+          // Point of the triangle
+          a_pXOffsets[0] = xOffset;
+          a_pYOffsets[0] = yOffset + (orientation * triangleHeight * 2.0 / 3.0);
+
+          // Left base of the triangle
+          a_pXOffsets[1] = xOffset - (triangleWidth / 2.0);
+          a_pYOffsets[1] = yOffset - (orientation * triangleHeight / 3.0);
+
+          // Right base of the triangle
+          a_pXOffsets[2] = xOffset + (triangleWidth / 2.0);
+          a_pYOffsets[2] = yOffset - (orientation * triangleHeight / 3.0);
+
+          return 3U;
+        }
+
+        unsigned short Aperture4TriangleGrid::GetNeighbourOffsets(
+            const Cell::HierarchicalCell & a_cell,
+            double* a_pXOffsets,
+            double* a_pYOffsets) const
+        {
+          double xOffset;
+          double yOffset;
+          GetFaceOffset(a_cell, xOffset, yOffset);
+
+          const double orientation = (GetOrientation(a_cell) == STANDARD) ? 1.0 : -1.0;
+
+          // Lattice units of half the triangle width and a third of the triangle height
+          const double xUnit = ldexp(0.5, -a_cell.GetResolution());
+          const double yUnit = orientation * xUnit * m_HEIGHT_TO_EDGE_RATIO * 2.0 / 3.0;
+
+          // Offsets of the neighbour centres in lattice units for a triangle in the standard
+          // orientation. The first three share an edge with the triangle (right, left, then base)
+          // and the rest share the top, left or right vertex.
+          static const short NEIGHBOUR_X[m_MAX_NUM_NEIGHBOURS] =
+          { 1, -1, 0, 1, 0, -1, -2, -2, -1, 2, 2, 1 };
+          static const short NEIGHBOUR_Y[m_MAX_NUM_NEIGHBOURS] =
+          { 1, 1, -2, 3, 4, 3, 0, -2, -3, -2, 0, -3 };
+
+          for (unsigned short neighbour = 0U; neighbour < m_MAX_NUM_NEIGHBOURS; ++neighbour)
+          {
+            a_pXOffsets[neighbour] = xOffset + NEIGHBOUR_X[neighbour] * xUnit;
+            a_pYOffsets[neighbour] = yOffset + NEIGHBOUR_Y[neighbour] * yUnit;
+          }
+
+          return m_MAX_NUM_NEIGHBOURS;
+        }
+
+        void Aperture4TriangleGrid::MoveToChildLattice(
+            const unsigned short a_cellIndex,
+            std::int64_t &a_xLattice,
+            std::int64_t &a_yLattice,
+            short &a_orientation)
+        {
+          // Lattice units halve in size on moving to the child resolution
+          a_xLattice *= 2;
+          a_yLattice *= 2;
+
+          switch (a_cellIndex)
+          {
+            case 0:
+              // Child cell centre is the same as the parent but orientation changes
+              a_orientation *= -1;
+              break;
+            case 1:
+              // Child y coordinate is offset by 1/3 of the parent triangle height
+              a_yLattice += 2 * a_orientation;
+              break;
+            case 2:
+              // Child is a quarter of the parent width to the left and 1/6 of its height below
+              a_xLattice -= 1;
+              a_yLattice -= a_orientation;
+              break;
+            case 3:
+              // Child is a quarter of the parent width to the right and 1/6 of its height below
+              a_xLattice += 1;
+              a_yLattice -= a_orientation;
+              break;
+            default:
+              std::stringstream stream;
+              stream << "Invalid partition index " << a_cellIndex;
+              throw EAGGRException(stream.str());
+          }
+        }
+
+        void Aperture4TriangleGrid::MoveToChildCentre(
+            const unsigned short a_cellIndex,
+            const double a_triangleWidth,
+            const double a_triangleHeight,
+            short &a_orientation,
+            double &a_xOffset,
+            double &a_yOffset) const
+        {
+          switch (a_cellIndex)
+          {
+            case 0:
+              // Child cell centre is the same as the parent but orientation changes
+              a_orientation *= -1;
+              break;
+            case 1:
+              // Child X coordinate is the same as the parent; y coordinate is offset by 1/3 * triangle height
+              a_yOffset += a_orientation * a_triangleHeight / 3.0;
+              break;
+            case 2:
+              // Child X coordinate is a quarter of the triangle width to the left
+              // Child Y coordinate is 1/6 of the triangle height below the parent
+              a_xOffset -= a_triangleWidth / 4.0;
+              a_yOffset -= a_orientation * a_triangleHeight / 6.0;
+              break;
+            case 3:
+              // Child X coordinate is a quarter of the triangle width to the right
+              // Child Y coordinate is 1/6 of the triangle height below the parent
+              a_xOffset += a_triangleWidth / 4.0;
+              a_yOffset -= a_orientation * a_triangleHeight / 6.0;
+              break;
+            default:
+              std::stringstream stream;
+              stream << "Invalid partition index " << a_cellIndex;
+              throw EAGGRException(stream.str());
+          }
+        }
       }
     }
   }
@@ -30,6 +30,7 @@
 //------------------------------------------------------
 
 #include <cmath>
+#include <cstdint>
 
 #include "Src/Model/IGrid/IHierarchicalGrid.hpp"
 
@@ -45,6 +46,9 @@ namespace EAGGR
         class Aperture4TriangleGrid: public IHierarchicalGrid
         {
           public:
+            /// Default constructor - builds the lookup table used to decode cell indices.
+            Aperture4TriangleGrid();
+
             virtual unsigned short
             GetResolutionFromAccuracy(const double a_accuracy) const;
 
@@ -57,12 +61,24 @@ namespace EAGGR
                 const FaceCoordinate a_locationOnFace,
                 CellPartition* a_pSubCellPartition) const;
 
+            virtual void
+            GetCellIndices(
+                const FaceCoordinate a_locationOnFace,
+                const unsigned short a_resolution,
+                unsigned short* a_pCellIndices) const;
+
             virtual void
             GetFaceOffset(
                 const Cell::HierarchicalCell & a_cell,
                 double &a_xOffset,
                 double &a_yOffset) const;
 
+            virtual void
+            GetFaceOffset(
+                const Cell::HierarchicalCellValue a_cell,
+                double &a_xOffset,
+                double &a_yOffset) const;
+
             virtual unsigned short GetNumChildren() const;
 
             virtual unsigned short GetMaximumCellIndex() const;
@@ -75,9 +91,82 @@ namespace EAGGR
 
             virtual ShapeOrientation GetOrientation(const Cell::HierarchicalCell & a_cell) const;
 
+            virtual ShapeOrientation GetOrientation(const Cell::HierarchicalCellValue a_cell) const;
+
+            virtual void GetFaceOffsetAndOrientation(
+                const Cell::HierarchicalCellValue a_cell,
+                double &a_xOffset,
+                double &a_yOffset,
+                ShapeOrientation &a_orientation) const;
+
+            virtual unsigned short GetVertexOffsets(
+                const Cell::HierarchicalCellValue a_cell,
+                double* a_pXOffsets,
+                double* a_pYOffsets) const;
+
+            virtual unsigned short GetNeighbourOffsets(
+                const Cell::HierarchicalCell & a_cell,
+                double* a_pXOffsets,
+                double* a_pYOffsets) const;
+
           private:
+            /// The combined effect of a group of consecutive cell indices on a cell centre, starting
+            /// from a triangle in the standard orientation.
+            struct CellIndexGroup
+            {
+                /// Change in x offset in units of half the width of the last triangle in the group.
+                short m_xOffset;
+                /// Change in y offset in units of a third of the height of the last triangle in the
+                /// group.
+                short m_yOffset;
+                /// True if the group contains an odd number of middle (index 0) triangles.
+                bool m_isRotated;
+            };
+
+            /// Moves the lattice offset of a triangle centre to the centre of one of its children.
+            /// Lattice x offsets are in units of half the triangle width and y offsets in units of a
+            /// third of the triangle height, so both double on moving to the child resolution.
+            /// @param a_cellIndex The index of the child triangle.
+            /// @param a_xLattice The x lattice offset of the parent, updated for the child.
+            /// @param a_yLattice The y lattice offset of the parent, updated for the child.
+            /// @param a_orientation The orientation (1 for standard; -1 for inverted), updated
+            /// for the child.
+            static void MoveToChildLattice(
+                const unsigned short a_cellIndex,
+                std::int64_t &a_xLattice,
+                std::int64_t &a_yLattice,
+                short &a_orientation);
+
+            /// Moves the offset from the centre of a triangle to the centre of one of its children.
+            /// @param a_cellIndex The index of the child triangle.
+            /// @param a_triangleWidth The width of the parent triangle.
+            /// @param a_triangleHeight The height of the parent triangle.
+            /// @param a_orientation The orientation of the parent triangle (1 for standard; -1 for
+            /// inverted), updated to the orientation of the child.
+            /// @param a_xOffset The x offset of the parent, updated to the x offset of the child.
+            /// @param a_yOffset The y offset of the parent, updated to the y offset of the child.
+            void MoveToChildCentre(
+                const unsigned short a_cellIndex,
+                const double a_triangleWidth,
+                const double a_triangleHeight,
+                short &a_orientation,
+                double &a_xOffset,
+                double &a_yOffset) const;
+
             static constexpr double m_APERTURE = 4.0;
 
+            /// Number of cell indices decoded with each lookup of m_cellIndexGroups.
+            static const unsigned short m_CELL_INDICES_PER_GROUP = 4U;
+
+            /// Number of distinct groups of m_CELL_INDICES_PER_GROUP cell indices.
+            static const unsigned short m_NO_OF_CELL_INDEX_GROUPS = 256U;
+
+            CellIndexGroup m_cellIndexGroups[m_NO_OF_CELL_INDEX_GROUPS];
+
+            /// Fixed point representation of one triangle height in the lattice frame used by
+            /// GetCellIndices. Leaves headroom for points lying just outside the triangle.
+            static constexpr std::int64_t m_LATTICE_UNIT = static_cast<std::int64_t>(1) << 60;
+
             static constexpr double m_HEIGHT_TO_EDGE_RATIO = sqrt(3.0) / 2.0;
         };
       }
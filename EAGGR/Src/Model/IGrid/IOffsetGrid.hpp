@@ -89,6 +89,15 @@ namespace EAGGR
               const Cell::OffsetCell & a_cell,
               std::vector<Grid::OffsetCoordinate>& a_parents) const = 0;
 
+          /// Gets the parent cells for the cell without allocating memory.
+          /// @param a_cell The cell to get the parents for.
+          /// @param a_pParents Array that will be populated with the parent cell Ids. Must have space
+          /// for at least m_MAX_NUM_PARENTS coordinates.
+          /// @return The number of parent cells written to the array.
+          virtual unsigned short GetParents(
+              const Cell::OffsetCell & a_cell,
+              Grid::OffsetCoordinate* a_pParents) const = 0;
+
           /// Gets the child cells for the cell defined by the row, column and resolution.
           /// @param a_cell The cell to get the children for.
           /// @param a_children A vector that will be populated with the child cell Ids.
@@ -96,10 +105,40 @@ namespace EAGGR
               const Cell::OffsetCell & a_cell,
               std::vector<Grid::OffsetCoordinate>& a_children) const = 0;
 
+          /// Gets the child cells for the cell without allocating memory.
+          /// @param a_cell The cell to get the children for.
+          /// @param a_pChildren Array that will be populated with the child cell Ids. Must have space
+          /// for at least m_MAX_NUM_CHILDREN coordinates.
+          /// @return The number of child cells written to the array.
+          virtual unsigned short GetChildren(
+              const Cell::OffsetCell & a_cell,
+              Grid::OffsetCoordinate* a_pChildren) const = 0;
+
+          /// Gets the cells on the same face grid that share an edge with the cell. The neighbours
+          /// are not limited to the face, so cells beyond the face edges may be returned.
+          /// @param a_cell The cell to get the neighbours for. Its resolution must be greater than
+          /// zero.
+          /// @param a_pNeighbours Array that will be populated with the neighbouring cell Ids. Must
+          /// have space for at least m_MAX_NUM_NEIGHBOURS coordinates.
+          /// @return The number of neighbouring cells written to the array.
+          /// @throws EAGGRException If the cell is at resolution zero.
+          virtual unsigned short GetNeighbours(
+              const Cell::OffsetCell & a_cell,
+              Grid::OffsetCoordinate* a_pNeighbours) const = 0;
+
           /// Gets the orientation of the supplied cell.
           /// @param a_cell The cell to get the orientation for.
           /// @return The orientation of the cell.
           virtual Grid::ShapeOrientation GetOrientation(const Cell::OffsetCell & a_cell) const = 0;
+
+          /// The maximum number of parents any offset grid cell can have.
+          static const unsigned short m_MAX_NUM_PARENTS = 3U;
+
+          /// The maximum number of children any offset grid cell can have.
+          static const unsigned short m_MAX_NUM_CHILDREN = 7U;
+
+          /// The maximum number of neighbours any offset grid cell can have on its face grid.
+          static const unsigned short m_MAX_NUM_NEIGHBOURS = 6U;
       };
     }
   }
@@ -206,7 +206,17 @@ namespace EAGGR
             const Cell::OffsetCell & a_cell,
             std::vector<Grid::OffsetCoordinate>& a_parents) const
         {
-          a_parents.clear();
+          OffsetCoordinate parents[m_MAX_NUM_PARENTS];
+          const unsigned short noOfParents = GetParents(a_cell, parents);
+
+          a_parents.assign(parents, parents + noOfParents);
+        }
+
+        unsigned short Aperture3HexagonGrid::GetParents(
+            const Cell::OffsetCell & a_cell,
+            Grid::OffsetCoordinate* a_pParents) const
+        {
+          unsigned short noOfParents = 0U;
 
           double faceCoordX;
           double faceCoordY;
@@ -250,7 +260,7 @@ namespace EAGGR
 
           OffsetCoordinate parent =
           { firstParentRow, firstParentColumn };
-          a_parents.push_back(parent);
+          a_pParents[noOfParents++] = parent;
 
           // Find the second parent
           long row;
@@ -270,7 +280,7 @@ namespace EAGGR
           {
             parent =
             { row, column};
-            a_parents.push_back(parent);
+            a_pParents[noOfParents++] = parent;
 
             // Find the third parent
             GetRowAndColumn(
@@ -281,8 +291,10 @@ namespace EAGGR
 
             parent =
             { row, column};
-            a_parents.push_back(parent);
+            a_pParents[noOfParents++] = parent;
           }
+
+          return noOfParents;
         }
 
         unsigned short Aperture3HexagonGrid::GetNumChildren() const
@@ -300,7 +312,17 @@ namespace EAGGR
             const Cell::OffsetCell & a_cell,
             std::vector<Grid::OffsetCoordinate>& a_children) const
         {
-          a_children.clear();
+          OffsetCoordinate children[m_MAX_NUM_CHILDREN];
+          const unsigned short noOfChildren = GetChildren(a_cell, children);
+
+          a_children.assign(children, children + noOfChildren);
+        }
+
+        unsigned short Aperture3HexagonGrid::GetChildren(
+            const Cell::OffsetCell & a_cell,
+            Grid::OffsetCoordinate* a_pChildren) const
+        {
+          unsigned short noOfChildren = 0U;
 
           // Orientation of the grid rotates between resolution levels
           const bool horizontalOrientation = IsHorizontalOrientation(a_cell.GetResolution());
@@ -312,20 +334,21 @@ namespace EAGGR
           long baseChildRowId;
           long baseChildColumnId;
 
+          // Parity is taken from the lowest bit so that it is 0 or 1 for negative rows and columns
           if (horizontalOrientation)
           {
-            baseChildRowId = (rowId * 2) + (columnId % 2);
-            baseChildColumnId = ((columnId - (columnId % 2)) * 3 / 2) + (columnId % 2);
+            baseChildRowId = (rowId * 2) + (columnId & 1);
+            baseChildColumnId = ((columnId - (columnId & 1)) * 3 / 2) + (columnId & 1);
           }
           else
           {
-            baseChildRowId = ((rowId - (rowId % 2)) * 3 / 2) + (rowId % 2);
-            baseChildColumnId = (columnId * 2) + (rowId % 2);
+            baseChildRowId = ((rowId - (rowId & 1)) * 3 / 2) + (rowId & 1);
+            baseChildColumnId = (columnId * 2) + (rowId & 1);
           }
 
           OffsetCoordinate child0 =
           { baseChildRowId, baseChildColumnId };
-          a_children.push_back(child0);
+          a_pChildren[noOfChildren++] = child0;
 
           // Add the surrounding cells.  Four are the same no matter what the orientation but two depend on orientation/row or column
           OffsetCoordinate child1 =
@@ -336,10 +359,10 @@ namespace EAGGR
           { baseChildRowId + 1, baseChildColumnId };
           OffsetCoordinate child4 =
           { baseChildRowId, baseChildColumnId - 1 };
-          a_children.push_back(child1);
-          a_children.push_back(child2);
-          a_children.push_back(child3);
-          a_children.push_back(child4);
+          a_pChildren[noOfChildren++] = child1;
+          a_pChildren[noOfChildren++] = child2;
+          a_pChildren[noOfChildren++] = child3;
+          a_pChildren[noOfChildren++] = child4;
 
           if (horizontalOrientation)
           {
@@ -349,8 +372,8 @@ namespace EAGGR
               { baseChildRowId + 1, baseChildColumnId - 1 };
               OffsetCoordinate child6 =
               { baseChildRowId - 1, baseChildColumnId - 1 };
-              a_children.push_back(child5);
-              a_children.push_back(child6);
+              a_pChildren[noOfChildren++] = child5;
+              a_pChildren[noOfChildren++] = child6;
             }
             else
             {
@@ -358,8 +381,8 @@ namespace EAGGR
               { baseChildRowId - 1, baseChildColumnId + 1 };
               OffsetCoordinate child6 =
               { baseChildRowId + 1, baseChildColumnId + 1 };
-              a_children.push_back(child5);
-              a_children.push_back(child6);
+              a_pChildren[noOfChildren++] = child5;
+              a_pChildren[noOfChildren++] = child6;
             }
           }
           else
@@ -370,8 +393,8 @@ namespace EAGGR
               { baseChildRowId - 1, baseChildColumnId + 1 };
               OffsetCoordinate child6 =
               { baseChildRowId - 1, baseChildColumnId - 1 };
-              a_children.push_back(child5);
-              a_children.push_back(child6);
+              a_pChildren[noOfChildren++] = child5;
+              a_pChildren[noOfChildren++] = child6;
             }
             else
             {
@@ -379,10 +402,75 @@ namespace EAGGR
               { baseChildRowId + 1, baseChildColumnId + 1 };
               OffsetCoordinate child6 =
               { baseChildRowId + 1, baseChildColumnId - 1 };
-              a_children.push_back(child5);
-              a_children.push_back(child6);
+              a_pChildren[noOfChildren++] = child5;
+              a_pChildren[noOfChildren++] = child6;
             }
           }
+
+          return noOfChildren;
+        }
+
+        unsigned short Aperture3HexagonGrid::GetNeighbours(
+            const Cell::OffsetCell & a_cell,
+            Grid::OffsetCoordinate* a_pNeighbours) const
+        {
+          const unsigned short resolution = a_cell.GetResolution();
+
+          if (resolution == 0U)
+          {
+            throw EAGGRException("Resolution 0 cells cover a whole face and are not hexagons.");
+          }
+
+          // Equations are based on:
+          // http://www.redblobgames.com/grids/hexagons/#neighbors-cube
+
+          // Orientation of the grid rotates between resolution levels
+          const bool isPointyTopGrid = ((resolution & 1U) == 0U);
+
+          const long rowId = a_cell.GetRow();
+          const long columnId = a_cell.GetColumn();
+
+          // Convert the offset coordinates to cube coordinates (the y coordinate is not needed)
+          long cubeX;
+          long cubeZ;
+          if (isPointyTopGrid)
+          {
+            // Use odd-r offset coordinate system for "pointy top" grids
+            cubeX = columnId - (rowId - (rowId & 1L)) / 2L;
+            cubeZ = rowId;
+          }
+          else
+          {
+            // Use odd-q offset coordinate system for "flat top" grids
+            cubeX = columnId;
+            cubeZ = rowId - (columnId - (columnId & 1L)) / 2L;
+          }
+
+          // Changes to the cube x and z coordinates in each of the six directions
+          static const long NEIGHBOUR_X[] =
+          { 1L, 1L, 0L, -1L, -1L, 0L };
+          static const long NEIGHBOUR_Z[] =
+          { 0L, -1L, -1L, 0L, 1L, 1L };
+
+          for (unsigned short neighbour = 0U; neighbour < m_MAX_NUM_NEIGHBOURS; ++neighbour)
+          {
+            const long x = cubeX + NEIGHBOUR_X[neighbour];
+            const long z = cubeZ + NEIGHBOUR_Z[neighbour];
+
+            // Convert back to offset coordinates
+            if (isPointyTopGrid)
+            {
+              a_pNeighbours[neighbour].m_rowId = z;
+              a_pNeighbours[neighbour].m_columnId = x + (z - (z & 1L)) / 2L;
+            }
+            else
+            {
+              a_pNeighbours[neighbour].m_rowId = z + (x - (x & 1L)) / 2L;
+              a_pNeighbours[neighbour].m_columnId = x;
+            }
+          }
+
+          return m_MAX_NUM_NEIGHBOURS;
         }
 
         unsigned short Aperture3HexagonGrid::GetAperture() const
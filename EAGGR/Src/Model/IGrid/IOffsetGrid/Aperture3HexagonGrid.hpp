@@ -73,6 +73,10 @@ namespace EAGGR
                 const Cell::OffsetCell & a_cell,
                 std::vector<Grid::OffsetCoordinate>& a_parents) const;
 
+            virtual unsigned short GetParents(
+                const Cell::OffsetCell & a_cell,
+                Grid::OffsetCoordinate* a_pParents) const;
+
             virtual unsigned short GetNumChildren() const;
 
             virtual unsigned short GetMaximumCellIndex() const;
@@ -81,6 +85,14 @@ namespace EAGGR
                 const Cell::OffsetCell & a_cell,
                 std::vector<Grid::OffsetCoordinate>& a_children) const;
 
+            virtual unsigned short GetChildren(
+                const Cell::OffsetCell & a_cell,
+                Grid::OffsetCoordinate* a_pChildren) const;
+
+            virtual unsigned short GetNeighbours(
+                const Cell::OffsetCell & a_cell,
+                Grid::OffsetCoordinate* a_pNeighbours) const;
+
             virtual unsigned short GetAperture() const;
 
             virtual void GetVertices(
@@ -57,6 +57,23 @@ namespace EAGGR
           virtual std::unique_ptr<Cell::ICell> GetCell(
               const FaceCoordinate a_faceCoordinate) const = 0;
 
+          /// Gets the cell at the location specified by the coordinate at the specified resolution,
+          /// ignoring the accuracy of the coordinate
+          /// @param a_faceCoordinate The location to find the cell at
+          /// @param a_resolution The resolution of the cell
+          /// @return The cell object represention the specified location
+          virtual std::unique_ptr<Cell::ICell> GetCellAtResolution(
+              const FaceCoordinate a_faceCoordinate,
+              const unsigned short a_resolution) const = 0;
+
+          /// Gets the cells at the location specified by the coordinate at every resolution, from
+          /// the whole face down to the resolution given by the accuracy of the coordinate.
+          /// @param a_faceCoordinate The location to find the cells at
+          /// @param a_cells A vector that will be populated with the cells (coarsest first)
+          virtual void GetCellsAtAllResolutions(
+              const FaceCoordinate a_faceCoordinate,
+              std::vector<std::unique_ptr<Cell::ICell> >& a_cells) const = 0;
+
           /// Gets the coordinate on the polyhedron face represented by the specified cell
           /// @param a_cell The cell to get the location for
           /// @return The coordinate on the face representing the cell
@@ -68,6 +85,12 @@ namespace EAGGR
           virtual std::unique_ptr<Cell::ICell> CreateCell(
               const Cell::DggsCellId& a_cellId) const = 0;
 
+          /// Creates a cell from the packed cell id
+          /// @param a_packedCellId The packed integer representation of the cell
+          /// @return The cell object created from the id
+          virtual std::unique_ptr<Cell::ICell> CreateCell(
+              const Cell::DggsPackedCellId a_packedCellId) const = 0;
+
           /// Gets the parent cells for the specified cell
           /// @param a_cell The cell to get the parents for
           /// @param a_parentCells A vector that will be populated with the parent cells
@@ -88,6 +111,22 @@ namespace EAGGR
           virtual void GetCellVertices(
               const Cell::ICell & a_cell,
               std::list<FaceCoordinate>& a_cellVertices) const = 0;
+
+          /// Gets the centres of the cells that share an edge or a vertex with the supplied cell,
+          /// treating the grid on the cell's face as if it continued beyond the face edges.
+          /// Centres beyond the face edges are those of cells on a neighbouring face, at the same
+          /// place in the plane of the face unfolded about the shared edge.
+          /// @param a_cell The cell to get the neighbours for.
+          /// @param a_neighbourCoordinates A vector that will be populated with the neighbour
+          /// centres, at the accuracy of the cell's resolution.
+          virtual void GetNeighbourCoordinates(
+              const Cell::ICell & a_cell,
+              std::vector<FaceCoordinate>& a_neighbourCoordinates) const = 0;
+
+          /// @return The factor by which the outline of a cell must be scaled about its centre so
+          /// that it encloses all of the cell's descendants, at any resolution. This is one for
+          /// grids whose child cells partition their parent.
+          virtual double GetDescendantExtentFactor() const = 0;
       };
     }
   }
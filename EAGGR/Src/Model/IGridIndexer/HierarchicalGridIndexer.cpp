@@ -34,7 +34,6 @@
 #include "HierarchicalGridIndexer.hpp"
 #include "Src/Model/ICell/HierarchicalCell.hpp"
 #include "Src/Utilities/Maths.hpp"
-#include "Src/Model/IGrid/CellPartition.hpp"
 #include "Src/EAGGRException.hpp"
 
 using namespace EAGGR::Utilities::Maths;
@@ -59,27 +58,18 @@ namespace EAGGR
         const unsigned short resolution = m_pGrid->GetResolutionFromAccuracy(
             a_faceCoordinate.GetAccuracy());
 
-        // Initial parameters
-        unsigned short partitionId = m_pGrid->GetAperture(); // initialise to invalid value
-        Grid::ShapeOrientation partitionOrientation = Grid::STANDARD;
-        CartesianPoint partitionShapeCentre(0.0, 0.0);
-
-        FaceCoordinate coordinateInPartition(
-            a_faceCoordinate.GetFaceIndex(),
-            a_faceCoordinate.GetXOffset(),
-            a_faceCoordinate.GetYOffset(),
-            a_faceCoordinate.GetAccuracy());
-
-        std::vector<unsigned short> cellIndices;
+        return GetCellAtResolution(a_faceCoordinate, resolution);
+      }
 
-        CartesianPoint partitionCentre(0.0, 0.0);
-        Grid::CellPartition partition(partitionId, partitionCentre, partitionOrientation);
-        // Determine the cell index at each resolution level and add to the cell
-        for (unsigned short resolutionLevel = 1; resolutionLevel <= resolution; ++resolutionLevel)
+      std::unique_ptr<Cell::ICell> HierarchicalGridIndexer::GetCellAtResolution(
+          const FaceCoordinate a_faceCoordinate,
+          const unsigned short a_resolution) const
+      {
+        // Determine the cell index at each resolution level
+        std::vector<unsigned short> cellIndices(a_resolution);
+        if (a_resolution > 0U)
         {
-          m_pGrid->GetFacePartition(partition, resolutionLevel, coordinateInPartition, &partition);
-
-          cellIndices.push_back(partition.GetId());
+          m_pGrid->GetCellIndices(a_faceCoordinate, a_resolution, &cellIndices[0]);
         }
 
         // Create a cell object
@@ -92,6 +82,42 @@ namespace EAGGR
         return std::unique_ptr < Cell::ICell > (hierarchicalCell);
       }
 
+      void HierarchicalGridIndexer::GetCellsAtAllResolutions(
+          const FaceCoordinate a_faceCoordinate,
+          std::vector<std::unique_ptr<Cell::ICell> >& a_cells) const
+      {
+        a_cells.clear();
+
+        const unsigned short resolution = m_pGrid->GetResolutionFromAccuracy(
+            a_faceCoordinate.GetAccuracy());
+
+        // Descend to the finest resolution once, the cell at each coarser resolution is
+        // identified by a prefix of its cell indices
+        std::vector<unsigned short> cellIndices(resolution);
+        if (resolution > 0U)
+        {
+          m_pGrid->GetCellIndices(a_faceCoordinate, resolution, &cellIndices[0]);
+        }
+
+        const unsigned short maximumCellIndex = m_pGrid->GetMaximumCellIndex();
+
+        a_cells.reserve(resolution + 1U);
+        for (unsigned short cellResolution = 0U; cellResolution <= resolution; ++cellResolution)
+        {
+          const std::vector<unsigned short> prefix(
+              cellIndices.begin(),
+              cellIndices.begin() + cellResolution);
+
+          a_cells.push_back(
+              std::unique_ptr < Cell::ICell
+                  > (new Cell::HierarchicalCell(
+                      a_faceCoordinate.GetFaceIndex(),
+                      prefix,
+                      m_maximumFaceIndex,
+                      maximumCellIndex)));
+        }
+      }
+
       FaceCoordinate HierarchicalGridIndexer::GetFaceCoordinate(const Cell::ICell & a_cell) const
       {
         try
@@ -132,6 +158,20 @@ namespace EAGGR
         return std::unique_ptr < Cell::ICell > (cell);
       }
 
+      std::unique_ptr<Cell::ICell> HierarchicalGridIndexer::CreateCell(
+          const Cell::DggsPackedCellId a_packedCellId) const
+      {
+        Cell::HierarchicalCell* cell = new Cell::HierarchicalCell(
+            a_packedCellId,
+            m_maximumFaceIndex,
+            m_pGrid->GetMaximumCellIndex());
+
+        Grid::ShapeOrientation orientation = m_pGrid->GetOrientation(*cell);
+        cell->SetOrientation(orientation);
+
+        return std::unique_ptr < Cell::ICell > (cell);
+      }
+
       void HierarchicalGridIndexer::GetParents(
           const Cell::ICell& a_cell,
           std::vector<std::unique_ptr<Cell::ICell> >& a_parentCells) const
@@ -204,6 +244,128 @@ namespace EAGGR
       {
         m_pGrid->GetVertices(a_cell, a_cellVertices);
       }
+
+      void HierarchicalGridIndexer::GetNeighbourCoordinates(
+          const Cell::ICell & a_cell,
+          std::vector<FaceCoordinate>& a_neighbourCoordinates) const
+      {
+        a_neighbourCoordinates.clear();
+
+        const Cell::HierarchicalCell* cell = dynamic_cast<const Cell::HierarchicalCell*>(&a_cell);
+
+        if (cell == NULL)
+        {
+          throw EAGGRException(
+              "Cell in HierarchicalGridIndexer GetNeighbourCoordinates is not a hierarchical "
+              "cell.");
+        }
+
+        double xOffsets[Grid::IHierarchicalGrid::m_MAX_NUM_NEIGHBOURS];
+        double yOffsets[Grid::IHierarchicalGrid::m_MAX_NUM_NEIGHBOURS];
+        const unsigned short noOfNeighbours = m_pGrid->GetNeighbourOffsets(
+            *cell,
+            xOffsets,
+            yOffsets);
+
+        const double accuracy = m_pGrid->GetAccuracyFromResolution(a_cell.GetResolution());
+        for (unsigned short neighbour = 0U; neighbour < noOfNeighbours; ++neighbour)
+        {
+          a_neighbourCoordinates.push_back(
+              FaceCoordinate(
+                  a_cell.GetFaceIndex(),
+                  xOffsets[neighbour],
+                  yOffsets[neighbour],
+                  accuracy));
+        }
+      }
+
+      double HierarchicalGridIndexer::GetDescendantExtentFactor() const
+      {
+        // Child cells partition their parent
+        return 1.0;
+      }
+
+      Cell::HierarchicalCellValue HierarchicalGridIndexer::GetCellValue(
+          const FaceCoordinate a_faceCoordinate) const
+      {
+        // Calculate the resolution
+        const unsigned short resolution = m_pGrid->GetResolutionFromAccuracy(
+            a_faceCoordinate.GetAccuracy());
+
+        if (resolution > Cell::HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL)
+        {
+          std::stringstream stream;
+          stream << "Resolution " << resolution << " exceeds the upper limit for a cell value ("
+              << Cell::HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL << ").";
+          throw EAGGRException(stream.str());
+        }
+
+        Cell::HierarchicalCellValue cell(a_faceCoordinate.GetFaceIndex(), m_maximumFaceIndex);
+
+        unsigned short cellIndices[Cell::HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL];
+        m_pGrid->GetCellIndices(a_faceCoordinate, resolution, cellIndices);
+
+        // Descend to the child at each resolution level
+        for (unsigned short resolutionLevel = 0U; resolutionLevel < resolution; ++resolutionLevel)
+        {
+          cell = cell.GetChild(cellIndices[resolutionLevel]);
+        }
+
+        return cell;
+      }
+
+      void HierarchicalGridIndexer::GetCellValues(
+          const FaceCoordinate* a_pFaceCoordinates,
+          const std::size_t a_noOfCoordinates,
+          Cell::HierarchicalCellValue* a_pCells) const
+      {
+        for (std::size_t coordinateIndex = 0U; coordinateIndex < a_noOfCoordinates;
+            ++coordinateIndex)
+        {
+          a_pCells[coordinateIndex] = GetCellValue(a_pFaceCoordinates[coordinateIndex]);
+        }
+      }
+
+      FaceCoordinate HierarchicalGridIndexer::GetFaceCoordinate(
+          const Cell::HierarchicalCellValue a_cell) const
+      {
+        double xOffset;
+        double yOffset;
+
+        m_pGrid->GetFaceOffset(a_cell, xOffset, yOffset);
+
+        const double accuracy = m_pGrid->GetAccuracyFromResolution(a_cell.GetResolution());
+
+        return FaceCoordinate(a_cell.GetFaceIndex(), xOffset, yOffset, accuracy);
+      }
+
+      unsigned short HierarchicalGridIndexer::GetParents(
+          const Cell::HierarchicalCellValue a_cell,
+          Cell::HierarchicalCellValue* a_pParents) const
+      {
+        // Resolution 0 cells are whole faces and have no parent
+        if (a_cell.GetResolution() == 0U)
+        {
+          return 0U;
+        }
+
+        a_pParents[0] = a_cell.GetParent();
+        return 1U;
+      }
+
+      unsigned short HierarchicalGridIndexer::GetChildren(
+          const Cell::HierarchicalCellValue a_cell,
+          Cell::HierarchicalCellValue* a_pChildren) const
+      {
+        const unsigned short noOfChildren = m_pGrid->GetNumChildren();
+
+        for (unsigned short childIndex = 0U; childIndex < noOfChildren; ++childIndex)
+        {
+          a_pChildren[childIndex] = a_cell.GetChild(childIndex);
+        }
+
+        return noOfChildren;
+      }
     }
   }
 }
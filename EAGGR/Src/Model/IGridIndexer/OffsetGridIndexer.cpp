@@ -53,23 +53,48 @@ namespace EAGGR
         const unsigned short resolution = m_pGrid->GetResolutionFromAccuracy(
             a_faceCoordinate.GetAccuracy());
 
+        return GetCellAtResolution(a_faceCoordinate, resolution);
+      }
+
+      std::unique_ptr<Cell::ICell> OffsetGridIndexer::GetCellAtResolution(
+          const FaceCoordinate a_faceCoordinate,
+          const unsigned short a_resolution) const
+      {
         long rowId;
         long columnId;
 
-        m_pGrid->GetRowAndColumn(resolution, a_faceCoordinate, rowId, columnId);
+        m_pGrid->GetRowAndColumn(a_resolution, a_faceCoordinate, rowId, columnId);
 
         return std::unique_ptr < Cell::ICell
             > (new Cell::OffsetCell(
                 a_faceCoordinate.GetFaceIndex(),
-                resolution,
+                a_resolution,
                 rowId,
                 columnId,
                 m_face.CalculateCellLocation(
                     a_faceCoordinate,
-                    m_pGrid->GetAccuracyFromResolution(resolution)),
+                    m_pGrid->GetAccuracyFromResolution(a_resolution)),
                 m_maximumFaceIndex));
       }
 
+      void OffsetGridIndexer::GetCellsAtAllResolutions(
+          const FaceCoordinate a_faceCoordinate,
+          std::vector<std::unique_ptr<Cell::ICell> >& a_cells) const
+      {
+        a_cells.clear();
+
+        const unsigned short resolution = m_pGrid->GetResolutionFromAccuracy(
+            a_faceCoordinate.GetAccuracy());
+
+        // Hexagons do not nest, so the cell at each resolution is found directly from the
+        // location on the face rather than from the cell at the finer resolution
+        a_cells.reserve(resolution + 1U);
+        for (unsigned short cellResolution = 0U; cellResolution <= resolution; ++cellResolution)
+        {
+          a_cells.push_back(GetCellAtResolution(a_faceCoordinate, cellResolution));
+        }
+      }
+
       FaceCoordinate OffsetGridIndexer::GetFaceCoordinate(const Cell::ICell & a_cell) const
       {
         const Cell::OffsetCell &cell = dynamic_cast<const Cell::OffsetCell&>(a_cell);
@@ -92,6 +117,14 @@ namespace EAGGR
         return std::unique_ptr < Cell::ICell > (new Cell::OffsetCell(a_cellId, m_maximumFaceIndex));
       }
 
+      std::unique_ptr<Cell::ICell> OffsetGridIndexer::CreateCell(
+          const Cell::DggsPackedCellId a_packedCellId) const
+      {
+        Cell::OffsetCell* cell = new Cell::OffsetCell(a_packedCellId, m_maximumFaceIndex);
+
+        return std::unique_ptr < Cell::ICell > (cell);
+      }
+
       void OffsetGridIndexer::GetParents(
           const Cell::ICell& a_cell,
           std::vector<std::unique_ptr<Cell::ICell> >& a_parentCells) const
@@ -148,6 +181,149 @@ namespace EAGGR
       {
         m_pGrid->GetVertices(a_cell, a_cellVertices);
       }
+
+      void OffsetGridIndexer::GetNeighbourCoordinates(
+          const Cell::ICell & a_cell,
+          std::vector<FaceCoordinate>& a_neighbourCoordinates) const
+      {
+        a_neighbourCoordinates.clear();
+
+        const Cell::OffsetCell& offsetCell = dynamic_cast<const Cell::OffsetCell&>(a_cell);
+
+        Grid::OffsetCoordinate neighbours[Grid::IOffsetGrid::m_MAX_NUM_NEIGHBOURS];
+        const unsigned short noOfNeighbours = m_pGrid->GetNeighbours(offsetCell, neighbours);
+
+        const double accuracy = m_pGrid->GetAccuracyFromResolution(a_cell.GetResolution());
+        for (unsigned short neighbour = 0U; neighbour < noOfNeighbours; ++neighbour)
+        {
+          // Only the row and column are needed to find the centre of the neighbour
+          const Cell::OffsetCell neighbourCell(
+              a_cell.GetFaceIndex(),
+              a_cell.GetResolution(),
+              neighbours[neighbour].m_rowId,
+              neighbours[neighbour].m_columnId,
+              offsetCell.GetCellLocation(),
+              m_maximumFaceIndex);
+
+          double xOffset;
+          double yOffset;
+          m_pGrid->GetFaceOffset(neighbourCell, xOffset, yOffset);
+
+          a_neighbourCoordinates.push_back(
+              FaceCoordinate(a_cell.GetFaceIndex(), xOffset, yOffset, accuracy));
+        }
+      }
+
+      double OffsetGridIndexer::GetDescendantExtentFactor() const
+      {
+        // The outer children are centred on the vertices of their parent and the edge length is
+        // divided by sqrt(aperture) at each resolution, so the descendants lie within a circle of
+        // radius r / (1 - 1 / sqrt(aperture)) of the centre of a cell with circumradius r. The
+        // hexagon enclosing that circle is larger by a further factor of 2 / sqrt(3).
+        const double edgeScale = 1.0 / sqrt(static_cast<double>(m_pGrid->GetAperture()));
+        return (2.0 / sqrt(3.0)) / (1.0 - edgeScale);
+      }
+
+      Cell::OffsetCellValue OffsetGridIndexer::GetCellValue(
+          const FaceCoordinate a_faceCoordinate) const
+      {
+        // Calculate the resolution
+        const unsigned short resolution = m_pGrid->GetResolutionFromAccuracy(
+            a_faceCoordinate.GetAccuracy());
+
+        Cell::OffsetCellValue cell;
+        cell.m_faceIndex = a_faceCoordinate.GetFaceIndex();
+        cell.m_resolution = resolution;
+        cell.m_cellLocation = m_face.CalculateCellLocation(
+            a_faceCoordinate,
+            m_pGrid->GetAccuracyFromResolution(resolution));
+
+        m_pGrid->GetRowAndColumn(resolution, a_faceCoordinate, cell.m_rowId, cell.m_columnId);
+
+        // Validates the face index and resolution
+        ToOffsetCell(cell);
+
+        return cell;
+      }
+
+      void OffsetGridIndexer::GetCellValues(
+          const FaceCoordinate* a_pFaceCoordinates,
+          const std::size_t a_noOfCoordinates,
+          Cell::OffsetCellValue* a_pCells) const
+      {
+        for (std::size_t coordinateIndex = 0U; coordinateIndex < a_noOfCoordinates;
+            ++coordinateIndex)
+        {
+          a_pCells[coordinateIndex] = GetCellValue(a_pFaceCoordinates[coordinateIndex]);
+        }
+      }
+
+      FaceCoordinate OffsetGridIndexer::GetFaceCoordinate(const Cell::OffsetCellValue& a_cell) const
+      {
+        double xOffset;
+        double yOffset;
+
+        m_pGrid->GetFaceOffset(ToOffsetCell(a_cell), xOffset, yOffset);
+
+        const double accuracy = m_pGrid->GetAccuracyFromResolution(a_cell.m_resolution);
+
+        return FaceCoordinate(a_cell.m_faceIndex, xOffset, yOffset, accuracy);
+      }
+
+      unsigned short OffsetGridIndexer::GetParents(
+          const Cell::OffsetCellValue& a_cell,
+          Cell::OffsetCellValue* a_pParents) const
+      {
+        // Resolution 0 cells are whole faces and have no parent
+        if (a_cell.m_resolution == 0U)
+        {
+          return 0U;
+        }
+
+        Grid::OffsetCoordinate parents[Grid::IOffsetGrid::m_MAX_NUM_PARENTS];
+        const unsigned short noOfParents = m_pGrid->GetParents(ToOffsetCell(a_cell), parents);
+
+        for (unsigned short parent = 0U; parent < noOfParents; ++parent)
+        {
+          a_pParents[parent].m_faceIndex = a_cell.m_faceIndex;
+          a_pParents[parent].m_resolution = a_cell.m_resolution - 1;
+          a_pParents[parent].m_rowId = parents[parent].m_rowId;
+          a_pParents[parent].m_columnId = parents[parent].m_columnId;
+          a_pParents[parent].m_cellLocation = a_cell.m_cellLocation;
+        }
+
+        return noOfParents;
+      }
+
+      unsigned short OffsetGridIndexer::GetChildren(
+          const Cell::OffsetCellValue& a_cell,
+          Cell::OffsetCellValue* a_pChildren) const
+      {
+        Grid::OffsetCoordinate children[Grid::IOffsetGrid::m_MAX_NUM_CHILDREN];
+        const unsigned short noOfChildren = m_pGrid->GetChildren(ToOffsetCell(a_cell), children);
+
+        for (unsigned short childIndex = 0U; childIndex < noOfChildren; ++childIndex)
+        {
+          a_pChildren[childIndex].m_faceIndex = a_cell.m_faceIndex;
+          a_pChildren[childIndex].m_resolution = a_cell.m_resolution + 1;
+          a_pChildren[childIndex].m_rowId = children[childIndex].m_rowId;
+          a_pChildren[childIndex].m_columnId = children[childIndex].m_columnId;
+          a_pChildren[childIndex].m_cellLocation = a_cell.m_cellLocation;
+        }
+
+        return noOfChildren;
+      }
+
+      Cell::OffsetCell OffsetGridIndexer::ToOffsetCell(const Cell::OffsetCellValue& a_cell) const
+      {
+        return Cell::OffsetCell(
+            a_cell.m_faceIndex,
+            a_cell.m_resolution,
+            a_cell.m_rowId,
+            a_cell.m_columnId,
+            a_cell.m_cellLocation,
+            m_maximumFaceIndex);
+      }
     }
   }
 }
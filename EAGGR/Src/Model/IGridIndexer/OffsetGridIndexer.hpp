@@ -29,6 +29,9 @@
 
 #pragma once
 
+#include <cstddef>
+
+#include "Src/Model/ICell/OffsetCellValue.hpp"
 #include "Src/Model/IGrid/IOffsetGrid.hpp"
 #include "Src/Model/IGridIndexer.hpp"
 #include "Src/Model/IPolyhedralGlobe.hpp"
@@ -53,10 +56,21 @@ namespace EAGGR
 
           virtual std::unique_ptr<Cell::ICell> GetCell(const FaceCoordinate a_faceCoordinate) const;
 
+          virtual std::unique_ptr<Cell::ICell> GetCellAtResolution(
+              const FaceCoordinate a_faceCoordinate,
+              const unsigned short a_resolution) const;
+
+          virtual void GetCellsAtAllResolutions(
+              const FaceCoordinate a_faceCoordinate,
+              std::vector<std::unique_ptr<Cell::ICell> >& a_cells) const;
+
           virtual FaceCoordinate GetFaceCoordinate(const Cell::ICell & a_cell) const;
 
           virtual std::unique_ptr<Cell::ICell> CreateCell(const Cell::DggsCellId& a_cellId) const;
 
+          virtual std::unique_ptr<Cell::ICell> CreateCell(
+              const Cell::DggsPackedCellId a_packedCellId) const;
+
           virtual void GetParents(
               const Cell::ICell& a_cell,
               std::vector<std::unique_ptr<Cell::ICell> >& a_parentCells) const;
@@ -69,7 +83,54 @@ namespace EAGGR
               const Cell::ICell & a_cell,
               std::list<FaceCoordinate>& a_cellVertices) const;
 
+          virtual void GetNeighbourCoordinates(
+              const Cell::ICell & a_cell,
+              std::vector<FaceCoordinate>& a_neighbourCoordinates) const;
+
+          virtual double GetDescendantExtentFactor() const;
+
+          /// Gets the cell containing a face coordinate without allocating memory.
+          /// @param a_faceCoordinate The location on the face of the polyhedron.
+          /// @return The cell containing the face coordinate.
+          Cell::OffsetCellValue GetCellValue(const FaceCoordinate a_faceCoordinate) const;
+
+          /// Gets the cells containing an array of face coordinates without allocating memory.
+          /// @param a_pFaceCoordinates Array of locations on the faces of the polyhedron.
+          /// @param a_noOfCoordinates The number of face coordinates in the array.
+          /// @param a_pCells Array to be populated with the cells containing the face coordinates.
+          /// Must have space for a_noOfCoordinates cells.
+          void GetCellValues(
+              const FaceCoordinate* a_pFaceCoordinates,
+              const std::size_t a_noOfCoordinates,
+              Cell::OffsetCellValue* a_pCells) const;
+
+          /// @param a_cell The cell to get the centre of.
+          /// @return The location of the cell centre on the face of the polyhedron.
+          FaceCoordinate GetFaceCoordinate(const Cell::OffsetCellValue& a_cell) const;
+
+          /// Gets the parents of a cell without allocating memory.
+          /// @param a_cell The cell to get the parents of.
+          /// @param a_pParents Array to be populated with the parent cells. Must have space for at
+          /// least IOffsetGrid::m_MAX_NUM_PARENTS cells.
+          /// @return The number of parents written to the array (0 for a resolution 0 cell).
+          unsigned short GetParents(
+              const Cell::OffsetCellValue& a_cell,
+              Cell::OffsetCellValue* a_pParents) const;
+
+          /// Gets the children of a cell without allocating memory.
+          /// @param a_cell The cell to get the children of.
+          /// @param a_pChildren Array to be populated with the child cells. Must have space for at
+          /// least IOffsetGrid::m_MAX_NUM_CHILDREN cells.
+          /// @return The number of children written to the array.
+          unsigned short GetChildren(
+              const Cell::OffsetCellValue& a_cell,
+              Cell::OffsetCellValue* a_pChildren) const;
+
         private:
+          /// @param a_cell The cell value to convert.
+          /// @return The offset cell equivalent to the cell value.
+          Cell::OffsetCell ToOffsetCell(const Cell::OffsetCellValue& a_cell) const;
+
           const Grid::IOffsetGrid* const m_pGrid;
           const unsigned short m_maximumFaceIndex;
           const TriangularFace m_face;
@@ -41,6 +41,25 @@ namespace EAGGR
   {
     namespace PolyhedralGlobe
     {
+      /// Precomputed geometry of a face of a polyhedral globe.
+      struct FaceGeometry
+      {
+          /// Components of the unit vector from the centre of the globe to the centre of the face.
+          double m_centreX;
+          double m_centreY;
+          double m_centreZ;
+
+          /// Sine and cosine of the latitude of the face centre.
+          double m_sinLatitude;
+          double m_cosLatitude;
+
+          /// Longitude of the face centre.
+          Utilities::Maths::Radians m_longitude;
+
+          /// Angle of the face relative to the top of the polyhedron (vertex 0).
+          Utilities::Maths::Radians m_orientation;
+      };
+
       /// Interface for a polyhedral globe.
       class IPolyhedralGlobe
       {
@@ -82,6 +101,11 @@ namespace EAGGR
           /// @return The latitude and longitude of the centre of the face on the polyhedron.
           /// @throws DGGSException if the specified face does not exist.
           virtual LatLong::Point GetFaceCentre(const FaceIndex a_faceIndex) const = 0;
+
+          /// @param a_faceIndex The index of the face to get the geometry for.
+          /// @return The precomputed centre and orientation of the face.
+          /// @throws DGGSException if the specified face does not exist.
+          virtual const FaceGeometry& GetFaceGeometry(const FaceIndex a_faceIndex) const = 0;
       };
     }
   }
@@ -27,6 +27,7 @@
 /// or can be found at <http://www.gnu.org/licenses/>.
 //------------------------------------------------------
 
+#include <cmath>
 #include <string>
 #include <sstream>
 
@@ -41,9 +42,28 @@ namespace EAGGR
   {
     namespace PolyhedralGlobe
     {
+      Icosahedron::Icosahedron()
+      {
+        for (FaceIndex faceIndex = 0U; faceIndex < m_NO_OF_FACES; ++faceIndex)
+        {
+          const LatLong::Point faceCentre = GetFaceCentre(faceIndex);
+          const Utilities::Maths::Radians latitude = faceCentre.GetLatitudeInRadians();
+          const Utilities::Maths::Radians longitude = faceCentre.GetLongitudeInRadians();
+
+          FaceGeometry& geometry = m_faceGeometry[faceIndex];
+          geometry.m_sinLatitude = sin(latitude);
+          geometry.m_cosLatitude = cos(latitude);
+          geometry.m_longitude = longitude;
+          geometry.m_centreX = geometry.m_cosLatitude * cos(longitude);
+          geometry.m_centreY = geometry.m_cosLatitude * sin(longitude);
+          geometry.m_centreZ = geometry.m_sinLatitude;
+          geometry.m_orientation = GetOrientationOfFace(faceIndex);
+        }
+      }
+
       FaceIndex Icosahedron::GetNoOfFaces() const
       {
-        return (20U);
+        return (m_NO_OF_FACES);
       }
 
       Utilities::Maths::Radians Icosahedron::Get_g() const
@@ -156,6 +176,18 @@ namespace EAGGR
             throw EAGGRException(stream.str());
         }
       }
+
+      const FaceGeometry& Icosahedron::GetFaceGeometry(const FaceIndex a_faceIndex) const
+      {
+        if (a_faceIndex >= m_NO_OF_FACES)
+        {
+          std::stringstream stream;
+          stream << "Unknown face index (" << a_faceIndex << ")";
+          throw EAGGRException(stream.str());
+        }
+
+        return (m_faceGeometry[a_faceIndex]);
+      }
     }
   }
 }
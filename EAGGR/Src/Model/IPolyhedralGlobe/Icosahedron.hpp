@@ -44,6 +44,8 @@ namespace EAGGR
       class Icosahedron: public IPolyhedralGlobe
       {
         public:
+          /// Constructor - precomputes the geometry of each face.
+          Icosahedron();
 
           /// Destructor
           virtual ~Icosahedron()
@@ -63,6 +65,12 @@ namespace EAGGR
 
           virtual Utilities::Maths::Radians GetOrientationOfFace(const FaceIndex a_faceIndex) const;
           virtual LatLong::Point GetFaceCentre(const FaceIndex a_faceIndex) const;
+          virtual const FaceGeometry& GetFaceGeometry(const FaceIndex a_faceIndex) const;
+
+        private:
+          static const FaceIndex m_NO_OF_FACES = 20U;
+
+          FaceGeometry m_faceGeometry[m_NO_OF_FACES];
       };
     }
   }
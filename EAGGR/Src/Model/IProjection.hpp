@@ -29,8 +29,12 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "Src/LatLong/SphericalAccuracyPoint.hpp"
 #include "Src/Model/FaceCoordinate.hpp"
+#include "Src/Model/FaceTypes.hpp"
+#include "Src/Utilities/Maths.hpp"
 
 namespace EAGGR
 {
@@ -57,6 +61,53 @@ namespace EAGGR
           /// @return The point obtained by projecting the supplied coordinate.
           virtual LatLong::SphericalAccuracyPoint GetLatLongPoint(
               const FaceCoordinate a_coordinate) const = 0;
+
+          /// @param a_accuracyAngle The angle defining the accuracy of a lat/long point.
+          /// @return The accuracy of a face coordinate projected from a point with that accuracy,
+          /// as a fraction of the area of a face.
+          virtual double GetFaceAccuracy(const Utilities::Maths::Degrees a_accuracyAngle) const = 0;
+
+          /// Converts an array of lat/long points on the earth to coordinates on the faces of a
+          /// polyhedron. Gives the same results as calling GetFaceCoordinate for each point, but
+          /// processes the points in bulk.
+          /// @param a_pLatitudes Array of point latitudes.
+          /// @param a_pLongitudes Array of point longitudes.
+          /// @param a_pAccuracies Array of point accuracy angles.
+          /// @param a_noOfPoints The number of points in each of the input arrays.
+          /// @param a_pFaceIndices Array to be populated with the face index of each point.
+          /// @param a_pXOffsets Array to be populated with the x offset of each point on its face.
+          /// @param a_pYOffsets Array to be populated with the y offset of each point on its face.
+          /// @param a_pAccuracyAreas Array to be populated with the accuracy of each face coordinate.
+          virtual void GetFaceCoordinates(
+              const Utilities::Maths::Degrees* a_pLatitudes,
+              const Utilities::Maths::Degrees* a_pLongitudes,
+              const Utilities::Maths::Degrees* a_pAccuracies,
+              const std::size_t a_noOfPoints,
+              FaceIndex* a_pFaceIndices,
+              double* a_pXOffsets,
+              double* a_pYOffsets,
+              double* a_pAccuracyAreas) const = 0;
+
+          /// Converts an array of coordinates on the faces of a polyhedron to lat/long points on the
+          /// earth. Gives the same results as calling GetLatLongPoint for each coordinate, but
+          /// processes the coordinates in bulk.
+          /// @param a_pFaceIndices Array of face indices.
+          /// @param a_pXOffsets Array of x offsets on the faces.
+          /// @param a_pYOffsets Array of y offsets on the faces.
+          /// @param a_pAccuracyAreas Array of face coordinate accuracies.
+          /// @param a_noOfPoints The number of coordinates in each of the input arrays.
+          /// @param a_pLatitudes Array to be populated with the latitude of each point.
+          /// @param a_pLongitudes Array to be populated with the longitude of each point.
+          /// @param a_pAccuracies Array to be populated with the accuracy angle of each point.
+          virtual void GetLatLongPoints(
+              const FaceIndex* a_pFaceIndices,
+              const double* a_pXOffsets,
+              const double* a_pYOffsets,
+              const double* a_pAccuracyAreas,
+              const std::size_t a_noOfPoints,
+              Utilities::Maths::Degrees* a_pLatitudes,
+              Utilities::Maths::Degrees* a_pLongitudes,
+              Utilities::Maths::Degrees* a_pAccuracies) const = 0;
       };
     }
   }
@@ -46,251 +46,764 @@ namespace EAGGR
     namespace Projection
     {
       Snyder::Snyder(const PolyhedralGlobe::IPolyhedralGlobe * const a_pGlobe)
-          : m_pGlobe(a_pGlobe)
+          : m_pGlobe(a_pGlobe), m_pForwardKernel(SnyderSimd::SelectForwardKernel()),
+              m_pInverseKernel(SnyderSimd::SelectInverseKernel())
       {
+        InitialiseGlobeConstants();
+      }
+
+      Snyder::Snyder(
+          const PolyhedralGlobe::IPolyhedralGlobe * const a_pGlobe,
+          const SnyderSimd::ForwardKernel a_pForwardKernel,
+          const SnyderSimd::InverseKernel a_pInverseKernel)
+          : m_pGlobe(a_pGlobe), m_pForwardKernel(a_pForwardKernel),
+              m_pInverseKernel(a_pInverseKernel)
+      {
+        InitialiseGlobeConstants();
+      }
+
+      void Snyder::InitialiseGlobeConstants()
+      {
+        if (m_pGlobe->GetNoOfFaces() > m_MAX_NO_OF_FACES)
+        {
+          std::stringstream stream;
+          stream << "Polyhedral globe has " << m_pGlobe->GetNoOfFaces()
+              << " faces, the Snyder projection supports at most " << m_MAX_NO_OF_FACES << ".";
+          throw EAGGRException(stream.str());
+        }
+
+        m_globeConstants.m_noOfFaces = m_pGlobe->GetNoOfFaces();
+        for (FaceIndex faceIndex = 0U; faceIndex < m_globeConstants.m_noOfFaces; ++faceIndex)
+        {
+          const PolyhedralGlobe::FaceGeometry& face = m_pGlobe->GetFaceGeometry(faceIndex);
+          m_globeConstants.m_centreX[faceIndex] = face.m_centreX;
+          m_globeConstants.m_centreY[faceIndex] = face.m_centreY;
+          m_globeConstants.m_centreZ[faceIndex] = face.m_centreZ;
+          m_globeConstants.m_sinLatitude[faceIndex] = face.m_sinLatitude;
+          m_globeConstants.m_cosLatitude[faceIndex] = face.m_cosLatitude;
+          m_globeConstants.m_longitude[faceIndex] = face.m_longitude;
+          m_globeConstants.m_orientation[faceIndex] = face.m_orientation;
+        }
+
+        const Radians g = m_pGlobe->Get_g();
+        const Radians G = m_pGlobe->Get_G();
+        const Radians theta = m_pGlobe->GetTheta();
+        m_globeConstants.m_G = G;
+        m_globeConstants.m_sinG = sin(G);
+        m_globeConstants.m_cosG = cos(G);
+        m_globeConstants.m_cosg = cos(g);
+        m_globeConstants.m_tang = tan(g);
+        m_globeConstants.m_cotTheta = Cot(theta);
+        m_globeConstants.m_angleBetweenVertices = 2.0 * (DEGREES_IN_RAD(90) - theta);
+        m_globeConstants.m_RPrime = m_pGlobe->GetRPrimeRelativeToR();
+        m_globeConstants.m_edgeLengthRelativeToR = GetEdgeLengthRelativeToR();
+        m_globeConstants.m_earthRadiusRelativeToEdgeLength = 1 / GetEdgeLengthRelativeToR();
+        m_globeConstants.m_faceSelectionTolerance = m_FACE_SELECTION_TOLERANCE;
+        m_globeConstants.m_edgeMargin = m_EDGE_MARGIN;
+        m_globeConstants.m_iterationAccuracy = m_ITERATION_ACCURACY;
       }
 
       FaceCoordinate Snyder::GetFaceCoordinate(const LatLong::SphericalAccuracyPoint a_point) const
       {
         // Note: All angles in this method are in radians (because cmath functions use radians)
 
-        // Margin around the edges of the polyhedron to ensure that points near the edge do not fall
-        // between two faces. The margin is needed due cumulative inaccuracies in the calculations.
-        /// @todo Find a better way of coping with inaccuracies, because currently systems that use a
-        ///       different number of bits to store doubles could calculate different faces for the
-        ///       same point.
-        static const Radians EDGE_MARGIN = 0.0000000001;
-
         // Get the point's lat and long coordinates
         const Radians phi = a_point.GetLatitudeInRadians();
         const Radians lambda = a_point.GetLongitudeInRadians();
 
-        // Variables used in step 4 (outside the while loop)
-        Radians z = 0.0, Az = 0.0, AzAdjustment = 0.0, q = 0.0;
-
-        // Constants that depend on face index
-        Radians g = 0.0, G = 0.0, theta = 0.0;
-
-        // Test each face in turn
-        bool foundFace = false;
-        FaceIndex faceIndex = 0U;
-        while (!foundFace)
+        // Unit vector from the centre of the globe to the point
+        const double sinPhi = sin(phi);
+        const double cosPhi = cos(phi);
+        const double pointX = cosPhi * cos(lambda);
+        const double pointY = cosPhi * sin(lambda);
+        const double pointZ = sinPhi;
+
+        // The point lies on the face whose centre is nearest, i.e. the face centre vector with the
+        // largest dot product. Only a few multiplications are needed per face.
+        const FaceIndex noOfFaces = m_pGlobe->GetNoOfFaces();
+        double faceDotProducts[m_MAX_NO_OF_FACES];
+        double maxDotProduct = -HUGE_VAL;
+        for (FaceIndex faceIndex = 0U; faceIndex < noOfFaces; ++faceIndex)
         {
-          // Should always find a face, but just in case
-          if (faceIndex >= m_pGlobe->GetNoOfFaces())
+          const PolyhedralGlobe::FaceGeometry& face = m_pGlobe->GetFaceGeometry(faceIndex);
+          faceDotProducts[faceIndex] = (face.m_centreX * pointX) + (face.m_centreY * pointY)
+              + (face.m_centreZ * pointZ);
+          if (faceDotProducts[faceIndex] > maxDotProduct)
           {
-            std::stringstream stream;
-            stream << "Impossible transform: Point (" << a_point.GetLatitude() << ", "
-                << a_point.GetLongitude() << ") is not located on any face";
-            throw EAGGRException(stream.str());
+            maxDotProduct = faceDotProducts[faceIndex];
           }
+        }
 
-          // Get the geographic centre of the face
-          const LatLong::Point faceCentre = m_pGlobe->GetFaceCentre(faceIndex);
-          const Radians phi0 = faceCentre.GetLatitudeInRadians();
-          const Radians lambda0 = faceCentre.GetLongitudeInRadians();
+        Radians z = 0.0, Az = 0.0, AzAdjustment = 0.0, q = 0.0;
+        const FaceIndex faceIndex = SelectFace(
+            a_point,
+            sinPhi,
+            cosPhi,
+            faceDotProducts,
+            1U,
+            maxDotProduct,
+            z,
+            Az,
+            AzAdjustment,
+            q);
+
+        double xOffset;
+        double yOffset;
+        ProjectOntoFace(z, Az, AzAdjustment, q, xOffset, yOffset);
 
-          // Get spherical constants for face
-          g = m_pGlobe->Get_g();
-          G = m_pGlobe->Get_G();
-          theta = m_pGlobe->GetTheta();
+        // Enter results into the face coordinate object
+        FaceCoordinate faceCoordinate(
+            faceIndex,
+            xOffset,
+            yOffset,
+            GetAccuracyArea(a_point.GetAccuracy()));
 
-          // Step 1 - Calculate z and Az
+        return (faceCoordinate);
+      }
 
-          // Equation 13: Calculate the spherical distance (z) of the point from the geographic centre of the hexagon
-          z = acos((sin(phi0) * sin(phi)) + (cos(phi0) * cos(phi) * cos(lambda - lambda0)));
+      void Snyder::GetFaceCoordinates(
+          const Degrees* a_pLatitudes,
+          const Degrees* a_pLongitudes,
+          const Degrees* a_pAccuracies,
+          const std::size_t a_noOfPoints,
+          FaceIndex* a_pFaceIndices,
+          double* a_pXOffsets,
+          double* a_pYOffsets,
+          double* a_pAccuracyAreas) const
+      {
+        if (m_pForwardKernel != NULL)
+        {
+          GetFaceCoordinatesVector(
+              a_pLatitudes,
+              a_pLongitudes,
+              a_pAccuracies,
+              a_noOfPoints,
+              a_pFaceIndices,
+              a_pXOffsets,
+              a_pYOffsets,
+              a_pAccuracyAreas);
+        }
+        else
+        {
+          GetFaceCoordinatesScalar(
+              a_pLatitudes,
+              a_pLongitudes,
+              a_pAccuracies,
+              a_noOfPoints,
+              a_pFaceIndices,
+              a_pXOffsets,
+              a_pYOffsets,
+              a_pAccuracyAreas);
+        }
+      }
+
+      void Snyder::GetFaceCoordinatesScalar(
+          const Degrees* a_pLatitudes,
+          const Degrees* a_pLongitudes,
+          const Degrees* a_pAccuracies,
+          const std::size_t a_noOfPoints,
+          FaceIndex* a_pFaceIndices,
+          double* a_pXOffsets,
+          double* a_pYOffsets,
+          double* a_pAccuracyAreas) const
+      {
+        const FaceIndex noOfFaces = m_pGlobe->GetNoOfFaces();
+
+        // Points are processed in blocks so the working arrays stay in cache. Each stage runs
+        // across the whole block, so the compiler is free to vectorise the loops.
+        double sinPhi[m_BATCH_BLOCK_SIZE];
+        double cosPhi[m_BATCH_BLOCK_SIZE];
+        double pointX[m_BATCH_BLOCK_SIZE];
+        double pointY[m_BATCH_BLOCK_SIZE];
+        double pointZ[m_BATCH_BLOCK_SIZE];
+        double maxDotProducts[m_BATCH_BLOCK_SIZE];
+        double faceDotProducts[m_BATCH_BLOCK_SIZE * m_MAX_NO_OF_FACES];
+
+        for (std::size_t blockStart = 0U; blockStart < a_noOfPoints; blockStart +=
+            m_BATCH_BLOCK_SIZE)
+        {
+          const std::size_t blockSize =
+              (a_noOfPoints - blockStart < m_BATCH_BLOCK_SIZE) ?
+                  a_noOfPoints - blockStart : m_BATCH_BLOCK_SIZE;
 
-          // If z exceeds g, point is too far from centre of the face and located on another face
-          if (z > g + EDGE_MARGIN)
+          // Unit vector from the centre of the globe to each point
+          for (std::size_t point = 0U; point < blockSize; ++point)
           {
-            // Try next face
-            faceIndex++;
-            continue;
+            // Point object validates and caps the coordinates
+            const LatLong::Point latLongPoint(
+                a_pLatitudes[blockStart + point],
+                a_pLongitudes[blockStart + point]);
+            const Radians phi = latLongPoint.GetLatitudeInRadians();
+            const Radians lambda = latLongPoint.GetLongitudeInRadians();
+            sinPhi[point] = sin(phi);
+            cosPhi[point] = cos(phi);
+            pointX[point] = cosPhi[point] * cos(lambda);
+            pointY[point] = cosPhi[point] * sin(lambda);
+            pointZ[point] = sinPhi[point];
+            maxDotProducts[point] = -HUGE_VAL;
           }
 
-          // Equation 14: Calculate the azimuth (Az) of the point from the geographic centre of the hexagon
-          Az = atan2(
-              cos(phi) * sin(lambda - lambda0),
-              (cos(phi0) * sin(phi)) - (sin(phi0) * cos(phi) * cos(lambda - lambda0)));
-
-          // Step 2 - Work out which section of the face we are in
+          // Dot product of every point with every face centre, stored face by face
+          for (FaceIndex faceIndex = 0U; faceIndex < noOfFaces; ++faceIndex)
+          {
+            const PolyhedralGlobe::FaceGeometry& face = m_pGlobe->GetFaceGeometry(faceIndex);
+            const double centreX = face.m_centreX;
+            const double centreY = face.m_centreY;
+            const double centreZ = face.m_centreZ;
+            double* pDotProducts = faceDotProducts + (faceIndex * m_BATCH_BLOCK_SIZE);
+
+            for (std::size_t point = 0U; point < blockSize; ++point)
+            {
+              const double dotProduct = (centreX * pointX[point]) + (centreY * pointY[point])
+                  + (centreZ * pointZ[point]);
+              pDotProducts[point] = dotProduct;
+              maxDotProducts[point] =
+                  (dotProduct > maxDotProducts[point]) ? dotProduct : maxDotProducts[point];
+            }
+          }
 
-          // Initial adjustment to give "some" vertex an Az of 0
-          Az += m_pGlobe->GetOrientationOfFace(faceIndex);
+          // Select the face and apply the projection equations for each point
+          for (std::size_t point = 0U; point < blockSize; ++point)
+          {
+            const std::size_t pointIndex = blockStart + point;
+            const LatLong::SphericalAccuracyPoint latLongPoint(
+                a_pLatitudes[pointIndex],
+                a_pLongitudes[pointIndex],
+                a_pAccuracies[pointIndex]);
+
+            Radians z = 0.0, Az = 0.0, AzAdjustment = 0.0, q = 0.0;
+            a_pFaceIndices[pointIndex] = SelectFace(
+                latLongPoint,
+                sinPhi[point],
+                cosPhi[point],
+                faceDotProducts + point,
+                m_BATCH_BLOCK_SIZE,
+                maxDotProducts[point],
+                z,
+                Az,
+                AzAdjustment,
+                q);
+
+            ProjectOntoFace(
+                z,
+                Az,
+                AzAdjustment,
+                q,
+                a_pXOffsets[pointIndex],
+                a_pYOffsets[pointIndex]);
+
+            a_pAccuracyAreas[pointIndex] = GetAccuracyArea(latLongPoint.GetAccuracy());
+          }
+        }
+      }
 
-          // Adjust Az for the point to fall within the range of 0 and the angle between the vertices
-          AzAdjustment = AdjustAz(theta, Az);
+      void Snyder::GetFaceCoordinatesVector(
+          const Degrees* a_pLatitudes,
+          const Degrees* a_pLongitudes,
+          const Degrees* a_pAccuracies,
+          const std::size_t a_noOfPoints,
+          FaceIndex* a_pFaceIndices,
+          double* a_pXOffsets,
+          double* a_pYOffsets,
+          double* a_pAccuracyAreas) const
+      {
+        const FaceIndex noOfFaces = m_pGlobe->GetNoOfFaces();
 
-          // Step 3
+        Radians phi[m_BATCH_BLOCK_SIZE];
+        Radians lambda[m_BATCH_BLOCK_SIZE];
 
-          // Equation 9: Calculate q.
-          q = atan(tan(g) / (cos(Az) + (sin(Az) * Cot(theta))));
+        for (std::size_t blockStart = 0U; blockStart < a_noOfPoints; blockStart +=
+            m_BATCH_BLOCK_SIZE)
+        {
+          const std::size_t blockSize =
+              (a_noOfPoints - blockStart < m_BATCH_BLOCK_SIZE) ?
+                  a_noOfPoints - blockStart : m_BATCH_BLOCK_SIZE;
 
-          // If z exceeds q, it will not fit on this polygon and is located on another one
-          if (z > q + EDGE_MARGIN)
+          for (std::size_t point = 0U; point < blockSize; ++point)
           {
-            // Try next face
-            faceIndex++;
+            // Point object validates and caps the coordinates
+            const std::size_t pointIndex = blockStart + point;
+            const LatLong::SphericalAccuracyPoint latLongPoint(
+                a_pLatitudes[pointIndex],
+                a_pLongitudes[pointIndex],
+                a_pAccuracies[pointIndex]);
+            phi[point] = latLongPoint.GetLatitudeInRadians();
+            lambda[point] = latLongPoint.GetLongitudeInRadians();
+            a_pAccuracyAreas[pointIndex] = GetAccuracyArea(latLongPoint.GetAccuracy());
           }
-          else
+
+          m_pForwardKernel(
+              m_globeConstants,
+              phi,
+              lambda,
+              blockSize,
+              a_pFaceIndices + blockStart,
+              a_pXOffsets + blockStart,
+              a_pYOffsets + blockStart);
+
+          // Points near an edge or vertex go through the exact face test of the scalar path
+          for (std::size_t point = 0U; point < blockSize; ++point)
           {
-            foundFace = true;
+            const std::size_t pointIndex = blockStart + point;
+            if (a_pFaceIndices[pointIndex] == noOfFaces)
+            {
+              const FaceCoordinate faceCoordinate = GetFaceCoordinate(
+                  LatLong::SphericalAccuracyPoint(
+                      a_pLatitudes[pointIndex],
+                      a_pLongitudes[pointIndex],
+                      a_pAccuracies[pointIndex]));
+              a_pFaceIndices[pointIndex] = faceCoordinate.GetFaceIndex();
+              a_pXOffsets[pointIndex] = faceCoordinate.GetXOffset();
+              a_pYOffsets[pointIndex] = faceCoordinate.GetYOffset();
+            }
           }
         }
+      }
 
-        // Step 4 - Apply equations (5)(8) and (10)(12) in order
-
-        // Equation 5 (Let R = 1 until the final scaling of the map)
-        const double RPrime = m_pGlobe->GetRPrimeRelativeToR();
+      LatLong::SphericalAccuracyPoint Snyder::GetLatLongPoint(
+          const FaceCoordinate a_coordinate) const
+      {
+        // Note: All angles in this method are in radians (except in the lat / long point)
 
-        // Equation 6
-        const Radians H = acos((sin(Az) * sin(G) * cos(g)) - (cos(Az) * cos(G)));
+        // Get spherical constants for face
+        const Radians g = m_pGlobe->Get_g();
+        const Radians G = m_pGlobe->Get_G();
+        const double sinG = sin(G);
+        const double cosG = cos(G);
+        const double cosg = cos(g);
 
-        // Equation 7
-        // Note: pi * R^2 / 180 degrees gives 1 so can be omitted from the equation
-        const double AG = Az + G + H - DEGREES_IN_RAD(180);
+        // Get the face on which the point is located
+        const FaceIndex faceIndex = a_coordinate.GetFaceIndex();
 
-        // Equation 8
-        Radians AzPrime = atan2(
-            2.0 * AG,
-            (Squared(RPrime) * Squared(tan(g))) - (2.0 * AG * Cot(theta)));
+        Radians AzPrime = 0.0, AzAdjustment = 0.0;
+        double rho = 0.0, AG = 0.0;
+        GetInverseStartingValues(
+            a_coordinate.GetXOffset(),
+            a_coordinate.GetYOffset(),
+            AzPrime,
+            AzAdjustment,
+            rho,
+            AG);
 
-        // Equation 10
-        const double dPrime = RPrime * tan(g) / (cos(AzPrime) + (sin(AzPrime) * Cot(theta)));
+        // Iterate through equations (6) and (20)-(22) in order, with Az' as the first approximation
+        Radians approxAz = AzPrime;
+        Radians deltaAz = 0.0;
+        do
+        {
+          deltaAz = GetAzimuthCorrection(approxAz, AG, sinG, cosG, cosg);
 
-        // Equation 11
-        const double f = dPrime / (2.0 * RPrime * sin(q / 2.0));
+          // Calculate next approximation
+          approxAz += deltaAz;
 
-        // Equation 12
-        const double rho = 2.0 * RPrime * f * sin(z / 2.0);
+        }
+        while (std::abs(deltaAz) > m_ITERATION_ACCURACY);
 
-        // Remove the adjustment amount from Step 2
-        AzPrime -= AzAdjustment;
+        Degrees latitude = 0.0, longitude = 0.0;
+        GetLatLongFromAzimuth(
+            faceIndex,
+            approxAz,
+            AzPrime,
+            AzAdjustment,
+            rho,
+            latitude,
+            longitude);
 
-        // Calculate rectangular coordinates (as a fraction of the radius of earth)
+        // Convert lat / long to degrees and enter results into the point object
+        LatLong::SphericalAccuracyPoint point(
+            latitude,
+            longitude,
+            GetAccuracyAngle(a_coordinate.GetAccuracy()));
 
-        // Equation 15
-        const double x = rho * sin(AzPrime);
-        // Equation 16
-        const double y = rho * cos(AzPrime);
+        return (point);
+      }
 
-        // Get the conversion ratio to make coordinates relative to the edge length of the globe
-        const double earthRadiusRelativeToEdgeLength = 1 / GetEdgeLengthRelativeToR();
+      void Snyder::GetLatLongPoints(
+          const FaceIndex* a_pFaceIndices,
+          const double* a_pXOffsets,
+          const double* a_pYOffsets,
+          const double* a_pAccuracyAreas,
+          const std::size_t a_noOfPoints,
+          Degrees* a_pLatitudes,
+          Degrees* a_pLongitudes,
+          Degrees* a_pAccuracies) const
+      {
+        if (m_pInverseKernel != NULL)
+        {
+          GetLatLongPointsVector(
+              a_pFaceIndices,
+              a_pXOffsets,
+              a_pYOffsets,
+              a_pAccuracyAreas,
+              a_noOfPoints,
+              a_pLatitudes,
+              a_pLongitudes,
+              a_pAccuracies);
+        }
+        else
+        {
+          GetLatLongPointsScalar(
+              a_pFaceIndices,
+              a_pXOffsets,
+              a_pYOffsets,
+              a_pAccuracyAreas,
+              a_noOfPoints,
+              a_pLatitudes,
+              a_pLongitudes,
+              a_pAccuracies);
+        }
+      }
 
-        // Enter results into the face coordinate object
-        FaceCoordinate faceCoordinate(
-            faceIndex,
-            x * earthRadiusRelativeToEdgeLength,
-            y * earthRadiusRelativeToEdgeLength,
-            GetAccuracyArea(a_point.GetAccuracy()));
+      void Snyder::GetLatLongPointsScalar(
+          const FaceIndex* a_pFaceIndices,
+          const double* a_pXOffsets,
+          const double* a_pYOffsets,
+          const double* a_pAccuracyAreas,
+          const std::size_t a_noOfPoints,
+          Degrees* a_pLatitudes,
+          Degrees* a_pLongitudes,
+          Degrees* a_pAccuracies) const
+      {
+        // Get spherical constants for face
+        const Radians g = m_pGlobe->Get_g();
+        const Radians G = m_pGlobe->Get_G();
+        const double sinG = sin(G);
+        const double cosG = cos(G);
+        const double cosg = cos(g);
 
-        return (faceCoordinate);
+        for (std::size_t point = 0U; point < a_noOfPoints; ++point)
+        {
+          Radians AzPrime = 0.0, AzAdjustment = 0.0;
+          double rho = 0.0, AG = 0.0;
+          GetInverseStartingValues(
+              a_pXOffsets[point],
+              a_pYOffsets[point],
+              AzPrime,
+              AzAdjustment,
+              rho,
+              AG);
+
+          Radians approxAz = AzPrime;
+          Radians deltaAz = 0.0;
+          do
+          {
+            deltaAz = GetAzimuthCorrection(approxAz, AG, sinG, cosG, cosg);
+            approxAz += deltaAz;
+          }
+          while (std::abs(deltaAz) > m_ITERATION_ACCURACY);
+
+          GetLatLongFromAzimuth(
+              a_pFaceIndices[point],
+              approxAz,
+              AzPrime,
+              AzAdjustment,
+              rho,
+              a_pLatitudes[point],
+              a_pLongitudes[point]);
+
+          a_pAccuracies[point] = GetAccuracyAngle(a_pAccuracyAreas[point]);
+        }
       }
 
-      LatLong::SphericalAccuracyPoint Snyder::GetLatLongPoint(
-          const FaceCoordinate a_coordinate) const
+      void Snyder::GetLatLongPointsVector(
+          const FaceIndex* a_pFaceIndices,
+          const double* a_pXOffsets,
+          const double* a_pYOffsets,
+          const double* a_pAccuracyAreas,
+          const std::size_t a_noOfPoints,
+          Degrees* a_pLatitudes,
+          Degrees* a_pLongitudes,
+          Degrees* a_pAccuracies) const
       {
-        // Note: All angles in this method are in radians (except in the lat / long point)
+        Radians phi[m_BATCH_BLOCK_SIZE];
+        Radians lambda[m_BATCH_BLOCK_SIZE];
 
-        // Get the face on which the point is located
-        const FaceIndex faceIndex = a_coordinate.GetFaceIndex();
+        for (std::size_t blockStart = 0U; blockStart < a_noOfPoints; blockStart +=
+            m_BATCH_BLOCK_SIZE)
+        {
+          const std::size_t blockSize =
+              (a_noOfPoints - blockStart < m_BATCH_BLOCK_SIZE) ?
+                  a_noOfPoints - blockStart : m_BATCH_BLOCK_SIZE;
+
+          // The kernel does not check the face indices, so reject unknown faces as the globe
+          // does for the scalar path
+          for (std::size_t point = 0U; point < blockSize; ++point)
+          {
+            m_pGlobe->GetFaceGeometry(a_pFaceIndices[blockStart + point]);
+          }
+
+          m_pInverseKernel(
+              m_globeConstants,
+              a_pFaceIndices + blockStart,
+              a_pXOffsets + blockStart,
+              a_pYOffsets + blockStart,
+              blockSize,
+              phi,
+              lambda);
 
+          for (std::size_t point = 0U; point < blockSize; ++point)
+          {
+            const std::size_t pointIndex = blockStart + point;
+            a_pLatitudes[pointIndex] = RADIANS_IN_DEG(phi[point]);
+            a_pLongitudes[pointIndex] = LatLong::Point::WrapLongitude(
+                RADIANS_IN_DEG(lambda[point]));
+            a_pAccuracies[pointIndex] = GetAccuracyAngle(a_pAccuracyAreas[pointIndex]);
+          }
+        }
+      }
+
+      void Snyder::GetInverseStartingValues(
+          const double a_xOffset,
+          const double a_yOffset,
+          Radians & a_AzPrime,
+          Radians & a_AzAdjustment,
+          double & a_rho,
+          double & a_AG) const
+      {
         // Convert face coordinate to x and y offsets (in terms of R)
         const double edgeLengthRelativeToEarthRadius = GetEdgeLengthRelativeToR();
-        const double x = a_coordinate.GetXOffset() * edgeLengthRelativeToEarthRadius;
-        const double y = a_coordinate.GetYOffset() * edgeLengthRelativeToEarthRadius;
+        const double x = a_xOffset * edgeLengthRelativeToEarthRadius;
+        const double y = a_yOffset * edgeLengthRelativeToEarthRadius;
 
         // Get spherical constants for face
         const Radians g = m_pGlobe->Get_g();
-        const Radians G = m_pGlobe->Get_G();
         const Radians theta = m_pGlobe->GetTheta();
 
         // Equation 17
-        Radians AzPrime = atan2(x, y);
+        a_AzPrime = atan2(x, y);
 
         // Equation 18 (Pythagoras Theorem)
-        const double rho = sqrt(Squared(x) + Squared(y));
+        a_rho = sqrt(Squared(x) + Squared(y));
 
         // Adjust Az' for the point to fall within the range of 0 and the angle between the vertices
-        const Radians AzAdjustment = AdjustAz(theta, AzPrime);
+        a_AzAdjustment = AdjustAz(theta, a_AzPrime);
 
         // Equation 5 (Ultimately R terms will cancel out so for convenience let R = 1)
         const double RPrime = m_pGlobe->GetRPrimeRelativeToR();
 
         // Equation 19
-        const double AG = Squared(RPrime) * Squared(tan(g)) / (2 * (Cot(AzPrime) + Cot(theta)));
+        a_AG = Squared(RPrime) * Squared(tan(g)) / (2 * (Cot(a_AzPrime) + Cot(theta)));
+      }
 
-        // Iteration converges even to 10^-9 degrees in 3 to 4 cycles
-        static const double ITERATION_ACCURACY = pow(10, -9.0);
+      Radians Snyder::GetAzimuthCorrection(
+          const Radians a_approxAz,
+          const double a_AG,
+          const double a_sinG,
+          const double a_cosG,
+          const double a_cosg) const
+      {
+        const Radians G = m_pGlobe->Get_G();
 
-        // Iterate through equations (6) and (20)-(22) in order, with Az' as the first approximation
-        Radians approxAz = AzPrime;
-        Radians deltaAz = 0.0;
-        do
-        {
-          // Equation 6
-          const Radians H = acos(sin(approxAz) * sin(G) * cos(g) - cos(approxAz) * cos(G));
+        // Equation 6
+        const Radians H = acos(sin(a_approxAz) * a_sinG * a_cosg - cos(a_approxAz) * a_cosG);
 
-          // Equation 20 (180 degrees / (pi * R^2) gives 1 so can be omitted from the equation
-          const Radians FunctionAz = AG - G - H - approxAz + DEGREES_IN_RAD(180);
+        // Equation 20 (180 degrees / (pi * R^2) gives 1 so can be omitted from the equation
+        const Radians FunctionAz = a_AG - G - H - a_approxAz + DEGREES_IN_RAD(180);
 
-          // Equation 21
-          const Radians DerivativeAz = ((cos(approxAz) * sin(G) * cos(g) + sin(approxAz) * cos(G))
-              / sin(H)) - 1.0;
+        // Equation 21
+        const Radians DerivativeAz = ((cos(a_approxAz) * a_sinG * a_cosg + sin(a_approxAz) * a_cosG)
+            / sin(H)) - 1.0;
 
-          // Equation 22
-          deltaAz = -1.0 * FunctionAz / DerivativeAz;
+        // Equation 22
+        return (-1.0 * FunctionAz / DerivativeAz);
+      }
 
-          // Calculate next approximation
-          approxAz += deltaAz;
+      void Snyder::GetLatLongFromAzimuth(
+          const FaceIndex a_faceIndex,
+          const Radians a_Az,
+          const Radians a_AzPrime,
+          const Radians a_AzAdjustment,
+          const double a_rho,
+          Degrees & a_latitude,
+          Degrees & a_longitude) const
+      {
+        // Get spherical constants for face
+        const Radians g = m_pGlobe->Get_g();
+        const Radians theta = m_pGlobe->GetTheta();
 
-        }
-        while (std::abs(deltaAz) > ITERATION_ACCURACY);
-        Radians Az = approxAz;
+        // Equation 5 (Ultimately R terms will cancel out so for convenience let R = 1)
+        const double RPrime = m_pGlobe->GetRPrimeRelativeToR();
+
+        Radians Az = a_Az;
 
         // Equation 9
         const Radians q = atan(tan(g) / (cos(Az) + (sin(Az) * Cot(theta))));
 
         // Equation 10
-        const double dPrime = RPrime * tan(g) / (cos(AzPrime) + (sin(AzPrime) * Cot(theta)));
+        const double dPrime = RPrime * tan(g) / (cos(a_AzPrime) + (sin(a_AzPrime) * Cot(theta)));
 
         // Equation 11
         const double f = dPrime / (2.0 * RPrime * sin(q / 2.0));
 
         // Equation 23
-        const Radians z = 2 * asin(rho / (2 * RPrime * f));
+        const Radians z = 2 * asin(a_rho / (2 * RPrime * f));
 
         // Remove the adjustment amount
-        Az -= AzAdjustment;
+        Az -= a_AzAdjustment;
 
-        // Adjust Az to allow for the orientation of the face
-        Az -= m_pGlobe->GetOrientationOfFace(faceIndex);
+        // Get the geographic centre and orientation of the face
+        const PolyhedralGlobe::FaceGeometry& face = m_pGlobe->GetFaceGeometry(a_faceIndex);
+        const double sinPhi0 = face.m_sinLatitude;
+        const double cosPhi0 = face.m_cosLatitude;
+        const Radians lambda0 = face.m_longitude;
 
-        // Get the geographic centre of the face
-        const LatLong::Point faceCentre = m_pGlobe->GetFaceCentre(faceIndex);
-        const Radians phi0 = faceCentre.GetLatitudeInRadians();
-        const Radians lambda0 = faceCentre.GetLongitudeInRadians();
+        // Adjust Az to allow for the orientation of the face
+        Az -= face.m_orientation;
 
         // Convert to final lat / long based on the centre and orientation of the face
         // Equations taken from: http://www.movable-type.co.uk/scripts/latlong.html
-        const Radians phi = asin((sin(phi0) * cos(z)) + (cos(phi0) * sin(z) * cos(Az)));
+        const Radians phi = asin((sinPhi0 * cos(z)) + (cosPhi0 * sin(z) * cos(Az)));
         const Radians lambda = lambda0
-            + atan2(sin(Az) * sin(z) * cos(phi0), cos(z) - sin(phi0) * sin(phi));
+            + atan2(sin(Az) * sin(z) * cosPhi0, cos(z) - sinPhi0 * sin(phi));
 
         // Convert to degrees to get latitude and longitude
-        const Degrees latitude = RADIANS_IN_DEG(phi);
-        Degrees longitude = RADIANS_IN_DEG(lambda);
+        a_latitude = RADIANS_IN_DEG(phi);
 
         // Wrap around the world if we have exceeded the maximum or minimum longitude
-        longitude = LatLong::Point::WrapLongitude(longitude);
+        a_longitude = LatLong::Point::WrapLongitude(RADIANS_IN_DEG(lambda));
+      }
 
-        // Convert lat / long to degrees and enter results into the point object
-        LatLong::SphericalAccuracyPoint point(
-            latitude,
-            longitude,
-            GetAccuracyAngle(a_coordinate.GetAccuracy()));
+      FaceIndex Snyder::SelectFace(
+          const LatLong::SphericalAccuracyPoint & a_point,
+          const double a_sinPhi,
+          const double a_cosPhi,
+          const double* a_pFaceDotProducts,
+          const std::size_t a_dotProductStride,
+          const double a_maxDotProduct,
+          Radians & a_z,
+          Radians & a_Az,
+          Radians & a_AzAdjustment,
+          Radians & a_q) const
+      {
+        const Radians lambda = a_point.GetLongitudeInRadians();
+        const FaceIndex noOfFaces = m_pGlobe->GetNoOfFaces();
 
-        return (point);
+        // Points near an edge or vertex are (within the edge margin) on more than one face, so run
+        // the full face test on every face that is nearly the nearest, lowest index first. In most
+        // cases there is only one candidate.
+        for (FaceIndex faceIndex = 0U; faceIndex < noOfFaces; ++faceIndex)
+        {
+          if (a_pFaceDotProducts[faceIndex * a_dotProductStride]
+              >= a_maxDotProduct - m_FACE_SELECTION_TOLERANCE
+              && IsOnFace(faceIndex, lambda, a_sinPhi, a_cosPhi, a_z, a_Az, a_AzAdjustment, a_q))
+          {
+            return faceIndex;
+          }
+        }
+
+        // Should always find a face, but just in case
+        std::stringstream stream;
+        stream << "Impossible transform: Point (" << a_point.GetLatitude() << ", "
+            << a_point.GetLongitude() << ") is not located on any face";
+        throw EAGGRException(stream.str());
+      }
+
+      void Snyder::ProjectOntoFace(
+          const Radians a_z,
+          const Radians a_Az,
+          const Radians a_AzAdjustment,
+          const Radians a_q,
+          double & a_xOffset,
+          double & a_yOffset) const
+      {
+        // Get spherical constants for the globe
+        const Radians g = m_pGlobe->Get_g();
+        const Radians G = m_pGlobe->Get_G();
+        const Radians theta = m_pGlobe->GetTheta();
+
+        // Step 4 - Apply equations (5)(8) and (10)(12) in order
+
+        // Equation 5 (Let R = 1 until the final scaling of the map)
+        const double RPrime = m_pGlobe->GetRPrimeRelativeToR();
+
+        // Equation 6
+        const Radians H = acos((sin(a_Az) * sin(G) * cos(g)) - (cos(a_Az) * cos(G)));
+
+        // Equation 7
+        // Note: pi * R^2 / 180 degrees gives 1 so can be omitted from the equation
+        const double AG = a_Az + G + H - DEGREES_IN_RAD(180);
+
+        // Equation 8
+        Radians AzPrime = atan2(
+            2.0 * AG,
+            (Squared(RPrime) * Squared(tan(g))) - (2.0 * AG * Cot(theta)));
+
+        // Equation 10
+        const double dPrime = RPrime * tan(g) / (cos(AzPrime) + (sin(AzPrime) * Cot(theta)));
+
+        // Equation 11
+        const double f = dPrime / (2.0 * RPrime * sin(a_q / 2.0));
+
+        // Equation 12
+        const double rho = 2.0 * RPrime * f * sin(a_z / 2.0);
+
+        // Remove the adjustment amount from Step 2
+        AzPrime -= a_AzAdjustment;
+
+        // Calculate rectangular coordinates (as a fraction of the radius of earth)
+
+        // Equation 15
+        const double x = rho * sin(AzPrime);
+        // Equation 16
+        const double y = rho * cos(AzPrime);
+
+        // Get the conversion ratio to make coordinates relative to the edge length of the globe
+        const double earthRadiusRelativeToEdgeLength = 1 / GetEdgeLengthRelativeToR();
+
+        a_xOffset = x * earthRadiusRelativeToEdgeLength;
+        a_yOffset = y * earthRadiusRelativeToEdgeLength;
+      }
+
+      bool Snyder::IsOnFace(
+          const FaceIndex a_faceIndex,
+          const Radians a_lambda,
+          const double a_sinPhi,
+          const double a_cosPhi,
+          Radians & a_z,
+          Radians & a_Az,
+          Radians & a_AzAdjustment,
+          Radians & a_q) const
+      {
+        // Get the geographic centre of the face
+        const PolyhedralGlobe::FaceGeometry& face = m_pGlobe->GetFaceGeometry(a_faceIndex);
+        const double sinPhi0 = face.m_sinLatitude;
+        const double cosPhi0 = face.m_cosLatitude;
+        const Radians lambda0 = face.m_longitude;
+
+        // Get spherical constants for face
+        const Radians g = m_pGlobe->Get_g();
+        const Radians theta = m_pGlobe->GetTheta();
+
+        // Step 1 - Calculate z and Az
+
+        // Equation 13: Calculate the spherical distance (z) of the point from the geographic centre of the hexagon
+        a_z = acos((sinPhi0 * a_sinPhi) + (cosPhi0 * a_cosPhi * cos(a_lambda - lambda0)));
+
+        // If z exceeds g, point is too far from centre of the face and located on another face
+        if (a_z > g + m_EDGE_MARGIN)
+        {
+          return false;
+        }
+
+        // Equation 14: Calculate the azimuth (Az) of the point from the geographic centre of the hexagon
+        a_Az = atan2(
+            a_cosPhi * sin(a_lambda - lambda0),
+            (cosPhi0 * a_sinPhi) - (sinPhi0 * a_cosPhi * cos(a_lambda - lambda0)));
+
+        // Step 2 - Work out which section of the face we are in
+
+        // Initial adjustment to give "some" vertex an Az of 0
+        a_Az += face.m_orientation;
+
+        // Adjust Az for the point to fall within the range of 0 and the angle between the vertices
+        a_AzAdjustment = AdjustAz(theta, a_Az);
+
+        // Step 3
+
+        // Equation 9: Calculate q.
+        a_q = atan(tan(g) / (cos(a_Az) + (sin(a_Az) * Cot(theta))));
+
+        // If z exceeds q, it will not fit on this polygon and is located on another one
+        return (a_z <= a_q + m_EDGE_MARGIN);
       }
 
       Radians Snyder::AdjustAz(const Radians a_theta, Radians & a_Az) const
@@ -315,6 +828,11 @@ namespace EAGGR
         return (angleBetweenVertices * static_cast<Radians>(noOfAdjustments));
       }
 
+      double Snyder::GetFaceAccuracy(const Utilities::Maths::Degrees a_accuracyAngle) const
+      {
+        return (GetAccuracyArea(a_accuracyAngle));
+      }
+
       double Snyder::GetEdgeLengthRelativeToR() const
       {
         return (m_pGlobe->GetRPrimeRelativeToR() * m_pGlobe->GetEdgeLengthRelativeToRPrime());
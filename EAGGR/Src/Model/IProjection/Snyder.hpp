@@ -29,10 +29,13 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "Src/Utilities/Maths.hpp"
 #include "Src/Model/FaceCoordinate.hpp"
 #include "Src/Model/IProjection.hpp"
 #include "Src/Model/IPolyhedralGlobe.hpp"
+#include "Src/Model/IProjection/SnyderSimd.hpp"
 
 namespace EAGGR
 {
@@ -50,6 +53,17 @@ namespace EAGGR
           /// @param a_pGlobe The polyhedral globe to project onto.
           Snyder(const PolyhedralGlobe::IPolyhedralGlobe * const a_pGlobe);
 
+          /// Constructor.
+          /// @param a_pGlobe The polyhedral globe to project onto.
+          /// @param a_pForwardKernel The vector kernel used by GetFaceCoordinates(), or NULL to
+          /// use the scalar path.
+          /// @param a_pInverseKernel The vector kernel used by GetLatLongPoints(), or NULL to use
+          /// the scalar path.
+          Snyder(
+              const PolyhedralGlobe::IPolyhedralGlobe * const a_pGlobe,
+              const SnyderSimd::ForwardKernel a_pForwardKernel,
+              const SnyderSimd::InverseKernel a_pInverseKernel);
+
           /// Destructor
           virtual ~Snyder()
           {
@@ -68,10 +82,230 @@ namespace EAGGR
           virtual LatLong::SphericalAccuracyPoint GetLatLongPoint(
               const FaceCoordinate a_coordinate) const;
 
+          virtual double GetFaceAccuracy(const Utilities::Maths::Degrees a_accuracyAngle) const;
+
+          virtual void GetFaceCoordinates(
+              const Utilities::Maths::Degrees* a_pLatitudes,
+              const Utilities::Maths::Degrees* a_pLongitudes,
+              const Utilities::Maths::Degrees* a_pAccuracies,
+              const std::size_t a_noOfPoints,
+              FaceIndex* a_pFaceIndices,
+              double* a_pXOffsets,
+              double* a_pYOffsets,
+              double* a_pAccuracyAreas) const;
+
+          virtual void GetLatLongPoints(
+              const FaceIndex* a_pFaceIndices,
+              const double* a_pXOffsets,
+              const double* a_pYOffsets,
+              const double* a_pAccuracyAreas,
+              const std::size_t a_noOfPoints,
+              Utilities::Maths::Degrees* a_pLatitudes,
+              Utilities::Maths::Degrees* a_pLongitudes,
+              Utilities::Maths::Degrees* a_pAccuracies) const;
+
         private:
           /// Pointer to the polyhedral globe used for the projection.
           const PolyhedralGlobe::IPolyhedralGlobe * const m_pGlobe;
 
+          /// Vector kernel used by GetFaceCoordinates(), or NULL to use the scalar path.
+          const SnyderSimd::ForwardKernel m_pForwardKernel;
+
+          /// Vector kernel used by GetLatLongPoints(), or NULL to use the scalar path.
+          const SnyderSimd::InverseKernel m_pInverseKernel;
+
+          /// Constants of the globe passed to the vector kernels.
+          SnyderSimd::GlobeConstants m_globeConstants;
+
+          /// Maximum number of faces on a supported polyhedral globe.
+          static const FaceIndex m_MAX_NO_OF_FACES =
+              SnyderSimd::GlobeConstants::m_MAX_NO_OF_FACES;
+
+          /// Faces whose centres are this close (as a dot product of unit vectors) to the nearest
+          /// face centre are also tested when projecting a point, so that points on edges are
+          /// assigned consistently.
+          static constexpr double m_FACE_SELECTION_TOLERANCE = 1e-8;
+
+          /// Margin around the edges of the polyhedron to ensure that points near the edge do not
+          /// fall between two faces. The margin is needed due cumulative inaccuracies in the
+          /// calculations.
+          /// @todo Find a better way of coping with inaccuracies, because currently systems that
+          ///       use a different number of bits to store doubles could calculate different faces
+          ///       for the same point.
+          static constexpr Utilities::Maths::Radians m_EDGE_MARGIN = 0.0000000001;
+
+          /// Convergence limit of the iteration in the inverse projection. Iteration converges even
+          /// to 10^-9 degrees in 3 to 4 cycles.
+          static constexpr double m_ITERATION_ACCURACY = 1e-9;
+
+          /// Number of points processed together by GetFaceCoordinates and GetLatLongPoints.
+          static const std::size_t m_BATCH_BLOCK_SIZE = 64U;
+
+          /// Sets m_globeConstants from the polyhedral globe.
+          /// @throws EAGGRException if the globe has more faces than are supported.
+          void InitialiseGlobeConstants();
+
+          /// Implements GetFaceCoordinates() without a vector kernel. See IProjection for the
+          /// parameters.
+          void GetFaceCoordinatesScalar(
+              const Utilities::Maths::Degrees* a_pLatitudes,
+              const Utilities::Maths::Degrees* a_pLongitudes,
+              const Utilities::Maths::Degrees* a_pAccuracies,
+              const std::size_t a_noOfPoints,
+              FaceIndex* a_pFaceIndices,
+              double* a_pXOffsets,
+              double* a_pYOffsets,
+              double* a_pAccuracyAreas) const;
+
+          /// Implements GetFaceCoordinates() with m_pForwardKernel. Points the kernel cannot
+          /// assign to a single face are projected by GetFaceCoordinate(). See IProjection for the
+          /// parameters.
+          void GetFaceCoordinatesVector(
+              const Utilities::Maths::Degrees* a_pLatitudes,
+              const Utilities::Maths::Degrees* a_pLongitudes,
+              const Utilities::Maths::Degrees* a_pAccuracies,
+              const std::size_t a_noOfPoints,
+              FaceIndex* a_pFaceIndices,
+              double* a_pXOffsets,
+              double* a_pYOffsets,
+              double* a_pAccuracyAreas) const;
+
+          /// Implements GetLatLongPoints() without a vector kernel. See IProjection for the
+          /// parameters.
+          void GetLatLongPointsScalar(
+              const FaceIndex* a_pFaceIndices,
+              const double* a_pXOffsets,
+              const double* a_pYOffsets,
+              const double* a_pAccuracyAreas,
+              const std::size_t a_noOfPoints,
+              Utilities::Maths::Degrees* a_pLatitudes,
+              Utilities::Maths::Degrees* a_pLongitudes,
+              Utilities::Maths::Degrees* a_pAccuracies) const;
+
+          /// Implements GetLatLongPoints() with m_pInverseKernel. See IProjection for the
+          /// parameters.
+          void GetLatLongPointsVector(
+              const FaceIndex* a_pFaceIndices,
+              const double* a_pXOffsets,
+              const double* a_pYOffsets,
+              const double* a_pAccuracyAreas,
+              const std::size_t a_noOfPoints,
+              Utilities::Maths::Degrees* a_pLatitudes,
+              Utilities::Maths::Degrees* a_pLongitudes,
+              Utilities::Maths::Degrees* a_pAccuracies) const;
+
+          /// Finds the face a point is located on (steps 1 to 3 of the forward projection).
+          /// @param a_point The point to project.
+          /// @param a_sinPhi The sine of the latitude of the point.
+          /// @param a_cosPhi The cosine of the latitude of the point.
+          /// @param a_pFaceDotProducts The dot products of the point with the centre of each face.
+          /// @param a_dotProductStride The distance between consecutive faces in a_pFaceDotProducts.
+          /// @param a_maxDotProduct The largest of the dot products.
+          /// @param a_z Output variable for the spherical distance of the point from the face centre.
+          /// @param a_Az Output variable for the adjusted azimuth of the point from the face centre.
+          /// @param a_AzAdjustment Output variable for the adjustment applied to the azimuth.
+          /// @param a_q Output variable for the spherical distance from the face centre to the edge
+          /// of the face in the direction of the point.
+          /// @return The index of the face the point is located on.
+          /// @throws EAGGRException if the point is not located on any face.
+          FaceIndex SelectFace(
+              const LatLong::SphericalAccuracyPoint & a_point,
+              const double a_sinPhi,
+              const double a_cosPhi,
+              const double* a_pFaceDotProducts,
+              const std::size_t a_dotProductStride,
+              const double a_maxDotProduct,
+              Utilities::Maths::Radians & a_z,
+              Utilities::Maths::Radians & a_Az,
+              Utilities::Maths::Radians & a_AzAdjustment,
+              Utilities::Maths::Radians & a_q) const;
+
+          /// Calculates the location of a point on its face (step 4 of the forward projection).
+          /// @param a_z The spherical distance of the point from the face centre.
+          /// @param a_Az The adjusted azimuth of the point from the face centre.
+          /// @param a_AzAdjustment The adjustment applied to the azimuth.
+          /// @param a_q The spherical distance from the face centre to the edge of the face in the
+          /// direction of the point.
+          /// @param a_xOffset Output variable for the x offset as a fraction of the edge length.
+          /// @param a_yOffset Output variable for the y offset as a fraction of the edge length.
+          void ProjectOntoFace(
+              const Utilities::Maths::Radians a_z,
+              const Utilities::Maths::Radians a_Az,
+              const Utilities::Maths::Radians a_AzAdjustment,
+              const Utilities::Maths::Radians a_q,
+              double & a_xOffset,
+              double & a_yOffset) const;
+
+          /// Calculates the values needed to start the iteration of the inverse projection
+          /// (equations 17 to 19).
+          /// @param a_xOffset The x offset of the point as a fraction of the edge length.
+          /// @param a_yOffset The y offset of the point as a fraction of the edge length.
+          /// @param a_AzPrime Output variable for the adjusted plane azimuth of the point.
+          /// @param a_AzAdjustment Output variable for the adjustment applied to the azimuth.
+          /// @param a_rho Output variable for the distance of the point from the face centre.
+          /// @param a_AG Output variable for the area of the triangle containing the point.
+          void GetInverseStartingValues(
+              const double a_xOffset,
+              const double a_yOffset,
+              Utilities::Maths::Radians & a_AzPrime,
+              Utilities::Maths::Radians & a_AzAdjustment,
+              double & a_rho,
+              double & a_AG) const;
+
+          /// Performs one Newton-Raphson step of the inverse projection (equations 6 and 20 to 22).
+          /// @param a_approxAz The current approximation of the spherical azimuth.
+          /// @param a_AG The area of the triangle containing the point.
+          /// @param a_sinG The sine of G.
+          /// @param a_cosG The cosine of G.
+          /// @param a_cosg The cosine of g.
+          /// @return The correction to apply to the approximate azimuth.
+          Utilities::Maths::Radians GetAzimuthCorrection(
+              const Utilities::Maths::Radians a_approxAz,
+              const double a_AG,
+              const double a_sinG,
+              const double a_cosG,
+              const double a_cosg) const;
+
+          /// Completes the inverse projection once the spherical azimuth is known (equations 9 to
+          /// 11 and 23).
+          /// @param a_faceIndex The face the point is located on.
+          /// @param a_Az The spherical azimuth of the point.
+          /// @param a_AzPrime The adjusted plane azimuth of the point.
+          /// @param a_AzAdjustment The adjustment applied to the azimuth.
+          /// @param a_rho The distance of the point from the face centre.
+          /// @param a_latitude Output variable for the latitude of the point in degrees.
+          /// @param a_longitude Output variable for the longitude of the point in degrees.
+          void GetLatLongFromAzimuth(
+              const FaceIndex a_faceIndex,
+              const Utilities::Maths::Radians a_Az,
+              const Utilities::Maths::Radians a_AzPrime,
+              const Utilities::Maths::Radians a_AzAdjustment,
+              const double a_rho,
+              Utilities::Maths::Degrees & a_latitude,
+              Utilities::Maths::Degrees & a_longitude) const;
+
+          /// Tests whether a point is on a face and calculates the values from steps 1 to 3 of the
+          /// forward projection for that face.
+          /// @param a_faceIndex The face to test.
+          /// @param a_lambda The longitude of the point in radians.
+          /// @param a_sinPhi The sine of the latitude of the point.
+          /// @param a_cosPhi The cosine of the latitude of the point.
+          /// @param a_z Output variable for the spherical distance of the point from the face centre.
+          /// @param a_Az Output variable for the adjusted azimuth of the point from the face centre.
+          /// @param a_AzAdjustment Output variable for the adjustment applied to the azimuth.
+          /// @param a_q Output variable for the spherical distance from the face centre to the edge
+          /// of the face in the direction of the point.
+          /// @return True if the point is on the face.
+          bool IsOnFace(
+              const FaceIndex a_faceIndex,
+              const Utilities::Maths::Radians a_lambda,
+              const double a_sinPhi,
+              const double a_cosPhi,
+              Utilities::Maths::Radians & a_z,
+              Utilities::Maths::Radians & a_Az,
+              Utilities::Maths::Radians & a_AzAdjustment,
+              Utilities::Maths::Radians & a_q) const;
+
           /// Adjusts an angle so it is between 0 and the specified angle.
           /// @param a_theta The plane angle in radians between radius vector to centre and adjacent edge of plane polygon.
           /// @param a_angle The value of the angle to be adjusted in radians.
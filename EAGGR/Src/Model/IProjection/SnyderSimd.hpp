@@ -0,0 +1,199 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Projection
+//
+//------------------------------------------------------
+/// @file SnyderSimd.hpp
+/// 
+/// Declares the vector kernels of the Snyder projection.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+
+#include "Src/Utilities/Maths.hpp"
+#include "Src/Model/FaceTypes.hpp"
+
+// The vector kernels use GCC function attributes to select the instruction set, so no global
+// instruction set flags are needed. They are not built for Windows because MinGW cannot align
+// 32 byte values on the stack (GCC bug 54412).
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(_WIN32)
+#define EAGGR_SNYDER_SIMD 1
+#else
+#define EAGGR_SNYDER_SIMD 0
+#endif
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Projection
+    {
+      /// Vector kernels for the Snyder forward and inverse projections, and the runtime selection
+      /// between them.
+      ///
+      /// The kernels evaluate sin, cos, atan, atan2, asin and acos with polynomial approximations
+      /// taken from fdlibm. Over the arguments used by the projection, sin and cos are within 1 ulp
+      /// and the inverse functions within 2 ulp of the correctly rounded result. The face offsets
+      /// agree with the scalar path to within 1e-12 of the edge length, well below the 2^-29 edge
+      /// length of the finest ISEA4T cells, and the latitudes and longitudes to within 1e-10
+      /// degrees.
+      namespace SnyderSimd
+      {
+        /// Constants of the polyhedral globe and the projection laid out for the vector kernels.
+        struct GlobeConstants
+        {
+            /// Maximum number of faces on a supported polyhedral globe.
+            static const FaceIndex m_MAX_NO_OF_FACES = 20U;
+
+            /// Number of faces on the globe.
+            FaceIndex m_noOfFaces;
+
+            /// Components of the unit vector to the centre of each face.
+            double m_centreX[m_MAX_NO_OF_FACES];
+            double m_centreY[m_MAX_NO_OF_FACES];
+            double m_centreZ[m_MAX_NO_OF_FACES];
+
+            /// Sine and cosine of the latitude, longitude and orientation of each face centre.
+            double m_sinLatitude[m_MAX_NO_OF_FACES];
+            double m_cosLatitude[m_MAX_NO_OF_FACES];
+            Utilities::Maths::Radians m_longitude[m_MAX_NO_OF_FACES];
+            Utilities::Maths::Radians m_orientation[m_MAX_NO_OF_FACES];
+
+            /// Spherical constants of the globe and the values derived from them.
+            Utilities::Maths::Radians m_G;
+            double m_sinG;
+            double m_cosG;
+            double m_cosg;
+            double m_tang;
+            double m_cotTheta;
+            Utilities::Maths::Radians m_angleBetweenVertices;
+            double m_RPrime;
+            double m_edgeLengthRelativeToR;
+            double m_earthRadiusRelativeToEdgeLength;
+
+            /// Tolerances of the face selection, as used by the scalar path.
+            double m_faceSelectionTolerance;
+            Utilities::Maths::Radians m_edgeMargin;
+
+            /// Convergence limit of the iteration in the inverse projection.
+            Utilities::Maths::Radians m_iterationAccuracy;
+        };
+
+        /// Projects points on to the faces of a polyhedral globe.
+        /// Points within the face selection tolerance of more than one face, or that fail the
+        /// test for being on their face, are given the face index m_noOfFaces and must be
+        /// projected by the scalar path.
+        /// @param a_constants The constants of the globe.
+        /// @param a_pLatitudes The validated latitudes of the points in radians.
+        /// @param a_pLongitudes The validated longitudes of the points in radians.
+        /// @param a_noOfPoints The number of points.
+        /// @param a_pFaceIndices Output array for the face of each point.
+        /// @param a_pXOffsets Output array for the x offset of each point.
+        /// @param a_pYOffsets Output array for the y offset of each point.
+        typedef void (*ForwardKernel)(
+            const GlobeConstants & a_constants,
+            const Utilities::Maths::Radians* a_pLatitudes,
+            const Utilities::Maths::Radians* a_pLongitudes,
+            const std::size_t a_noOfPoints,
+            FaceIndex* a_pFaceIndices,
+            double* a_pXOffsets,
+            double* a_pYOffsets);
+
+        /// Projects points on faces of a polyhedral globe back to the globe. The Newton-Raphson
+        /// iteration runs for all the points of a vector together, with points that have
+        /// converged masked out, so each point gets the same iterations as in the scalar path.
+        /// @param a_constants The constants of the globe.
+        /// @param a_pFaceIndices The validated face of each point.
+        /// @param a_pXOffsets The x offset of each point.
+        /// @param a_pYOffsets The y offset of each point.
+        /// @param a_noOfPoints The number of points.
+        /// @param a_pLatitudes Output array for the latitude of each point in radians.
+        /// @param a_pLongitudes Output array for the longitude of each point in radians, which
+        /// may need to be wrapped.
+        typedef void (*InverseKernel)(
+            const GlobeConstants & a_constants,
+            const FaceIndex* a_pFaceIndices,
+            const double* a_pXOffsets,
+            const double* a_pYOffsets,
+            const std::size_t a_noOfPoints,
+            Utilities::Maths::Radians* a_pLatitudes,
+            Utilities::Maths::Radians* a_pLongitudes);
+
+        /// @return The fastest forward kernel supported by the CPU, or NULL if none is.
+        ForwardKernel SelectForwardKernel();
+
+        /// @return The fastest inverse kernel supported by the CPU, or NULL if none is.
+        InverseKernel SelectInverseKernel();
+
+#if EAGGR_SNYDER_SIMD
+        /// @return True if the CPU and operating system support the AVX2 kernel.
+        bool IsAvx2Supported();
+
+        /// @return True if the CPU and operating system support the AVX-512 kernel.
+        bool IsAvx512Supported();
+
+        /// Forward kernel using AVX2 and FMA instructions, four points at a time.
+        void GetFaceCoordinatesAvx2(
+            const GlobeConstants & a_constants,
+            const Utilities::Maths::Radians* a_pLatitudes,
+            const Utilities::Maths::Radians* a_pLongitudes,
+            const std::size_t a_noOfPoints,
+            FaceIndex* a_pFaceIndices,
+            double* a_pXOffsets,
+            double* a_pYOffsets);
+
+        /// Forward kernel using AVX-512 instructions, eight points at a time.
+        void GetFaceCoordinatesAvx512(
+            const GlobeConstants & a_constants,
+            const Utilities::Maths::Radians* a_pLatitudes,
+            const Utilities::Maths::Radians* a_pLongitudes,
+            const std::size_t a_noOfPoints,
+            FaceIndex* a_pFaceIndices,
+            double* a_pXOffsets,
+            double* a_pYOffsets);
+
+        /// Inverse kernel using AVX2 and FMA instructions, four points at a time.
+        void GetLatLongPointsAvx2(
+            const GlobeConstants & a_constants,
+            const FaceIndex* a_pFaceIndices,
+            const double* a_pXOffsets,
+            const double* a_pYOffsets,
+            const std::size_t a_noOfPoints,
+            Utilities::Maths::Radians* a_pLatitudes,
+            Utilities::Maths::Radians* a_pLongitudes);
+
+        /// Inverse kernel using AVX-512 instructions, eight points at a time.
+        void GetLatLongPointsAvx512(
+            const GlobeConstants & a_constants,
+            const FaceIndex* a_pFaceIndices,
+            const double* a_pXOffsets,
+            const double* a_pYOffsets,
+            const std::size_t a_noOfPoints,
+            Utilities::Maths::Radians* a_pLatitudes,
+            Utilities::Maths::Radians* a_pLongitudes);
+#endif
+      }
+    }
+  }
+}
@@ -0,0 +1,113 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Projection
+//
+//------------------------------------------------------
+/// @file SnyderSimdAvx2.cpp
+/// 
+/// Implements the AVX2 kernels of the Snyder projection.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include "SnyderSimd.hpp"
+
+#if EAGGR_SNYDER_SIMD
+
+#include <immintrin.h>
+
+#define EAGGR_SIMD_FUNCTION static inline __attribute__((always_inline, target("avx2,fma")))
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Projection
+    {
+      namespace SnyderSimd
+      {
+        namespace
+        {
+          typedef double Vector __attribute__((vector_size(32)));
+          typedef long long VectorMask __attribute__((vector_size(32)));
+
+          EAGGR_SIMD_FUNCTION Vector Sqrt(const Vector a_x)
+          {
+            return (_mm256_sqrt_pd(a_x));
+          }
+        }
+      }
+    }
+  }
+}
+
+#include "SnyderSimdKernel.hpp"
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Projection
+    {
+      namespace SnyderSimd
+      {
+        __attribute__((target("avx2,fma"))) void GetFaceCoordinatesAvx2(
+            const GlobeConstants & a_constants,
+            const Utilities::Maths::Radians* a_pLatitudes,
+            const Utilities::Maths::Radians* a_pLongitudes,
+            const std::size_t a_noOfPoints,
+            FaceIndex* a_pFaceIndices,
+            double* a_pXOffsets,
+            double* a_pYOffsets)
+        {
+          ProjectPoints(
+              a_constants,
+              a_pLatitudes,
+              a_pLongitudes,
+              a_noOfPoints,
+              a_pFaceIndices,
+              a_pXOffsets,
+              a_pYOffsets);
+        }
+
+        __attribute__((target("avx2,fma"))) void GetLatLongPointsAvx2(
+            const GlobeConstants & a_constants,
+            const FaceIndex* a_pFaceIndices,
+            const double* a_pXOffsets,
+            const double* a_pYOffsets,
+            const std::size_t a_noOfPoints,
+            Utilities::Maths::Radians* a_pLatitudes,
+            Utilities::Maths::Radians* a_pLongitudes)
+        {
+          InverseProjectPoints(
+              a_constants,
+              a_pFaceIndices,
+              a_pXOffsets,
+              a_pYOffsets,
+              a_noOfPoints,
+              a_pLatitudes,
+              a_pLongitudes);
+        }
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,572 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Projection
+//
+//------------------------------------------------------
+/// @file SnyderSimdKernel.hpp
+/// 
+/// Vector kernels of the Snyder projection, shared by the instruction set specific
+/// translation units.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+// This file is included by one translation unit per instruction set, which must first define
+// in the anonymous namespace below:
+//  - Vector, a GCC vector of doubles, and VectorMask, the matching vector of 64 bit integers
+//  - EAGGR_SIMD_FUNCTION, the attributes of an inlined function for the instruction set
+//  - Sqrt(Vector), the square root of each element
+// Everything here has internal linkage, so each instruction set gets its own copy.
+
+namespace EAGGR
+{
+  namespace Model
+  {
+    namespace Projection
+    {
+      namespace SnyderSimd
+      {
+        namespace
+        {
+          /// Number of points processed together.
+          const std::size_t LANES = sizeof(Vector) / sizeof(double);
+
+          EAGGR_SIMD_FUNCTION Vector Broadcast(const double a_value)
+          {
+            const Vector zero = { };
+            return (zero + a_value);
+          }
+
+          EAGGR_SIMD_FUNCTION Vector Select(
+              const VectorMask a_mask,
+              const Vector a_true,
+              const Vector a_false)
+          {
+            return (a_mask ? a_true : a_false);
+          }
+
+          /// @return Each element rounded to the nearest integer. Only valid below 2^51.
+          EAGGR_SIMD_FUNCTION Vector Round(const Vector a_x)
+          {
+            // Adding 1.5 * 2^52 leaves no bits for the fraction
+            const double SHIFT = 6755399441055744.0;
+            return ((a_x + SHIFT) - SHIFT);
+          }
+
+          EAGGR_SIMD_FUNCTION Vector Floor(const Vector a_x)
+          {
+            const Vector rounded = Round(a_x);
+            return (Select(rounded > a_x, rounded - 1.0, rounded));
+          }
+
+          EAGGR_SIMD_FUNCTION Vector Ceil(const Vector a_x)
+          {
+            const Vector rounded = Round(a_x);
+            return (Select(rounded < a_x, rounded + 1.0, rounded));
+          }
+
+          EAGGR_SIMD_FUNCTION Vector Abs(const Vector a_x)
+          {
+            return (Select(a_x < 0.0, -a_x, a_x));
+          }
+
+          /// @return Each element clamped to [-1, 1], so rounding errors in the argument of asin
+          /// and acos do not give NaN.
+          EAGGR_SIMD_FUNCTION Vector ClampToUnit(const Vector a_x)
+          {
+            return (Select(
+                a_x > 1.0,
+                Broadcast(1.0),
+                Select(a_x < -1.0, Broadcast(-1.0), a_x)));
+          }
+
+          /// Calculates the sine and cosine of each element to within 1 ulp, for arguments well
+          /// below 2^20 radians.
+          EAGGR_SIMD_FUNCTION void SinCos(const Vector a_x, Vector & a_sin, Vector & a_cos)
+          {
+            // Reduce the argument to [-pi/4, pi/4] using pi/2 split into parts whose products
+            // with the quadrant number are exact
+            const double PIO2_1 = 1.57079632673412561417e+00;
+            const double PIO2_2 = 6.07710050630396597660e-11;
+            const double PIO2_3 = 2.02226624871116645580e-21;
+            const double PIO2_3T = 8.47842766036889956997e-32;
+            const Vector n = Round(a_x * 6.36619772367581382433e-01);
+            const Vector r = (((a_x - n * PIO2_1) - n * PIO2_2) - n * PIO2_3) - n * PIO2_3T;
+            const Vector z = r * r;
+
+            // Minimax polynomials of fdlibm's __kernel_sin and __kernel_cos
+            const Vector sinR = r
+                + r * z
+                    * (-1.66666666666666324348e-01
+                        + z
+                            * (8.33333333332248946124e-03
+                                + z
+                                    * (-1.98412698298579493134e-04
+                                        + z
+                                            * (2.75573137070700676789e-06
+                                                + z
+                                                    * (-2.50507602534068634195e-08
+                                                        + z * 1.58969099521155010221e-10)))));
+            const Vector hz = z * 0.5;
+            const Vector w = 1.0 - hz;
+            const Vector cosR = w
+                + (((1.0 - w) - hz)
+                    + z * z
+                        * (4.16666666666666019037e-02
+                            + z
+                                * (-1.38888888888741095749e-03
+                                    + z
+                                        * (2.48015872894767294178e-05
+                                            + z
+                                                * (-2.75573143513906633035e-07
+                                                    + z
+                                                        * (2.08757232129817482790e-09
+                                                            + z * -1.13596475577881948265e-11))))));
+
+            // Map the result back to the quadrant of the argument
+            const Vector quadrant = n - 4.0 * Floor(n * 0.25);
+            const VectorMask isOdd = (quadrant == 1.0) | (quadrant == 3.0);
+            const Vector sinX = Select(isOdd, cosR, sinR);
+            const Vector cosX = Select(isOdd, sinR, cosR);
+            a_sin = Select(quadrant >= 2.0, -sinX, sinX);
+            a_cos = Select((quadrant == 1.0) | (quadrant == 2.0), -cosX, cosX);
+          }
+
+          EAGGR_SIMD_FUNCTION Vector Sin(const Vector a_x)
+          {
+            Vector sinX, cosX;
+            SinCos(a_x, sinX, cosX);
+            return (sinX);
+          }
+
+          /// Calculates the arctangent of each element to within 2 ulp, using the argument
+          /// reduction and polynomial of fdlibm's atan.
+          EAGGR_SIMD_FUNCTION Vector Atan(const Vector a_x)
+          {
+            const Vector x = Abs(a_x);
+
+            // atan(x) = atan(c) + atan((x - c) / (1 + x * c)) for c = 0, 0.5, 1, 1.5 and infinity
+            Vector numerator = x;
+            Vector denominator = Broadcast(1.0);
+            Vector atanHi = Broadcast(0.0);
+            Vector atanLo = Broadcast(0.0);
+
+            const VectorMask isReduced = x >= 0.4375;
+            numerator = Select(isReduced, 2.0 * x - 1.0, numerator);
+            denominator = Select(isReduced, 2.0 + x, denominator);
+            atanHi = Select(isReduced, Broadcast(4.63647609000806093515e-01), atanHi);
+            atanLo = Select(isReduced, Broadcast(2.26987774529616870924e-17), atanLo);
+
+            const VectorMask isAboveHalf = x >= 0.6875;
+            numerator = Select(isAboveHalf, x - 1.0, numerator);
+            denominator = Select(isAboveHalf, x + 1.0, denominator);
+            atanHi = Select(isAboveHalf, Broadcast(7.85398163397448278999e-01), atanHi);
+            atanLo = Select(isAboveHalf, Broadcast(3.06161699786838301793e-17), atanLo);
+
+            const VectorMask isAboveOne = x >= 1.1875;
+            numerator = Select(isAboveOne, x - 1.5, numerator);
+            denominator = Select(isAboveOne, 1.0 + 1.5 * x, denominator);
+            atanHi = Select(isAboveOne, Broadcast(9.82793723247329054082e-01), atanHi);
+            atanLo = Select(isAboveOne, Broadcast(1.39033110312309984516e-17), atanLo);
+
+            const VectorMask isLarge = x >= 2.4375;
+            numerator = Select(isLarge, Broadcast(-1.0), numerator);
+            denominator = Select(isLarge, x, denominator);
+            atanHi = Select(isLarge, Broadcast(1.57079632679489655800e+00), atanHi);
+            atanLo = Select(isLarge, Broadcast(6.12323399573676603587e-17), atanLo);
+
+            const Vector t = numerator / denominator;
+            const Vector z = t * t;
+            const Vector w = z * z;
+            const Vector oddTerms = z
+                * (3.33333333333329318027e-01
+                    + w
+                        * (1.42857142725034663711e-01
+                            + w
+                                * (9.09088713343650656196e-02
+                                    + w
+                                        * (6.66107313738753120669e-02
+                                            + w
+                                                * (4.97687799461593236017e-02
+                                                    + w * 1.62858201153657823623e-02)))));
+            const Vector evenTerms = w
+                * (-1.99999999998764832476e-01
+                    + w
+                        * (-1.11111104054623557880e-01
+                            + w
+                                * (-7.69187620504482999495e-02
+                                    + w
+                                        * (-5.83357013379057348645e-02
+                                            + w * -3.65315727442169155270e-02))));
+            const Vector correction = t * (oddTerms + evenTerms);
+
+            const Vector result = Select(
+                isReduced,
+                atanHi - ((correction - atanLo) - t),
+                t - correction);
+            return (Select(a_x < 0.0, -result, result));
+          }
+
+          /// Calculates the four quadrant arctangent of each pair of elements to within 2 ulp.
+          /// Unlike std::atan2 the sign of a zero y is ignored, which only changes the result by
+          /// 2 pi.
+          EAGGR_SIMD_FUNCTION Vector Atan2(const Vector a_y, const Vector a_x)
+          {
+            const double ONE_EIGHTY_DEGREES = 3.14159265358979311600e+00;
+
+            const Vector ratio = Atan(a_y / a_x);
+            const Vector halfTurn = Select(
+                a_y < 0.0,
+                Broadcast(-ONE_EIGHTY_DEGREES),
+                Broadcast(ONE_EIGHTY_DEGREES));
+            const Vector result = Select(a_x < 0.0, ratio + halfTurn, ratio);
+
+            // Both zero gives a zero angle rather than the NaN from 0 / 0
+            return (Select((a_x == 0.0) & (a_y == 0.0), Broadcast(0.0), result));
+          }
+
+          /// @return The rational approximation (asin(sqrt(z)) - sqrt(z)) / sqrt(z) used by
+          /// fdlibm for z in [0, 0.5].
+          EAGGR_SIMD_FUNCTION Vector AsinRational(const Vector a_z)
+          {
+            const Vector numerator = a_z
+                * (1.66666666666666657415e-01
+                    + a_z
+                        * (-3.25565818622400915405e-01
+                            + a_z
+                                * (2.01212532134862925881e-01
+                                    + a_z
+                                        * (-4.00555345006794114027e-02
+                                            + a_z
+                                                * (7.91534994289814532176e-04
+                                                    + a_z * 3.47933107596021167570e-05)))));
+            const Vector denominator = 1.0
+                + a_z
+                    * (-2.40339491173441421878e+00
+                        + a_z
+                            * (2.02094576023350569471e+00
+                                + a_z
+                                    * (-6.88283971605453293030e-01
+                                        + a_z * 7.70381505559019352791e-02)));
+            return (numerator / denominator);
+          }
+
+          /// Calculates the arcsine of each element, clamped to [-1, 1], to within 2 ulp.
+          EAGGR_SIMD_FUNCTION Vector Asin(const Vector a_x)
+          {
+            const double PIO2_HI = 1.57079632679489655800e+00;
+            const double PIO2_LO = 6.12323399573676603587e-17;
+
+            const Vector x = ClampToUnit(a_x);
+            const Vector central = x + x * AsinRational(x * x);
+
+            // asin(x) = pi/2 - 2 asin(sqrt((1 - |x|) / 2)), reflected for negative x, near +/-1
+            const Vector z = (1.0 - Abs(x)) * 0.5;
+            const Vector s = Sqrt(z);
+            const Vector outer = PIO2_HI - ((2.0 * (s + s * AsinRational(z))) - PIO2_LO);
+
+            return (Select(Abs(x) <= 0.5, central, Select(x < 0.0, -outer, outer)));
+          }
+
+          /// Calculates the arccosine of each element, clamped to [-1, 1], to within 2 ulp.
+          EAGGR_SIMD_FUNCTION Vector Acos(const Vector a_x)
+          {
+            const double PIO2_HI = 1.57079632679489655800e+00;
+            const double PIO2_LO = 6.12323399573676603587e-17;
+            const double ONE_EIGHTY_DEGREES = 3.14159265358979311600e+00;
+
+            const Vector x = ClampToUnit(a_x);
+
+            // acos(x) = pi/2 - asin(x) near zero
+            const Vector central = PIO2_HI - (x - (PIO2_LO - x * AsinRational(x * x)));
+
+            // acos(x) = 2 asin(sqrt((1 - |x|) / 2)), reflected for negative x, near +/-1
+            const Vector z = (1.0 - Abs(x)) * 0.5;
+            const Vector s = Sqrt(z);
+            const Vector asinS = s + s * AsinRational(z);
+            const Vector outer = Select(x < 0.0, ONE_EIGHTY_DEGREES - 2.0 * asinS, 2.0 * asinS);
+
+            return (Select(Abs(x) <= 0.5, central, outer));
+          }
+
+          /// Loads a vector from an array, padding it with zeros beyond the end of the array.
+          EAGGR_SIMD_FUNCTION Vector Load(const double* a_pValues, const std::size_t a_noOfValues)
+          {
+            Vector values = { };
+            if (a_noOfValues >= LANES)
+            {
+              __builtin_memcpy(&values, a_pValues, sizeof(Vector));
+            }
+            else
+            {
+              for (std::size_t lane = 0U; lane < a_noOfValues; ++lane)
+              {
+                values[lane] = a_pValues[lane];
+              }
+            }
+            return (values);
+          }
+
+          /// Adjusts the azimuths in the same way as Snyder::AdjustAz(), but without the loops.
+          /// @param a_angleBetweenVertices The angle between the vertices of a face.
+          /// @param a_Az The azimuths, adjusted to lie in the range 0 to a_angleBetweenVertices.
+          /// @return The adjustment applied to each azimuth.
+          EAGGR_SIMD_FUNCTION Vector AdjustAz(const double a_angleBetweenVertices, Vector & a_Az)
+          {
+            const Vector noOfAdjustments = Select(
+                a_Az < 0.0,
+                Ceil(-a_Az / a_angleBetweenVertices),
+                Select(
+                    a_Az > a_angleBetweenVertices,
+                    1.0 - Ceil(a_Az / a_angleBetweenVertices),
+                    Broadcast(0.0)));
+            const Vector adjustment = noOfAdjustments * a_angleBetweenVertices;
+            a_Az += adjustment;
+            return (adjustment);
+          }
+
+          /// Projects the points in the same way as Snyder::GetFaceCoordinate(), LANES at a
+          /// time. See ForwardKernel for the parameters.
+          EAGGR_SIMD_FUNCTION void ProjectPoints(
+              const GlobeConstants & a_constants,
+              const Utilities::Maths::Radians* a_pLatitudes,
+              const Utilities::Maths::Radians* a_pLongitudes,
+              const std::size_t a_noOfPoints,
+              FaceIndex* a_pFaceIndices,
+              double* a_pXOffsets,
+              double* a_pYOffsets)
+          {
+            const double ONE_EIGHTY_DEGREES = 3.14159265358979311600e+00;
+            const GlobeConstants & c = a_constants;
+
+            for (std::size_t start = 0U; start < a_noOfPoints; start += LANES)
+            {
+              const std::size_t noOfLanes =
+                  (a_noOfPoints - start < LANES) ? a_noOfPoints - start : LANES;
+              const Vector phi = Load(a_pLatitudes + start, noOfLanes);
+              const Vector lambda = Load(a_pLongitudes + start, noOfLanes);
+
+              // Unit vector from the centre of the globe to the point
+              Vector sinPhi, cosPhi, sinLambda, cosLambda;
+              SinCos(phi, sinPhi, cosPhi);
+              SinCos(lambda, sinLambda, cosLambda);
+              const Vector pointX = cosPhi * cosLambda;
+              const Vector pointY = cosPhi * sinLambda;
+              const Vector pointZ = sinPhi;
+
+              // Dot products with the face centres, as in the scalar path
+              Vector faceDotProducts[GlobeConstants::m_MAX_NO_OF_FACES];
+              Vector maxDotProduct = Broadcast(-2.0);
+              for (FaceIndex faceIndex = 0U; faceIndex < c.m_noOfFaces; ++faceIndex)
+              {
+                faceDotProducts[faceIndex] = (c.m_centreX[faceIndex] * pointX)
+                    + (c.m_centreY[faceIndex] * pointY) + (c.m_centreZ[faceIndex] * pointZ);
+                maxDotProduct = Select(
+                    faceDotProducts[faceIndex] > maxDotProduct,
+                    faceDotProducts[faceIndex],
+                    maxDotProduct);
+              }
+
+              // Take the lowest index face within the tolerance of the nearest, and count them
+              const Vector threshold = maxDotProduct - c.m_faceSelectionTolerance;
+              Vector face = Broadcast(0.0);
+              Vector noOfCandidates = Broadcast(0.0);
+              for (FaceIndex faceIndex = 0U; faceIndex < c.m_noOfFaces; ++faceIndex)
+              {
+                const VectorMask isCandidate = faceDotProducts[faceIndex] >= threshold;
+                face = Select(
+                    isCandidate & (noOfCandidates == 0.0),
+                    Broadcast(static_cast<double>(faceIndex)),
+                    face);
+                noOfCandidates = Select(isCandidate, noOfCandidates + 1.0, noOfCandidates);
+              }
+
+              // Gather the geometry of each lane's face
+              Vector sinPhi0, cosPhi0, lambda0, orientation;
+              for (std::size_t lane = 0U; lane < LANES; ++lane)
+              {
+                const FaceIndex faceIndex = static_cast<FaceIndex>(face[lane]);
+                sinPhi0[lane] = c.m_sinLatitude[faceIndex];
+                cosPhi0[lane] = c.m_cosLatitude[faceIndex];
+                lambda0[lane] = c.m_longitude[faceIndex];
+                orientation[lane] = c.m_orientation[faceIndex];
+              }
+
+              // Equations 13 and 14
+              Vector sinDeltaLambda, cosDeltaLambda;
+              SinCos(lambda - lambda0, sinDeltaLambda, cosDeltaLambda);
+              const Vector z = Acos((sinPhi0 * sinPhi) + (cosPhi0 * cosPhi * cosDeltaLambda));
+              Vector Az = Atan2(
+                  cosPhi * sinDeltaLambda,
+                  (cosPhi0 * sinPhi) - (sinPhi0 * cosPhi * cosDeltaLambda));
+
+              // Step 2
+              Az += orientation;
+              const Vector AzAdjustment = AdjustAz(c.m_angleBetweenVertices, Az);
+
+              // Equation 9
+              Vector sinAz, cosAz;
+              SinCos(Az, sinAz, cosAz);
+              const Vector q = Atan(c.m_tang / (cosAz + (sinAz * c.m_cotTheta)));
+
+              // Points that are not clearly on a single face go through the scalar face test
+              const VectorMask isResolved = (noOfCandidates == 1.0) & (z <= q + c.m_edgeMargin);
+
+              // Equations 5 to 8
+              const Vector H = Acos((sinAz * c.m_sinG * c.m_cosg) - (cosAz * c.m_cosG));
+              const Vector AG = Az + c.m_G + H - ONE_EIGHTY_DEGREES;
+              Vector AzPrime = Atan2(
+                  2.0 * AG,
+                  (c.m_RPrime * c.m_RPrime * c.m_tang * c.m_tang) - (2.0 * AG * c.m_cotTheta));
+
+              // Equations 10 to 12
+              Vector sinAzPrime, cosAzPrime;
+              SinCos(AzPrime, sinAzPrime, cosAzPrime);
+              const Vector dPrime = c.m_RPrime * c.m_tang
+                  / (cosAzPrime + (sinAzPrime * c.m_cotTheta));
+              const Vector f = dPrime / (2.0 * c.m_RPrime * Sin(q * 0.5));
+              const Vector rho = 2.0 * c.m_RPrime * f * Sin(z * 0.5);
+
+              // Equations 15 and 16, relative to the edge length
+              AzPrime -= AzAdjustment;
+              SinCos(AzPrime, sinAzPrime, cosAzPrime);
+              const Vector x = rho * sinAzPrime * c.m_earthRadiusRelativeToEdgeLength;
+              const Vector y = rho * cosAzPrime * c.m_earthRadiusRelativeToEdgeLength;
+
+              for (std::size_t lane = 0U; lane < noOfLanes; ++lane)
+              {
+                a_pFaceIndices[start + lane] =
+                    isResolved[lane] ? static_cast<FaceIndex>(face[lane]) : c.m_noOfFaces;
+                a_pXOffsets[start + lane] = x[lane];
+                a_pYOffsets[start + lane] = y[lane];
+              }
+            }
+          }
+
+          /// Calculates the correction to the approximate azimuths in the same way as
+          /// Snyder::GetAzimuthCorrection() (equations 6 and 20 to 22).
+          EAGGR_SIMD_FUNCTION Vector GetAzimuthCorrection(
+              const GlobeConstants & a_constants,
+              const Vector a_approxAz,
+              const Vector a_AG)
+          {
+            const double ONE_EIGHTY_DEGREES = 3.14159265358979311600e+00;
+            const GlobeConstants & c = a_constants;
+
+            Vector sinAz, cosAz;
+            SinCos(a_approxAz, sinAz, cosAz);
+
+            const Vector H = Acos((sinAz * c.m_sinG * c.m_cosg) - (cosAz * c.m_cosG));
+            const Vector functionAz = a_AG - c.m_G - H - a_approxAz + ONE_EIGHTY_DEGREES;
+            const Vector derivativeAz = (((cosAz * c.m_sinG * c.m_cosg) + (sinAz * c.m_cosG))
+                / Sin(H)) - 1.0;
+
+            return (-functionAz / derivativeAz);
+          }
+
+          /// Projects the points back to the globe in the same way as Snyder::GetLatLongPoint(),
+          /// LANES at a time. See InverseKernel for the parameters.
+          EAGGR_SIMD_FUNCTION void InverseProjectPoints(
+              const GlobeConstants & a_constants,
+              const FaceIndex* a_pFaceIndices,
+              const double* a_pXOffsets,
+              const double* a_pYOffsets,
+              const std::size_t a_noOfPoints,
+              Utilities::Maths::Radians* a_pLatitudes,
+              Utilities::Maths::Radians* a_pLongitudes)
+          {
+            const GlobeConstants & c = a_constants;
+
+            for (std::size_t start = 0U; start < a_noOfPoints; start += LANES)
+            {
+              const std::size_t noOfLanes =
+                  (a_noOfPoints - start < LANES) ? a_noOfPoints - start : LANES;
+              const Vector x = Load(a_pXOffsets + start, noOfLanes) * c.m_edgeLengthRelativeToR;
+              const Vector y = Load(a_pYOffsets + start, noOfLanes) * c.m_edgeLengthRelativeToR;
+
+              // Gather the geometry of each lane's face, leaving the padding lanes zero
+              Vector sinPhi0 = { }, cosPhi0 = { }, lambda0 = { }, orientation = { };
+              for (std::size_t lane = 0U; lane < noOfLanes; ++lane)
+              {
+                const FaceIndex faceIndex = a_pFaceIndices[start + lane];
+                sinPhi0[lane] = c.m_sinLatitude[faceIndex];
+                cosPhi0[lane] = c.m_cosLatitude[faceIndex];
+                lambda0[lane] = c.m_longitude[faceIndex];
+                orientation[lane] = c.m_orientation[faceIndex];
+              }
+
+              // Equations 17 to 19
+              Vector AzPrime = Atan2(x, y);
+              const Vector rho = Sqrt((x * x) + (y * y));
+              const Vector AzAdjustment = AdjustAz(c.m_angleBetweenVertices, AzPrime);
+              Vector sinAzPrime, cosAzPrime;
+              SinCos(AzPrime, sinAzPrime, cosAzPrime);
+              const Vector AG = c.m_RPrime * c.m_RPrime * c.m_tang * c.m_tang
+                  / (2.0 * ((cosAzPrime / sinAzPrime) + c.m_cotTheta));
+
+              // Newton-Raphson iteration of equations 6 and 20 to 22. Lanes stop updating once
+              // they have converged.
+              Vector approxAz = AzPrime;
+              VectorMask isConverging = Broadcast(0.0) == 0.0;
+              bool isAnyConverging = true;
+              while (isAnyConverging)
+              {
+                const Vector deltaAz = GetAzimuthCorrection(c, approxAz, AG);
+                approxAz = Select(isConverging, approxAz + deltaAz, approxAz);
+                isConverging = isConverging & (Abs(deltaAz) > c.m_iterationAccuracy);
+
+                isAnyConverging = false;
+                for (std::size_t lane = 0U; lane < LANES; ++lane)
+                {
+                  isAnyConverging = isAnyConverging || (isConverging[lane] != 0);
+                }
+              }
+
+              // Equations 9 to 11 and 23
+              Vector sinAz, cosAz;
+              SinCos(approxAz, sinAz, cosAz);
+              const Vector q = Atan(c.m_tang / (cosAz + (sinAz * c.m_cotTheta)));
+              const Vector dPrime = c.m_RPrime * c.m_tang
+                  / (cosAzPrime + (sinAzPrime * c.m_cotTheta));
+              const Vector f = dPrime / (2.0 * c.m_RPrime * Sin(q * 0.5));
+              const Vector z = 2.0 * Asin(rho / (2.0 * c.m_RPrime * f));
+
+              // Remove the adjustment and the orientation of the face, then convert to lat / long
+              SinCos(approxAz - AzAdjustment - orientation, sinAz, cosAz);
+              Vector sinZ, cosZ;
+              SinCos(z, sinZ, cosZ);
+              const Vector phi = Asin((sinPhi0 * cosZ) + (cosPhi0 * sinZ * cosAz));
+              const Vector lambda = lambda0
+                  + Atan2(sinAz * sinZ * cosPhi0, cosZ - sinPhi0 * Sin(phi));
+
+              for (std::size_t lane = 0U; lane < noOfLanes; ++lane)
+              {
+                a_pLatitudes[start + lane] = phi[lane];
+                a_pLongitudes[start + lane] = lambda[lane];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
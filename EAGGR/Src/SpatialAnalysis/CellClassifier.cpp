@@ -0,0 +1,474 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2016
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Spatial Analysis
+//
+//------------------------------------------------------
+/// @file CellClassifier.cpp
+///
+/// Implements the EAGGR::SpatialAnalysis::CellClassifier class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <sstream>
+
+#include "CellClassifier.hpp"
+#include "Src/EAGGRException.hpp"
+
+namespace EAGGR
+{
+  namespace SpatialAnalysis
+  {
+    using namespace Model;
+    using namespace Model::Cell;
+
+    CellClassifier::CellClassifier(
+        const GridIndexer::IGridIndexer * const a_gridIndexer,
+        const Projection::IProjection * const a_projection,
+        const CoordinateConversion::CoordinateConverter * const a_converter,
+        const LatLong::Wgs84Polygon & a_polygon)
+        : m_gridIndexer(a_gridIndexer),
+          m_projection(a_projection),
+          m_converter(a_converter),
+          m_isLinestring(false),
+          m_crossesAntimeridian(false)
+    {
+      const LatLong::Wgs84Linestring * outerRing = a_polygon.GetOuterRing();
+      if (outerRing->GetNumberOfPoints() < 3U)
+      {
+        std::stringstream errorMessage;
+        errorMessage << "Polygon outer ring has " << outerRing->GetNumberOfPoints()
+            << " points, at least 3 are required.";
+        throw EAGGRException(errorMessage.str());
+      }
+
+      for (unsigned short pointIndex = 0U; pointIndex < outerRing->GetNumberOfPoints();
+          ++pointIndex)
+      {
+        const LatLong::Wgs84AccuracyPoint * point = outerRing->GetAccuracyPoint(pointIndex);
+        boost::geometry::append(
+            m_polygon.outer(),
+            point_type(point->GetLongitude(), point->GetLatitude()));
+      }
+
+      m_polygon.inners().resize(a_polygon.GetNumberOfInnerRings());
+      for (unsigned short ringIndex = 0U; ringIndex < a_polygon.GetNumberOfInnerRings();
+          ++ringIndex)
+      {
+        const LatLong::Wgs84Linestring * innerRing = a_polygon.GetInnerRing(ringIndex);
+        for (unsigned short pointIndex = 0U; pointIndex < innerRing->GetNumberOfPoints();
+            ++pointIndex)
+        {
+          const LatLong::Wgs84AccuracyPoint * point = innerRing->GetAccuracyPoint(pointIndex);
+          boost::geometry::append(
+              m_polygon.inners()[ringIndex],
+              point_type(point->GetLongitude(), point->GetLatitude()));
+        }
+      }
+
+      boost::geometry::correct(m_polygon);
+      boost::geometry::envelope(m_polygon, m_envelope);
+
+      Initialise();
+    }
+
+    CellClassifier::CellClassifier(
+        const GridIndexer::IGridIndexer * const a_gridIndexer,
+        const Projection::IProjection * const a_projection,
+        const CoordinateConversion::CoordinateConverter * const a_converter,
+        const LatLong::Wgs84Linestring & a_linestring)
+        : m_gridIndexer(a_gridIndexer),
+          m_projection(a_projection),
+          m_converter(a_converter),
+          m_isLinestring(true),
+          m_crossesAntimeridian(false)
+    {
+      if (a_linestring.GetNumberOfPoints() < 2U)
+      {
+        std::stringstream errorMessage;
+        errorMessage << "Linestring has " << a_linestring.GetNumberOfPoints()
+            << " points, at least 2 are required.";
+        throw EAGGRException(errorMessage.str());
+      }
+
+      for (unsigned short pointIndex = 0U; pointIndex < a_linestring.GetNumberOfPoints();
+          ++pointIndex)
+      {
+        const LatLong::Wgs84AccuracyPoint * point = a_linestring.GetAccuracyPoint(pointIndex);
+        boost::geometry::append(
+            m_linestring,
+            point_type(point->GetLongitude(), point->GetLatitude()));
+      }
+
+      boost::geometry::envelope(m_linestring, m_envelope);
+
+      Initialise();
+    }
+
+    CellClassifier::CellClassifier(
+        const GridIndexer::IGridIndexer * const a_gridIndexer,
+        const Projection::IProjection * const a_projection,
+        const CoordinateConversion::CoordinateConverter * const a_converter,
+        const Utilities::Maths::Degrees a_minLatitude,
+        const Utilities::Maths::Degrees a_minLongitude,
+        const Utilities::Maths::Degrees a_maxLatitude,
+        const Utilities::Maths::Degrees a_maxLongitude)
+        : m_gridIndexer(a_gridIndexer),
+          m_projection(a_projection),
+          m_converter(a_converter),
+          m_isLinestring(false),
+          m_crossesAntimeridian(a_minLongitude > a_maxLongitude)
+    {
+      if (a_minLatitude > a_maxLatitude)
+      {
+        std::stringstream errorMessage;
+        errorMessage << "Bounding box minimum latitude (" << a_minLatitude
+            << ") exceeds its maximum (" << a_maxLatitude << ").";
+        throw EAGGRException(errorMessage.str());
+      }
+
+      // A box crossing the antimeridian is held east of it, beyond 180 degrees longitude
+      const double maxLongitude = m_crossesAntimeridian ? a_maxLongitude + 360.0 : a_maxLongitude;
+
+      m_envelope = box_type(
+          point_type(a_minLongitude, a_minLatitude),
+          point_type(maxLongitude, a_maxLatitude));
+      boost::geometry::convert(m_envelope, m_polygon);
+
+      Initialise();
+    }
+
+    void CellClassifier::Initialise()
+    {
+      m_isNested = m_gridIndexer->GetDescendantExtentFactor() == 1.0;
+
+      // The resolution zero cell covers the whole face
+      std::unique_ptr<ICell> faceCell = m_gridIndexer->GetCell(FaceCoordinate(0U, 0.0, 0.0, 1.0));
+
+      std::list<FaceCoordinate> vertices;
+      m_gridIndexer->GetCellVertices(*faceCell, vertices);
+      for (std::list<FaceCoordinate>::const_iterator vertex = vertices.begin();
+          vertex != vertices.end(); ++vertex)
+      {
+        boost::geometry::append(
+            m_faceTriangle,
+            point_type(vertex->GetXOffset(), vertex->GetYOffset()));
+      }
+      boost::geometry::correct(m_faceTriangle);
+    }
+
+    CellClassifier::Classification CellClassifier::Classify(
+        const ICell & a_cell,
+        const bool a_useDescendantExtent) const
+    {
+      std::vector<polygon_type> outlines;
+      const bool isClipped = GetFaceOutline(a_cell, a_useDescendantExtent, outlines);
+
+      std::vector<polygon_type> areas;
+      for (std::vector<polygon_type>::const_iterator outline = outlines.begin();
+          outline != outlines.end(); ++outline)
+      {
+        GetLatLongAreas(a_cell.GetFaceIndex(), a_cell.GetResolution(), *outline, areas);
+      }
+
+      // Areas west of the antimeridian are also compared with the part of the region beyond it
+      if (m_crossesAntimeridian)
+      {
+        const size_t noOfAreas = areas.size();
+        for (size_t areaIndex = 0U; areaIndex < noOfAreas; ++areaIndex)
+        {
+          polygon_type shiftedArea;
+          for (polygon_type::ring_type::const_iterator point = areas[areaIndex].outer().begin();
+              point != areas[areaIndex].outer().end(); ++point)
+          {
+            boost::geometry::append(shiftedArea, point_type(point->x() + 360.0, point->y()));
+          }
+          areas.push_back(shiftedArea);
+        }
+      }
+
+      // Copies of an area shifted across the antimeridian lie outside the valid longitudes, so
+      // the area is inside the region if any copy is
+      bool isOnBoundary = false;
+      for (std::vector<polygon_type>::const_iterator area = areas.begin(); area != areas.end();
+          ++area)
+      {
+        const Classification classification = Classify(*area);
+        if (classification == INSIDE)
+        {
+          // The part of a cell on another face has not been classified
+          return (isClipped && !a_useDescendantExtent) ? BOUNDARY : INSIDE;
+        }
+        isOnBoundary = isOnBoundary || classification == BOUNDARY;
+      }
+
+      return isOnBoundary ? BOUNDARY : OUTSIDE;
+    }
+
+    CellClassifier::Classification CellClassifier::Classify(const polygon_type & a_area) const
+    {
+      if (boost::geometry::disjoint(
+          boost::geometry::return_envelope<box_type>(a_area),
+          m_envelope))
+      {
+        return OUTSIDE;
+      }
+
+      if (m_isLinestring)
+      {
+        return boost::geometry::intersects(a_area, m_linestring) ? BOUNDARY : OUTSIDE;
+      }
+
+      if (boost::geometry::covered_by(a_area, m_polygon))
+      {
+        return INSIDE;
+      }
+
+      // Areas that only share an edge or a point with the polygon have no area in common
+      if (boost::geometry::disjoint(a_area, m_polygon)
+          || boost::geometry::touches(a_area, m_polygon))
+      {
+        return OUTSIDE;
+      }
+
+      return BOUNDARY;
+    }
+
+    bool CellClassifier::IsOnFace(const ICell & a_cell, const bool a_useDescendantExtent) const
+    {
+      std::vector<polygon_type> outlines;
+      GetFaceOutline(a_cell, a_useDescendantExtent, outlines);
+
+      for (std::vector<polygon_type>::const_iterator outline = outlines.begin();
+          outline != outlines.end(); ++outline)
+      {
+        if (boost::geometry::area(*outline) > 0.0)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    bool CellClassifier::IsNested() const
+    {
+      return m_isNested;
+    }
+
+    bool CellClassifier::GetFaceOutline(
+        const ICell & a_cell,
+        const bool a_useDescendantExtent,
+        std::vector<polygon_type>& a_outlines) const
+    {
+      std::list<FaceCoordinate> vertices;
+      m_gridIndexer->GetCellVertices(a_cell, vertices);
+
+      double scaleFactor = 1.0;
+      double centreX = 0.0;
+      double centreY = 0.0;
+      if (a_useDescendantExtent)
+      {
+        const FaceCoordinate centre = m_gridIndexer->GetFaceCoordinate(a_cell);
+        scaleFactor = m_gridIndexer->GetDescendantExtentFactor();
+        centreX = centre.GetXOffset();
+        centreY = centre.GetYOffset();
+      }
+
+      polygon_type outline;
+      for (std::list<FaceCoordinate>::const_iterator vertex = vertices.begin();
+          vertex != vertices.end(); ++vertex)
+      {
+        boost::geometry::append(
+            outline,
+            point_type(
+                centreX + scaleFactor * (vertex->GetXOffset() - centreX),
+                centreY + scaleFactor * (vertex->GetYOffset() - centreY)));
+      }
+      boost::geometry::correct(outline);
+
+      if (m_isNested)
+      {
+        // Cells of nested grids never extend beyond their face
+        a_outlines.push_back(outline);
+        return false;
+      }
+
+      boost::geometry::intersection(outline, m_faceTriangle, a_outlines);
+      return !boost::geometry::covered_by(outline, m_faceTriangle);
+    }
+
+    void CellClassifier::GetLatLongAreas(
+        const FaceIndex a_faceIndex,
+        const unsigned short a_resolution,
+        const polygon_type & a_outline,
+        std::vector<polygon_type>& a_areas) const
+    {
+      const unsigned short noOfSegments = std::max(
+          1,
+          m_MAX_EDGE_SEGMENTS >> std::min(a_resolution, static_cast<unsigned short>(15U)));
+
+      // The ring is closed, so the last point repeats the first
+      const polygon_type::ring_type & ring = a_outline.outer();
+      if (ring.size() < 4U)
+      {
+        return;
+      }
+      const std::size_t noOfPoints = (ring.size() - 1U) * noOfSegments;
+
+      std::vector<FaceIndex> faceIndices(noOfPoints, a_faceIndex);
+      std::vector<double> xOffsets(noOfPoints);
+      std::vector<double> yOffsets(noOfPoints);
+      std::vector<double> accuracies(noOfPoints, 0.0);
+      for (std::size_t edgeIndex = 0U; edgeIndex < ring.size() - 1U; ++edgeIndex)
+      {
+        const point_type & start = ring[edgeIndex];
+        const point_type & end = ring[edgeIndex + 1U];
+        for (unsigned short segment = 0U; segment < noOfSegments; ++segment)
+        {
+          const double fraction = static_cast<double>(segment) / noOfSegments;
+          const std::size_t pointIndex = edgeIndex * noOfSegments + segment;
+          xOffsets[pointIndex] = start.x() + fraction * (end.x() - start.x());
+          yOffsets[pointIndex] = start.y() + fraction * (end.y() - start.y());
+        }
+      }
+
+      std::vector<Utilities::Maths::Degrees> latitudes(noOfPoints);
+      std::vector<Utilities::Maths::Degrees> longitudes(noOfPoints);
+      std::vector<Utilities::Maths::Degrees> latLongAccuracies(noOfPoints);
+      m_projection->GetLatLongPoints(
+          &faceIndices[0],
+          &xOffsets[0],
+          &yOffsets[0],
+          &accuracies[0],
+          noOfPoints,
+          &latitudes[0],
+          &longitudes[0],
+          &latLongAccuracies[0]);
+      m_converter->ConvertSphereToWGS84(
+          &latitudes[0],
+          &longitudes[0],
+          noOfPoints,
+          &latitudes[0],
+          &longitudes[0]);
+
+      // Points this close to a pole may take any longitude
+      static const Utilities::Maths::Degrees POLE_LATITUDE = 90.0 - 1E-9;
+
+      // A vertex on a pole is replaced by points on the pole at the longitudes of its
+      // neighbours, which follows the area's edge along the pole in longitude / latitude
+      std::vector<point_type> points;
+      points.reserve(noOfPoints + 2U);
+      for (std::size_t pointIndex = 0U; pointIndex < noOfPoints; ++pointIndex)
+      {
+        if (std::abs(latitudes[pointIndex]) >= POLE_LATITUDE)
+        {
+          const double poleLatitude = latitudes[pointIndex] > 0.0 ? 90.0 : -90.0;
+          points.push_back(
+              point_type(longitudes[(pointIndex + noOfPoints - 1U) % noOfPoints], poleLatitude));
+          points.push_back(point_type(longitudes[(pointIndex + 1U) % noOfPoints], poleLatitude));
+        }
+        else
+        {
+          points.push_back(point_type(longitudes[pointIndex], latitudes[pointIndex]));
+        }
+      }
+
+      // Unwrap the longitudes so the area does not jump across the antimeridian
+      polygon_type area;
+      double unwrappedLongitude = points.front().x();
+      double minLongitude = unwrappedLongitude;
+      double maxLongitude = unwrappedLongitude;
+      double minLatitude = points.front().y();
+      double maxLatitude = points.front().y();
+      double latitudeSum = 0.0;
+      for (std::size_t pointIndex = 0U; pointIndex < points.size(); ++pointIndex)
+      {
+        if (pointIndex > 0U)
+        {
+          unwrappedLongitude += WrapLongitudeDifference(
+              points[pointIndex].x() - points[pointIndex - 1U].x());
+        }
+
+        boost::geometry::append(area, point_type(unwrappedLongitude, points[pointIndex].y()));
+
+        minLongitude = std::min(minLongitude, unwrappedLongitude);
+        maxLongitude = std::max(maxLongitude, unwrappedLongitude);
+        minLatitude = std::min(minLatitude, points[pointIndex].y());
+        maxLatitude = std::max(maxLatitude, points[pointIndex].y());
+        latitudeSum += points[pointIndex].y();
+      }
+
+      // A ring around a pole does not return to its starting longitude
+      const double totalLongitudeChange = unwrappedLongitude - points.front().x()
+          + WrapLongitudeDifference(points.front().x() - points.back().x());
+      if (std::abs(totalLongitudeChange) > 180.0)
+      {
+        // Use the band of latitude between the area and the pole, which contains the area
+        box_type band;
+        if (latitudeSum > 0.0)
+        {
+          band = box_type(point_type(-180.0, minLatitude), point_type(180.0, 90.0));
+        }
+        else
+        {
+          band = box_type(point_type(-180.0, -90.0), point_type(180.0, maxLatitude));
+        }
+
+        polygon_type bandPolygon;
+        boost::geometry::convert(band, bandPolygon);
+        a_areas.push_back(bandPolygon);
+        return;
+      }
+
+      boost::geometry::correct(area);
+      a_areas.push_back(area);
+
+      // Add a copy of an area crossing the antimeridian on the other side of it
+      if (maxLongitude > 180.0 || minLongitude < -180.0)
+      {
+        const double shift = maxLongitude > 180.0 ? -360.0 : 360.0;
+        polygon_type shiftedArea;
+        for (polygon_type::ring_type::const_iterator point = area.outer().begin();
+            point != area.outer().end(); ++point)
+        {
+          boost::geometry::append(shiftedArea, point_type(point->x() + shift, point->y()));
+        }
+        a_areas.push_back(shiftedArea);
+      }
+    }
+
+    double CellClassifier::WrapLongitudeDifference(const double a_difference)
+    {
+      if (a_difference > 180.0)
+      {
+        return a_difference - 360.0;
+      }
+      if (a_difference < -180.0)
+      {
+        return a_difference + 360.0;
+      }
+      return a_difference;
+    }
+  }
+}
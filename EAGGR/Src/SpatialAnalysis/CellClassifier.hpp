@@ -0,0 +1,186 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2016
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Spatial Analysis
+//
+//------------------------------------------------------
+/// @file CellClassifier.hpp
+///
+/// Implements the EAGGR::SpatialAnalysis::CellClassifier class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "GeometryTypes.hpp"
+#include "Src/CoordinateConversion/CoordinateConverter.hpp"
+#include "Src/LatLong/Wgs84Linestring.hpp"
+#include "Src/LatLong/Wgs84Polygon.hpp"
+#include "Src/Model/ICell.hpp"
+#include "Src/Model/IGridIndexer.hpp"
+#include "Src/Model/IProjection.hpp"
+#include "Src/Utilities/Maths.hpp"
+
+namespace EAGGR
+{
+  namespace SpatialAnalysis
+  {
+    /// Classifies DGGS cells as inside, outside or on the boundary of a region in WGS84
+    /// coordinates.
+    ///
+    /// As in SpatialAnalysis, the edges of the region are straight lines in longitude / latitude.
+    /// The cell outlines are densified before being compared so that their curvature in
+    /// longitude / latitude is followed at coarse resolutions.
+    class CellClassifier
+    {
+      public:
+        enum Classification
+        {
+          OUTSIDE, INSIDE, BOUNDARY
+        };
+
+        /// Constructor for a polygon region. Areas inside the polygon's inner rings are outside
+        /// the region.
+        /// @param a_gridIndexer The grid indexer of the DGGS.
+        /// @param a_projection The projection of the DGGS.
+        /// @param a_converter Converter between the sphere used by the projection and WGS84.
+        /// @param a_polygon The polygon.
+        /// @throws EAGGRException If the polygon's outer ring has fewer than three points.
+        CellClassifier(
+            const Model::GridIndexer::IGridIndexer * const a_gridIndexer,
+            const Model::Projection::IProjection * const a_projection,
+            const CoordinateConversion::CoordinateConverter * const a_converter,
+            const LatLong::Wgs84Polygon & a_polygon);
+
+        /// Constructor for a linestring region. No cell is inside a linestring.
+        /// @param a_gridIndexer The grid indexer of the DGGS.
+        /// @param a_projection The projection of the DGGS.
+        /// @param a_converter Converter between the sphere used by the projection and WGS84.
+        /// @param a_linestring The linestring.
+        /// @throws EAGGRException If the linestring has fewer than two points.
+        CellClassifier(
+            const Model::GridIndexer::IGridIndexer * const a_gridIndexer,
+            const Model::Projection::IProjection * const a_projection,
+            const CoordinateConversion::CoordinateConverter * const a_converter,
+            const LatLong::Wgs84Linestring & a_linestring);
+
+        /// Constructor for a bounding box region.
+        /// @param a_gridIndexer The grid indexer of the DGGS.
+        /// @param a_projection The projection of the DGGS.
+        /// @param a_converter Converter between the sphere used by the projection and WGS84.
+        /// @param a_minLatitude The southern edge of the box.
+        /// @param a_minLongitude The western edge of the box.
+        /// @param a_maxLatitude The northern edge of the box.
+        /// @param a_maxLongitude The eastern edge of the box. A box whose eastern edge is west of
+        /// its western edge crosses the antimeridian.
+        /// @throws EAGGRException If the minimum latitude exceeds the maximum.
+        CellClassifier(
+            const Model::GridIndexer::IGridIndexer * const a_gridIndexer,
+            const Model::Projection::IProjection * const a_projection,
+            const CoordinateConversion::CoordinateConverter * const a_converter,
+            const Utilities::Maths::Degrees a_minLatitude,
+            const Utilities::Maths::Degrees a_minLongitude,
+            const Utilities::Maths::Degrees a_maxLatitude,
+            const Utilities::Maths::Degrees a_maxLongitude);
+
+        /// Classifies the region covered by a cell (or by its descendants) against the region.
+        /// For grids whose child cells extend beyond their parent, only the part on the cell's face
+        /// is classified, and a cell that extends onto another face is never inside.
+        /// @param a_cell The cell to classify.
+        /// @param a_useDescendantExtent Whether to classify the area enclosing all of the cell's
+        /// descendants (see IGridIndexer::GetDescendantExtentFactor()) instead of the cell itself.
+        /// @return The classification of the cell.
+        Classification Classify(
+            const Model::Cell::ICell & a_cell,
+            const bool a_useDescendantExtent) const;
+
+        /// @param a_cell The cell.
+        /// @param a_useDescendantExtent Whether to test the area enclosing the descendants.
+        /// @return True if the cell (or its descendants) has an area in common with its face
+        /// triangle.
+        bool IsOnFace(const Model::Cell::ICell & a_cell, const bool a_useDescendantExtent) const;
+
+        /// @return True if the child cells of the grid partition their parent.
+        bool IsNested() const;
+
+      private:
+        typedef boost::geometry::model::box<point_type> box_type;
+
+        /// Sets up the members that do not depend on the region.
+        void Initialise();
+
+        /// Classifies an area in longitude / latitude against the region.
+        Classification Classify(const polygon_type & a_area) const;
+
+        /// Gets the outline of a cell on its face, clipped to the face triangle.
+        /// @param a_cell The cell.
+        /// @param a_useDescendantExtent Whether to enlarge the outline to enclose the descendants.
+        /// @param a_outlines Populated with the outline (empty if it lies outside the face).
+        /// @return True if the outline extends beyond the face triangle.
+        bool GetFaceOutline(
+            const Model::Cell::ICell & a_cell,
+            const bool a_useDescendantExtent,
+            std::vector<polygon_type>& a_outlines) const;
+
+        /// Converts the outline of a cell on a face to longitude / latitude, densifying its edges.
+        /// @param a_faceIndex The face the outline is on.
+        /// @param a_resolution The resolution of the cell, used to choose the edge densification.
+        /// @param a_outline The outline on the face.
+        /// @param a_areas Populated with the outline in longitude / latitude. Outlines that cross
+        /// the antimeridian are given a second copy shifted by 360 degrees, and outlines around a
+        /// pole are replaced by the band of latitude they enclose.
+        void GetLatLongAreas(
+            const Model::FaceIndex a_faceIndex,
+            const unsigned short a_resolution,
+            const polygon_type & a_outline,
+            std::vector<polygon_type>& a_areas) const;
+
+        /// @param a_difference The difference between two longitudes, in the range [-360, 360].
+        /// @return The equivalent difference in the range [-180, 180].
+        static double WrapLongitudeDifference(const double a_difference);
+
+        const Model::GridIndexer::IGridIndexer * const m_gridIndexer;
+        const Model::Projection::IProjection * const m_projection;
+        const CoordinateConversion::CoordinateConverter * const m_converter;
+
+        /// Whether child cells partition their parent.
+        bool m_isNested;
+
+        /// Outline of a face, which is the same for every face.
+        polygon_type m_faceTriangle;
+
+        /// The region in longitude / latitude, which is either a polygon or a linestring.
+        bool m_isLinestring;
+        polygon_type m_polygon;
+        linestring_type m_linestring;
+        box_type m_envelope;
+
+        /// Whether the region is a bounding box crossing the antimeridian, which is held with its
+        /// eastern edge beyond 180 degrees longitude.
+        bool m_crossesAntimeridian;
+
+        /// Number of segments each cell edge is divided into at resolution zero. This is halved
+        /// at each resolution, down to a minimum of one.
+        static const unsigned short m_MAX_EDGE_SEGMENTS = 32U;
+    };
+  }
+}
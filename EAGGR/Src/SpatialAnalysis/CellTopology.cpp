@@ -0,0 +1,188 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Spatial Analysis
+//
+//------------------------------------------------------
+/// @file CellTopology.cpp
+///
+/// Implements the EAGGR::SpatialAnalysis::CellTopology class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <algorithm>
+
+#include "CellTopology.hpp"
+#include "Src/Model/ICell/HierarchicalCell.hpp"
+
+namespace EAGGR
+{
+  namespace SpatialAnalysis
+  {
+    CellTopology::CellTopology(
+        const Model::GridIndexer::IGridIndexer * const a_gridIndexer,
+        const Model::CellNeighbourhood * const a_neighbourhood)
+        : m_gridIndexer(a_gridIndexer), m_neighbourhood(a_neighbourhood)
+    {
+    }
+
+    bool CellTopology::Analyse(
+        const Model::Cell::ICell & a_baseCell,
+        const Model::Cell::ICell & a_comparisonCell,
+        const AnalysisType a_analysisType,
+        bool & a_result) const
+    {
+      // Crossing is only defined between geometries of different dimensions, so is left to the
+      // geometry analysers
+      if (a_analysisType == CROSSES)
+      {
+        return false;
+      }
+
+      const CellRelation relation = GetRelation(a_baseCell, a_comparisonCell);
+      if (relation == UNKNOWN_RELATION)
+      {
+        return false;
+      }
+
+      switch (a_analysisType)
+      {
+        case EQUALS:
+          a_result = relation == SAME_CELL;
+          break;
+        case CONTAINS:
+        case COVERS:
+          a_result = relation == SAME_CELL || relation == CONTAINS_CELL;
+          break;
+        case WITHIN:
+        case COVERED_BY:
+          a_result = relation == SAME_CELL || relation == WITHIN_CELL;
+          break;
+        case TOUCHES:
+          a_result = relation == TOUCHING_CELL;
+          break;
+        case DISJOINT:
+          a_result = relation == DISJOINT_CELL;
+          break;
+        case INTERSECTS:
+          a_result = relation != DISJOINT_CELL;
+          break;
+        case OVERLAPS:
+          // The interiors of different cells only meet if one cell is inside the other
+          a_result = false;
+          break;
+        default:
+          return false;
+      }
+
+      return true;
+    }
+
+    CellTopology::CellRelation CellTopology::GetRelation(
+        const Model::Cell::ICell & a_baseCell,
+        const Model::Cell::ICell & a_comparisonCell) const
+    {
+      if (dynamic_cast<const Model::Cell::HierarchicalCell *>(&a_baseCell) != NULL
+          && dynamic_cast<const Model::Cell::HierarchicalCell *>(&a_comparisonCell) != NULL)
+      {
+        return GetHierarchicalRelation(a_baseCell, a_comparisonCell);
+      }
+
+      // The children of an offset grid cell are not nested inside it
+      if (a_baseCell.GetResolution() == a_comparisonCell.GetResolution())
+      {
+        return GetSameResolutionRelation(a_baseCell, a_comparisonCell);
+      }
+
+      return UNKNOWN_RELATION;
+    }
+
+    CellTopology::CellRelation CellTopology::GetHierarchicalRelation(
+        const Model::Cell::ICell & a_baseCell,
+        const Model::Cell::ICell & a_comparisonCell) const
+    {
+      // Each character after the face index is the index of a child within its parent
+      const Model::Cell::DggsCellId baseCellId = a_baseCell.GetCellId();
+      const Model::Cell::DggsCellId comparisonCellId = a_comparisonCell.GetCellId();
+
+      if (baseCellId == comparisonCellId)
+      {
+        return SAME_CELL;
+      }
+
+      const bool isBaseCoarser = baseCellId.size() < comparisonCellId.size();
+      const Model::Cell::DggsCellId& coarseCellId = isBaseCoarser ? baseCellId : comparisonCellId;
+      const Model::Cell::DggsCellId& fineCellId = isBaseCoarser ? comparisonCellId : baseCellId;
+
+      if (std::equal(coarseCellId.begin(), coarseCellId.end(), fineCellId.begin()))
+      {
+        return isBaseCoarser ? CONTAINS_CELL : WITHIN_CELL;
+      }
+
+      if (baseCellId.size() == comparisonCellId.size())
+      {
+        return GetSameResolutionRelation(a_baseCell, a_comparisonCell);
+      }
+
+      // The finer cell is inside its ancestor, so is disjoint from the coarser cell if its
+      // ancestor is. It may or may not touch the coarser cell if its ancestor does.
+      const std::unique_ptr<Model::Cell::ICell> ancestor =
+          m_gridIndexer->CreateCell(fineCellId.substr(0U, coarseCellId.size()));
+      const Model::Cell::ICell & coarseCell = isBaseCoarser ? a_baseCell : a_comparisonCell;
+
+      if (GetSameResolutionRelation(coarseCell, *ancestor) == DISJOINT_CELL)
+      {
+        return DISJOINT_CELL;
+      }
+
+      return UNKNOWN_RELATION;
+    }
+
+    CellTopology::CellRelation CellTopology::GetSameResolutionRelation(
+        const Model::Cell::ICell & a_baseCell,
+        const Model::Cell::ICell & a_comparisonCell) const
+    {
+      // Cells on a face edge have an id on each face they lie on
+      const std::unique_ptr<Model::Cell::ICell> baseCell =
+          m_neighbourhood->GetCanonicalCell(a_baseCell);
+      const Model::Cell::DggsCellId comparisonCellId =
+          m_neighbourhood->GetCanonicalCell(a_comparisonCell)->GetCellId();
+
+      if (baseCell->GetCellId() == comparisonCellId)
+      {
+        return SAME_CELL;
+      }
+
+      // The cells of one resolution tile the globe, so cells that are not neighbours are apart
+      std::vector<std::unique_ptr<Model::Cell::ICell> > neighbours;
+      m_neighbourhood->GetNeighbours(*baseCell, neighbours);
+      for (std::vector<std::unique_ptr<Model::Cell::ICell> >::const_iterator neighbour =
+          neighbours.begin(); neighbour != neighbours.end(); ++neighbour)
+      {
+        if ((*neighbour)->GetCellId() == comparisonCellId)
+        {
+          return TOUCHING_CELL;
+        }
+      }
+
+      return DISJOINT_CELL;
+    }
+  }
+}
@@ -0,0 +1,105 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Spatial Analysis
+//
+//------------------------------------------------------
+/// @file CellTopology.hpp
+///
+/// Implements the EAGGR::SpatialAnalysis::CellTopology class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include "SpatialAnalysis.hpp"
+#include "Src/Model/CellNeighbourhood.hpp"
+#include "Src/Model/ICell.hpp"
+#include "Src/Model/IGridIndexer.hpp"
+
+namespace EAGGR
+{
+  namespace SpatialAnalysis
+  {
+    /// Compares pairs of cells using the structure of the grid instead of their outlines.
+    ///
+    /// Cells of a hierarchical grid are nested, so one cell contains another if its id is a prefix
+    /// of the other's id. Cells at the same resolution either are the same cell, are neighbours
+    /// that touch or are disjoint. A cell is disjoint from a coarser cell if its ancestor at the
+    /// coarser resolution is. Other pairs of cells, such as cells at different resolutions of an
+    /// offset grid, must be compared using their outlines.
+    class CellTopology
+    {
+      public:
+        /// Constructor
+        /// @param a_gridIndexer The grid indexer of the DGGS.
+        /// @param a_neighbourhood Finds the neighbours of the cells of the DGGS.
+        CellTopology(
+            const Model::GridIndexer::IGridIndexer * const a_gridIndexer,
+            const Model::CellNeighbourhood * const a_neighbourhood);
+
+        /// Evaluates a spatial predicate between two cells if it can be found from the grid
+        /// structure.
+        /// @param a_baseCell The cell that the predicate is evaluated for.
+        /// @param a_comparisonCell The cell compared with the base cell.
+        /// @param a_analysisType The predicate to evaluate.
+        /// @param a_result Set to the result of the predicate if it can be found.
+        /// @return True if the result was found, false if the cell outlines must be compared.
+        bool Analyse(
+            const Model::Cell::ICell & a_baseCell,
+            const Model::Cell::ICell & a_comparisonCell,
+            const AnalysisType a_analysisType,
+            bool & a_result) const;
+
+      private:
+        enum CellRelation
+        {
+          SAME_CELL,
+          /// The comparison cell is inside the base cell.
+          CONTAINS_CELL,
+          /// The base cell is inside the comparison cell.
+          WITHIN_CELL,
+          /// The cells share an edge or a vertex but their interiors are disjoint.
+          TOUCHING_CELL,
+          DISJOINT_CELL,
+          /// The relation cannot be found from the grid structure.
+          UNKNOWN_RELATION
+        };
+
+        /// @return The relation of the comparison cell to the base cell.
+        CellRelation GetRelation(
+            const Model::Cell::ICell & a_baseCell,
+            const Model::Cell::ICell & a_comparisonCell) const;
+
+        /// @return The relation of two cells of a hierarchical grid.
+        CellRelation GetHierarchicalRelation(
+            const Model::Cell::ICell & a_baseCell,
+            const Model::Cell::ICell & a_comparisonCell) const;
+
+        /// @return The relation of two cells at the same resolution.
+        CellRelation GetSameResolutionRelation(
+            const Model::Cell::ICell & a_baseCell,
+            const Model::Cell::ICell & a_comparisonCell) const;
+
+        const Model::GridIndexer::IGridIndexer * const m_gridIndexer;
+        const Model::CellNeighbourhood * const m_neighbourhood;
+    };
+  }
+}
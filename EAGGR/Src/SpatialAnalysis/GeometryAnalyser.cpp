@@ -27,20 +27,67 @@
 /// or can be found at <http://www.gnu.org/licenses/>.
 //------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
+
 #include "GeometryAnalyser.hpp"
 
 namespace EAGGR
 {
   namespace SpatialAnalysis
   {
+    const double GeometryAnalyser::m_ENVELOPE_TOLERANCE = 1e-9;
+
     GeometryAnalyser::~GeometryAnalyser()
     {
     }
 
-    bool GeometryAnalyser::Disjoint(Geometry a_geometry) const
+    bool GeometryAnalyser::Disjoint(const Geometry & a_geometry) const
     {
       return !Intersects(a_geometry);
     }
+
+    bool GeometryAnalyser::IsEnvelopeDisjoint(const Geometry & a_geometry) const
+    {
+      box_type envelope;
+      switch (a_geometry.m_type)
+      {
+        case POINT:
+          boost::geometry::envelope(a_geometry.m_point, envelope);
+          break;
+        case LINESTRING:
+          boost::geometry::envelope(a_geometry.m_linestring, envelope);
+          break;
+        case POLYGON:
+          boost::geometry::envelope(a_geometry.m_polygon, envelope);
+          break;
+        default:
+          return false;
+      }
+
+      return boost::geometry::disjoint(m_envelope, envelope);
+    }
+
+    const box_type & GeometryAnalyser::GetEnvelope() const
+    {
+      return m_envelope;
+    }
+
+    void GeometryAnalyser::ExpandEnvelope()
+    {
+      point_type& minCorner = m_envelope.min_corner();
+      point_type& maxCorner = m_envelope.max_corner();
+
+      const double scale = std::max(
+          std::max(1.0, std::max(fabs(minCorner.x()), fabs(minCorner.y()))),
+          std::max(fabs(maxCorner.x()), fabs(maxCorner.y())));
+      const double margin = scale * m_ENVELOPE_TOLERANCE;
+
+      minCorner.x(minCorner.x() - margin);
+      minCorner.y(minCorner.y() - margin);
+      maxCorner.x(maxCorner.x() + margin);
+      maxCorner.y(maxCorner.y() + margin);
+    }
   }
 }
 
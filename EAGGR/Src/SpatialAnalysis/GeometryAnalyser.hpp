@@ -30,6 +30,7 @@
 #pragma once
 
 #include "GeometryTypes.hpp"
+#include "RelationMatrix.hpp"
 
 namespace EAGGR
 {
@@ -52,27 +53,53 @@ namespace EAGGR
 
         virtual GeometryType GetGeometryType() = 0;
 
-        virtual bool Equals(Geometry a_geometry) const = 0;
+        virtual bool Equals(const Geometry & a_geometry) const = 0;
 
-        virtual bool Intersects(Geometry a_geometry) const = 0;
+        virtual bool Intersects(const Geometry & a_geometry) const = 0;
 
-        virtual bool Touches(Geometry a_geometry) const = 0;
+        virtual bool Touches(const Geometry & a_geometry) const = 0;
 
-        virtual bool Contains(Geometry a_geometry) const = 0;
+        virtual bool Contains(const Geometry & a_geometry) const = 0;
 
-        virtual bool Covers(Geometry a_geometry) const = 0;
+        virtual bool Covers(const Geometry & a_geometry) const = 0;
 
-        virtual bool Within(Geometry a_geometry) const = 0;
+        virtual bool Within(const Geometry & a_geometry) const = 0;
 
-        virtual bool CoveredBy(Geometry a_geometry) const = 0;
+        virtual bool CoveredBy(const Geometry & a_geometry) const = 0;
 
-        virtual bool Crosses(Geometry a_geometry) const = 0;
+        virtual bool Crosses(const Geometry & a_geometry) const = 0;
 
-        virtual bool Overlaps(Geometry a_geometry) const = 0;
+        virtual bool Overlaps(const Geometry & a_geometry) const = 0;
 
-        bool Disjoint(Geometry a_geometry) const;
+        bool Disjoint(const Geometry & a_geometry) const;
+
+        /// @param a_geometry The geometry to compare with.
+        /// @return The DE-9IM matrix of the analysed geometry and the other geometry.
+        /// @throws EAGGRException If the type of the other geometry is not supported.
+        virtual RelationMatrix Relate(const Geometry & a_geometry) const = 0;
 
         virtual GeometryType GetGeometryType() const = 0;
+
+        /// @param a_geometry The geometry to compare with.
+        /// @return True if the bounding boxes of the geometries do not meet, in which case the
+        /// geometries are disjoint.
+        bool IsEnvelopeDisjoint(const Geometry & a_geometry) const;
+
+        /// @return The bounding box of the analysed geometry, enlarged by a small margin.
+        const box_type & GetEnvelope() const;
+
+      protected:
+        /// Enlarges the envelope by a small margin. Vertices shared by neighbouring geometries
+        /// may be calculated with different rounding errors, so a touching geometry must not be
+        /// rejected by the envelope. Called by the derived class once the envelope is set.
+        void ExpandEnvelope();
+
+        /// Bounding box of the analysed geometry, set by the derived class.
+        box_type m_envelope;
+
+      private:
+        /// Margin added to the envelope, relative to the size of its coordinates.
+        static const double m_ENVELOPE_TOLERANCE;
     };
   }
 }
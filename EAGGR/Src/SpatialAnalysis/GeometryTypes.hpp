@@ -44,10 +44,16 @@ namespace EAGGR
     typedef boost::geometry::model::d2::point_xy<double> point_type;
     typedef boost::geometry::model::linestring<point_type> linestring_type;
     typedef boost::geometry::model::polygon<point_type> polygon_type;
+    typedef boost::geometry::model::box<point_type> box_type;
 
     enum GeometryType
     {
       POINT, LINESTRING, POLYGON
     };
+
+    enum AnalysisType
+    {
+      CONTAINS, COVERED_BY, COVERS, CROSSES, DISJOINT, EQUALS, INTERSECTS, OVERLAPS, TOUCHES, WITHIN
+    };
   }
 }
@@ -29,6 +29,8 @@
 
 #include "LinestringAnalyser.hpp"
 
+#include "Src/EAGGRException.hpp"
+
 namespace EAGGR
 {
   namespace SpatialAnalysis
@@ -36,6 +38,8 @@ namespace EAGGR
     LinestringAnalyser::LinestringAnalyser(linestring_type a_linestring)
         : m_linestring(a_linestring)
     {
+      boost::geometry::envelope(m_linestring, m_envelope);
+      ExpandEnvelope();
     }
 
     LinestringAnalyser::~LinestringAnalyser()
@@ -47,7 +51,7 @@ namespace EAGGR
       return GeometryType::LINESTRING;
     }
 
-    bool LinestringAnalyser::Equals(Geometry a_geometry) const
+    bool LinestringAnalyser::Equals(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -58,7 +62,7 @@ namespace EAGGR
       }
     }
 
-    bool LinestringAnalyser::Intersects(Geometry a_geometry) const
+    bool LinestringAnalyser::Intersects(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -73,7 +77,7 @@ namespace EAGGR
       }
     }
 
-    bool LinestringAnalyser::Touches(Geometry a_geometry) const
+    bool LinestringAnalyser::Touches(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -88,7 +92,7 @@ namespace EAGGR
       }
     }
 
-    bool LinestringAnalyser::Contains(Geometry a_geometry) const
+    bool LinestringAnalyser::Contains(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -103,7 +107,7 @@ namespace EAGGR
       }
     }
 
-    bool LinestringAnalyser::Covers(Geometry a_geometry) const
+    bool LinestringAnalyser::Covers(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -118,7 +122,7 @@ namespace EAGGR
       }
     }
 
-    bool LinestringAnalyser::Within(Geometry a_geometry) const
+    bool LinestringAnalyser::Within(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -131,7 +135,7 @@ namespace EAGGR
       }
     }
 
-    bool LinestringAnalyser::CoveredBy(Geometry a_geometry) const
+    bool LinestringAnalyser::CoveredBy(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -144,7 +148,7 @@ namespace EAGGR
       }
     }
 
-    bool LinestringAnalyser::Crosses(Geometry a_geometry) const
+    bool LinestringAnalyser::Crosses(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -159,7 +163,7 @@ namespace EAGGR
       }
     }
 
-    bool LinestringAnalyser::Overlaps(Geometry a_geometry) const
+    bool LinestringAnalyser::Overlaps(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -170,6 +174,24 @@ namespace EAGGR
       }
     }
 
+    RelationMatrix LinestringAnalyser::Relate(const Geometry & a_geometry) const
+    {
+      switch (a_geometry.m_type)
+      {
+        case POINT:
+          return RelationMatrix(
+              boost::geometry::relation(m_linestring, a_geometry.m_point).str());
+        case LINESTRING:
+          return RelationMatrix(
+              boost::geometry::relation(m_linestring, a_geometry.m_linestring).str());
+        case POLYGON:
+          return RelationMatrix(
+              boost::geometry::relation(m_linestring, a_geometry.m_polygon).str());
+        default:
+          throw EAGGRException("Unsupported geometry type.");
+      }
+    }
+
     GeometryType LinestringAnalyser::GetGeometryType() const
     {
       return GeometryType::LINESTRING;
@@ -44,23 +44,25 @@ namespace EAGGR
 
         virtual GeometryType GetGeometryType();
 
-        virtual bool Equals(Geometry a_geometry) const;
+        virtual bool Equals(const Geometry & a_geometry) const;
 
-        virtual bool Intersects(Geometry a_geometry) const;
+        virtual bool Intersects(const Geometry & a_geometry) const;
 
-        virtual bool Touches(Geometry a_geometry) const;
+        virtual bool Touches(const Geometry & a_geometry) const;
 
-        virtual bool Contains(Geometry a_geometry) const;
+        virtual bool Contains(const Geometry & a_geometry) const;
 
-        virtual bool Covers(Geometry a_geometry) const;
+        virtual bool Covers(const Geometry & a_geometry) const;
 
-        virtual bool Within(Geometry a_geometry) const;
+        virtual bool Within(const Geometry & a_geometry) const;
 
-        virtual bool CoveredBy(Geometry a_geometry) const;
+        virtual bool CoveredBy(const Geometry & a_geometry) const;
 
-        virtual bool Crosses(Geometry a_geometry) const;
+        virtual bool Crosses(const Geometry & a_geometry) const;
 
-        virtual bool Overlaps(Geometry a_geometry) const;
+        virtual bool Overlaps(const Geometry & a_geometry) const;
+
+        virtual RelationMatrix Relate(const Geometry & a_geometry) const;
 
         virtual GeometryType GetGeometryType() const;
 
@@ -0,0 +1,173 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2016
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Spatial Analysis
+//
+//------------------------------------------------------
+/// @file Polyfill.cpp
+///
+/// Implements the EAGGR::SpatialAnalysis::Polyfill class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include "Polyfill.hpp"
+
+namespace EAGGR
+{
+  namespace SpatialAnalysis
+  {
+    using namespace Model;
+    using namespace Model::Cell;
+
+    Polyfill::Polyfill(
+        const GridIndexer::IGridIndexer * const a_gridIndexer,
+        const Projection::IProjection * const a_projection,
+        const CoordinateConversion::CoordinateConverter * const a_converter,
+        const unsigned short a_noOfFaces)
+        : m_gridIndexer(a_gridIndexer),
+          m_projection(a_projection),
+          m_converter(a_converter),
+          m_noOfFaces(a_noOfFaces)
+    {
+    }
+
+    void Polyfill::GetCells(
+        const LatLong::Wgs84Polygon & a_polygon,
+        const unsigned short a_resolution,
+        std::vector<std::unique_ptr<ICell> >& a_cells) const
+    {
+      const CellClassifier classifier(m_gridIndexer, m_projection, m_converter, a_polygon);
+      const bool isNested = classifier.IsNested();
+
+      // Start from the cell covering each face
+      std::vector<std::unique_ptr<ICell> > level;
+      for (FaceIndex faceIndex = 0U; faceIndex < m_noOfFaces; ++faceIndex)
+      {
+        level.push_back(m_gridIndexer->GetCell(FaceCoordinate(faceIndex, 0.0, 0.0, 1.0)));
+      }
+
+      std::set<DggsCellId> cellIds;
+      for (unsigned short resolution = 0U; resolution < a_resolution; ++resolution)
+      {
+        // Children are shared by several parents in grids that are not nested
+        std::vector<std::unique_ptr<ICell> > nextLevel;
+        std::set<DggsCellId> nextLevelIds;
+
+        for (std::vector<std::unique_ptr<ICell> >::iterator cell = level.begin();
+            cell != level.end(); ++cell)
+        {
+          switch (classifier.Classify(**cell, !isNested))
+          {
+            case CellClassifier::OUTSIDE:
+              break;
+            case CellClassifier::INSIDE:
+              AddDescendants(classifier, std::move(*cell), a_resolution, cellIds, a_cells);
+              break;
+            case CellClassifier::BOUNDARY:
+            {
+              // Children that are off the face may still have descendants on the face
+              std::vector<std::unique_ptr<ICell> > children;
+              m_gridIndexer->GetChildren(**cell, children);
+              for (std::vector<std::unique_ptr<ICell> >::iterator child = children.begin();
+                  child != children.end(); ++child)
+              {
+                if (isNested
+                    || (classifier.IsOnFace(**child, resolution + 1U < a_resolution)
+                        && nextLevelIds.insert((*child)->GetCellId()).second))
+                {
+                  nextLevel.push_back(std::move(*child));
+                }
+              }
+              break;
+            }
+          }
+        }
+
+        level.swap(nextLevel);
+      }
+
+      // Cells at the requested resolution are tested against their own outline
+      for (std::vector<std::unique_ptr<ICell> >::iterator cell = level.begin();
+          cell != level.end(); ++cell)
+      {
+        if (classifier.Classify(**cell, false) != CellClassifier::OUTSIDE)
+        {
+          AddCell(classifier, std::move(*cell), cellIds, a_cells);
+        }
+      }
+    }
+
+    void Polyfill::AddCell(
+        const CellClassifier & a_classifier,
+        std::unique_ptr<ICell> a_cell,
+        std::set<DggsCellId>& a_cellIds,
+        std::vector<std::unique_ptr<ICell> >& a_cells) const
+    {
+      // Cells of nested grids are only ever reached from a single parent
+      if (a_classifier.IsNested() || a_cellIds.insert(a_cell->GetCellId()).second)
+      {
+        a_cells.push_back(std::move(a_cell));
+      }
+    }
+
+    void Polyfill::AddDescendants(
+        const CellClassifier & a_classifier,
+        std::unique_ptr<ICell> a_cell,
+        const unsigned short a_resolution,
+        std::set<DggsCellId>& a_cellIds,
+        std::vector<std::unique_ptr<ICell> >& a_cells) const
+    {
+      std::vector<std::unique_ptr<ICell> > generation;
+      generation.push_back(std::move(a_cell));
+
+      for (unsigned short resolution = generation.front()->GetResolution();
+          resolution < a_resolution; ++resolution)
+      {
+        std::vector<std::unique_ptr<ICell> > nextGeneration;
+        std::set<DggsCellId> nextGenerationIds;
+
+        for (std::vector<std::unique_ptr<ICell> >::iterator cell = generation.begin();
+            cell != generation.end(); ++cell)
+        {
+          std::vector<std::unique_ptr<ICell> > children;
+          m_gridIndexer->GetChildren(**cell, children);
+          for (std::vector<std::unique_ptr<ICell> >::iterator child = children.begin();
+              child != children.end(); ++child)
+          {
+            if (a_classifier.IsNested()
+                || (a_classifier.IsOnFace(**child, resolution + 1U < a_resolution)
+                    && nextGenerationIds.insert((*child)->GetCellId()).second))
+            {
+              nextGeneration.push_back(std::move(*child));
+            }
+          }
+        }
+
+        generation.swap(nextGeneration);
+      }
+
+      for (std::vector<std::unique_ptr<ICell> >::iterator cell = generation.begin();
+          cell != generation.end(); ++cell)
+      {
+        AddCell(a_classifier, std::move(*cell), a_cellIds, a_cells);
+      }
+    }
+  }
+}
@@ -0,0 +1,107 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2016
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Spatial Analysis
+//
+//------------------------------------------------------
+/// @file Polyfill.hpp
+///
+/// Implements the EAGGR::SpatialAnalysis::Polyfill class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "CellClassifier.hpp"
+#include "Src/CoordinateConversion/CoordinateConverter.hpp"
+#include "Src/LatLong/Wgs84Polygon.hpp"
+#include "Src/Model/ICell.hpp"
+#include "Src/Model/IGridIndexer.hpp"
+#include "Src/Model/IProjection.hpp"
+
+namespace EAGGR
+{
+  namespace SpatialAnalysis
+  {
+    /// Finds the cells that cover a polygon.
+    ///
+    /// The cell hierarchy is descended from the cell covering each face. Each cell is classified
+    /// as inside, outside or on the boundary of the polygon. Cells outside the polygon are
+    /// discarded, cells inside the polygon are expanded to their descendants without further
+    /// tests, and only boundary cells are subdivided and tested again.
+    ///
+    /// For grids whose child cells extend beyond their parent the classification uses the region
+    /// enclosing all of the cell's descendants (see IGridIndexer::GetDescendantExtentFactor()),
+    /// clipped to the face, so no covering cell is missed.
+    ///
+    /// The cells are classified by CellClassifier, so the polygon edges are straight lines in
+    /// longitude / latitude.
+    class Polyfill
+    {
+      public:
+        /// Constructor
+        /// @param a_gridIndexer The grid indexer of the DGGS.
+        /// @param a_projection The projection of the DGGS.
+        /// @param a_converter Converter between the sphere used by the projection and WGS84.
+        /// @param a_noOfFaces The number of faces on the polyhedral globe.
+        Polyfill(
+            const Model::GridIndexer::IGridIndexer * const a_gridIndexer,
+            const Model::Projection::IProjection * const a_projection,
+            const CoordinateConversion::CoordinateConverter * const a_converter,
+            const unsigned short a_noOfFaces);
+
+        /// Finds the cells at the requested resolution whose interiors intersect the polygon.
+        /// Areas of the polygon inside its inner rings are excluded.
+        /// @param a_polygon The polygon to fill.
+        /// @param a_resolution The resolution of the output cells.
+        /// @param a_cells Populated with the cells covering the polygon. Each cell appears once.
+        /// @throws EAGGRException If the polygon's outer ring has fewer than three points.
+        void GetCells(
+            const LatLong::Wgs84Polygon & a_polygon,
+            const unsigned short a_resolution,
+            std::vector<std::unique_ptr<Model::Cell::ICell> >& a_cells) const;
+
+      private:
+        /// Adds a cell to the output if it has not been added already.
+        void AddCell(
+            const CellClassifier & a_classifier,
+            std::unique_ptr<Model::Cell::ICell> a_cell,
+            std::set<Model::Cell::DggsCellId>& a_cellIds,
+            std::vector<std::unique_ptr<Model::Cell::ICell> >& a_cells) const;
+
+        /// Adds the descendants of a cell inside the polygon at the requested resolution.
+        void AddDescendants(
+            const CellClassifier & a_classifier,
+            std::unique_ptr<Model::Cell::ICell> a_cell,
+            const unsigned short a_resolution,
+            std::set<Model::Cell::DggsCellId>& a_cellIds,
+            std::vector<std::unique_ptr<Model::Cell::ICell> >& a_cells) const;
+
+        const Model::GridIndexer::IGridIndexer * const m_gridIndexer;
+        const Model::Projection::IProjection * const m_projection;
+        const CoordinateConversion::CoordinateConverter * const m_converter;
+        const unsigned short m_noOfFaces;
+    };
+  }
+}
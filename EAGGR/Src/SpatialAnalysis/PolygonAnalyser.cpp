@@ -29,6 +29,8 @@
 
 #include "PolygonAnalyser.hpp"
 
+#include "Src/EAGGRException.hpp"
+
 namespace EAGGR
 {
   namespace SpatialAnalysis
@@ -36,6 +38,8 @@ namespace EAGGR
     PolygonAnalyser::PolygonAnalyser(polygon_type a_polygon)
         : m_polygon(a_polygon)
     {
+      boost::geometry::envelope(m_polygon, m_envelope);
+      ExpandEnvelope();
     }
 
     PolygonAnalyser::~PolygonAnalyser()
@@ -47,7 +51,7 @@ namespace EAGGR
       return GeometryType::POLYGON;
     }
 
-    bool PolygonAnalyser::Equals(Geometry a_geometry) const
+    bool PolygonAnalyser::Equals(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -58,7 +62,7 @@ namespace EAGGR
       }
     }
 
-    bool PolygonAnalyser::Intersects(Geometry a_geometry) const
+    bool PolygonAnalyser::Intersects(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -73,7 +77,7 @@ namespace EAGGR
       }
     }
 
-    bool PolygonAnalyser::Touches(Geometry a_geometry) const
+    bool PolygonAnalyser::Touches(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -88,7 +92,7 @@ namespace EAGGR
       }
     }
 
-    bool PolygonAnalyser::Contains(Geometry a_geometry) const
+    bool PolygonAnalyser::Contains(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -105,7 +109,7 @@ namespace EAGGR
       }
     }
 
-    bool PolygonAnalyser::Covers(Geometry a_geometry) const
+    bool PolygonAnalyser::Covers(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -122,7 +126,7 @@ namespace EAGGR
       }
     }
 
-    bool PolygonAnalyser::Within(Geometry a_geometry) const
+    bool PolygonAnalyser::Within(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -133,7 +137,7 @@ namespace EAGGR
       }
     }
 
-    bool PolygonAnalyser::CoveredBy(Geometry a_geometry) const
+    bool PolygonAnalyser::CoveredBy(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -144,7 +148,7 @@ namespace EAGGR
       }
     }
 
-    bool PolygonAnalyser::Crosses(Geometry a_geometry) const
+    bool PolygonAnalyser::Crosses(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -157,7 +161,7 @@ namespace EAGGR
       }
     }
 
-    bool PolygonAnalyser::Overlaps(Geometry a_geometry) const
+    bool PolygonAnalyser::Overlaps(const Geometry & a_geometry) const
     {
       switch (a_geometry.m_type)
       {
@@ -168,6 +172,24 @@ namespace EAGGR
       }
     }
 
+    RelationMatrix PolygonAnalyser::Relate(const Geometry & a_geometry) const
+    {
+      switch (a_geometry.m_type)
+      {
+        case POINT:
+          return RelationMatrix(
+              boost::geometry::relation(m_polygon, a_geometry.m_point).str());
+        case LINESTRING:
+          return RelationMatrix(
+              boost::geometry::relation(m_polygon, a_geometry.m_linestring).str());
+        case POLYGON:
+          return RelationMatrix(
+              boost::geometry::relation(m_polygon, a_geometry.m_polygon).str());
+        default:
+          throw EAGGRException("Unsupported geometry type.");
+      }
+    }
+
     GeometryType PolygonAnalyser::GetGeometryType() const
     {
       return GeometryType::POLYGON;
@@ -0,0 +1,200 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2016
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Spatial Analysis
+//
+//------------------------------------------------------
+/// @file RegionCoverer.cpp
+///
+/// Implements the EAGGR::SpatialAnalysis::RegionCoverer class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <deque>
+#include <set>
+#include <sstream>
+
+#include "RegionCoverer.hpp"
+#include "Src/EAGGRException.hpp"
+
+namespace EAGGR
+{
+  namespace SpatialAnalysis
+  {
+    using namespace Model;
+    using namespace Model::Cell;
+
+    RegionCoverer::RegionCoverer(
+        const GridIndexer::IGridIndexer * const a_gridIndexer,
+        const Projection::IProjection * const a_projection,
+        const CoordinateConversion::CoordinateConverter * const a_converter,
+        const unsigned short a_noOfFaces,
+        const unsigned short a_minResolution,
+        const unsigned short a_maxResolution,
+        const unsigned int a_maxCells)
+        : m_gridIndexer(a_gridIndexer),
+          m_projection(a_projection),
+          m_converter(a_converter),
+          m_noOfFaces(a_noOfFaces),
+          m_minResolution(a_minResolution),
+          m_maxResolution(a_maxResolution),
+          m_maxCells(a_maxCells)
+    {
+      if (a_minResolution > a_maxResolution)
+      {
+        std::stringstream errorMessage;
+        errorMessage << "Minimum resolution (" << a_minResolution
+            << ") exceeds the maximum resolution (" << a_maxResolution << ").";
+        throw EAGGRException(errorMessage.str());
+      }
+
+      if (a_maxCells == 0U)
+      {
+        throw EAGGRException("Maximum number of cells in a covering must be greater than zero.");
+      }
+    }
+
+    void RegionCoverer::GetCovering(
+        const LatLong::Wgs84Polygon & a_polygon,
+        const CoveringType a_coveringType,
+        std::vector<std::unique_ptr<ICell> >& a_cells) const
+    {
+      const CellClassifier classifier(m_gridIndexer, m_projection, m_converter, a_polygon);
+      GetCovering(classifier, a_coveringType, a_cells);
+    }
+
+    void RegionCoverer::GetCovering(
+        const LatLong::Wgs84Linestring & a_linestring,
+        const CoveringType a_coveringType,
+        std::vector<std::unique_ptr<ICell> >& a_cells) const
+    {
+      const CellClassifier classifier(m_gridIndexer, m_projection, m_converter, a_linestring);
+      GetCovering(classifier, a_coveringType, a_cells);
+    }
+
+    void RegionCoverer::GetCovering(
+        const Utilities::Maths::Degrees a_minLatitude,
+        const Utilities::Maths::Degrees a_minLongitude,
+        const Utilities::Maths::Degrees a_maxLatitude,
+        const Utilities::Maths::Degrees a_maxLongitude,
+        const CoveringType a_coveringType,
+        std::vector<std::unique_ptr<ICell> >& a_cells) const
+    {
+      const CellClassifier classifier(
+          m_gridIndexer,
+          m_projection,
+          m_converter,
+          a_minLatitude,
+          a_minLongitude,
+          a_maxLatitude,
+          a_maxLongitude);
+      GetCovering(classifier, a_coveringType, a_cells);
+    }
+
+    void RegionCoverer::GetCovering(
+        const CellClassifier & a_classifier,
+        const CoveringType a_coveringType,
+        std::vector<std::unique_ptr<ICell> >& a_cells) const
+    {
+      // Children are shared by several parents in grids that are not nested
+      std::set<DggsCellId> cellIds;
+
+      // Children are always one resolution finer than their parent, so a first-in first-out
+      // queue subdivides the coarsest candidates first
+      std::deque<Candidate> candidates;
+      for (FaceIndex faceIndex = 0U; faceIndex < m_noOfFaces; ++faceIndex)
+      {
+        Candidate candidate;
+        candidate.m_cell = m_gridIndexer->GetCell(FaceCoordinate(faceIndex, 0.0, 0.0, 1.0));
+        candidate.m_classification = a_classifier.Classify(*candidate.m_cell, false);
+        if (candidate.m_classification != CellClassifier::OUTSIDE)
+        {
+          candidates.push_back(std::move(candidate));
+        }
+      }
+
+      // The queued candidates count towards the budget whether or not they end up in an
+      // interior covering, which bounds the work done along the region's boundary
+      std::size_t coveringSize = a_cells.size() + candidates.size();
+
+      while (!candidates.empty())
+      {
+        Candidate candidate = std::move(candidates.front());
+        candidates.pop_front();
+
+        const unsigned short resolution = candidate.m_cell->GetResolution();
+        const bool isFinal = resolution >= m_maxResolution
+            || (resolution >= m_minResolution
+                && candidate.m_classification == CellClassifier::INSIDE);
+
+        std::vector<Candidate> children;
+        if (!isFinal)
+        {
+          std::vector<std::unique_ptr<ICell> > childCells;
+          m_gridIndexer->GetChildren(*candidate.m_cell, childCells);
+          for (std::vector<std::unique_ptr<ICell> >::iterator childCell = childCells.begin();
+              childCell != childCells.end(); ++childCell)
+          {
+            // The children of a cell that are on its face cover the part of the cell on the face
+            if (!a_classifier.IsNested()
+                && (cellIds.count((*childCell)->GetCellId()) != 0U
+                    || !a_classifier.IsOnFace(**childCell, false)))
+            {
+              continue;
+            }
+
+            Candidate child;
+            child.m_classification = a_classifier.Classify(**childCell, false);
+            if (child.m_classification != CellClassifier::OUTSIDE)
+            {
+              child.m_cell = std::move(*childCell);
+              children.push_back(std::move(child));
+            }
+          }
+        }
+
+        if (!isFinal
+            && (resolution < m_minResolution
+                || coveringSize - 1U + children.size() <= m_maxCells))
+        {
+          coveringSize = coveringSize - 1U + children.size();
+          for (std::vector<Candidate>::iterator child = children.begin();
+              child != children.end(); ++child)
+          {
+            if (!a_classifier.IsNested())
+            {
+              static_cast<void>(cellIds.insert(child->m_cell->GetCellId()));
+            }
+            candidates.push_back(std::move(*child));
+          }
+        }
+        else if (a_coveringType == EXTERIOR_COVERING
+            || candidate.m_classification == CellClassifier::INSIDE)
+        {
+          a_cells.push_back(std::move(candidate.m_cell));
+        }
+        else
+        {
+          --coveringSize;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,151 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2016
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Spatial Analysis
+//
+//------------------------------------------------------
+/// @file RegionCoverer.hpp
+///
+/// Implements the EAGGR::SpatialAnalysis::RegionCoverer class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "CellClassifier.hpp"
+#include "Src/CoordinateConversion/CoordinateConverter.hpp"
+#include "Src/LatLong/Wgs84Linestring.hpp"
+#include "Src/LatLong/Wgs84Polygon.hpp"
+#include "Src/Model/ICell.hpp"
+#include "Src/Model/IGridIndexer.hpp"
+#include "Src/Model/IProjection.hpp"
+#include "Src/Utilities/Maths.hpp"
+
+namespace EAGGR
+{
+  namespace SpatialAnalysis
+  {
+    enum CoveringType
+    {
+      /// Cells that together contain the whole region.
+      EXTERIOR_COVERING,
+      /// Cells that lie entirely inside the region.
+      INTERIOR_COVERING
+    };
+
+    /// Approximates a region with a limited number of cells of mixed resolution.
+    ///
+    /// Candidate cells are subdivided coarsest first, starting from the cell covering each face.
+    /// A candidate is replaced by its children (ignoring those outside the region) as long as the
+    /// covering stays within the cell budget. Candidates inside the region are not subdivided
+    /// once the minimum resolution is reached. When subdivision stops, an exterior covering keeps
+    /// every candidate that is not outside the region and an interior covering keeps only the
+    /// candidates inside it.
+    ///
+    /// The cells are classified by CellClassifier, so the region edges are straight lines in
+    /// longitude / latitude.
+    class RegionCoverer
+    {
+      public:
+        /// Constructor
+        /// @param a_gridIndexer The grid indexer of the DGGS.
+        /// @param a_projection The projection of the DGGS.
+        /// @param a_converter Converter between the sphere used by the projection and WGS84.
+        /// @param a_noOfFaces The number of faces on the polyhedral globe.
+        /// @param a_minResolution The coarsest resolution of the output cells.
+        /// @param a_maxResolution The finest resolution of the output cells.
+        /// @param a_maxCells The number of cells the covering should not exceed. The covering may
+        /// exceed it if the region needs more cells at the minimum resolution.
+        /// @throws EAGGRException If the minimum resolution exceeds the maximum or the maximum
+        /// number of cells is zero.
+        RegionCoverer(
+            const Model::GridIndexer::IGridIndexer * const a_gridIndexer,
+            const Model::Projection::IProjection * const a_projection,
+            const CoordinateConversion::CoordinateConverter * const a_converter,
+            const unsigned short a_noOfFaces,
+            const unsigned short a_minResolution,
+            const unsigned short a_maxResolution,
+            const unsigned int a_maxCells);
+
+        /// Finds the cells covering a polygon. Areas inside the polygon's inner rings are outside
+        /// the region.
+        /// @param a_polygon The polygon to cover.
+        /// @param a_coveringType Whether to find an exterior or interior covering.
+        /// @param a_cells Populated with the covering cells. Each cell appears once.
+        /// @throws EAGGRException If the polygon's outer ring has fewer than three points.
+        void GetCovering(
+            const LatLong::Wgs84Polygon & a_polygon,
+            const CoveringType a_coveringType,
+            std::vector<std::unique_ptr<Model::Cell::ICell> >& a_cells) const;
+
+        /// Finds the cells covering a linestring. The interior covering of a linestring is empty.
+        /// @param a_linestring The linestring to cover.
+        /// @param a_coveringType Whether to find an exterior or interior covering.
+        /// @param a_cells Populated with the covering cells. Each cell appears once.
+        /// @throws EAGGRException If the linestring has fewer than two points.
+        void GetCovering(
+            const LatLong::Wgs84Linestring & a_linestring,
+            const CoveringType a_coveringType,
+            std::vector<std::unique_ptr<Model::Cell::ICell> >& a_cells) const;
+
+        /// Finds the cells covering a bounding box.
+        /// @param a_minLatitude The southern edge of the box.
+        /// @param a_minLongitude The western edge of the box.
+        /// @param a_maxLatitude The northern edge of the box.
+        /// @param a_maxLongitude The eastern edge of the box. A box whose eastern edge is west of
+        /// its western edge crosses the antimeridian.
+        /// @param a_coveringType Whether to find an exterior or interior covering.
+        /// @param a_cells Populated with the covering cells. Each cell appears once.
+        /// @throws EAGGRException If the minimum latitude exceeds the maximum.
+        void GetCovering(
+            const Utilities::Maths::Degrees a_minLatitude,
+            const Utilities::Maths::Degrees a_minLongitude,
+            const Utilities::Maths::Degrees a_maxLatitude,
+            const Utilities::Maths::Degrees a_maxLongitude,
+            const CoveringType a_coveringType,
+            std::vector<std::unique_ptr<Model::Cell::ICell> >& a_cells) const;
+
+      private:
+        /// A cell that is part of the covering unless it is subdivided.
+        struct Candidate
+        {
+            std::unique_ptr<Model::Cell::ICell> m_cell;
+            CellClassifier::Classification m_classification;
+        };
+
+        /// Finds the cells covering the region of a classifier.
+        void GetCovering(
+            const CellClassifier & a_classifier,
+            const CoveringType a_coveringType,
+            std::vector<std::unique_ptr<Model::Cell::ICell> >& a_cells) const;
+
+        const Model::GridIndexer::IGridIndexer * const m_gridIndexer;
+        const Model::Projection::IProjection * const m_projection;
+        const CoordinateConversion::CoordinateConverter * const m_converter;
+        const unsigned short m_noOfFaces;
+        const unsigned short m_minResolution;
+        const unsigned short m_maxResolution;
+        const unsigned int m_maxCells;
+    };
+  }
+}
@@ -0,0 +1,161 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Spatial Analysis
+//
+//------------------------------------------------------
+/// @file RelationMatrix.cpp
+///
+/// Implements the EAGGR::SpatialAnalysis::RelationMatrix class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <algorithm>
+#include <sstream>
+
+#include "RelationMatrix.hpp"
+
+#include "Src/EAGGRException.hpp"
+
+namespace EAGGR
+{
+  namespace SpatialAnalysis
+  {
+    RelationMatrix::RelationMatrix(const std::string & a_matrix)
+        : m_matrix(a_matrix)
+    {
+      if (m_matrix.size() != m_MATRIX_SIZE
+          || m_matrix.find_first_not_of("F012") != std::string::npos)
+      {
+        std::stringstream stream;
+        stream << "Invalid relation matrix '" << a_matrix << "'.";
+        throw EAGGRException(stream.str());
+      }
+    }
+
+    const std::string & RelationMatrix::GetMatrix() const
+    {
+      return m_matrix;
+    }
+
+    bool RelationMatrix::Matches(const AnalysisType a_analysisType) const
+    {
+      // Patterns are those defined by the OGC Simple Features specification
+      switch (a_analysisType)
+      {
+        case EQUALS:
+          return Matches("T*F**FFF*");
+        case CONTAINS:
+          return Matches("T*****FF*");
+        case WITHIN:
+          return Matches("T*F**F***");
+        case TOUCHES:
+          return Matches("FT*******") || Matches("F**T*****") || Matches("F***T****");
+        case DISJOINT:
+          return Matches("FF*FF****");
+        case INTERSECTS:
+          return !Matches("FF*FF****");
+        case COVERS:
+          return Matches("T*****FF*") || Matches("*T****FF*") || Matches("***T**FF*")
+              || Matches("****T*FF*");
+        case COVERED_BY:
+          return Matches("T*F**F***") || Matches("*TF**F***") || Matches("**FT*F***")
+              || Matches("**F*TF***");
+        case CROSSES:
+        {
+          // Crosses is not defined for two areas or two points
+          const int baseDimension = GetBaseDimension();
+          const int comparisonDimension = GetComparisonDimension();
+          if (baseDimension < comparisonDimension)
+          {
+            return Matches("T*T******");
+          }
+          if (baseDimension > comparisonDimension)
+          {
+            return Matches("T*****T**");
+          }
+          return baseDimension == 1 && Matches("0********");
+        }
+        case OVERLAPS:
+        {
+          // Overlaps is only defined for geometries of the same dimension
+          const int baseDimension = GetBaseDimension();
+          if (baseDimension != GetComparisonDimension())
+          {
+            return false;
+          }
+          return Matches(baseDimension == 1 ? "1*T***T**" : "T*T***T**");
+        }
+        default:
+          throw EAGGRException("Unsupported analysis type.");
+      }
+    }
+
+    bool RelationMatrix::Matches(const std::string & a_pattern) const
+    {
+      if (a_pattern.size() != m_MATRIX_SIZE
+          || a_pattern.find_first_not_of("TF*012") != std::string::npos)
+      {
+        std::stringstream stream;
+        stream << "Invalid relation pattern '" << a_pattern << "'.";
+        throw EAGGRException(stream.str());
+      }
+
+      for (unsigned int index = 0U; index < m_MATRIX_SIZE; ++index)
+      {
+        const char required = a_pattern[index];
+        const char entry = m_matrix[index];
+
+        if ((required == 'T' && entry == 'F') || (required != 'T' && required != '*'
+            && required != entry))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    int RelationMatrix::GetDimension(const char a_entry)
+    {
+      return a_entry == 'F' ? -1 : a_entry - '0';
+    }
+
+    int RelationMatrix::GetBaseDimension() const
+    {
+      int dimension = -1;
+      for (unsigned int column = 0U; column < m_ROW_SIZE; ++column)
+      {
+        dimension = std::max(dimension, GetDimension(m_matrix[column]));
+      }
+      return dimension;
+    }
+
+    int RelationMatrix::GetComparisonDimension() const
+    {
+      int dimension = -1;
+      for (unsigned int row = 0U; row < m_ROW_SIZE; ++row)
+      {
+        dimension = std::max(dimension, GetDimension(m_matrix[row * m_ROW_SIZE]));
+      }
+      return dimension;
+    }
+  }
+}
@@ -0,0 +1,86 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Spatial Analysis
+//
+//------------------------------------------------------
+/// @file RelationMatrix.hpp
+///
+/// Implements the EAGGR::SpatialAnalysis::RelationMatrix class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+#include "GeometryTypes.hpp"
+
+namespace EAGGR
+{
+  namespace SpatialAnalysis
+  {
+    /// The DE-9IM matrix describing how two geometries relate.
+    ///
+    /// Each entry is the dimension ('0', '1' or '2') of the intersection of the interior, boundary
+    /// or exterior of the base geometry (rows) with those of the comparison geometry (columns), or
+    /// 'F' if they do not intersect. Every spatial predicate can be found from the matrix, so it
+    /// only needs to be calculated once for a pair of geometries.
+    class RelationMatrix
+    {
+      public:
+        /// Constructor
+        /// @param a_matrix The nine entries of the matrix in row order.
+        /// @throws EAGGRException If the matrix is not valid.
+        explicit RelationMatrix(const std::string & a_matrix);
+
+        /// @return The nine entries of the matrix in row order.
+        const std::string & GetMatrix() const;
+
+        /// @param a_analysisType The predicate to evaluate.
+        /// @return The result of the predicate for the geometries the matrix was found for.
+        /// @throws EAGGRException If the analysis type is not supported.
+        bool Matches(const AnalysisType a_analysisType) const;
+
+        /// @param a_pattern Nine characters in row order, each 'T' (any intersection), 'F' (no
+        /// intersection), '*' (anything) or the required dimension.
+        /// @return True if every entry of the matrix matches the pattern.
+        /// @throws EAGGRException If the pattern is not valid.
+        bool Matches(const std::string & a_pattern) const;
+
+      private:
+        /// @return The dimension of an entry, or -1 if it is 'F'.
+        static int GetDimension(const char a_entry);
+
+        /// @return The dimension of the base geometry, which is the largest dimension in the row
+        /// of its interior.
+        int GetBaseDimension() const;
+
+        /// @return The dimension of the comparison geometry, which is the largest dimension in the
+        /// column of its interior.
+        int GetComparisonDimension() const;
+
+        static const unsigned int m_MATRIX_SIZE = 9U;
+        static const unsigned int m_ROW_SIZE = 3U;
+
+        std::string m_matrix;
+    };
+  }
+}
@@ -45,14 +45,10 @@ namespace EAGGR
         const std::unique_ptr<Cell::ICell> a_dggsCell,
         const GridIndexer::IGridIndexer * const a_gridIndexer,
         const EAGGR::Model::Projection::IProjection * const a_projection)
-        : m_gridIndexer(a_gridIndexer), m_projection(a_projection)
+        : m_gridIndexer(a_gridIndexer), m_geometryType(GeometryType::POLYGON),
+          m_projection(a_projection)
     {
-      polygon_type cellOutline;
-      CreateCell(*a_dggsCell, cellOutline);
-      m_analyser.reset(new PolygonAnalyser(cellOutline));
-      polygon_type latLongCellOutline;
-      CreateLatLongCell(*a_dggsCell, latLongCellOutline);
-      m_latLongAnalyser.reset(new PolygonAnalyser(latLongCellOutline));
+      AddCellRing(*a_dggsCell, m_rings);
 
       // Point analysis is always on one face
       m_isOnSingleFace = true;
@@ -63,20 +59,15 @@ namespace EAGGR
         const std::vector<std::unique_ptr<Cell::ICell> > & a_dggsLinestring,
         const GridIndexer::IGridIndexer * const a_gridIndexer,
         const EAGGR::Model::Projection::IProjection * const a_projection)
-        : m_gridIndexer(a_gridIndexer), m_projection(a_projection)
+        : m_gridIndexer(a_gridIndexer), m_geometryType(GeometryType::LINESTRING),
+          m_projection(a_projection)
     {
       if (a_dggsLinestring.size() == 0)
       {
         throw EAGGRException("Linestring has no cells.");
       }
 
-      linestring_type linestring;
-      CreateLinestring(a_dggsLinestring, linestring);
-      m_analyser.reset(new LinestringAnalyser(linestring));
-
-      linestring_type latLongLinestring;
-      CreateLatLongLinestring(a_dggsLinestring, latLongLinestring);
-      m_latLongAnalyser.reset(new LinestringAnalyser(latLongLinestring));
+      AddCentreRing(a_dggsLinestring, m_rings);
 
       m_faceIndex = a_dggsLinestring[0]->GetFaceIndex();
       m_isOnSingleFace = IsGeometryContainedWithinFace(a_dggsLinestring, m_faceIndex);
@@ -87,20 +78,15 @@ namespace EAGGR
         const std::vector<std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > > & a_dggsPolygonInnerRings,
         const GridIndexer::IGridIndexer * const a_gridIndexer,
         const EAGGR::Model::Projection::IProjection * const a_projection)
-        : m_gridIndexer(a_gridIndexer), m_projection(a_projection)
+        : m_gridIndexer(a_gridIndexer), m_geometryType(GeometryType::POLYGON),
+          m_projection(a_projection)
     {
       if (a_dggsPolygonOuterRing.size() == 0)
       {
         throw EAGGRException("Polygon outer ring has no cells.");
       }
 
-      polygon_type polygon;
-      CreatePolygon(a_dggsPolygonOuterRing, a_dggsPolygonInnerRings, polygon);
-      m_analyser.reset(new PolygonAnalyser(polygon));
-
-      polygon_type latLongPolygon;
-      CreateLatLongPolygon(a_dggsPolygonOuterRing, a_dggsPolygonInnerRings, latLongPolygon);
-      m_latLongAnalyser.reset(new PolygonAnalyser(latLongPolygon));
+      AddPolygonRings(a_dggsPolygonOuterRing, a_dggsPolygonInnerRings, m_rings);
 
       m_faceIndex = a_dggsPolygonOuterRing[0]->GetFaceIndex();
       m_isOnSingleFace = IsGeometryContainedWithinFace(a_dggsPolygonOuterRing, m_faceIndex);
@@ -110,42 +96,24 @@ namespace EAGGR
         const std::unique_ptr<EAGGR::Model::Cell::ICell> a_dggsCell,
         const AnalysisType a_analysisType) const
     {
-      Geometry geometry;
-      geometry.m_type = GeometryType::POLYGON;
+      FaceCoordinateRings rings;
+      AddCellRing(*a_dggsCell, rings);
 
       // Check the point is on the same face as the geometry used by the analyser
       bool onSameFace = m_isOnSingleFace && IsGeometryContainedWithinFace(a_dggsCell, m_faceIndex);
-      if (onSameFace)
-      {
-        CreateCell(*a_dggsCell, geometry.m_polygon);
-        return AnalyseGeometry(*m_analyser, geometry, a_analysisType);
-      }
-      else
-      {
-        CreateLatLongCell(*a_dggsCell, geometry.m_polygon);
-        return AnalyseGeometry(*m_latLongAnalyser, geometry, a_analysisType);
-      }
+      return AnalyseRings(GeometryType::POLYGON, rings, onSameFace, a_analysisType);
     }
 
     bool SpatialAnalysis::Analyse(
         const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsLineString,
         const AnalysisType a_analysisType) const
     {
-      Geometry geometry;
-      geometry.m_type = GeometryType::LINESTRING;
+      FaceCoordinateRings rings;
+      AddCentreRing(a_dggsLineString, rings);
 
       bool onSameFace = m_isOnSingleFace
           && IsGeometryContainedWithinFace(a_dggsLineString, m_faceIndex);
-      if (onSameFace)
-      {
-        CreateLinestring(a_dggsLineString, geometry.m_linestring);
-        return AnalyseGeometry(*m_analyser, geometry, a_analysisType);
-      }
-      else
-      {
-        CreateLatLongLinestring(a_dggsLineString, geometry.m_linestring);
-        return AnalyseGeometry(*m_latLongAnalyser, geometry, a_analysisType);
-      }
+      return AnalyseRings(GeometryType::LINESTRING, rings, onSameFace, a_analysisType);
     }
 
     bool SpatialAnalysis::Analyse(
@@ -153,174 +121,274 @@ namespace EAGGR
         const std::vector<std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > > & a_dggsPolygonInnerRings,
         const AnalysisType a_analysisType) const
     {
-      Geometry geometry;
-      geometry.m_type = GeometryType::POLYGON;
+      FaceCoordinateRings rings;
+      AddPolygonRings(a_dggsPolygonOuterRing, a_dggsPolygonInnerRings, rings);
 
       bool onSameFace = m_isOnSingleFace
           && IsGeometryContainedWithinFace(a_dggsPolygonOuterRing, m_faceIndex);
+      return AnalyseRings(GeometryType::POLYGON, rings, onSameFace, a_analysisType);
+    }
 
-      if (onSameFace)
-      {
-        CreatePolygon(a_dggsPolygonOuterRing, a_dggsPolygonInnerRings, geometry.m_polygon);
-        return AnalyseGeometry(*m_analyser, geometry, a_analysisType);
-      }
-      else
-      {
-        CreateLatLongPolygon(a_dggsPolygonOuterRing, a_dggsPolygonInnerRings, geometry.m_polygon);
-        return AnalyseGeometry(*m_latLongAnalyser, geometry, a_analysisType);
-      }
+    RelationMatrix SpatialAnalysis::Relate(const std::unique_ptr<Cell::ICell> a_dggsCell) const
+    {
+      FaceCoordinateRings rings;
+      AddCellRing(*a_dggsCell, rings);
+
+      bool onSameFace = m_isOnSingleFace && IsGeometryContainedWithinFace(a_dggsCell, m_faceIndex);
+      return RelateRings(GeometryType::POLYGON, rings, onSameFace);
     }
 
-    void SpatialAnalysis::CreatePoint(const Cell::ICell & a_dggsCell, point_type& a_point) const
+    RelationMatrix SpatialAnalysis::Relate(
+        const std::vector<std::unique_ptr<Cell::ICell> > & a_dggsLinestring) const
     {
-      FaceCoordinate coordinate = m_gridIndexer->GetFaceCoordinate(a_dggsCell);
-      a_point.x(coordinate.GetXOffset());
-      a_point.y(coordinate.GetYOffset());
+      FaceCoordinateRings rings;
+      AddCentreRing(a_dggsLinestring, rings);
+
+      bool onSameFace = m_isOnSingleFace
+          && IsGeometryContainedWithinFace(a_dggsLinestring, m_faceIndex);
+      return RelateRings(GeometryType::LINESTRING, rings, onSameFace);
     }
 
-    void SpatialAnalysis::CreateLatLongPoint(
-        const Cell::ICell & a_dggsCell,
-        point_type& a_point) const
+    RelationMatrix SpatialAnalysis::Relate(
+        const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsPolygonOuterRing,
+        const std::vector<std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > > & a_dggsPolygonInnerRings) const
     {
-      FaceCoordinate coordinate = m_gridIndexer->GetFaceCoordinate(a_dggsCell);
-      LatLong::SphericalAccuracyPoint sphericalPoint = m_projection->GetLatLongPoint(coordinate);
-      LatLong::Wgs84AccuracyPoint wgs84Point = m_converter.ConvertSphereToWGS84(sphericalPoint);
-      a_point.x(wgs84Point.GetLongitude());
-      a_point.y(wgs84Point.GetLatitude());
+      FaceCoordinateRings rings;
+      AddPolygonRings(a_dggsPolygonOuterRing, a_dggsPolygonInnerRings, rings);
+
+      bool onSameFace = m_isOnSingleFace
+          && IsGeometryContainedWithinFace(a_dggsPolygonOuterRing, m_faceIndex);
+      return RelateRings(GeometryType::POLYGON, rings, onSameFace);
     }
 
-    void SpatialAnalysis::CreateCell(const Cell::ICell & a_dggsCell, polygon_type& a_cell) const
+    bool SpatialAnalysis::Analyse(
+        const SpatialAnalysis & a_comparisonShape,
+        const AnalysisType a_analysisType) const
     {
-      std::list < FaceCoordinate > vertices;
-      m_gridIndexer->GetCellVertices(a_dggsCell, vertices);
+      const bool isLatLong = !IsOnSameFace(a_comparisonShape);
+      return AnalyseGeometry(
+          isLatLong ? GetLatLongAnalyser() : GetAnalyser(),
+          a_comparisonShape.GetGeometry(isLatLong),
+          a_analysisType);
+    }
 
-      linestring_type outerLine;
+    const GeometryAnalyser& SpatialAnalysis::GetAnalyser() const
+    {
+      std::call_once(m_analyserCreated, [this]()
+      {
+        m_analyser.reset(CreateAnalyser(false, m_geometry));
+      });
+      return *m_analyser;
+    }
 
-      for (std::list<FaceCoordinate>::const_iterator vertexIter = vertices.begin();
-          vertexIter != vertices.end(); ++vertexIter)
+    const GeometryAnalyser& SpatialAnalysis::GetLatLongAnalyser() const
+    {
+      // Projecting the vertices to lat / long is the most expensive step, so it is skipped for
+      // base shapes only compared with shapes on their own face
+      std::call_once(m_latLongAnalyserCreated, [this]()
       {
-        point_type point;
-        point.x(vertexIter->GetXOffset());
-        point.y(vertexIter->GetYOffset());
+        m_latLongAnalyser.reset(CreateAnalyser(true, m_latLongGeometry));
+      });
+      return *m_latLongAnalyser;
+    }
 
-        boost::geometry::append(outerLine, point);
+    GeometryAnalyser * SpatialAnalysis::CreateAnalyser(
+        const bool a_isLatLong,
+        Geometry & a_geometry) const
+    {
+      CreateGeometry(m_geometryType, m_rings, a_isLatLong, a_geometry);
+
+      if (m_geometryType == GeometryType::LINESTRING)
+      {
+        return new LinestringAnalyser(a_geometry.m_linestring);
       }
 
-      boost::geometry::assign_points(a_cell.outer(), outerLine);
+      return new PolygonAnalyser(a_geometry.m_polygon);
+    }
+
+    const Geometry & SpatialAnalysis::GetGeometry(const bool a_isLatLong) const
+    {
+      // The geometry is set when the analyser is created
+      if (a_isLatLong)
+      {
+        GetLatLongAnalyser();
+        return m_latLongGeometry;
+      }
 
-      // Use the correct function to ensure it is closed
-      boost::geometry::correct(a_cell);
+      GetAnalyser();
+      return m_geometry;
     }
 
-    void SpatialAnalysis::CreateLatLongCell(
+    void SpatialAnalysis::AddCellRing(
         const Cell::ICell & a_dggsCell,
-        polygon_type& a_cell) const
+        FaceCoordinateRings & a_rings) const
     {
       std::list < FaceCoordinate > vertices;
       m_gridIndexer->GetCellVertices(a_dggsCell, vertices);
 
-      linestring_type outerLine;
-
-      for (std::list<FaceCoordinate>::const_iterator vertexIter = vertices.begin();
-          vertexIter != vertices.end(); ++vertexIter)
-      {
-        LatLong::SphericalAccuracyPoint sphericalPoint = m_projection->GetLatLongPoint(*vertexIter);
-        LatLong::Wgs84AccuracyPoint wgs84Point = m_converter.ConvertSphereToWGS84(sphericalPoint);
+      a_rings.push_back(std::vector<FaceCoordinate>(vertices.begin(), vertices.end()));
+    }
 
-        point_type point;
-        point.x(wgs84Point.GetLongitude());
-        point.y(wgs84Point.GetLatitude());
+    void SpatialAnalysis::AddCentreRing(
+        const std::vector<std::unique_ptr<Cell::ICell> > & a_dggsCells,
+        FaceCoordinateRings & a_rings) const
+    {
+      a_rings.push_back(std::vector<FaceCoordinate>());
+      a_rings.back().reserve(a_dggsCells.size());
 
-        boost::geometry::append(outerLine, point);
+      for (std::vector<std::unique_ptr<Cell::ICell> >::const_iterator cellIter =
+          a_dggsCells.begin(); cellIter < a_dggsCells.end(); ++cellIter)
+      {
+        a_rings.back().push_back(m_gridIndexer->GetFaceCoordinate(**cellIter));
       }
+    }
 
-      boost::geometry::assign_points(a_cell.outer(), outerLine);
+    void SpatialAnalysis::AddPolygonRings(
+        const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsPolygonOuterRing,
+        const std::vector<std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > > & a_dggsPolygonInnerRings,
+        FaceCoordinateRings & a_rings) const
+    {
+      AddCentreRing(a_dggsPolygonOuterRing, a_rings);
 
-      // Use the correct function to ensure it is closed
-      boost::geometry::correct(a_cell);
+      for (unsigned int index = 0; index < a_dggsPolygonInnerRings.size(); ++index)
+      {
+        AddCentreRing(a_dggsPolygonInnerRings.at(index), a_rings);
+      }
     }
 
-    void SpatialAnalysis::CreateLinestring(
-        const std::vector<std::unique_ptr<Cell::ICell> > & a_dggsLineString,
-        linestring_type& a_linestring) const
+    void SpatialAnalysis::CreatePoint(
+        const FaceCoordinate & a_coordinate,
+        const bool a_isLatLong,
+        point_type& a_point) const
     {
-      for (std::vector<std::unique_ptr<Cell::ICell> >::const_iterator cellIter =
-          a_dggsLineString.begin(); cellIter < a_dggsLineString.end(); ++cellIter)
+      if (a_isLatLong)
       {
-        point_type point;
-
-        Cell::ICell& cell = *(*cellIter).get();
-        CreatePoint(cell, point);
-
-        boost::geometry::append(a_linestring, point);
+        LatLong::SphericalAccuracyPoint sphericalPoint =
+            m_projection->GetLatLongPoint(a_coordinate);
+        LatLong::Wgs84AccuracyPoint wgs84Point = m_converter.ConvertSphereToWGS84(sphericalPoint);
+        a_point.x(wgs84Point.GetLongitude());
+        a_point.y(wgs84Point.GetLatitude());
+      }
+      else
+      {
+        a_point.x(a_coordinate.GetXOffset());
+        a_point.y(a_coordinate.GetYOffset());
       }
     }
 
-    void SpatialAnalysis::CreateLatLongLinestring(
-        const std::vector<std::unique_ptr<Cell::ICell> > & a_dggsLineString,
+    void SpatialAnalysis::CreateLinestring(
+        const std::vector<FaceCoordinate> & a_ring,
+        const bool a_isLatLong,
         linestring_type& a_linestring) const
     {
-      for (std::vector<std::unique_ptr<Cell::ICell> >::const_iterator cellIter =
-          a_dggsLineString.begin(); cellIter < a_dggsLineString.end(); ++cellIter)
+      for (std::vector<FaceCoordinate>::const_iterator coordinateIter = a_ring.begin();
+          coordinateIter != a_ring.end(); ++coordinateIter)
       {
         point_type point;
-
-        Cell::ICell& cell = *(*cellIter).get();
-        CreateLatLongPoint(cell, point);
+        CreatePoint(*coordinateIter, a_isLatLong, point);
 
         boost::geometry::append(a_linestring, point);
       }
     }
 
     void SpatialAnalysis::CreatePolygon(
-        const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsPolygonOuterRing,
-        const std::vector<std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > > & a_dggsPolygonInnerRings,
+        const FaceCoordinateRings & a_rings,
+        const bool a_isLatLong,
         polygon_type& a_polygon) const
     {
       linestring_type outerLine;
-      CreateLinestring(a_dggsPolygonOuterRing, outerLine);
+      CreateLinestring(a_rings.front(), a_isLatLong, outerLine);
       boost::geometry::assign_points(a_polygon.outer(), outerLine);
 
-      a_polygon.inners().resize(a_dggsPolygonInnerRings.size());
+      a_polygon.inners().resize(a_rings.size() - 1U);
 
-      for (unsigned int index = 0; index < a_dggsPolygonInnerRings.size(); ++index)
+      for (unsigned int index = 1U; index < a_rings.size(); ++index)
       {
         linestring_type innerLine;
-        CreateLinestring(a_dggsPolygonInnerRings.at(index), innerLine);
-        boost::geometry::assign_points(a_polygon.inners().at(index), innerLine);
+        CreateLinestring(a_rings.at(index), a_isLatLong, innerLine);
+        boost::geometry::assign_points(a_polygon.inners().at(index - 1U), innerLine);
       }
 
       // Use the correct function to ensure it is closed
       boost::geometry::correct(a_polygon);
     }
 
-    void SpatialAnalysis::CreateLatLongPolygon(
-        const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsPolygonOuterRing,
-        const std::vector<std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > > & a_dggsPolygonInnerRings,
-        polygon_type& a_polygon) const
+    void SpatialAnalysis::CreateGeometry(
+        const GeometryType a_geometryType,
+        const FaceCoordinateRings & a_rings,
+        const bool a_isLatLong,
+        Geometry & a_geometry) const
     {
-      linestring_type outerLine;
-      CreateLatLongLinestring(a_dggsPolygonOuterRing, outerLine);
-      boost::geometry::assign_points(a_polygon.outer(), outerLine);
-
-      a_polygon.inners().resize(a_dggsPolygonInnerRings.size());
+      a_geometry.m_type = a_geometryType;
 
-      for (unsigned int index = 0; index < a_dggsPolygonInnerRings.size(); ++index)
+      if (a_geometryType == GeometryType::LINESTRING)
       {
-        linestring_type innerLine;
-        CreateLatLongLinestring(a_dggsPolygonInnerRings.at(index), innerLine);
-        boost::geometry::assign_points(a_polygon.inners().at(index), innerLine);
+        CreateLinestring(a_rings.front(), a_isLatLong, a_geometry.m_linestring);
       }
+      else
+      {
+        CreatePolygon(a_rings, a_isLatLong, a_geometry.m_polygon);
+      }
+    }
 
-      // Use the correct function to ensure it is closed
-      boost::geometry::correct(a_polygon);
+    bool SpatialAnalysis::AnalyseRings(
+        const GeometryType a_geometryType,
+        const FaceCoordinateRings & a_rings,
+        const bool a_isOnSameFace,
+        const AnalysisType a_analysisType) const
+    {
+      const bool isLatLong = !a_isOnSameFace;
+
+      Geometry geometry;
+      CreateGeometry(a_geometryType, a_rings, isLatLong, geometry);
+
+      return AnalyseGeometry(
+          isLatLong ? GetLatLongAnalyser() : GetAnalyser(),
+          geometry,
+          a_analysisType);
+    }
+
+    RelationMatrix SpatialAnalysis::RelateRings(
+        const GeometryType a_geometryType,
+        const FaceCoordinateRings & a_rings,
+        const bool a_isOnSameFace) const
+    {
+      const bool isLatLong = !a_isOnSameFace;
+
+      Geometry geometry;
+      CreateGeometry(a_geometryType, a_rings, isLatLong, geometry);
+
+      return (isLatLong ? GetLatLongAnalyser() : GetAnalyser()).Relate(geometry);
     }
 
     bool SpatialAnalysis::AnalyseGeometry(
-        GeometryAnalyser& a_analyser,
-        Geometry a_geometry,
+        const GeometryAnalyser& a_analyser,
+        const Geometry & a_geometry,
         AnalysisType a_analysisType) const
     {
+      // Geometries whose bounding boxes do not meet are disjoint, so every other relation is
+      // false
+      if (a_analyser.IsEnvelopeDisjoint(a_geometry))
+      {
+        switch (a_analysisType)
+        {
+          case EQUALS:
+          case CONTAINS:
+          case WITHIN:
+          case TOUCHES:
+          case INTERSECTS:
+          case COVERS:
+          case COVERED_BY:
+          case CROSSES:
+          case OVERLAPS:
+            return false;
+          case DISJOINT:
+            return true;
+          default:
+            throw EAGGRException("Unsupported analysis type.");
+        }
+      }
+
       switch (a_analysisType)
       {
         case EQUALS:
@@ -350,7 +418,7 @@ namespace EAGGR
 
     GeometryType SpatialAnalysis::GetGeometryType() const
     {
-      return m_analyser->GetGeometryType();
+      return m_geometryType;
     }
 
     bool SpatialAnalysis::IsOnSingleFace() const
@@ -358,6 +426,21 @@ namespace EAGGR
       return m_isOnSingleFace;
     }
 
+    unsigned int SpatialAnalysis::GetFaceIndex() const
+    {
+      return m_faceIndex;
+    }
+
+    bool SpatialAnalysis::IsOnSameFace(const SpatialAnalysis & a_shape) const
+    {
+      return m_isOnSingleFace && a_shape.m_isOnSingleFace && m_faceIndex == a_shape.m_faceIndex;
+    }
+
+    const box_type & SpatialAnalysis::GetEnvelope(const bool a_isLatLong) const
+    {
+      return (a_isLatLong ? GetLatLongAnalyser() : GetAnalyser()).GetEnvelope();
+    }
+
     bool SpatialAnalysis::IsGeometryContainedWithinFace(
         const std::unique_ptr<EAGGR::Model::Cell::ICell> & a_cell,
         const unsigned int a_faceIndex) const
@@ -32,10 +32,12 @@
 #include "Src/Model/ICell.hpp"
 #include "Src/Model/IGridIndexer.hpp"
 #include "GeometryAnalyser.hpp"
+#include "RelationMatrix.hpp"
 #include "Src/Model/IProjection.hpp"
 #include "Src/CoordinateConversion/CoordinateConverter.hpp"
 
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <map>
 
@@ -43,11 +45,12 @@ namespace EAGGR
 {
   namespace SpatialAnalysis
   {
-    enum AnalysisType
-    {
-      CONTAINS, COVERED_BY, COVERS, CROSSES, DISJOINT, EQUALS, INTERSECTS, OVERLAPS, TOUCHES, WITHIN
-    };
-
+    /// Compares a base shape with other shapes.
+    ///
+    /// Shapes on the same face as the base shape are compared in the plane of the face, others
+    /// are compared in lat / long. The base shape's analyser for each is only created when it is
+    /// first needed and is kept for later comparisons, so the base shape may be compared with
+    /// many shapes, including from several threads at once.
     class SpatialAnalysis
     {
       public:
@@ -80,55 +83,159 @@ namespace EAGGR
             const std::vector<std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > > & a_dggsPolygonInnerRings,
             const AnalysisType a_analysisType) const;
 
+        /// @param a_dggsCell The cell to compare with the base shape.
+        /// @return The DE-9IM matrix of the base shape and the cell.
+        RelationMatrix Relate(const std::unique_ptr<EAGGR::Model::Cell::ICell> a_dggsCell) const;
+
+        /// @param a_dggsLinestring The linestring to compare with the base shape.
+        /// @return The DE-9IM matrix of the base shape and the linestring.
+        RelationMatrix Relate(
+            const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsLinestring) const;
+
+        /// @param a_dggsPolygonOuterRing The outer ring of the polygon to compare with the base
+        /// shape.
+        /// @param a_dggsPolygonInnerRings The inner rings of the polygon.
+        /// @return The DE-9IM matrix of the base shape and the polygon.
+        RelationMatrix Relate(
+            const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsPolygonOuterRing,
+            const std::vector<std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > > & a_dggsPolygonInnerRings) const;
+
+        /// Compares another prepared shape with the base shape. The geometry of the other shape is
+        /// reused rather than created for the comparison.
+        /// @param a_comparisonShape The shape to compare with the base shape.
+        /// @param a_analysisType The comparison to make.
+        /// @return The result of the comparison.
+        bool Analyse(
+            const SpatialAnalysis & a_comparisonShape,
+            const AnalysisType a_analysisType) const;
+
         GeometryType GetGeometryType() const;
 
         bool IsOnSingleFace() const;
 
+        /// @return The face of the first cell of the base shape.
+        unsigned int GetFaceIndex() const;
+
+        /// @param a_shape Another shape.
+        /// @return True if the shapes are compared in the plane of their face, false if they are
+        /// compared in lat / long.
+        bool IsOnSameFace(const SpatialAnalysis & a_shape) const;
+
+        /// @param a_isLatLong Whether to get the envelope in lat / long or in the plane of the base
+        /// shape's face.
+        /// @return The bounding box of the base shape, enlarged by a small margin.
+        const box_type & GetEnvelope(const bool a_isLatLong) const;
+
       private:
+        /// Rings of face coordinates describing a shape. A polygon has its outer ring followed by
+        /// any inner rings and a linestring has a single ring.
+        typedef std::vector<std::vector<EAGGR::Model::FaceCoordinate> > FaceCoordinateRings;
 
         const EAGGR::Model::GridIndexer::IGridIndexer * const m_gridIndexer;
 
-        std::unique_ptr<GeometryAnalyser> m_analyser;
-        std::unique_ptr<GeometryAnalyser> m_latLongAnalyser;
+        /// The base shape, from which the analysers are created.
+        GeometryType m_geometryType;
+        FaceCoordinateRings m_rings;
+
+        /// The geometry of the base shape in the plane of its face and in lat / long, created with
+        /// the analysers.
+        mutable Geometry m_geometry;
+        mutable Geometry m_latLongGeometry;
+
+        mutable std::unique_ptr<GeometryAnalyser> m_analyser;
+        mutable std::unique_ptr<GeometryAnalyser> m_latLongAnalyser;
+        mutable std::once_flag m_analyserCreated;
+        mutable std::once_flag m_latLongAnalyserCreated;
 
         const EAGGR::Model::Projection::IProjection * const m_projection;
         const EAGGR::CoordinateConversion::CoordinateConverter m_converter;
         unsigned int m_faceIndex;
         bool m_isOnSingleFace;
 
-        void CreatePoint(const EAGGR::Model::Cell::ICell & a_dggsCell, point_type& a_point) const;
+        /// @return The analyser for the base shape in the plane of its face.
+        const GeometryAnalyser& GetAnalyser() const;
 
-        void CreateLatLongPoint(
-            const EAGGR::Model::Cell::ICell & a_dggsCell,
-            point_type& a_point) const;
+        /// @return The analyser for the base shape in lat / long.
+        const GeometryAnalyser& GetLatLongAnalyser() const;
+
+        /// @param a_isLatLong Whether to create the analyser in lat / long or in the plane of
+        /// the base shape's face.
+        /// @param a_geometry Set to the geometry of the base shape.
+        /// @return A new analyser for the base shape.
+        GeometryAnalyser * CreateAnalyser(const bool a_isLatLong, Geometry & a_geometry) const;
 
-        void CreateCell(const EAGGR::Model::Cell::ICell & a_dggsCell, polygon_type& a_cell) const;
+        /// @param a_isLatLong Whether to get the geometry in lat / long or in the plane of the base
+        /// shape's face.
+        /// @return The geometry of the base shape.
+        const Geometry & GetGeometry(const bool a_isLatLong) const;
 
-        void CreateLatLongCell(
+        /// Adds the vertices of a cell as a ring.
+        void AddCellRing(
             const EAGGR::Model::Cell::ICell & a_dggsCell,
-            polygon_type& a_cell) const;
+            FaceCoordinateRings & a_rings) const;
 
-        void CreateLinestring(
-            const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsLineString,
-            linestring_type& a_linestring) const;
+        /// Adds the centres of a sequence of cells as a ring.
+        void AddCentreRing(
+            const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsCells,
+            FaceCoordinateRings & a_rings) const;
 
-        void CreateLatLongLinestring(
-            const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsLineString,
+        /// Adds the centres of the cells of a polygon's rings, outer ring first.
+        void AddPolygonRings(
+            const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsPolygonOuterRing,
+            const std::vector<std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > > & a_dggsPolygonInnerRings,
+            FaceCoordinateRings & a_rings) const;
+
+        void CreatePoint(
+            const EAGGR::Model::FaceCoordinate & a_coordinate,
+            const bool a_isLatLong,
+            point_type& a_point) const;
+
+        void CreateLinestring(
+            const std::vector<EAGGR::Model::FaceCoordinate> & a_ring,
+            const bool a_isLatLong,
             linestring_type& a_linestring) const;
 
         void CreatePolygon(
-            const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsPolygonOuterRing,
-            const std::vector<std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > > & a_dggsPolygonInnerRings,
+            const FaceCoordinateRings & a_rings,
+            const bool a_isLatLong,
             polygon_type& a_polygon) const;
 
-        void CreateLatLongPolygon(
-            const std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > & a_dggsPolygonOuterRing,
-            const std::vector<std::vector<std::unique_ptr<EAGGR::Model::Cell::ICell> > > & a_dggsPolygonInnerRings,
-            polygon_type& a_polygon) const;
+        /// Creates the geometry of a shape.
+        /// @param a_geometryType The type of the shape.
+        /// @param a_rings The rings of the shape.
+        /// @param a_isLatLong Whether to create the geometry in lat / long or in the plane of the
+        /// base shape's face.
+        /// @param a_geometry Set to the geometry of the shape.
+        void CreateGeometry(
+            const GeometryType a_geometryType,
+            const FaceCoordinateRings & a_rings,
+            const bool a_isLatLong,
+            Geometry & a_geometry) const;
+
+        /// Compares a shape with the base shape.
+        /// @param a_geometryType The type of the shape.
+        /// @param a_rings The rings of the shape.
+        /// @param a_isOnSameFace Whether the shape and the base shape are on the same face.
+        /// @param a_analysisType The comparison to make.
+        /// @return The result of the comparison.
+        bool AnalyseRings(
+            const GeometryType a_geometryType,
+            const FaceCoordinateRings & a_rings,
+            const bool a_isOnSameFace,
+            const AnalysisType a_analysisType) const;
+
+        /// @param a_geometryType The type of the shape.
+        /// @param a_rings The rings of the shape.
+        /// @param a_isOnSameFace Whether the shape and the base shape are on the same face.
+        /// @return The DE-9IM matrix of the base shape and the shape.
+        RelationMatrix RelateRings(
+            const GeometryType a_geometryType,
+            const FaceCoordinateRings & a_rings,
+            const bool a_isOnSameFace) const;
 
         bool AnalyseGeometry(
-            GeometryAnalyser& a_analyser,
-            Geometry a_geometry,
+            const GeometryAnalyser& a_analyser,
+            const Geometry & a_geometry,
             AnalysisType a_analysisType) const;
 
         bool IsGeometryContainedWithinFace(
@@ -0,0 +1,243 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Spatial Analysis
+//
+//------------------------------------------------------
+/// @file SpatialJoin.cpp
+///
+/// Implements the EAGGR::SpatialAnalysis::SpatialJoin class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <algorithm>
+
+#include "SpatialJoin.hpp"
+
+namespace EAGGR
+{
+  namespace SpatialAnalysis
+  {
+    SpatialJoin::SpatialJoin(
+        const std::vector<const SpatialAnalysis *> & a_baseShapes,
+        const std::vector<const SpatialAnalysis *> & a_comparisonShapes,
+        const Utilities::WorkStealingPool & a_pool)
+        : m_baseShapes(a_baseShapes), m_comparisonShapes(a_comparisonShapes), m_pool(a_pool),
+          m_comparisonFaceCounts(CountShapesOnFaces(a_comparisonShapes))
+    {
+      const FaceCounts baseFaceCounts = CountShapesOnFaces(m_baseShapes);
+
+      // Create the envelopes in parallel, as projecting the shapes to lat / long is the most
+      // expensive step. Shapes only compared with shapes on their own face are not projected.
+      std::vector<char> isComparedInLatLong(m_comparisonShapes.size());
+      m_pool.ParallelFor(
+          m_comparisonShapes.size(),
+          m_SHAPES_PER_CHUNK,
+          [this, &baseFaceCounts, &isComparedInLatLong](
+              const std::size_t a_begin,
+              const std::size_t a_end)
+          {
+            for (std::size_t shapeIndex = a_begin; shapeIndex < a_end; ++shapeIndex)
+            {
+              const SpatialAnalysis & shape = *m_comparisonShapes[shapeIndex];
+              if (shape.IsOnSingleFace())
+              {
+                shape.GetEnvelope(false);
+              }
+
+              isComparedInLatLong[shapeIndex] =
+                  IsComparedInLatLong(shape, baseFaceCounts, m_baseShapes.size());
+              if (isComparedInLatLong[shapeIndex])
+              {
+                shape.GetEnvelope(true);
+              }
+            }
+          });
+
+      std::map<unsigned int, std::vector<IndexEntry> > faceEntries;
+      std::vector<IndexEntry> latLongEntries;
+      for (std::size_t shapeIndex = 0U; shapeIndex < m_comparisonShapes.size(); ++shapeIndex)
+      {
+        const SpatialAnalysis & shape = *m_comparisonShapes[shapeIndex];
+        if (shape.IsOnSingleFace())
+        {
+          faceEntries[shape.GetFaceIndex()].push_back(
+              IndexEntry(shape.GetEnvelope(false), shapeIndex));
+        }
+
+        if (isComparedInLatLong[shapeIndex])
+        {
+          latLongEntries.push_back(IndexEntry(shape.GetEnvelope(true), shapeIndex));
+        }
+      }
+
+      // Creating the R-trees from a range bulk-loads them using the packing algorithm
+      for (std::map<unsigned int, std::vector<IndexEntry> >::const_iterator faceIter =
+          faceEntries.begin(); faceIter != faceEntries.end(); ++faceIter)
+      {
+        m_faceIndexes.insert(std::make_pair(
+            faceIter->first,
+            RTree(faceIter->second.begin(), faceIter->second.end())));
+      }
+
+      m_latLongIndex = RTree(latLongEntries.begin(), latLongEntries.end());
+    }
+
+    void SpatialJoin::FindPairs(
+        const AnalysisType a_analysisType,
+        std::vector<ShapePair> & a_pairs) const
+    {
+      std::vector<std::vector<ShapePair> > baseShapePairs(m_baseShapes.size());
+
+      m_pool.ParallelFor(
+          m_baseShapes.size(),
+          m_SHAPES_PER_CHUNK,
+          [this, a_analysisType, &baseShapePairs](
+              const std::size_t a_begin,
+              const std::size_t a_end)
+          {
+            std::vector<std::size_t> candidates;
+            for (std::size_t baseIndex = a_begin; baseIndex < a_end; ++baseIndex)
+            {
+              const SpatialAnalysis & baseShape = *m_baseShapes[baseIndex];
+              std::vector<ShapePair> & pairs = baseShapePairs[baseIndex];
+
+              FindCandidates(baseShape, candidates);
+
+              if (a_analysisType == DISJOINT)
+              {
+                // Shapes whose envelopes do not meet are disjoint
+                std::vector<std::size_t>::const_iterator candidateIter = candidates.begin();
+                for (std::size_t comparisonIndex = 0U; comparisonIndex < m_comparisonShapes.size();
+                    ++comparisonIndex)
+                {
+                  if (candidateIter != candidates.end() && *candidateIter == comparisonIndex)
+                  {
+                    ++candidateIter;
+                    if (!baseShape.Analyse(*m_comparisonShapes[comparisonIndex], a_analysisType))
+                    {
+                      continue;
+                    }
+                  }
+
+                  pairs.push_back(ShapePair(baseIndex, comparisonIndex));
+                }
+              }
+              else
+              {
+                for (std::vector<std::size_t>::const_iterator candidateIter = candidates.begin();
+                    candidateIter != candidates.end(); ++candidateIter)
+                {
+                  if (baseShape.Analyse(*m_comparisonShapes[*candidateIter], a_analysisType))
+                  {
+                    pairs.push_back(ShapePair(baseIndex, *candidateIter));
+                  }
+                }
+              }
+            }
+          });
+
+      a_pairs.clear();
+      for (std::vector<std::vector<ShapePair> >::const_iterator pairsIter =
+          baseShapePairs.begin(); pairsIter != baseShapePairs.end(); ++pairsIter)
+      {
+        a_pairs.insert(a_pairs.end(), pairsIter->begin(), pairsIter->end());
+      }
+    }
+
+    SpatialJoin::FaceCounts SpatialJoin::CountShapesOnFaces(
+        const std::vector<const SpatialAnalysis *> & a_shapes)
+    {
+      FaceCounts faceCounts;
+      for (std::vector<const SpatialAnalysis *>::const_iterator shapeIter = a_shapes.begin();
+          shapeIter != a_shapes.end(); ++shapeIter)
+      {
+        if ((*shapeIter)->IsOnSingleFace())
+        {
+          ++faceCounts[(*shapeIter)->GetFaceIndex()];
+        }
+      }
+      return faceCounts;
+    }
+
+    bool SpatialJoin::IsComparedInLatLong(
+        const SpatialAnalysis & a_shape,
+        const FaceCounts & a_otherFaceCounts,
+        const std::size_t a_noOfOtherShapes)
+    {
+      if (!a_shape.IsOnSingleFace())
+      {
+        return a_noOfOtherShapes > 0U;
+      }
+
+      // Compared in lat / long unless every shape of the other set is on the same face
+      const FaceCounts::const_iterator faceIter = a_otherFaceCounts.find(a_shape.GetFaceIndex());
+      const std::size_t noOnSameFace = faceIter == a_otherFaceCounts.end() ? 0U : faceIter->second;
+      return noOnSameFace < a_noOfOtherShapes;
+    }
+
+    void SpatialJoin::FindCandidates(
+        const SpatialAnalysis & a_baseShape,
+        std::vector<std::size_t> & a_candidates) const
+    {
+      a_candidates.clear();
+
+      std::vector<IndexEntry> entries;
+
+      if (a_baseShape.IsOnSingleFace())
+      {
+        const std::map<unsigned int, RTree>::const_iterator faceIndexIter =
+            m_faceIndexes.find(a_baseShape.GetFaceIndex());
+        if (faceIndexIter != m_faceIndexes.end())
+        {
+          faceIndexIter->second.query(
+              boost::geometry::index::intersects(a_baseShape.GetEnvelope(false)),
+              std::back_inserter(entries));
+        }
+
+        for (std::vector<IndexEntry>::const_iterator entryIter = entries.begin();
+            entryIter != entries.end(); ++entryIter)
+        {
+          a_candidates.push_back(entryIter->second);
+        }
+        entries.clear();
+      }
+
+      if (IsComparedInLatLong(a_baseShape, m_comparisonFaceCounts, m_comparisonShapes.size()))
+      {
+        m_latLongIndex.query(
+            boost::geometry::index::intersects(a_baseShape.GetEnvelope(true)),
+            std::back_inserter(entries));
+
+        // Shapes on the same face as the base shape were found in the plane of the face
+        for (std::vector<IndexEntry>::const_iterator entryIter = entries.begin();
+            entryIter != entries.end(); ++entryIter)
+        {
+          if (!a_baseShape.IsOnSameFace(*m_comparisonShapes[entryIter->second]))
+          {
+            a_candidates.push_back(entryIter->second);
+          }
+        }
+      }
+
+      std::sort(a_candidates.begin(), a_candidates.end());
+    }
+  }
+}
@@ -0,0 +1,120 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Spatial Analysis
+//
+//------------------------------------------------------
+/// @file SpatialJoin.hpp
+///
+/// Implements the EAGGR::SpatialAnalysis::SpatialJoin class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "SpatialAnalysis.hpp"
+#include "Src/Utilities/WorkStealingPool.hpp"
+
+// Included after the rest of Boost.Geometry (see GeometryTypes.hpp), which it relies on
+#include "boost/geometry/index/rtree.hpp"
+
+namespace EAGGR
+{
+  namespace SpatialAnalysis
+  {
+    /// Finds the pairs of shapes from two sets that satisfy a spatial predicate.
+    ///
+    /// The envelopes of the comparison shapes are bulk-loaded into R-trees, which are searched
+    /// with the envelope of each base shape. Only shapes whose envelopes meet are compared in
+    /// full, as any other pair is disjoint. Shapes on the same face are compared in the plane of
+    /// the face, so their envelopes are indexed by face, while other pairs are found using the
+    /// envelopes in lat / long.
+    class SpatialJoin
+    {
+      public:
+        /// Indices of a base shape and a comparison shape.
+        typedef std::pair<std::size_t, std::size_t> ShapePair;
+
+        /// Constructor - indexes the comparison shapes. The shapes must outlive the join.
+        /// @param a_baseShapes The base shapes.
+        /// @param a_comparisonShapes The shapes to compare with the base shapes.
+        /// @param a_pool The threads used to create the envelopes and compare the shapes.
+        SpatialJoin(
+            const std::vector<const SpatialAnalysis *> & a_baseShapes,
+            const std::vector<const SpatialAnalysis *> & a_comparisonShapes,
+            const Utilities::WorkStealingPool & a_pool);
+
+        /// Finds the pairs of shapes that satisfy a spatial predicate.
+        /// @param a_analysisType The predicate to evaluate.
+        /// @param a_pairs Set to the pairs of base and comparison shapes for which the predicate
+        /// is true, in order of base shape and then comparison shape.
+        void FindPairs(const AnalysisType a_analysisType, std::vector<ShapePair> & a_pairs) const;
+
+      private:
+        /// Envelope of a comparison shape and its index.
+        typedef std::pair<box_type, std::size_t> IndexEntry;
+        typedef boost::geometry::index::rtree<IndexEntry, boost::geometry::index::rstar<16> > RTree;
+
+        /// Number of shapes on a single face, for each face.
+        typedef std::map<unsigned int, std::size_t> FaceCounts;
+
+        /// Number of shapes processed by each task.
+        static const std::size_t m_SHAPES_PER_CHUNK = 16U;
+
+        /// @param a_shapes A set of shapes.
+        /// @return The number of shapes on a single face, for each face.
+        static FaceCounts CountShapesOnFaces(const std::vector<const SpatialAnalysis *> & a_shapes);
+
+        /// @param a_shape A shape from one of the sets.
+        /// @param a_otherFaceCounts The face counts of the other set.
+        /// @param a_noOfOtherShapes The number of shapes in the other set.
+        /// @return True if the shape is compared with any shapes of the other set in lat / long.
+        static bool IsComparedInLatLong(
+            const SpatialAnalysis & a_shape,
+            const FaceCounts & a_otherFaceCounts,
+            const std::size_t a_noOfOtherShapes);
+
+        /// @param a_baseShape A base shape.
+        /// @param a_candidates Set to the indices of the comparison shapes whose envelopes meet
+        /// that of the base shape, in ascending order.
+        void FindCandidates(
+            const SpatialAnalysis & a_baseShape,
+            std::vector<std::size_t> & a_candidates) const;
+
+        const std::vector<const SpatialAnalysis *> m_baseShapes;
+        const std::vector<const SpatialAnalysis *> m_comparisonShapes;
+        const Utilities::WorkStealingPool & m_pool;
+
+        FaceCounts m_comparisonFaceCounts;
+
+        /// Envelopes in the plane of each face of the comparison shapes on a single face.
+        std::map<unsigned int, RTree> m_faceIndexes;
+
+        /// Envelopes in lat / long of the comparison shapes compared with any base shape in
+        /// lat / long.
+        RTree m_latLongIndex;
+    };
+  }
+}
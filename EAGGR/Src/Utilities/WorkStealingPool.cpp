@@ -0,0 +1,203 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Utilities
+//
+//------------------------------------------------------
+/// @file WorkStealingPool.cpp
+///
+/// Implements the EAGGR::Utilities::WorkStealingPool class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "WorkStealingPool.hpp"
+#include "Src/EAGGRException.hpp"
+
+namespace EAGGR
+{
+  namespace Utilities
+  {
+    struct WorkStealingPool::ChunkQueue
+    {
+        std::mutex m_mutex;
+        std::size_t m_begin;
+        std::size_t m_end;
+    };
+
+    WorkStealingPool::WorkStealingPool(const unsigned short a_noOfThreads)
+        : m_noOfThreads(a_noOfThreads)
+    {
+      if (m_noOfThreads == 0U)
+      {
+        // hardware_concurrency() returns zero if the number of threads cannot be determined
+        m_noOfThreads = static_cast<unsigned short>(std::max(
+            1U,
+            std::min(std::thread::hardware_concurrency(), 0xFFFFU)));
+      }
+    }
+
+    unsigned short WorkStealingPool::GetNoOfThreads() const
+    {
+      return m_noOfThreads;
+    }
+
+    void WorkStealingPool::ParallelFor(
+        const std::size_t a_noOfItems,
+        const std::size_t a_chunkSize,
+        const Task& a_task) const
+    {
+      if (a_chunkSize == 0U)
+      {
+        throw EAGGRException("Chunk size must be greater than zero.");
+      }
+
+      const std::size_t noOfChunks = (a_noOfItems + a_chunkSize - 1U) / a_chunkSize;
+      const std::size_t noOfWorkers = std::min(static_cast<std::size_t>(m_noOfThreads), noOfChunks);
+
+      // Avoid starting threads if there is not enough work to share
+      if (noOfWorkers <= 1U)
+      {
+        for (std::size_t begin = 0U; begin < a_noOfItems; begin += a_chunkSize)
+        {
+          a_task(begin, std::min(begin + a_chunkSize, a_noOfItems));
+        }
+        return;
+      }
+
+      // Give each worker an equal share of the chunks to start with
+      std::unique_ptr<ChunkQueue[]> queues(new ChunkQueue[noOfWorkers]);
+      for (std::size_t workerIndex = 0U; workerIndex < noOfWorkers; ++workerIndex)
+      {
+        queues[workerIndex].m_begin = workerIndex * noOfChunks / noOfWorkers;
+        queues[workerIndex].m_end = (workerIndex + 1U) * noOfChunks / noOfWorkers;
+      }
+
+      std::atomic<bool> hasFailed(false);
+      std::mutex errorMutex;
+      std::exception_ptr error;
+
+      const auto worker = [&](const std::size_t a_workerIndex)
+      {
+        try
+        {
+          std::size_t chunkIndex;
+          while (!hasFailed && TakeChunk(queues.get(), noOfWorkers, a_workerIndex, chunkIndex))
+          {
+            const std::size_t begin = chunkIndex * a_chunkSize;
+            a_task(begin, std::min(begin + a_chunkSize, a_noOfItems));
+          }
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> lock(errorMutex);
+          if (!error)
+          {
+            error = std::current_exception();
+          }
+          hasFailed = true;
+        }
+      };
+
+      std::vector<std::thread> threads;
+      threads.reserve(noOfWorkers - 1U);
+      try
+      {
+        for (std::size_t workerIndex = 1U; workerIndex < noOfWorkers; ++workerIndex)
+        {
+          threads.push_back(std::thread(worker, workerIndex));
+        }
+      }
+      catch (std::system_error&)
+      {
+        // The chunks of any worker that could not be started are stolen by the others
+      }
+
+      // The calling thread is the first worker
+      worker(0U);
+
+      for (std::vector<std::thread>::iterator thread = threads.begin(); thread != threads.end();
+          ++thread)
+      {
+        thread->join();
+      }
+
+      if (error)
+      {
+        std::rethrow_exception(error);
+      }
+    }
+
+    bool WorkStealingPool::TakeChunk(
+        ChunkQueue* a_pQueues,
+        const std::size_t a_noOfWorkers,
+        const std::size_t a_workerIndex,
+        std::size_t& a_chunkIndex)
+    {
+      ChunkQueue& ownQueue = a_pQueues[a_workerIndex];
+      {
+        std::lock_guard<std::mutex> lock(ownQueue.m_mutex);
+        if (ownQueue.m_begin < ownQueue.m_end)
+        {
+          a_chunkIndex = ownQueue.m_begin++;
+          return true;
+        }
+      }
+
+      // Steal the back half of the next worker's queue that still has chunks
+      for (std::size_t offset = 1U; offset < a_noOfWorkers; ++offset)
+      {
+        ChunkQueue& victimQueue = a_pQueues[(a_workerIndex + offset) % a_noOfWorkers];
+
+        std::size_t stolenBegin;
+        std::size_t stolenEnd;
+        {
+          std::lock_guard<std::mutex> lock(victimQueue.m_mutex);
+          const std::size_t noOfRemainingChunks = victimQueue.m_end - victimQueue.m_begin;
+          if (noOfRemainingChunks == 0U)
+          {
+            continue;
+          }
+
+          stolenEnd = victimQueue.m_end;
+          stolenBegin = stolenEnd - (noOfRemainingChunks + 1U) / 2U;
+          victimQueue.m_end = stolenBegin;
+        }
+
+        // Process the first stolen chunk now and queue the rest so they can be stolen in turn
+        a_chunkIndex = stolenBegin;
+        std::lock_guard<std::mutex> lock(ownQueue.m_mutex);
+        ownQueue.m_begin = stolenBegin + 1U;
+        ownQueue.m_end = stolenEnd;
+        return true;
+      }
+
+      return false;
+    }
+  }
+}
@@ -0,0 +1,95 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGR
+//
+// subsystem: Utilities
+//
+//------------------------------------------------------
+/// @file WorkStealingPool.hpp
+///
+/// Implements the EAGGR::Utilities::WorkStealingPool class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace EAGGR
+{
+  namespace Utilities
+  {
+    /// Splits a range of items between a number of worker threads.
+    ///
+    /// The items are divided into chunks and each worker starts with an equal share of the chunks.
+    /// A worker takes chunks from the front of its own share, and once that is exhausted it steals
+    /// the back half of the remaining share of another worker, so uneven chunk costs do not leave
+    /// threads idle.
+    ///
+    /// The worker threads only exist for the duration of a call to ParallelFor, so the pool holds
+    /// no threads between calls and may be shared by concurrent callers.
+    class WorkStealingPool
+    {
+      public:
+        /// Function called to process the items in the range [a_begin, a_end).
+        typedef std::function<void(const std::size_t a_begin, const std::size_t a_end)> Task;
+
+        /// Constructor
+        /// @param a_noOfThreads The number of threads to process the items on, including the
+        /// calling thread. Zero uses the number of hardware threads.
+        explicit WorkStealingPool(const unsigned short a_noOfThreads = 0U);
+
+        /// @return The number of threads used to process the items, including the calling thread.
+        unsigned short GetNoOfThreads() const;
+
+        /// Calls a_task for consecutive chunks of the items [0, a_noOfItems), spread across the
+        /// worker threads, and waits for all of the chunks to be processed. Each item is passed to
+        /// a_task exactly once. The calling thread processes chunks as one of the workers.
+        /// @param a_noOfItems The number of items to process.
+        /// @param a_chunkSize The maximum number of items passed to each call of a_task.
+        /// @param a_task The function to call for each chunk.
+        /// @throws The first exception thrown by a_task, after all of the threads have stopped.
+        /// Remaining chunks are not processed once a_task has thrown.
+        void ParallelFor(
+            const std::size_t a_noOfItems,
+            const std::size_t a_chunkSize,
+            const Task& a_task) const;
+
+      private:
+        /// Range of chunks waiting to be processed by a worker.
+        struct ChunkQueue;
+
+        /// Takes the next chunk for a worker, stealing from the other workers if its own queue is
+        /// empty.
+        /// @param a_pQueues The queues of all of the workers.
+        /// @param a_noOfWorkers The number of workers.
+        /// @param a_workerIndex The index of the worker requesting a chunk.
+        /// @param a_chunkIndex Set to the index of the chunk to process.
+        /// @return False if there are no chunks left to process.
+        static bool TakeChunk(
+            ChunkQueue* a_pQueues,
+            const std::size_t a_noOfWorkers,
+            const std::size_t a_workerIndex,
+            std::size_t& a_chunkIndex);
+
+        unsigned short m_noOfThreads;
+    };
+  }
+}
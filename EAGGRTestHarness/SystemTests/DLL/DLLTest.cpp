@@ -30,6 +30,9 @@
 #include <cstdio>
 #include <fstream>
 #include <cstring>
+#include <set>
+#include <string>
+#include <vector>
 
 #include "TestMacros.hpp"
 
@@ -344,6 +347,315 @@ SYSTEM_TEST(DLL, EAGGR_ConvertPointsToDggsCells)
   ASSERT_EQ(DGGS_SUCCESS, returnCode);
 }
 
+SYSTEM_TEST(DLL, EAGGR_ConvertPointsToDggsCellsParallel)
+{
+  // Enough points to be shared between several threads
+  std::vector<DGGS_LatLongPoint> latLongPoints;
+  for (double latitude = -89.5; latitude < 90.0; latitude += 2.0)
+  {
+    for (double longitude = -179.5; longitude < 180.0; longitude += 2.0)
+    {
+      DGGS_LatLongPoint point =
+      { latitude, longitude, LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(1.0e-5)};
+      latLongPoints.push_back(point);
+    }
+  }
+  const unsigned int noOfPoints = latLongPoints.size();
+
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  std::vector<DGGS_Cell> parallelCells(noOfPoints);
+  returnCode = EAGGR_ConvertPointsToDggsCellsParallel(
+      handle,
+      &latLongPoints[0],
+      noOfPoints,
+      &parallelCells[0],
+      4U);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Gives the same cells as the single threaded function
+  DGGS_Cell cell;
+  for (unsigned int pointIndex = 0U; pointIndex < noOfPoints; ++pointIndex)
+  {
+    returnCode = EAGGR_ConvertPointsToDggsCells(handle, &latLongPoints[pointIndex], 1U, &cell);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+    EXPECT_STREQ(cell, parallelCells[pointIndex]);
+  }
+
+  // Zero threads uses the hardware threads
+  returnCode = EAGGR_ConvertPointsToDggsCellsParallel(handle, &latLongPoints[0], 1U, &cell, 0U);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_STREQ(parallelCells[0], cell);
+
+  // Test null pointer error cases
+  returnCode = EAGGR_ConvertPointsToDggsCellsParallel(NULL, &latLongPoints[0], 1U, &cell, 4U);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_ConvertPointsToDggsCellsParallel(handle, NULL, 1U, &cell, 4U);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertPointsToDggsCellsParallel(handle, &latLongPoints[0], 1U, NULL, 4U);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  // An invalid point reports the error on the calling thread
+  latLongPoints[noOfPoints / 2U].m_latitude = 360.0;
+  returnCode = EAGGR_ConvertPointsToDggsCellsParallel(
+      handle,
+      &latLongPoints[0],
+      noOfPoints,
+      &parallelCells[0],
+      4U);
+  ASSERT_EQ(DGGS_MODEL_ERROR, returnCode);
+
+  char * errorMessage;
+  unsigned short messageLength = 0U;
+  returnCode = EAGGR_GetLastErrorMessage(handle, &errorMessage, &messageLength);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_STREQ(
+      "EAGGR Exception: Latitude is greater than maximum allowed for a lat/long point.",
+      errorMessage);
+  EAGGR_DeallocateString(handle, &errorMessage);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, EAGGR_ConvertFaceCoordinatesToDggsCells)
+{
+  // Enough points to be shared between several threads
+  std::vector<DGGS_LatLongPoint> latLongPoints;
+  for (double latitude = -89.5; latitude < 90.0; latitude += 4.0)
+  {
+    for (double longitude = -179.5; longitude < 180.0; longitude += 2.0)
+    {
+      DGGS_LatLongPoint point = { latitude, longitude, 0.0 };
+      latLongPoints.push_back(point);
+    }
+  }
+  const unsigned int noOfPoints = latLongPoints.size();
+
+  DGGS_Handle triangleHandle = NULL;
+  DGGS_Handle hexagonHandle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &triangleHandle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA3H, &hexagonHandle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Project the points once
+  std::vector<DGGS_FaceCoordinate> faceCoordinates(noOfPoints);
+  returnCode = EAGGR_ConvertPointsToFaceCoordinates(triangleHandle, &latLongPoints[0], noOfPoints, &faceCoordinates[0], 4U);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Convert the face coordinates at several accuracies for both models
+  const double accuracies[] = { 1.0e12, 1.0e6, 1.0, 1.0e-4 };
+  const DGGS_Handle handles[] = { triangleHandle, hexagonHandle };
+  std::vector<DGGS_Cell> cells(noOfPoints);
+  DGGS_Cell expectedCell;
+  for (unsigned short accuracyIndex = 0U; accuracyIndex < 4U; ++accuracyIndex)
+  {
+    for (unsigned short handleIndex = 0U; handleIndex < 2U; ++handleIndex)
+    {
+      returnCode = EAGGR_ConvertFaceCoordinatesToDggsCells(handles[handleIndex], &faceCoordinates[0], noOfPoints, accuracies[accuracyIndex], &cells[0], 4U);
+      ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+      // Gives the same cells as converting the points at that accuracy
+      for (unsigned int pointIndex = 0U; pointIndex < noOfPoints; ++pointIndex)
+      {
+        DGGS_LatLongPoint point = latLongPoints[pointIndex];
+        point.m_accuracy = accuracies[accuracyIndex];
+        returnCode = EAGGR_ConvertPointsToDggsCells(handles[handleIndex], &point, 1U, &expectedCell);
+        ASSERT_EQ(DGGS_SUCCESS, returnCode);
+        EXPECT_STREQ(expectedCell, cells[pointIndex]);
+      }
+    }
+  }
+
+  // Test an invalid face index is handled correctly
+  DGGS_FaceCoordinate invalidFaceCoordinate = { 20U, 0.0, 0.0 };
+  returnCode = EAGGR_ConvertFaceCoordinatesToDggsCells(triangleHandle, &invalidFaceCoordinate, 1U, 1.0, &cells[0], 1U);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+
+  // Test a negative accuracy is handled correctly
+  returnCode = EAGGR_ConvertFaceCoordinatesToDggsCells(triangleHandle, &faceCoordinates[0], 1U, -1.0, &cells[0], 1U);
+  EXPECT_EQ(DGGS_MODEL_ERROR, returnCode);
+
+  // Test null pointer error cases
+  returnCode = EAGGR_ConvertPointsToFaceCoordinates(NULL, &latLongPoints[0], 1U, &faceCoordinates[0], 1U);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_ConvertPointsToFaceCoordinates(triangleHandle, NULL, 1U, &faceCoordinates[0], 1U);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertPointsToFaceCoordinates(triangleHandle, &latLongPoints[0], 1U, NULL, 1U);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertFaceCoordinatesToDggsCells(NULL, &faceCoordinates[0], 1U, 1.0, &cells[0], 1U);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_ConvertFaceCoordinatesToDggsCells(triangleHandle, NULL, 1U, 1.0, &cells[0], 1U);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertFaceCoordinatesToDggsCells(triangleHandle, &faceCoordinates[0], 1U, 1.0, NULL, 1U);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&triangleHandle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  returnCode = EAGGR_CloseDggsHandle(&hexagonHandle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, EAGGR_ConvertPointToDggsCellsAtAllResolutions)
+{
+  const DGGS_LatLongPoint point = { 1.234, 2.345, 3.884 };
+  const DGGS_Model models[] = { DGGS_ISEA4T, DGGS_ISEA3H };
+
+  for (unsigned short modelIndex = 0U; modelIndex < 2U; ++modelIndex)
+  {
+    DGGS_Handle handle = NULL;
+    DGGS_ReturnCode returnCode = EAGGR_OpenDggsHandle(models[modelIndex], &handle);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+    DGGS_Cell expectedCell;
+    returnCode = EAGGR_ConvertPointsToDggsCells(handle, &point, 1U, &expectedCell);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+    DGGS_Cell cells[50];
+    unsigned short noOfCells = 0U;
+    returnCode = EAGGR_ConvertPointToDggsCellsAtAllResolutions(handle, &point, cells, 50U, &noOfCells);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+    ASSERT_GT(noOfCells, 1U);
+
+    // The last cell is the one given by converting the point directly
+    EXPECT_STREQ(expectedCell, cells[noOfCells - 1U]);
+
+    // Triangular cells nest, so each cell is the parent of the next
+    if (models[modelIndex] == DGGS_ISEA4T)
+    {
+      for (unsigned short cellIndex = 1U; cellIndex < noOfCells; ++cellIndex)
+      {
+        DGGS_Cell parents[3];
+        unsigned short noOfParents = 0U;
+        returnCode = EAGGR_GetDggsCellParents(handle, cells[cellIndex], parents, &noOfParents);
+        ASSERT_EQ(DGGS_SUCCESS, returnCode);
+        ASSERT_EQ(1U, noOfParents);
+        EXPECT_STREQ(cells[cellIndex - 1U], parents[0]);
+      }
+    }
+
+    // Test an output array which is too small is handled correctly
+    returnCode = EAGGR_ConvertPointToDggsCellsAtAllResolutions(handle, &point, cells, noOfCells - 1U, &noOfCells);
+    EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+    EXPECT_EQ(0U, noOfCells);
+
+    // Test null pointer error cases
+    returnCode = EAGGR_ConvertPointToDggsCellsAtAllResolutions(NULL, &point, cells, 50U, &noOfCells);
+    EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+    returnCode = EAGGR_ConvertPointToDggsCellsAtAllResolutions(handle, NULL, cells, 50U, &noOfCells);
+    EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+    returnCode = EAGGR_ConvertPointToDggsCellsAtAllResolutions(handle, &point, NULL, 50U, &noOfCells);
+    EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+    returnCode = EAGGR_ConvertPointToDggsCellsAtAllResolutions(handle, &point, cells, 50U, NULL);
+    EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+    returnCode = EAGGR_CloseDggsHandle(&handle);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  }
+}
+
+SYSTEM_TEST(DLL, EAGGR_ConvertPointsToDggsCellsAtResolution)
+{
+  // Enough points to be shared between several threads, with accuracies that are ignored
+  std::vector<DGGS_LatLongPoint> latLongPoints;
+  for (double latitude = -89.5; latitude < 90.0; latitude += 4.0)
+  {
+    for (double longitude = -179.5; longitude < 180.0; longitude += 2.0)
+    {
+      DGGS_LatLongPoint point = { latitude, longitude, 1.0e6 * (latLongPoints.size() % 7U) };
+      latLongPoints.push_back(point);
+    }
+  }
+  const unsigned int noOfPoints = latLongPoints.size();
+
+  const DGGS_Model models[] = { DGGS_ISEA4T, DGGS_ISEA3H };
+  const unsigned short resolutions[] = { 0U, 3U, 9U };
+
+  for (unsigned short modelIndex = 0U; modelIndex < 2U; ++modelIndex)
+  {
+    DGGS_Handle handle = NULL;
+    DGGS_ReturnCode returnCode = EAGGR_OpenDggsHandle(models[modelIndex], &handle);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+    std::vector<DGGS_FaceCoordinate> faceCoordinates(noOfPoints);
+    returnCode = EAGGR_ConvertPointsToFaceCoordinates(handle, &latLongPoints[0], noOfPoints, &faceCoordinates[0], 4U);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+    std::vector<DGGS_Cell> cells(noOfPoints);
+    std::vector<DGGS_Cell> faceCoordinateCells(noOfPoints);
+    for (unsigned short resolutionIndex = 0U; resolutionIndex < 3U; ++resolutionIndex)
+    {
+      const unsigned short resolution = resolutions[resolutionIndex];
+
+      returnCode = EAGGR_ConvertPointsToDggsCellsAtResolution(handle, &latLongPoints[0], noOfPoints, resolution, &cells[0], 4U);
+      ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+      returnCode = EAGGR_ConvertFaceCoordinatesToDggsCellsAtResolution(handle, &faceCoordinates[0], noOfPoints, resolution, &faceCoordinateCells[0], 4U);
+      ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+      for (unsigned int pointIndex = 0U; pointIndex < noOfPoints; ++pointIndex)
+      {
+        EXPECT_STREQ(cells[pointIndex], faceCoordinateCells[pointIndex]);
+
+        // Gives the cell at the same resolution as converting at every resolution
+        DGGS_LatLongPoint point = latLongPoints[pointIndex];
+        point.m_accuracy = 1.0;
+        DGGS_Cell allCells[50];
+        unsigned short noOfCells = 0U;
+        returnCode = EAGGR_ConvertPointToDggsCellsAtAllResolutions(handle, &point, allCells, 50U, &noOfCells);
+        ASSERT_EQ(DGGS_SUCCESS, returnCode);
+        ASSERT_GT(noOfCells, resolution);
+        EXPECT_STREQ(allCells[resolution], cells[pointIndex]);
+      }
+    }
+
+    // The upper limit for a cell is accepted
+    const unsigned short maxResolution = 40U;
+    returnCode = EAGGR_ConvertPointsToDggsCellsAtResolution(handle, &latLongPoints[0], 1U, maxResolution, &cells[0], 1U);
+    EXPECT_EQ(DGGS_SUCCESS, returnCode);
+    returnCode = EAGGR_ConvertFaceCoordinatesToDggsCellsAtResolution(handle, &faceCoordinates[0], 1U, maxResolution, &faceCoordinateCells[0], 1U);
+    EXPECT_EQ(DGGS_SUCCESS, returnCode);
+    EXPECT_STREQ(cells[0], faceCoordinateCells[0]);
+
+    // Test a resolution which is too high is rejected before any cells are found
+    returnCode = EAGGR_ConvertPointsToDggsCellsAtResolution(handle, &latLongPoints[0], 1U, maxResolution + 1U, &cells[0], 1U);
+    EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+    returnCode = EAGGR_ConvertPointsToDggsCellsAtResolution(handle, &latLongPoints[0], 1U, 200U, &cells[0], 1U);
+    EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+    returnCode = EAGGR_ConvertFaceCoordinatesToDggsCellsAtResolution(handle, &faceCoordinates[0], 1U, maxResolution + 1U, &cells[0], 1U);
+    EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+
+    // Test an invalid face index is handled correctly
+    DGGS_FaceCoordinate invalidFaceCoordinate = { 20U, 0.0, 0.0 };
+    returnCode = EAGGR_ConvertFaceCoordinatesToDggsCellsAtResolution(handle, &invalidFaceCoordinate, 1U, 1U, &cells[0], 1U);
+    EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+
+    // Test null pointer error cases
+    returnCode = EAGGR_ConvertPointsToDggsCellsAtResolution(NULL, &latLongPoints[0], 1U, 1U, &cells[0], 1U);
+    EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+    returnCode = EAGGR_ConvertPointsToDggsCellsAtResolution(handle, NULL, 1U, 1U, &cells[0], 1U);
+    EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+    returnCode = EAGGR_ConvertPointsToDggsCellsAtResolution(handle, &latLongPoints[0], 1U, 1U, NULL, 1U);
+    EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+    returnCode = EAGGR_ConvertFaceCoordinatesToDggsCellsAtResolution(NULL, &faceCoordinates[0], 1U, 1U, &cells[0], 1U);
+    EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+    returnCode = EAGGR_ConvertFaceCoordinatesToDggsCellsAtResolution(handle, NULL, 1U, 1U, &cells[0], 1U);
+    EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+    returnCode = EAGGR_ConvertFaceCoordinatesToDggsCellsAtResolution(handle, &faceCoordinates[0], 1U, 1U, NULL, 1U);
+    EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+    returnCode = EAGGR_CloseDggsHandle(&handle);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  }
+}
+
 SYSTEM_TEST(DLL, EAGGR_ConvertShapesToDggsShapes)
 {
   DGGS_LatLongPoint point1 =
@@ -548,6 +860,656 @@ SYSTEM_TEST(DLL, EAGGR_ConvertShapeStringToDggsShapes)
   ASSERT_EQ(DGGS_SUCCESS, returnCode);
 }
 
+SYSTEM_TEST(DLL, EAGGR_ConvertShapesToDggsShapesInArena)
+{
+  const double accuracy = LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(1.0e-5);
+
+  DGGS_LatLongPoint points[] =
+  {
+    { 1.234, 2.345, accuracy },
+    { 3.456, 4.567, accuracy }};
+
+  static const unsigned short NO_OF_SHAPES = 2U;
+  DGGS_LatLongShape latLongShapes[NO_OF_SHAPES];
+  latLongShapes[0].m_type = DGGS_LAT_LONG_POINT;
+  latLongShapes[0].m_data.m_point = points[0];
+  latLongShapes[1].m_type = DGGS_LAT_LONG_LINESTRING;
+  latLongShapes[1].m_data.m_linestring.m_noOfPoints = 2U;
+  latLongShapes[1].m_data.m_linestring.m_points = points;
+
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Use a small arena so that it has to grow
+  DGGS_ShapeArena shapeArena = NULL;
+  returnCode = EAGGR_CreateShapeArena(handle, 64U, &shapeArena);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Convert into the arena several times, resetting it in between, to check the memory is reused
+  for (unsigned short iteration = 0U; iteration < 3U; ++iteration)
+  {
+    DGGS_Shape * firstShapes = NULL;
+    returnCode = EAGGR_ConvertShapesToDggsShapesInArena(handle, latLongShapes, NO_OF_SHAPES, shapeArena, &firstShapes);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+    DGGS_Shape * secondShapes = NULL;
+    returnCode = EAGGR_ConvertShapesToDggsShapesInArena(handle, latLongShapes, NO_OF_SHAPES, shapeArena, &secondShapes);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+    // The shapes converted first must not be overwritten by the second conversion
+    const DGGS_Shape * shapeArrays[] = { firstShapes, secondShapes };
+    for (unsigned short arrayIndex = 0U; arrayIndex < 2U; ++arrayIndex)
+    {
+      const DGGS_Shape * shapes = shapeArrays[arrayIndex];
+
+      ASSERT_EQ(DGGS_CELL, shapes[0].m_type);
+      EXPECT_STREQ("07231131111113100331001", shapes[0].m_data.m_cell);
+      EXPECT_EQ(DGGS_ONE_FACE, shapes[0].m_location);
+
+      ASSERT_EQ(DGGS_LINESTRING, shapes[1].m_type);
+      EXPECT_EQ(DGGS_NO_LOCATION, shapes[1].m_location);
+      ASSERT_EQ(2U, shapes[1].m_data.m_linestring.m_noOfCells);
+      EXPECT_STREQ("07231131111113100331001", shapes[1].m_data.m_linestring.m_cells[0]);
+      EXPECT_STREQ("07012000001303022011321", shapes[1].m_data.m_linestring.m_cells[1]);
+    }
+
+    returnCode = EAGGR_ResetShapeArena(handle, shapeArena);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  }
+
+  // Test an unsupported shape type is handled correctly
+  DGGS_Shape * shapes = NULL;
+  DGGS_LatLongShape invalidShape;
+  invalidShape.m_type = static_cast<DGGS_LatLongShapeType>(-1);
+  returnCode = EAGGR_ConvertShapesToDggsShapesInArena(handle, &invalidShape, 1U, shapeArena, &shapes);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+
+  // Test null pointer error cases
+  returnCode = EAGGR_CreateShapeArena(NULL, 0U, &shapeArena);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_CreateShapeArena(handle, 0U, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertShapesToDggsShapesInArena(handle, NULL, NO_OF_SHAPES, shapeArena, &shapes);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertShapesToDggsShapesInArena(handle, latLongShapes, NO_OF_SHAPES, NULL, &shapes);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertShapesToDggsShapesInArena(handle, latLongShapes, NO_OF_SHAPES, shapeArena, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ResetShapeArena(handle, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ReleaseShapeArena(handle, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_ReleaseShapeArena(handle, &shapeArena);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_EQ(NULL, shapeArena);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, EAGGR_ConvertShapeStringToDggsShapesInArena)
+{
+  char wktString[] =
+  "GEOMETRYCOLLECTION("
+  "MULTIPOINT(2.345 1.234, 4.567 3.456), "
+  "LINESTRING(2.345 1.234, 4.567 3.456),"
+  "POLYGON((2.345 1.234, 4.567 3.456), (2.345 1.234, 4.567 3.456), (2.345 1.234, 4.567 3.456)))";
+  const double accuracy = LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(1.0e-5);
+
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_ShapeArena shapeArena = NULL;
+  returnCode = EAGGR_CreateShapeArena(handle, 0U, &shapeArena);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_Shape * shapes = NULL;
+  unsigned short noOfShapes = 0U;
+  returnCode = EAGGR_ConvertShapeStringToDggsShapesInArena(handle, wktString, DGGS_WKT_FORMAT, accuracy, shapeArena, &shapes, &noOfShapes);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  ASSERT_EQ(4U, noOfShapes);
+
+  ASSERT_EQ(DGGS_CELL, shapes[0].m_type);
+  EXPECT_STREQ("07231131111113100331001", shapes[0].m_data.m_cell);
+  EXPECT_EQ(DGGS_ONE_FACE, shapes[0].m_location);
+
+  ASSERT_EQ(DGGS_CELL, shapes[1].m_type);
+  EXPECT_STREQ("07012000001303022011321", shapes[1].m_data.m_cell);
+  EXPECT_EQ(DGGS_ONE_FACE, shapes[1].m_location);
+
+  ASSERT_EQ(DGGS_LINESTRING, shapes[2].m_type);
+  ASSERT_EQ(2U, shapes[2].m_data.m_linestring.m_noOfCells);
+  EXPECT_STREQ("07231131111113100331001", shapes[2].m_data.m_linestring.m_cells[0]);
+  EXPECT_STREQ("07012000001303022011321", shapes[2].m_data.m_linestring.m_cells[1]);
+
+  ASSERT_EQ(DGGS_POLYGON, shapes[3].m_type);
+  ASSERT_EQ(2U, shapes[3].m_data.m_polygon.m_outerRing.m_noOfCells);
+  EXPECT_STREQ("07231131111113100331001", shapes[3].m_data.m_polygon.m_outerRing.m_cells[0]);
+  EXPECT_STREQ("07012000001303022011321", shapes[3].m_data.m_polygon.m_outerRing.m_cells[1]);
+  ASSERT_EQ(2U, shapes[3].m_data.m_polygon.m_noOfInnerRings);
+  ASSERT_EQ(2U, shapes[3].m_data.m_polygon.m_innerRings[1].m_noOfCells);
+  EXPECT_STREQ("07231131111113100331001", shapes[3].m_data.m_polygon.m_innerRings[1].m_cells[0]);
+  EXPECT_STREQ("07012000001303022011321", shapes[3].m_data.m_polygon.m_innerRings[1].m_cells[1]);
+
+  // Test null pointer error cases
+  returnCode = EAGGR_ConvertShapeStringToDggsShapesInArena(handle, NULL, DGGS_WKT_FORMAT, accuracy, shapeArena, &shapes, &noOfShapes);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertShapeStringToDggsShapesInArena(handle, wktString, DGGS_WKT_FORMAT, accuracy, NULL, &shapes, &noOfShapes);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertShapeStringToDggsShapesInArena(handle, wktString, DGGS_WKT_FORMAT, accuracy, shapeArena, &shapes, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_ReleaseShapeArena(handle, &shapeArena);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+/// Records the shapes passed to the streaming conversion functions.
+struct ConvertedShapes
+{
+    std::vector<unsigned int> m_shapeIndices;
+    std::vector<std::vector<std::string> > m_cellIds;
+    unsigned int m_maxShapes;
+};
+
+bool RecordConvertedShape(
+    const unsigned int a_shapeIndex,
+    const DGGS_Shape * a_pDggsShape,
+    void * a_pUserData)
+{
+  ConvertedShapes * pShapes = static_cast<ConvertedShapes *>(a_pUserData);
+  pShapes->m_shapeIndices.push_back(a_shapeIndex);
+
+  // Copy the cell IDs as the shape is not valid after the callback returns
+  std::vector<std::string> cellIds;
+  switch (a_pDggsShape->m_type)
+  {
+    case DGGS_CELL:
+      cellIds.push_back(a_pDggsShape->m_data.m_cell);
+      break;
+    case DGGS_LINESTRING:
+      for (unsigned short cellIndex = 0U; cellIndex < a_pDggsShape->m_data.m_linestring.m_noOfCells; ++cellIndex)
+      {
+        cellIds.push_back(a_pDggsShape->m_data.m_linestring.m_cells[cellIndex]);
+      }
+      break;
+    case DGGS_POLYGON:
+      for (unsigned short cellIndex = 0U; cellIndex < a_pDggsShape->m_data.m_polygon.m_outerRing.m_noOfCells; ++cellIndex)
+      {
+        cellIds.push_back(a_pDggsShape->m_data.m_polygon.m_outerRing.m_cells[cellIndex]);
+      }
+      break;
+  }
+  pShapes->m_cellIds.push_back(cellIds);
+
+  return pShapes->m_shapeIndices.size() < pShapes->m_maxShapes;
+}
+
+SYSTEM_TEST(DLL, EAGGR_ConvertShapesToDggsShapesWithCallback)
+{
+  const double accuracy = LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(1.0e-5);
+
+  DGGS_LatLongPoint points[] =
+  {
+    { 1.234, 2.345, accuracy },
+    { 3.456, 4.567, accuracy }};
+
+  static const unsigned int NO_OF_SHAPES = 3U;
+  DGGS_LatLongShape latLongShapes[NO_OF_SHAPES];
+  latLongShapes[0].m_type = DGGS_LAT_LONG_POINT;
+  latLongShapes[0].m_data.m_point = points[0];
+  latLongShapes[1].m_type = DGGS_LAT_LONG_LINESTRING;
+  latLongShapes[1].m_data.m_linestring.m_noOfPoints = 2U;
+  latLongShapes[1].m_data.m_linestring.m_points = points;
+  latLongShapes[2].m_type = DGGS_LAT_LONG_POINT;
+  latLongShapes[2].m_data.m_point = points[1];
+
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  ConvertedShapes convertedShapes;
+  convertedShapes.m_maxShapes = NO_OF_SHAPES;
+  returnCode = EAGGR_ConvertShapesToDggsShapesWithCallback(handle, latLongShapes, NO_OF_SHAPES, RecordConvertedShape, &convertedShapes);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  ASSERT_EQ(NO_OF_SHAPES, convertedShapes.m_shapeIndices.size());
+  for (unsigned int shapeIndex = 0U; shapeIndex < NO_OF_SHAPES; ++shapeIndex)
+  {
+    EXPECT_EQ(shapeIndex, convertedShapes.m_shapeIndices[shapeIndex]);
+  }
+  ASSERT_EQ(1U, convertedShapes.m_cellIds[0].size());
+  EXPECT_EQ("07231131111113100331001", convertedShapes.m_cellIds[0][0]);
+  ASSERT_EQ(2U, convertedShapes.m_cellIds[1].size());
+  EXPECT_EQ("07231131111113100331001", convertedShapes.m_cellIds[1][0]);
+  EXPECT_EQ("07012000001303022011321", convertedShapes.m_cellIds[1][1]);
+  ASSERT_EQ(1U, convertedShapes.m_cellIds[2].size());
+  EXPECT_EQ("07012000001303022011321", convertedShapes.m_cellIds[2][0]);
+
+  // The conversion stops when the callback returns false
+  ConvertedShapes firstShapes;
+  firstShapes.m_maxShapes = 2U;
+  returnCode = EAGGR_ConvertShapesToDggsShapesWithCallback(handle, latLongShapes, NO_OF_SHAPES, RecordConvertedShape, &firstShapes);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_EQ(2U, firstShapes.m_shapeIndices.size());
+
+  // Test an unsupported shape type is handled correctly
+  ConvertedShapes invalidShapes;
+  invalidShapes.m_maxShapes = NO_OF_SHAPES;
+  latLongShapes[1].m_type = static_cast<DGGS_LatLongShapeType>(-1);
+  returnCode = EAGGR_ConvertShapesToDggsShapesWithCallback(handle, latLongShapes, NO_OF_SHAPES, RecordConvertedShape, &invalidShapes);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+  EXPECT_EQ(1U, invalidShapes.m_shapeIndices.size());
+
+  // Test null pointer error cases
+  returnCode = EAGGR_ConvertShapesToDggsShapesWithCallback(NULL, latLongShapes, NO_OF_SHAPES, RecordConvertedShape, &convertedShapes);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_ConvertShapesToDggsShapesWithCallback(handle, NULL, NO_OF_SHAPES, RecordConvertedShape, &convertedShapes);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertShapesToDggsShapesWithCallback(handle, latLongShapes, NO_OF_SHAPES, NULL, &convertedShapes);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, EAGGR_ConvertShapeStringToDggsShapesWithCallback)
+{
+  char wktString[] =
+  "GEOMETRYCOLLECTION("
+  "MULTIPOINT(2.345 1.234, 4.567 3.456), "
+  "LINESTRING(2.345 1.234, 4.567 3.456),"
+  "POLYGON((2.345 1.234, 4.567 3.456), (2.345 1.234, 4.567 3.456), (2.345 1.234, 4.567 3.456)))";
+  const double accuracy = LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(1.0e-5);
+
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  ConvertedShapes convertedShapes;
+  convertedShapes.m_maxShapes = 10U;
+  unsigned int noOfShapes = 0U;
+  returnCode = EAGGR_ConvertShapeStringToDggsShapesWithCallback(handle, wktString, DGGS_WKT_FORMAT, accuracy, RecordConvertedShape, &convertedShapes, &noOfShapes);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  ASSERT_EQ(4U, noOfShapes);
+  ASSERT_EQ(4U, convertedShapes.m_cellIds.size());
+  ASSERT_EQ(1U, convertedShapes.m_cellIds[0].size());
+  EXPECT_EQ("07231131111113100331001", convertedShapes.m_cellIds[0][0]);
+  ASSERT_EQ(1U, convertedShapes.m_cellIds[1].size());
+  EXPECT_EQ("07012000001303022011321", convertedShapes.m_cellIds[1][0]);
+  ASSERT_EQ(2U, convertedShapes.m_cellIds[2].size());
+  EXPECT_EQ("07231131111113100331001", convertedShapes.m_cellIds[2][0]);
+  EXPECT_EQ("07012000001303022011321", convertedShapes.m_cellIds[2][1]);
+  ASSERT_EQ(2U, convertedShapes.m_cellIds[3].size());
+  EXPECT_EQ("07231131111113100331001", convertedShapes.m_cellIds[3][0]);
+  EXPECT_EQ("07012000001303022011321", convertedShapes.m_cellIds[3][1]);
+
+  // The conversion stops when the callback returns false
+  ConvertedShapes firstShapes;
+  firstShapes.m_maxShapes = 1U;
+  returnCode = EAGGR_ConvertShapeStringToDggsShapesWithCallback(handle, wktString, DGGS_WKT_FORMAT, accuracy, RecordConvertedShape, &firstShapes, &noOfShapes);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_EQ(1U, noOfShapes);
+
+  // Test null pointer error cases
+  returnCode = EAGGR_ConvertShapeStringToDggsShapesWithCallback(handle, NULL, DGGS_WKT_FORMAT, accuracy, RecordConvertedShape, &convertedShapes, &noOfShapes);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertShapeStringToDggsShapesWithCallback(handle, wktString, DGGS_WKT_FORMAT, accuracy, NULL, &convertedShapes, &noOfShapes);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertShapeStringToDggsShapesWithCallback(handle, wktString, DGGS_WKT_FORMAT, accuracy, RecordConvertedShape, &convertedShapes, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, TooManyShapesInString)
+{
+  // One more point than the shape count of the array functions can hold
+  static const unsigned int NO_OF_POINTS = 65536U;
+  std::string wktString = "MULTIPOINT(";
+  for (unsigned int pointIndex = 0U; pointIndex < NO_OF_POINTS; ++pointIndex)
+  {
+    wktString += (pointIndex == 0U) ? "2.345 1.234" : ", 2.345 1.234";
+  }
+  wktString += ")";
+  const double accuracy = LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(1.0e-5);
+
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_Shape * shapes = NULL;
+  unsigned short noOfShapes = 1U;
+  returnCode = EAGGR_ConvertShapeStringToDggsShapes(handle, &wktString[0], DGGS_WKT_FORMAT, accuracy, &shapes, &noOfShapes);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+  EXPECT_TRUE(shapes == NULL);
+  EXPECT_EQ(0U, noOfShapes);
+
+  DGGS_ShapeArena shapeArena = NULL;
+  returnCode = EAGGR_CreateShapeArena(handle, 0U, &shapeArena);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  returnCode = EAGGR_ConvertShapeStringToDggsShapesInArena(handle, &wktString[0], DGGS_WKT_FORMAT, accuracy, shapeArena, &shapes, &noOfShapes);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+  returnCode = EAGGR_ReleaseShapeArena(handle, &shapeArena);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // The callback variant has no limit on the number of shapes
+  ConvertedShapes convertedShapes;
+  convertedShapes.m_maxShapes = NO_OF_POINTS;
+  unsigned int noOfCallbackShapes = 0U;
+  returnCode = EAGGR_ConvertShapeStringToDggsShapesWithCallback(handle, &wktString[0], DGGS_WKT_FORMAT, accuracy, RecordConvertedShape, &convertedShapes, &noOfCallbackShapes);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_EQ(NO_OF_POINTS, noOfCallbackShapes);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, UnsupportedShapeInString)
+{
+  // The polygon is converted before the unsupported geometry is read from the string
+  char wktString[] =
+  "GEOMETRYCOLLECTION("
+  "POLYGON((2.345 1.234, 4.567 3.456, 2.345 3.456, 2.345 1.234)), "
+  "CIRCULARSTRING(1 5, 6 2, 7 3))";
+  const double accuracy = LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(1.0e-5);
+
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // The polygon already converted is freed and the outputs are cleared
+  DGGS_Shape * shapes = NULL;
+  unsigned short noOfShapes = 1U;
+  returnCode = EAGGR_ConvertShapeStringToDggsShapes(handle, wktString, DGGS_WKT_FORMAT, accuracy, &shapes, &noOfShapes);
+  EXPECT_EQ(DGGS_MODEL_ERROR, returnCode);
+  EXPECT_TRUE(shapes == NULL);
+  EXPECT_EQ(0U, noOfShapes);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, EAGGR_ConvertPolygonToDggsCells)
+{
+  static const unsigned short RESOLUTION = 6U;
+
+  DGGS_LatLongPoint outerRingPoints[] =
+  {
+    { 40.0, -10.0, 0.0 },
+    { 60.0, -10.0, 0.0 },
+    { 60.0, 10.0, 0.0 },
+    { 40.0, 10.0, 0.0 },
+    { 40.0, -10.0, 0.0 }};
+  DGGS_LatLongPoint innerRingPoints[] =
+  {
+    { 45.0, -5.0, 0.0 },
+    { 55.0, -5.0, 0.0 },
+    { 55.0, 5.0, 0.0 },
+    { 45.0, 5.0, 0.0 },
+    { 45.0, -5.0, 0.0 }};
+  DGGS_LatLongLinestring innerRing = { innerRingPoints, 5U };
+  DGGS_LatLongPolygon polygon = { { outerRingPoints, 5U }, &innerRing, 1U };
+
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_Cell * cells = NULL;
+  unsigned int noOfCells = 0U;
+  returnCode = EAGGR_ConvertPolygonToDggsCells(handle, &polygon, RESOLUTION, &cells, &noOfCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  ASSERT_LT(0U, noOfCells);
+
+  // Each cell is at the requested resolution (the cell ID has two face digits followed by one digit
+  // for each resolution) and appears once
+  std::set<std::string> cellIds;
+  for (unsigned int cellIndex = 0U; cellIndex < noOfCells; ++cellIndex)
+  {
+    EXPECT_EQ(RESOLUTION + 2U, strlen(cells[cellIndex]));
+    EXPECT_TRUE(cellIds.insert(cells[cellIndex]).second);
+  }
+
+  // The cell containing a point in the polygon is included, and the cell containing a point in the
+  // hole is not
+  DGGS_LatLongPoint points[] =
+  {
+    { 42.5, 0.0, LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(1.0e-5) },
+    { 50.0, 0.0, LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(1.0e-5) }};
+  DGGS_Cell pointCells[2];
+  returnCode = EAGGR_ConvertPointsToDggsCells(handle, points, 2U, pointCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_EQ(1U, cellIds.count(std::string(pointCells[0]).substr(0U, RESOLUTION + 2U)));
+  EXPECT_EQ(0U, cellIds.count(std::string(pointCells[1]).substr(0U, RESOLUTION + 2U)));
+
+  returnCode = EAGGR_DeallocateDggsCells(handle, &cells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_TRUE(cells == NULL);
+
+  // Test error cases for EAGGR_ConvertPolygonToDggsCells()
+  returnCode = EAGGR_ConvertPolygonToDggsCells(NULL, &polygon, RESOLUTION, &cells, &noOfCells);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_ConvertPolygonToDggsCells(handle, NULL, RESOLUTION, &cells, &noOfCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertPolygonToDggsCells(handle, &polygon, RESOLUTION, NULL, &noOfCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertPolygonToDggsCells(handle, &polygon, RESOLUTION, &cells, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  // A polygon needs at least three points
+  polygon.m_outerRing.m_noOfPoints = 2U;
+  returnCode = EAGGR_ConvertPolygonToDggsCells(handle, &polygon, RESOLUTION, &cells, &noOfCells);
+  EXPECT_EQ(DGGS_MODEL_ERROR, returnCode);
+  EXPECT_TRUE(cells == NULL);
+  EXPECT_EQ(0U, noOfCells);
+
+  // Test error cases for EAGGR_DeallocateDggsCells()
+  returnCode = EAGGR_DeallocateDggsCells(NULL, &cells);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_DeallocateDggsCells(handle, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, EAGGR_ConvertShapeToDggsCovering)
+{
+  static const unsigned short MIN_RESOLUTION = 2U;
+  static const unsigned short MAX_RESOLUTION = 10U;
+  static const unsigned int MAX_CELLS = 40U;
+
+  DGGS_LatLongPoint outerRingPoints[] =
+  {
+    { 40.0, -10.0, 0.0 },
+    { 60.0, -10.0, 0.0 },
+    { 60.0, 10.0, 0.0 },
+    { 40.0, 10.0, 0.0 },
+    { 40.0, -10.0, 0.0 }};
+  DGGS_LatLongShape polygon;
+  polygon.m_type = DGGS_LAT_LONG_POLYGON;
+  polygon.m_data.m_polygon.m_outerRing.m_points = outerRingPoints;
+  polygon.m_data.m_polygon.m_outerRing.m_noOfPoints = 5U;
+  polygon.m_data.m_polygon.m_innerRings = NULL;
+  polygon.m_data.m_polygon.m_noOfInnerRings = 0U;
+
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // The exterior covering contains the cell containing a point in the polygon at one of its
+  // resolutions
+  DGGS_Cell * cells = NULL;
+  unsigned int noOfCells = 0U;
+  returnCode = EAGGR_ConvertShapeToDggsCovering(
+      handle,
+      &polygon,
+      DGGS_EXTERIOR_COVERING,
+      MIN_RESOLUTION,
+      MAX_RESOLUTION,
+      MAX_CELLS,
+      &cells,
+      &noOfCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  ASSERT_LT(0U, noOfCells);
+  EXPECT_GE(MAX_CELLS, noOfCells);
+
+  DGGS_LatLongPoint point =
+  { 50.0, 0.0, LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(1.0e-5) };
+  DGGS_Cell pointCell;
+  returnCode = EAGGR_ConvertPointsToDggsCells(handle, &point, 1U, &pointCell);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  unsigned int noOfCoveringCells = 0U;
+  for (unsigned int cellIndex = 0U; cellIndex < noOfCells; ++cellIndex)
+  {
+    EXPECT_LE(MIN_RESOLUTION + 2U, strlen(cells[cellIndex]));
+    EXPECT_GE(MAX_RESOLUTION + 2U, strlen(cells[cellIndex]));
+    if (strncmp(pointCell, cells[cellIndex], strlen(cells[cellIndex])) == 0)
+    {
+      ++noOfCoveringCells;
+    }
+  }
+  EXPECT_EQ(1U, noOfCoveringCells);
+
+  returnCode = EAGGR_DeallocateDggsCells(handle, &cells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // The interior covering of a linestring is empty
+  DGGS_LatLongShape linestring;
+  linestring.m_type = DGGS_LAT_LONG_LINESTRING;
+  linestring.m_data.m_linestring.m_points = outerRingPoints;
+  linestring.m_data.m_linestring.m_noOfPoints = 3U;
+  returnCode = EAGGR_ConvertShapeToDggsCovering(
+      handle,
+      &linestring,
+      DGGS_INTERIOR_COVERING,
+      MIN_RESOLUTION,
+      MAX_RESOLUTION,
+      MAX_CELLS,
+      &cells,
+      &noOfCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_TRUE(cells == NULL);
+  EXPECT_EQ(0U, noOfCells);
+
+  // The bounding box of the polygon has the same covering as the polygon
+  DGGS_Cell * polygonCells = NULL;
+  unsigned int noOfPolygonCells = 0U;
+  returnCode = EAGGR_ConvertShapeToDggsCovering(
+      handle,
+      &polygon,
+      DGGS_INTERIOR_COVERING,
+      MIN_RESOLUTION,
+      MAX_RESOLUTION,
+      MAX_CELLS,
+      &polygonCells,
+      &noOfPolygonCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  returnCode = EAGGR_ConvertBoundingBoxToDggsCovering(
+      handle,
+      40.0,
+      -10.0,
+      60.0,
+      10.0,
+      DGGS_INTERIOR_COVERING,
+      MIN_RESOLUTION,
+      MAX_RESOLUTION,
+      MAX_CELLS,
+      &cells,
+      &noOfCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  ASSERT_LT(0U, noOfCells);
+  ASSERT_EQ(noOfPolygonCells, noOfCells);
+  for (unsigned int cellIndex = 0U; cellIndex < noOfCells; ++cellIndex)
+  {
+    EXPECT_STREQ(polygonCells[cellIndex], cells[cellIndex]);
+  }
+
+  returnCode = EAGGR_DeallocateDggsCells(handle, &cells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  returnCode = EAGGR_DeallocateDggsCells(handle, &polygonCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Test error cases for EAGGR_ConvertShapeToDggsCovering()
+  returnCode = EAGGR_ConvertShapeToDggsCovering(
+      NULL, &polygon, DGGS_EXTERIOR_COVERING, 2U, 5U, 10U, &cells, &noOfCells);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_ConvertShapeToDggsCovering(
+      handle, NULL, DGGS_EXTERIOR_COVERING, 2U, 5U, 10U, &cells, &noOfCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertShapeToDggsCovering(
+      handle, &polygon, DGGS_EXTERIOR_COVERING, 2U, 5U, 10U, NULL, &noOfCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertShapeToDggsCovering(
+      handle, &polygon, DGGS_EXTERIOR_COVERING, 2U, 5U, 10U, &cells, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  // The minimum resolution cannot exceed the maximum
+  returnCode = EAGGR_ConvertShapeToDggsCovering(
+      handle, &polygon, DGGS_EXTERIOR_COVERING, 6U, 5U, 10U, &cells, &noOfCells);
+  EXPECT_EQ(DGGS_MODEL_ERROR, returnCode);
+
+  // Points have no covering
+  DGGS_LatLongShape pointShape;
+  pointShape.m_type = DGGS_LAT_LONG_POINT;
+  pointShape.m_data.m_point = point;
+  returnCode = EAGGR_ConvertShapeToDggsCovering(
+      handle, &pointShape, DGGS_EXTERIOR_COVERING, 2U, 5U, 10U, &cells, &noOfCells);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+  EXPECT_TRUE(cells == NULL);
+  EXPECT_EQ(0U, noOfCells);
+
+  // A box whose maximum longitude is less than its minimum crosses the antimeridian
+  returnCode = EAGGR_ConvertBoundingBoxToDggsCovering(
+      handle, -10.0, 170.0, 10.0, -170.0, DGGS_EXTERIOR_COVERING, 2U, 5U, 10U, &cells, &noOfCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_LT(0U, noOfCells);
+  returnCode = EAGGR_DeallocateDggsCells(handle, &cells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Test error cases for EAGGR_ConvertBoundingBoxToDggsCovering()
+  returnCode = EAGGR_ConvertBoundingBoxToDggsCovering(
+      NULL, 40.0, -10.0, 60.0, 10.0, DGGS_EXTERIOR_COVERING, 2U, 5U, 10U, &cells, &noOfCells);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_ConvertBoundingBoxToDggsCovering(
+      handle, 40.0, -10.0, 60.0, 10.0, DGGS_EXTERIOR_COVERING, 2U, 5U, 10U, NULL, &noOfCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertBoundingBoxToDggsCovering(
+      handle, 40.0, -10.0, 60.0, 10.0, DGGS_EXTERIOR_COVERING, 2U, 5U, 10U, &cells, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertBoundingBoxToDggsCovering(
+      handle, 60.0, -10.0, 40.0, 10.0, DGGS_EXTERIOR_COVERING, 2U, 5U, 10U, &cells, &noOfCells);
+  EXPECT_EQ(DGGS_MODEL_ERROR, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
 SYSTEM_TEST(DLL, EAGGR_ConvertDggsCellsToPoints)
 {
   DGGS_Handle handle = NULL;
@@ -634,22 +1596,398 @@ SYSTEM_TEST(DLL, EAGGR_ConvertDggsCellsToShapeString)
   CheckShapeString(&wktImporter);
   EAGGR_DeallocateString(handle, &pString);
 
-  returnCode = EAGGR_ConvertDggsCellsToShapeString(handle, cells, noOfCells, DGGS_GEO_JSON_FORMAT, &pString);
+  returnCode = EAGGR_ConvertDggsCellsToShapeString(handle, cells, noOfCells, DGGS_GEO_JSON_FORMAT, &pString);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Import the string and test the values numerically because values in the string can vary slightly
+  ImportExport::GeoJsonImporter geoJsonImporter(pString, 1.0e-5);
+  CheckShapeString(&geoJsonImporter);
+  EAGGR_DeallocateString(handle, &pString);
+
+  // Test error cases
+  returnCode = EAGGR_ConvertDggsCellsToShapeString(NULL, cells, noOfCells, DGGS_WKT_FORMAT, &pString);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_ConvertDggsCellsToShapeString(handle, NULL, noOfCells, DGGS_WKT_FORMAT, &pString);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertDggsCellsToShapeString(handle, cells, noOfCells, DGGS_WKT_FORMAT, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, EAGGR_ConvertDggsCellsToPackedCells)
+{
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  DGGS_Cell cells[] =
+  {
+    "010123", "19", "07231131111113100331032"
+  };
+  const unsigned short noOfCells = sizeof(cells) / sizeof(cells[0]);
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_PackedCell packedCells[noOfCells];
+  returnCode = EAGGR_ConvertDggsCellsToPackedCells(handle, cells, noOfCells, packedCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  EXPECT_EQ(0x08DC000000000000ULL, packedCells[0]);
+  EXPECT_EQ(0x9C00000000000000ULL, packedCells[1]);
+
+  // Convert back to cell IDs
+  DGGS_Cell unpackedCells[noOfCells];
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(handle, packedCells, noOfCells, unpackedCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  for (unsigned short cellIndex = 0U; cellIndex < noOfCells; ++cellIndex)
+  {
+    EXPECT_STREQ(cells[cellIndex], unpackedCells[cellIndex]);
+  }
+
+  // Test null pointer error cases
+  returnCode = EAGGR_ConvertDggsCellsToPackedCells(NULL, cells, noOfCells, packedCells);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_ConvertDggsCellsToPackedCells(handle, NULL, noOfCells, packedCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertDggsCellsToPackedCells(handle, cells, noOfCells, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(NULL, packedCells, noOfCells, unpackedCells);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(handle, NULL, noOfCells, unpackedCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(handle, packedCells, noOfCells, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  // Test a packed cell without a resolution marker
+  packedCells[0] = 0x0800000000000000ULL;
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(handle, packedCells, noOfCells, unpackedCells);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+
+  char * errorMessage = NULL;
+  unsigned short messageLength = 0U;
+  returnCode = EAGGR_GetLastErrorMessage(handle, &errorMessage, &messageLength);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_STREQ("Packed cell 1 in 'a_packedCells' is not valid.", errorMessage);
+  EAGGR_DeallocateString(handle, &errorMessage);
+
+  // Test packed cells with a misaligned resolution marker and a face index beyond the last face
+  packedCells[0] = 0x0A00000000000000ULL;
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(handle, packedCells, noOfCells, unpackedCells);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+  packedCells[0] = 0xA400000000000000ULL;
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(handle, packedCells, noOfCells, unpackedCells);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, EAGGR_CompactPackedCells)
+{
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  // The four children of 0701 and three of the four children of 0302, in ascending order
+  DGGS_Cell cells[] =
+  {
+    "03020", "03021", "03023", "07010", "07011", "07012", "07013"
+  };
+  const unsigned int noOfCells = sizeof(cells) / sizeof(cells[0]);
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_PackedCell packedCells[noOfCells];
+  returnCode = EAGGR_ConvertDggsCellsToPackedCells(handle, cells, noOfCells, packedCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_PackedCell compactedCells[noOfCells];
+  unsigned int noOfCompactedCells = 0U;
+  returnCode = EAGGR_CompactPackedCells(
+      handle,
+      packedCells,
+      noOfCells,
+      compactedCells,
+      &noOfCompactedCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  ASSERT_EQ(4U, noOfCompactedCells);
+
+  DGGS_Cell compactedCellIds[4];
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(handle, compactedCells, 4U, compactedCellIds);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_STREQ("03020", compactedCellIds[0]);
+  EXPECT_STREQ("03021", compactedCellIds[1]);
+  EXPECT_STREQ("03023", compactedCellIds[2]);
+  EXPECT_STREQ("0701", compactedCellIds[3]);
+
+  // Uncompacting gives the original cells
+  DGGS_PackedCell * uncompactedCells = NULL;
+  unsigned int noOfUncompactedCells = 0U;
+  returnCode = EAGGR_UncompactPackedCells(
+      handle,
+      compactedCells,
+      noOfCompactedCells,
+      3U,
+      &uncompactedCells,
+      &noOfUncompactedCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  ASSERT_EQ(noOfCells, noOfUncompactedCells);
+  for (unsigned int cellIndex = 0U; cellIndex < noOfCells; ++cellIndex)
+  {
+    EXPECT_EQ(packedCells[cellIndex], uncompactedCells[cellIndex]);
+  }
+
+  returnCode = EAGGR_DeallocatePackedCells(handle, &uncompactedCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_TRUE(uncompactedCells == NULL);
+
+  // Test error cases
+  returnCode = EAGGR_CompactPackedCells(
+      NULL, packedCells, noOfCells, compactedCells, &noOfCompactedCells);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_CompactPackedCells(
+      handle, NULL, noOfCells, compactedCells, &noOfCompactedCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_CompactPackedCells(
+      handle, packedCells, noOfCells, NULL, &noOfCompactedCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_CompactPackedCells(handle, packedCells, noOfCells, compactedCells, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_UncompactPackedCells(
+      NULL, compactedCells, noOfCompactedCells, 3U, &uncompactedCells, &noOfUncompactedCells);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_UncompactPackedCells(
+      handle, NULL, noOfCompactedCells, 3U, &uncompactedCells, &noOfUncompactedCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_UncompactPackedCells(
+      handle, compactedCells, noOfCompactedCells, 3U, NULL, &noOfUncompactedCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_UncompactPackedCells(
+      handle, compactedCells, noOfCompactedCells, 3U, &uncompactedCells, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_DeallocatePackedCells(NULL, &uncompactedCells);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_DeallocatePackedCells(handle, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  // Cells must be in ascending order
+  std::swap(packedCells[0], packedCells[1]);
+  returnCode = EAGGR_CompactPackedCells(
+      handle, packedCells, noOfCells, compactedCells, &noOfCompactedCells);
+  EXPECT_EQ(DGGS_MODEL_ERROR, returnCode);
+
+  // Cells cannot be expanded to a coarser resolution
+  returnCode = EAGGR_UncompactPackedCells(
+      handle, compactedCells, 4U, 2U, &uncompactedCells, &noOfUncompactedCells);
+  EXPECT_EQ(DGGS_MODEL_ERROR, returnCode);
+  EXPECT_TRUE(uncompactedCells == NULL);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Compaction is not supported for ISEA3H
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA3H, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  returnCode = EAGGR_CompactPackedCells(
+      handle, packedCells, noOfCells, compactedCells, &noOfCompactedCells);
+  EXPECT_EQ(DGGS_NOT_IMPLEMENTED, returnCode);
+  returnCode = EAGGR_UncompactPackedCells(
+      handle, compactedCells, 1U, 3U, &uncompactedCells, &noOfUncompactedCells);
+  EXPECT_EQ(DGGS_NOT_IMPLEMENTED, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, EAGGR_CombinePackedCellSets)
+{
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  DGGS_Cell cells[] =
+  {
+    "07", "0512", "03021"
+  };
+  DGGS_Cell otherCells[] =
+  {
+    "0703", "051", "07012"
+  };
+  const unsigned int noOfCells = sizeof(cells) / sizeof(cells[0]);
+  const unsigned int noOfOtherCells = sizeof(otherCells) / sizeof(otherCells[0]);
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
   ASSERT_EQ(DGGS_SUCCESS, returnCode);
 
-  // Import the string and test the values numerically because values in the string can vary slightly
-  ImportExport::GeoJsonImporter geoJsonImporter(pString, 1.0e-5);
-  CheckShapeString(&geoJsonImporter);
-  EAGGR_DeallocateString(handle, &pString);
+  DGGS_PackedCell packedCells[noOfCells];
+  returnCode = EAGGR_ConvertDggsCellsToPackedCells(handle, cells, noOfCells, packedCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  DGGS_PackedCell otherPackedCells[noOfOtherCells];
+  returnCode = EAGGR_ConvertDggsCellsToPackedCells(
+      handle,
+      otherCells,
+      noOfOtherCells,
+      otherPackedCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_PackedCell * resultCells = NULL;
+  unsigned int noOfResultCells = 0U;
+  DGGS_Cell resultCellIds[4];
+
+  // The union is the face, 051 and 03021
+  returnCode = EAGGR_UnionPackedCells(
+      handle,
+      packedCells,
+      noOfCells,
+      otherPackedCells,
+      noOfOtherCells,
+      &resultCells,
+      &noOfResultCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  ASSERT_EQ(3U, noOfResultCells);
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(handle, resultCells, 3U, resultCellIds);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_STREQ("03021", resultCellIds[0]);
+  EXPECT_STREQ("051", resultCellIds[1]);
+  EXPECT_STREQ("07", resultCellIds[2]);
+  returnCode = EAGGR_DeallocatePackedCells(handle, &resultCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // The intersection is the smaller cell of each overlapping pair
+  returnCode = EAGGR_IntersectPackedCells(
+      handle,
+      packedCells,
+      noOfCells,
+      otherPackedCells,
+      noOfOtherCells,
+      &resultCells,
+      &noOfResultCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  ASSERT_EQ(3U, noOfResultCells);
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(handle, resultCells, 3U, resultCellIds);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_STREQ("0512", resultCellIds[0]);
+  EXPECT_STREQ("07012", resultCellIds[1]);
+  EXPECT_STREQ("0703", resultCellIds[2]);
+  returnCode = EAGGR_DeallocatePackedCells(handle, &resultCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Subtracting the first set leaves the rest of 051
+  returnCode = EAGGR_SubtractPackedCells(
+      handle,
+      otherPackedCells,
+      noOfOtherCells,
+      packedCells,
+      noOfCells,
+      &resultCells,
+      &noOfResultCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  ASSERT_EQ(3U, noOfResultCells);
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(handle, resultCells, 3U, resultCellIds);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_STREQ("0510", resultCellIds[0]);
+  EXPECT_STREQ("0511", resultCellIds[1]);
+  EXPECT_STREQ("0513", resultCellIds[2]);
+  returnCode = EAGGR_DeallocatePackedCells(handle, &resultCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Subtracting a covering set leaves nothing
+  returnCode = EAGGR_SubtractPackedCells(
+      handle,
+      packedCells,
+      1U,
+      packedCells,
+      noOfCells,
+      &resultCells,
+      &noOfResultCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_EQ(0U, noOfResultCells);
+  EXPECT_TRUE(resultCells == NULL);
+
+  // Membership of the other cells and of the parent of 0512
+  DGGS_Cell testCells[] =
+  {
+    "0703", "051", "07012", "051"
+  };
+  const unsigned int noOfTestCells = sizeof(testCells) / sizeof(testCells[0]);
+  DGGS_PackedCell packedTestCells[noOfTestCells];
+  returnCode = EAGGR_ConvertDggsCellsToPackedCells(
+      handle,
+      testCells,
+      noOfTestCells,
+      packedTestCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  bool results[noOfTestCells];
+  returnCode = EAGGR_PackedCellsContain(
+      handle,
+      packedCells,
+      noOfCells,
+      packedTestCells,
+      noOfTestCells,
+      results);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_TRUE(results[0]);
+  EXPECT_FALSE(results[1]);
+  EXPECT_TRUE(results[2]);
+  EXPECT_FALSE(results[3]);
 
   // Test error cases
-  returnCode = EAGGR_ConvertDggsCellsToShapeString(NULL, cells, noOfCells, DGGS_WKT_FORMAT, &pString);
+  returnCode = EAGGR_UnionPackedCells(
+      NULL, packedCells, noOfCells, otherPackedCells, noOfOtherCells, &resultCells,
+      &noOfResultCells);
   EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
-  returnCode = EAGGR_ConvertDggsCellsToShapeString(handle, NULL, noOfCells, DGGS_WKT_FORMAT, &pString);
+  returnCode = EAGGR_IntersectPackedCells(
+      handle, NULL, noOfCells, otherPackedCells, noOfOtherCells, &resultCells, &noOfResultCells);
   EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
-  returnCode = EAGGR_ConvertDggsCellsToShapeString(handle, cells, noOfCells, DGGS_WKT_FORMAT, NULL);
+  returnCode = EAGGR_SubtractPackedCells(
+      handle, packedCells, noOfCells, NULL, noOfOtherCells, &resultCells, &noOfResultCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_UnionPackedCells(
+      handle, packedCells, noOfCells, otherPackedCells, noOfOtherCells, NULL, &noOfResultCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_UnionPackedCells(
+      handle, packedCells, noOfCells, otherPackedCells, noOfOtherCells, &resultCells, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_PackedCellsContain(
+      NULL, packedCells, noOfCells, packedTestCells, noOfTestCells, results);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_PackedCellsContain(
+      handle, packedCells, noOfCells, NULL, noOfTestCells, results);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_PackedCellsContain(
+      handle, packedCells, noOfCells, packedTestCells, noOfTestCells, NULL);
   EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
 
+  // Invalid packed cells
+  packedTestCells[0] = 0U;
+  returnCode = EAGGR_PackedCellsContain(
+      handle, packedCells, noOfCells, packedTestCells, noOfTestCells, results);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+  otherPackedCells[0] = 0xA400000000000000ULL;
+  returnCode = EAGGR_UnionPackedCells(
+      handle, packedCells, noOfCells, otherPackedCells, noOfOtherCells, &resultCells, &noOfResultCells);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+  EXPECT_TRUE(resultCells == NULL);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Cell sets are not supported for ISEA3H
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA3H, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  returnCode = EAGGR_UnionPackedCells(
+      handle, packedCells, noOfCells, otherPackedCells, noOfOtherCells, &resultCells,
+      &noOfResultCells);
+  EXPECT_EQ(DGGS_NOT_IMPLEMENTED, returnCode);
+  returnCode = EAGGR_PackedCellsContain(
+      handle, packedCells, noOfCells, packedTestCells, noOfTestCells, results);
+  EXPECT_EQ(DGGS_NOT_IMPLEMENTED, returnCode);
+
   returnCode = EAGGR_CloseDggsHandle(&handle);
   ASSERT_EQ(DGGS_SUCCESS, returnCode);
 }
@@ -776,6 +2114,125 @@ SYSTEM_TEST(DLL, EAGGR_GetDggsCellSiblings)
   ASSERT_EQ(DGGS_SUCCESS, returnCode);
 }
 
+SYSTEM_TEST(DLL, EAGGR_GetDggsCellNeighbours)
+{
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  DGGS_Cell cell = "0000";
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_Cell neighbourCells[EAGGR_MAX_NEIGHBOUR_CELLS] =
+  {};
+  unsigned short noOfNeighbourCells = 0U;
+
+  returnCode = EAGGR_GetDggsCellNeighbours(handle, cell, neighbourCells, &noOfNeighbourCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // The middle triangle shares its edges with the other children of its parent
+  ASSERT_EQ(12U, noOfNeighbourCells);
+  std::set<std::string> edgeNeighbours(neighbourCells, neighbourCells + 3);
+  EXPECT_EQ(1U, edgeNeighbours.count("0001"));
+  EXPECT_EQ(1U, edgeNeighbours.count("0002"));
+  EXPECT_EQ(1U, edgeNeighbours.count("0003"));
+
+  // Only five triangles meet at the north pole
+  DGGS_Cell poleCell = "0011";
+  returnCode = EAGGR_GetDggsCellNeighbours(handle, poleCell, neighbourCells, &noOfNeighbourCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_EQ(11U, noOfNeighbourCells);
+
+  DGGS_Cell * kRingCells = NULL;
+  unsigned int noOfKRingCells = 0U;
+  returnCode = EAGGR_GetDggsCellKRing(handle, cell, 1U, &kRingCells, &noOfKRingCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  ASSERT_EQ(13U, noOfKRingCells);
+  EXPECT_STREQ("0000", kRingCells[0]);
+  returnCode = EAGGR_DeallocateDggsCells(handle, &kRingCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Test error cases
+  returnCode = EAGGR_GetDggsCellNeighbours(NULL, cell, neighbourCells, &noOfNeighbourCells);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_GetDggsCellNeighbours(handle, cell, NULL, &noOfNeighbourCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_GetDggsCellNeighbours(handle, cell, neighbourCells, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_GetDggsCellKRing(NULL, cell, 1U, &kRingCells, &noOfKRingCells);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+  returnCode = EAGGR_GetDggsCellKRing(handle, cell, 1U, NULL, &noOfKRingCells);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+  returnCode = EAGGR_GetDggsCellKRing(handle, cell, 1U, &kRingCells, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Hexagons have six neighbours and the rings around them grow by six cells each time
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA3H, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_Cell hexagonCell = "07050,0";
+  returnCode = EAGGR_GetDggsCellNeighbours(
+      handle,
+      hexagonCell,
+      neighbourCells,
+      &noOfNeighbourCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_EQ(6U, noOfNeighbourCells);
+
+  returnCode = EAGGR_GetDggsCellKRing(handle, hexagonCell, 2U, &kRingCells, &noOfKRingCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_EQ(19U, noOfKRingCells);
+  returnCode = EAGGR_DeallocateDggsCells(handle, &kRingCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, EAGGR_ConvertDggsCellsToPackedCellsISEA3H)
+{
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  DGGS_Cell cells[] =
+  {
+    "0105123,456", "1005-123,-456", "07231234567,-2345678"
+  };
+  const unsigned short noOfCells = sizeof(cells) / sizeof(cells[0]);
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA3H, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_PackedCell packedCells[noOfCells];
+  returnCode = EAGGR_ConvertDggsCellsToPackedCells(handle, cells, noOfCells, packedCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  EXPECT_EQ(0x04500003D8000390ULL, packedCells[0]);
+  EXPECT_EQ(0x28500003D400038FULL, packedCells[1]);
+
+  // Convert back to cell IDs
+  DGGS_Cell unpackedCells[noOfCells];
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(handle, packedCells, noOfCells, unpackedCells);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  for (unsigned short cellIndex = 0U; cellIndex < noOfCells; ++cellIndex)
+  {
+    EXPECT_STREQ(cells[cellIndex], unpackedCells[cellIndex]);
+  }
+
+  // Test a packed cell with an invalid resolution
+  packedCells[0] = 0x0290000000000000ULL;
+  returnCode = EAGGR_ConvertPackedCellsToDggsCells(handle, packedCells, noOfCells, unpackedCells);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
 SYSTEM_TEST(DLL, EAGGR_ConvertShapesToDggsShapesISEA3H)
 {
   static const unsigned short NO_OF_SHAPES = 4U;
@@ -2127,3 +3584,360 @@ SYSTEM_TEST(DLL, EAGGR_CompareShapesErrors)
 
   EAGGR_DeallocateString(handle, &errorMessage);
 }
+
+SYSTEM_TEST(DLL, EAGGR_ComparePreparedShape)
+{
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+  bool preparedResult;
+  bool expectedResult;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  TestData testData;
+
+  const DGGS_Shape * baseShapes[] =
+  {
+    &testData.m_baseCell,
+    &testData.m_baseLinestring,
+    &testData.m_basePolygon
+  };
+
+  const DGGS_Shape * comparisonShapes[] =
+  {
+    &testData.m_baseCell,
+    &testData.m_otherCell,
+    &testData.m_childCell,
+    &testData.m_parentCell,
+    &testData.m_disjointCell,
+    &testData.m_baseLinestring,
+    &testData.m_substringLinestring,
+    &testData.m_disjointLinestring,
+    &testData.m_basePolygon,
+    &testData.m_noInnerRingsPolygon,
+    &testData.m_containsPolygon,
+    &testData.m_interiorPolygon,
+    &testData.m_disjointPolygon
+  };
+
+  const DGGS_AnalysisType analysisTypes[] =
+  {
+    DGGS_EQUALS,
+    DGGS_CONTAINS,
+    DGGS_WITHIN,
+    DGGS_TOUCHES,
+    DGGS_DISJOINT,
+    DGGS_INTERSECTS,
+    DGGS_COVERS,
+    DGGS_COVERED_BY,
+    DGGS_CROSSES,
+    DGGS_OVERLAPS
+  };
+
+  // Comparing with a prepared shape gives the same results as comparing the shapes directly
+  for (const DGGS_Shape * baseShape : baseShapes)
+  {
+    DGGS_PreparedShape preparedShape = NULL;
+    returnCode = EAGGR_PrepareShape(handle, baseShape, &preparedShape);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+    ASSERT_TRUE(preparedShape != NULL);
+
+    for (const DGGS_AnalysisType analysisType : analysisTypes)
+    {
+      for (const DGGS_Shape * comparisonShape : comparisonShapes)
+      {
+        returnCode = EAGGR_CompareShapes(handle, analysisType, baseShape, comparisonShape, &expectedResult);
+        ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+        returnCode = EAGGR_ComparePreparedShape(handle, analysisType, preparedShape, comparisonShape, &preparedResult);
+        ASSERT_EQ(DGGS_SUCCESS, returnCode);
+        EXPECT_EQ(expectedResult, preparedResult);
+      }
+    }
+
+    returnCode = EAGGR_ReleasePreparedShape(handle, &preparedShape);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+    EXPECT_TRUE(preparedShape == NULL);
+  }
+
+  // A prepared shape can only be compared using the handle it was created with
+  DGGS_Handle otherHandle = NULL;
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &otherHandle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_PreparedShape preparedShape = NULL;
+  returnCode = EAGGR_PrepareShape(handle, &testData.m_baseCell, &preparedShape);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  returnCode = EAGGR_ComparePreparedShape(otherHandle, DGGS_EQUALS, preparedShape, &testData.m_baseCell, &preparedResult);
+  EXPECT_EQ(DGGS_INVALID_PARAM, returnCode);
+
+  char * errorMessage;
+  unsigned short messageLength = 0U;
+  returnCode = EAGGR_GetLastErrorMessage(otherHandle, &errorMessage, &messageLength);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  EXPECT_STREQ("Prepared shape was created with a different DGGS handle.", errorMessage);
+
+  EAGGR_DeallocateString(otherHandle, &errorMessage);
+
+  returnCode = EAGGR_ComparePreparedShape(handle, DGGS_EQUALS, preparedShape, &testData.m_baseCell, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_ComparePreparedShape(handle, DGGS_EQUALS, NULL, &testData.m_baseCell, &preparedResult);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_ComparePreparedShape(NULL, DGGS_EQUALS, preparedShape, &testData.m_baseCell, &preparedResult);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+
+  returnCode = EAGGR_ReleasePreparedShape(handle, &preparedShape);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Unsupported base shapes cannot be prepared
+  DGGS_Shape invalidShape;
+  invalidShape.m_type = (DGGS_ShapeType)100; // This is invalid
+  invalidShape.m_location = DGGS_ONE_FACE;
+  DGGS_Cell dggsCell = "0700";
+  AssignCell(invalidShape.m_data.m_cell, dggsCell);
+
+  returnCode = EAGGR_PrepareShape(handle, &invalidShape, &preparedShape);
+  EXPECT_EQ(DGGS_MODEL_ERROR, returnCode);
+
+  returnCode = EAGGR_GetLastErrorMessage(handle, &errorMessage, &messageLength);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  EXPECT_STREQ("EAGGR Exception: Unsupported base shape type.", errorMessage);
+
+  EAGGR_DeallocateString(handle, &errorMessage);
+
+  returnCode = EAGGR_CloseDggsHandle(&otherHandle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, EAGGR_RelateShapes)
+{
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+  bool matrixResult;
+  bool expectedResult;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  TestData testData;
+
+  const DGGS_Shape * shapes[] =
+  {
+    &testData.m_baseCell,
+    &testData.m_childCell,
+    &testData.m_disjointCell,
+    &testData.m_baseLinestring,
+    &testData.m_substringLinestring,
+    &testData.m_disjointLinestring,
+    &testData.m_basePolygon,
+    &testData.m_noInnerRingsPolygon,
+    &testData.m_interiorPolygon
+  };
+
+  const DGGS_AnalysisType analysisTypes[] =
+  {
+    DGGS_CONTAINS,
+    DGGS_COVERED_BY,
+    DGGS_COVERS,
+    DGGS_CROSSES,
+    DGGS_DISJOINT,
+    DGGS_EQUALS,
+    DGGS_INTERSECTS,
+    DGGS_OVERLAPS,
+    DGGS_TOUCHES,
+    DGGS_WITHIN
+  };
+
+  // Every comparison found from the relation matrix gives the same result as comparing the shapes
+  for (const DGGS_Shape * baseShape : shapes)
+  {
+    DGGS_PreparedShape preparedShape = NULL;
+    returnCode = EAGGR_PrepareShape(handle, baseShape, &preparedShape);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+    for (const DGGS_Shape * comparisonShape : shapes)
+    {
+      DGGS_RelationMatrix relationMatrix;
+      returnCode = EAGGR_RelateShapes(handle, baseShape, comparisonShape, relationMatrix);
+      ASSERT_EQ(DGGS_SUCCESS, returnCode);
+      EXPECT_EQ(EAGGR_RELATION_MATRIX_LENGTH - 1U, strlen(relationMatrix));
+
+      DGGS_RelationMatrix preparedRelationMatrix;
+      returnCode = EAGGR_RelatePreparedShape(handle, preparedShape, comparisonShape, preparedRelationMatrix);
+      ASSERT_EQ(DGGS_SUCCESS, returnCode);
+      EXPECT_STREQ(relationMatrix, preparedRelationMatrix);
+
+      for (const DGGS_AnalysisType analysisType : analysisTypes)
+      {
+        returnCode = EAGGR_CompareShapes(handle, analysisType, baseShape, comparisonShape, &expectedResult);
+        ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+        returnCode = EAGGR_RelationMatrixMatches(handle, analysisType, relationMatrix, &matrixResult);
+        ASSERT_EQ(DGGS_SUCCESS, returnCode);
+        EXPECT_EQ(expectedResult, matrixResult);
+      }
+    }
+
+    returnCode = EAGGR_ReleasePreparedShape(handle, &preparedShape);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  }
+
+  // Check the matrix of a cell and its central child, whose vertices lie on the cell's edges
+  DGGS_RelationMatrix relationMatrix;
+  returnCode = EAGGR_RelateShapes(handle, &testData.m_baseCell, &testData.m_childCell, relationMatrix);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_STREQ("212F01FF2", relationMatrix);
+
+  // Check errors
+  returnCode = EAGGR_RelateShapes(handle, &testData.m_baseCell, &testData.m_childCell, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_RelateShapes(NULL, &testData.m_baseCell, &testData.m_childCell, relationMatrix);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+
+  returnCode = EAGGR_RelationMatrixMatches(handle, DGGS_CONTAINS, relationMatrix, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  DGGS_RelationMatrix invalidRelationMatrix = "212F11FX2";
+  returnCode = EAGGR_RelationMatrixMatches(handle, DGGS_CONTAINS, invalidRelationMatrix, &matrixResult);
+  EXPECT_EQ(DGGS_MODEL_ERROR, returnCode);
+
+  char * errorMessage;
+  unsigned short messageLength = 0U;
+  returnCode = EAGGR_GetLastErrorMessage(handle, &errorMessage, &messageLength);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  EXPECT_STREQ("EAGGR Exception: Invalid relation matrix '212F11FX2'.", errorMessage);
+
+  EAGGR_DeallocateString(handle, &errorMessage);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(DLL, EAGGR_CompareShapeSets)
+{
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+  bool expectedResult;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  TestData testData;
+
+  const DGGS_Shape baseShapes[] =
+  {
+    testData.m_baseCell,
+    testData.m_baseLinestring,
+    testData.m_basePolygon,
+    testData.m_disjointCell,
+    testData.m_childCell
+  };
+  const unsigned int noOfBaseShapes = sizeof(baseShapes) / sizeof(baseShapes[0]);
+
+  const DGGS_Shape comparisonShapes[] =
+  {
+    testData.m_baseCell,
+    testData.m_otherCell,
+    testData.m_parentCell,
+    testData.m_substringLinestring,
+    testData.m_disjointLinestring,
+    testData.m_noInnerRingsPolygon,
+    testData.m_interiorPolygon,
+    testData.m_disjointPolygon
+  };
+  const unsigned int noOfComparisonShapes = sizeof(comparisonShapes) / sizeof(comparisonShapes[0]);
+
+  const DGGS_AnalysisType analysisTypes[] =
+  {
+    DGGS_CONTAINS,
+    DGGS_COVERED_BY,
+    DGGS_COVERS,
+    DGGS_CROSSES,
+    DGGS_DISJOINT,
+    DGGS_EQUALS,
+    DGGS_INTERSECTS,
+    DGGS_OVERLAPS,
+    DGGS_TOUCHES,
+    DGGS_WITHIN
+  };
+
+  // The pairs found must be those for which comparing the shapes gives true
+  for (const DGGS_AnalysisType analysisType : analysisTypes)
+  {
+    DGGS_ShapePair * shapePairs = NULL;
+    unsigned int noOfShapePairs = 0U;
+    returnCode = EAGGR_CompareShapeSets(handle, analysisType, baseShapes, noOfBaseShapes, comparisonShapes, noOfComparisonShapes, &shapePairs, &noOfShapePairs, 2U);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+    unsigned int pairIndex = 0U;
+    for (unsigned int baseIndex = 0U; baseIndex < noOfBaseShapes; ++baseIndex)
+    {
+      for (unsigned int comparisonIndex = 0U; comparisonIndex < noOfComparisonShapes; ++comparisonIndex)
+      {
+        returnCode = EAGGR_CompareShapes(handle, analysisType, &baseShapes[baseIndex], &comparisonShapes[comparisonIndex], &expectedResult);
+        ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+        if (expectedResult)
+        {
+          ASSERT_LT(pairIndex, noOfShapePairs);
+          EXPECT_EQ(baseIndex, shapePairs[pairIndex].m_baseShapeIndex);
+          EXPECT_EQ(comparisonIndex, shapePairs[pairIndex].m_comparisonShapeIndex);
+          ++pairIndex;
+        }
+      }
+    }
+    EXPECT_EQ(pairIndex, noOfShapePairs);
+
+    returnCode = EAGGR_DeallocateShapePairs(handle, &shapePairs);
+    ASSERT_EQ(DGGS_SUCCESS, returnCode);
+    EXPECT_TRUE(shapePairs == NULL);
+  }
+
+  // No pairs are found if either array is empty
+  DGGS_ShapePair * shapePairs = NULL;
+  unsigned int noOfShapePairs = 1U;
+  returnCode = EAGGR_CompareShapeSets(handle, DGGS_DISJOINT, NULL, 0U, comparisonShapes, noOfComparisonShapes, &shapePairs, &noOfShapePairs, 0U);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_EQ(0U, noOfShapePairs);
+  EXPECT_TRUE(shapePairs == NULL);
+
+  // Check errors
+  returnCode = EAGGR_CompareShapeSets(handle, DGGS_DISJOINT, NULL, 1U, comparisonShapes, noOfComparisonShapes, &shapePairs, &noOfShapePairs, 0U);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_CompareShapeSets(handle, DGGS_DISJOINT, baseShapes, noOfBaseShapes, comparisonShapes, noOfComparisonShapes, NULL, &noOfShapePairs, 0U);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_CompareShapeSets(NULL, DGGS_DISJOINT, baseShapes, noOfBaseShapes, comparisonShapes, noOfComparisonShapes, &shapePairs, &noOfShapePairs, 0U);
+  EXPECT_EQ(DGGS_INVALID_HANDLE, returnCode);
+
+  DGGS_Shape invalidShapes[] = { testData.m_baseCell };
+  invalidShapes[0].m_type = (DGGS_ShapeType)100; // This is invalid
+
+  returnCode = EAGGR_CompareShapeSets(handle, DGGS_DISJOINT, invalidShapes, 1U, comparisonShapes, noOfComparisonShapes, &shapePairs, &noOfShapePairs, 0U);
+  EXPECT_EQ(DGGS_MODEL_ERROR, returnCode);
+  EXPECT_TRUE(shapePairs == NULL);
+
+  char * errorMessage;
+  unsigned short messageLength = 0U;
+  returnCode = EAGGR_GetLastErrorMessage(handle, &errorMessage, &messageLength);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  EXPECT_STREQ("EAGGR Exception: Unsupported base shape type.", errorMessage);
+
+  EAGGR_DeallocateString(handle, &errorMessage);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+}
@@ -27,14 +27,18 @@
 /// or can be found at <http://www.gnu.org/licenses/>.
 //------------------------------------------------------
 
+#include <climits>
 #include <cstdio>
 #include <fstream>
 #include <thread>
+#include <vector>
 
 #include "TestMacros.hpp"
 
 #include "../EAGGR/API/eaggr_api.h"
 
+#include "Src/LatLong/SphericalAccuracyPoint.hpp"
+
 void ConvertPoint(DGGS_LatLongPoint point)
 {
   try
@@ -87,3 +91,132 @@ SYSTEM_TEST(Multithread, ConvertPoints)
     iter->join();
   }
 }
+
+SYSTEM_TEST(Multithread, LastErrorMessageIsPerThread)
+{
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Generate an error on this thread
+  returnCode = EAGGR_ConvertPointsToDggsCells(handle, NULL, 1U, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  // A second thread using the same handle does not see the error, and its own error is not seen
+  // by this thread
+  unsigned short otherThreadMessageLength = USHRT_MAX;
+  std::thread otherThread([handle, &otherThreadMessageLength]()
+  {
+    char * message = NULL;
+    EAGGR_GetLastErrorMessage(handle, &message, &otherThreadMessageLength);
+    EAGGR_DeallocateString(handle, &message);
+
+    DGGS_Cell cell;
+    EAGGR_ConvertPointsToDggsCells(handle, NULL, 1U, &cell);
+  });
+  otherThread.join();
+
+  EXPECT_EQ(0U, otherThreadMessageLength);
+
+  char * errorMessage = NULL;
+  unsigned short messageLength = 0U;
+  returnCode = EAGGR_GetLastErrorMessage(handle, &errorMessage, &messageLength);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_STREQ("Pointer argument 'a_points' is null", errorMessage);
+  EAGGR_DeallocateString(handle, &errorMessage);
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  EXPECT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(Multithread, LastErrorMessageOfHandleClosedOnOtherThread)
+{
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  // Generate an error on this thread, then close the handle on another thread
+  returnCode = EAGGR_ConvertPointsToDggsCells(handle, NULL, 1U, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  std::thread otherThread([&handle]()
+  {
+    EAGGR_CloseDggsHandle(&handle);
+  });
+  otherThread.join();
+
+  // The message of the closed handle is discarded, while the messages of open handles are kept
+  DGGS_Handle otherHandle = NULL;
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &otherHandle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  char * errorMessage = NULL;
+  unsigned short messageLength = USHRT_MAX;
+  returnCode = EAGGR_GetLastErrorMessage(otherHandle, &errorMessage, &messageLength);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_EQ(0U, messageLength);
+  EAGGR_DeallocateString(otherHandle, &errorMessage);
+
+  returnCode = EAGGR_ConvertPointsToDggsCells(otherHandle, NULL, 1U, NULL);
+  EXPECT_EQ(DGGS_NULL_POINTER, returnCode);
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  EXPECT_EQ(DGGS_SUCCESS, returnCode);
+
+  returnCode = EAGGR_GetLastErrorMessage(otherHandle, &errorMessage, &messageLength);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+  EXPECT_STREQ("Pointer argument 'a_points' is null", errorMessage);
+  EAGGR_DeallocateString(otherHandle, &errorMessage);
+
+  returnCode = EAGGR_CloseDggsHandle(&otherHandle);
+  EXPECT_EQ(DGGS_SUCCESS, returnCode);
+}
+
+SYSTEM_TEST(Multithread, ConvertPointsWithSharedHandle)
+{
+  static const unsigned short NO_OF_THREADS = 4U;
+  static const unsigned short NO_OF_ITERATIONS = 200U;
+
+  DGGS_Handle handle = NULL;
+  DGGS_ReturnCode returnCode;
+
+  returnCode = EAGGR_OpenDggsHandle(DGGS_ISEA4T, &handle);
+  ASSERT_EQ(DGGS_SUCCESS, returnCode);
+
+  DGGS_LatLongPoint latLongPoint =
+  { 1.234, 2.345, EAGGR::LatLong::SphericalAccuracyPoint::AngleAccuracyToSquareMetres(1.0e-5)};
+
+  // Every thread converts the same point using the shared handle
+  unsigned short noOfMismatches[NO_OF_THREADS] = { 0U };
+  std::vector<std::thread> threads;
+  for (unsigned short threadIndex = 0U; threadIndex < NO_OF_THREADS; ++threadIndex)
+  {
+    threads.push_back(std::thread([handle, &latLongPoint, &noOfMismatches, threadIndex]()
+    {
+      for (unsigned short iteration = 0U; iteration < NO_OF_ITERATIONS; ++iteration)
+      {
+        DGGS_Cell cell;
+        if (EAGGR_ConvertPointsToDggsCells(handle, &latLongPoint, 1U, &cell) != DGGS_SUCCESS
+            || strcmp("07231131111113100331001", cell) != 0)
+        {
+          ++noOfMismatches[threadIndex];
+        }
+      }
+    }));
+  }
+
+  for (unsigned short threadIndex = 0U; threadIndex < NO_OF_THREADS; ++threadIndex)
+  {
+    threads[threadIndex].join();
+    EXPECT_EQ(0U, noOfMismatches[threadIndex]);
+  }
+
+  returnCode = EAGGR_CloseDggsHandle(&handle);
+  EXPECT_EQ(DGGS_SUCCESS, returnCode);
+}
@@ -43,6 +43,12 @@ namespace EAGGR
       return m_cellId;
     }
 
+    Model::Cell::DggsPackedCellId KmlTestCell::GetPackedCellId() const
+    {
+      // Not used by the tests
+      return 0U;
+    }
+
     unsigned short KmlTestCell::GetFaceIndex() const
     {
       // Not used by the tests
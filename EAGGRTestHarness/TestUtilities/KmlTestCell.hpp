@@ -46,6 +46,7 @@ namespace EAGGR
         KmlTestCell(const Model::Cell::DggsCellId a_cellId);
 
         virtual Model::Cell::DggsCellId GetCellId() const;
+        virtual Model::Cell::DggsPackedCellId GetPackedCellId() const;
 
         virtual unsigned short GetFaceIndex() const;
         virtual unsigned short GetResolution() const;
@@ -62,6 +62,21 @@ namespace EAGGR
       return std::unique_ptr<Cell::ICell>();
     }
 
+    std::unique_ptr<Cell::ICell> KmlTestGridIndexer::GetCellAtResolution(
+        const FaceCoordinate a_faceCoordinate,
+        const unsigned short a_resolution) const
+    {
+      // Not used by KML export
+      return std::unique_ptr<Cell::ICell>();
+    }
+
+    void KmlTestGridIndexer::GetCellsAtAllResolutions(
+        const FaceCoordinate a_faceCoordinate,
+        std::vector<std::unique_ptr<Cell::ICell> >& a_cells) const
+    {
+      // Not used by KML export
+    }
+
     FaceCoordinate KmlTestGridIndexer::GetFaceCoordinate(const Cell::ICell & a_cell) const
     {
       return m_centres.find(a_cell.GetCellId())->second;
@@ -74,6 +89,13 @@ namespace EAGGR
       return std::unique_ptr<Cell::ICell>();
     }
 
+    std::unique_ptr<Cell::ICell> KmlTestGridIndexer::CreateCell(
+        const Cell::DggsPackedCellId a_packedCellId) const
+    {
+      // Not used by KML export
+      return std::unique_ptr<Cell::ICell>();
+    }
+
     void KmlTestGridIndexer::GetParents(
         const Cell::ICell& a_cellId,
         std::vector<std::unique_ptr<Cell::ICell> >& a_parentCellIds) const
@@ -100,5 +122,18 @@ namespace EAGGR
         a_cellVertices.push_back(*iter);
       }
     }
+
+    void KmlTestGridIndexer::GetNeighbourCoordinates(
+        const Cell::ICell & a_cell,
+        std::vector<FaceCoordinate>& a_neighbourCoordinates) const
+    {
+      // Not used by KML export
+    }
+
+    double KmlTestGridIndexer::GetDescendantExtentFactor() const
+    {
+      // Not used by KML export
+      return 1.0;
+    }
   }
 }
@@ -58,11 +58,22 @@ namespace EAGGR
         virtual std::unique_ptr<Model::Cell::ICell> GetCell(
             const Model::FaceCoordinate a_faceCoordinate) const;
 
+        virtual std::unique_ptr<Model::Cell::ICell> GetCellAtResolution(
+            const Model::FaceCoordinate a_faceCoordinate,
+            const unsigned short a_resolution) const;
+
+        virtual void GetCellsAtAllResolutions(
+            const Model::FaceCoordinate a_faceCoordinate,
+            std::vector<std::unique_ptr<Model::Cell::ICell> >& a_cells) const;
+
         virtual Model::FaceCoordinate GetFaceCoordinate(const Model::Cell::ICell & a_cell) const;
 
         virtual std::unique_ptr<Model::Cell::ICell> CreateCell(
             const Model::Cell::DggsCellId & a_cellId) const;
 
+        virtual std::unique_ptr<Model::Cell::ICell> CreateCell(
+            const Model::Cell::DggsPackedCellId a_packedCellId) const;
+
         virtual void GetParents(
             const Model::Cell::ICell& a_cell,
             std::vector<std::unique_ptr<Model::Cell::ICell> >& a_parentCells) const;
@@ -75,6 +86,12 @@ namespace EAGGR
             const Model::Cell::ICell & a_cell,
             std::list<Model::FaceCoordinate>& a_cellVertices) const;
 
+        virtual void GetNeighbourCoordinates(
+            const Model::Cell::ICell & a_cell,
+            std::vector<Model::FaceCoordinate>& a_neighbourCoordinates) const;
+
+        virtual double GetDescendantExtentFactor() const;
+
       private:
         std::map<Model::Cell::DggsCellId, Model::FaceCoordinate> m_centres;
         std::map<Model::Cell::DggsCellId, std::list<Model::FaceCoordinate> > m_vertices;
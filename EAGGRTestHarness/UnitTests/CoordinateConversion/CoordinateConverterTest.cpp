@@ -27,6 +27,7 @@
 /// or can be found at <http://www.gnu.org/licenses/>.
 //------------------------------------------------------
 
+#include <algorithm>
 #include <cstdlib>
 
 #include "TestMacros.hpp"
@@ -225,3 +226,91 @@ UNIT_TEST(CoordinateConverter, ConvertWGS84ToSphericalAndBackTest)
     EXPECT_NEAR(wgs84Point.GetLongitude(), convertedPoint.GetLongitude(), LAT_LONG_TOLERANCE);
   }
 }
+
+UNIT_TEST(CoordinateConverter, ClosedFormMatchesProj4)
+{
+  CoordinateConverter converter(CLOSED_FORM);
+  CoordinateConverter proj4Converter(PROJ4);
+
+  const double proj4Tolerance = 1e-12;
+
+  for (double latitude = -90.0; latitude <= 90.0; latitude += 0.01)
+  {
+    const double longitude = latitude * 2.0;
+
+    EAGGR::LatLong::Wgs84AccuracyPoint wgs84Point(latitude, longitude, ACCURACY);
+    EAGGR::LatLong::SphericalAccuracyPoint sphericalPoint = converter.ConvertWGS84ToSphere(
+        wgs84Point);
+    EAGGR::LatLong::SphericalAccuracyPoint proj4SphericalPoint =
+        proj4Converter.ConvertWGS84ToSphere(wgs84Point);
+
+    EXPECT_NEAR(proj4SphericalPoint.GetLatitude(), sphericalPoint.GetLatitude(), proj4Tolerance);
+    EXPECT_NEAR(proj4SphericalPoint.GetLongitude(), sphericalPoint.GetLongitude(), proj4Tolerance);
+
+    EAGGR::LatLong::SphericalAccuracyPoint spherePoint(latitude, longitude, ACCURACY);
+    EAGGR::LatLong::Wgs84AccuracyPoint convertedPoint = converter.ConvertSphereToWGS84(spherePoint);
+    EAGGR::LatLong::Wgs84AccuracyPoint proj4ConvertedPoint = proj4Converter.ConvertSphereToWGS84(
+        spherePoint);
+
+    EXPECT_NEAR(proj4ConvertedPoint.GetLatitude(), convertedPoint.GetLatitude(), proj4Tolerance);
+    EXPECT_NEAR(proj4ConvertedPoint.GetLongitude(), convertedPoint.GetLongitude(), proj4Tolerance);
+  }
+}
+
+UNIT_TEST(CoordinateConverter, ConvertArrays)
+{
+  CoordinateConverter converter;
+
+  const double latitudes[] =
+  { 51.1879158, 90.0, -90.0, 0.0, -33.5 };
+  const double longitudes[] =
+  { 90.0, -100.0, 0.0, -180.0, 151.2 };
+  const size_t noOfPoints = sizeof(latitudes) / sizeof(latitudes[0]);
+
+  double sphereLatitudes[noOfPoints];
+  double sphereLongitudes[noOfPoints];
+  converter.ConvertWGS84ToSphere(
+      latitudes,
+      longitudes,
+      noOfPoints,
+      sphereLatitudes,
+      sphereLongitudes);
+
+  double wgs84Latitudes[noOfPoints];
+  double wgs84Longitudes[noOfPoints];
+  converter.ConvertSphereToWGS84(latitudes, longitudes, noOfPoints, wgs84Latitudes, wgs84Longitudes);
+
+  for (size_t pointIndex = 0U; pointIndex < noOfPoints; ++pointIndex)
+  {
+    EAGGR::LatLong::SphericalAccuracyPoint sphericalPoint = converter.ConvertWGS84ToSphere(
+        EAGGR::LatLong::Wgs84AccuracyPoint(latitudes[pointIndex], longitudes[pointIndex], ACCURACY));
+    EXPECT_DOUBLE_EQ(sphericalPoint.GetLatitude(), sphereLatitudes[pointIndex]);
+    EXPECT_DOUBLE_EQ(sphericalPoint.GetLongitude(), sphereLongitudes[pointIndex]);
+
+    EAGGR::LatLong::Wgs84AccuracyPoint wgs84Point = converter.ConvertSphereToWGS84(
+        EAGGR::LatLong::SphericalAccuracyPoint(
+            latitudes[pointIndex],
+            longitudes[pointIndex],
+            ACCURACY));
+    EXPECT_DOUBLE_EQ(wgs84Point.GetLatitude(), wgs84Latitudes[pointIndex]);
+    EXPECT_DOUBLE_EQ(wgs84Point.GetLongitude(), wgs84Longitudes[pointIndex]);
+  }
+
+  // Converting in place gives the same result
+  double inPlaceLatitudes[noOfPoints];
+  double inPlaceLongitudes[noOfPoints];
+  std::copy(latitudes, latitudes + noOfPoints, inPlaceLatitudes);
+  std::copy(longitudes, longitudes + noOfPoints, inPlaceLongitudes);
+  converter.ConvertWGS84ToSphere(
+      inPlaceLatitudes,
+      inPlaceLongitudes,
+      noOfPoints,
+      inPlaceLatitudes,
+      inPlaceLongitudes);
+
+  for (size_t pointIndex = 0U; pointIndex < noOfPoints; ++pointIndex)
+  {
+    EXPECT_EQ(sphereLatitudes[pointIndex], inPlaceLatitudes[pointIndex]);
+    EXPECT_EQ(sphereLongitudes[pointIndex], inPlaceLongitudes[pointIndex]);
+  }
+}
@@ -0,0 +1,309 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2016
+//------------------------------------------------------
+//
+// system: EAGGRTestHarness
+//
+// subsystem: Unit Tests
+//
+//------------------------------------------------------
+/// @file CellNeighbourhoodTest.cpp
+/// 
+/// Tests for the EAGGR::Model::CellNeighbourhood class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <cmath>
+#include <map>
+#include <set>
+
+#include "TestMacros.hpp"
+
+#include "Src/Model/CellNeighbourhood.hpp"
+#include "Src/EAGGRException.hpp"
+#include "Src/Model/IPolyhedralGlobe/Icosahedron.hpp"
+#include "Src/Model/IProjection/Snyder.hpp"
+#include "Src/Model/IGrid/IHierarchicalGrid/Aperture4TriangleGrid.hpp"
+#include "Src/Model/IGrid/IOffsetGrid/Aperture3HexagonGrid.hpp"
+#include "Src/Model/IGridIndexer/HierarchicalGridIndexer.hpp"
+#include "Src/Model/IGridIndexer/OffsetGridIndexer.hpp"
+
+using namespace EAGGR::Model;
+using namespace EAGGR::Model::Cell;
+
+/// Gets the neighbours of every cell in a_cellIds and checks that each neighbour has the cell as
+/// a neighbour in return. Returns the number of cells with each number of neighbours.
+static std::map<std::size_t, unsigned int> CheckNeighboursAreSymmetric(
+    const CellNeighbourhood & a_neighbourhood,
+    const GridIndexer::IGridIndexer & a_gridIndexer,
+    const std::set<DggsCellId> & a_cellIds)
+{
+  std::map<DggsCellId, std::set<DggsCellId> > neighbourIds;
+  std::map<std::size_t, unsigned int> noOfCells;
+  std::vector<std::unique_ptr<ICell> > neighbours;
+
+  for (std::set<DggsCellId>::const_iterator cellId = a_cellIds.begin();
+      cellId != a_cellIds.end(); ++cellId)
+  {
+    a_neighbourhood.GetNeighbours(*a_gridIndexer.CreateCell(*cellId), neighbours);
+    ++noOfCells[neighbours.size()];
+
+    for (std::vector<std::unique_ptr<ICell> >::const_iterator neighbour = neighbours.begin();
+        neighbour != neighbours.end(); ++neighbour)
+    {
+      neighbourIds[*cellId].insert((*neighbour)->GetCellId());
+    }
+  }
+
+  for (std::map<DggsCellId, std::set<DggsCellId> >::const_iterator cell = neighbourIds.begin();
+      cell != neighbourIds.end(); ++cell)
+  {
+    for (std::set<DggsCellId>::const_iterator neighbourId = cell->second.begin();
+        neighbourId != cell->second.end(); ++neighbourId)
+    {
+      EXPECT_EQ(1U, a_cellIds.count(*neighbourId))<< *neighbourId;
+      EXPECT_EQ(1U, neighbourIds[*neighbourId].count(cell->first))<< cell->first << " "
+      << *neighbourId;
+    }
+  }
+
+  return noOfCells;
+}
+
+UNIT_TEST(CellNeighbourhood, GetNeighboursISEA4T)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
+  GridIndexer::HierarchicalGridIndexer gridIndexer(&grid, icosahedron.GetNoOfFaces() - 1U);
+  CellNeighbourhood neighbourhood(&gridIndexer, &projection, icosahedron.GetNoOfFaces());
+
+  std::vector<std::unique_ptr<ICell> > neighbours;
+
+  // The middle triangle shares its edges with the other children of its parent
+  neighbourhood.GetNeighbours(*gridIndexer.CreateCell("0000"), neighbours);
+  ASSERT_EQ(12U, neighbours.size());
+  std::set<DggsCellId> edgeNeighbours;
+  for (unsigned short neighbour = 0U; neighbour < 3U; ++neighbour)
+  {
+    edgeNeighbours.insert(neighbours[neighbour]->GetCellId());
+  }
+  EXPECT_EQ(1U, edgeNeighbours.count("0001"));
+  EXPECT_EQ(1U, edgeNeighbours.count("0002"));
+  EXPECT_EQ(1U, edgeNeighbours.count("0003"));
+  for (unsigned short neighbour = 0U; neighbour < neighbours.size(); ++neighbour)
+  {
+    EXPECT_EQ(0U, neighbours[neighbour]->GetFaceIndex());
+  }
+
+  // Only five triangles meet at a vertex of the icosahedron
+  neighbourhood.GetNeighbours(*gridIndexer.CreateCell("0011"), neighbours);
+  EXPECT_EQ(11U, neighbours.size());
+
+  // Whole faces share a vertex with nine other faces
+  neighbourhood.GetNeighbours(*gridIndexer.CreateCell("07"), neighbours);
+  EXPECT_EQ(9U, neighbours.size());
+
+  // Neighbours must be symmetric across every face edge and vertex
+  std::set<DggsCellId> cellIds;
+  std::vector<std::unique_ptr<ICell> > faceCells;
+  std::vector<std::unique_ptr<ICell> > childCells;
+  for (FaceIndex faceIndex = 0U; faceIndex < icosahedron.GetNoOfFaces(); ++faceIndex)
+  {
+    std::unique_ptr<ICell> face = gridIndexer.GetCell(FaceCoordinate(faceIndex, 0.0, 0.0, 1.0));
+    gridIndexer.GetChildren(*face, faceCells);
+    for (std::vector<std::unique_ptr<ICell> >::const_iterator cell = faceCells.begin();
+        cell != faceCells.end(); ++cell)
+    {
+      gridIndexer.GetChildren(**cell, childCells);
+      for (std::vector<std::unique_ptr<ICell> >::const_iterator child = childCells.begin();
+          child != childCells.end(); ++child)
+      {
+        cellIds.insert((*child)->GetCellId());
+      }
+    }
+  }
+
+  std::map<std::size_t, unsigned int> noOfCells = CheckNeighboursAreSymmetric(
+      neighbourhood,
+      gridIndexer,
+      cellIds);
+
+  // Five cells touch each of the twelve icosahedron vertices
+  EXPECT_EQ(2U, noOfCells.size());
+  EXPECT_EQ(60U, noOfCells[11U]);
+  EXPECT_EQ(320U - 60U, noOfCells[12U]);
+}
+
+UNIT_TEST(CellNeighbourhood, GetNeighboursISEA3H)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::OffsetGrid::Aperture3HexagonGrid grid;
+  GridIndexer::OffsetGridIndexer gridIndexer(&grid, icosahedron.GetNoOfFaces() - 1U);
+  CellNeighbourhood neighbourhood(&gridIndexer, &projection, icosahedron.GetNoOfFaces());
+
+  std::vector<std::unique_ptr<ICell> > neighbours;
+
+  // Cell at the centre of a face
+  neighbourhood.GetNeighbours(*gridIndexer.GetCell(FaceCoordinate(3U, 0.0, 0.0, 1e-3)), neighbours);
+  EXPECT_EQ(6U, neighbours.size());
+  for (unsigned short neighbour = 0U; neighbour < neighbours.size(); ++neighbour)
+  {
+    EXPECT_EQ(3U, neighbours[neighbour]->GetFaceIndex());
+  }
+
+  // Cells whose centres lie on a face edge or vertex are given on the lowest indexed face, so
+  // the cells covering points spread over each face are moved onto that face
+  for (unsigned short resolution = 3U; resolution <= 4U; ++resolution)
+  {
+    const double accuracy = grid.GetAccuracyFromResolution(resolution);
+
+    std::set<DggsCellId> cellIds;
+    static const unsigned short NO_OF_STEPS = 60U;
+    for (FaceIndex faceIndex = 0U; faceIndex < icosahedron.GetNoOfFaces(); ++faceIndex)
+    {
+      for (unsigned short yStep = 0U; yStep <= NO_OF_STEPS; ++yStep)
+      {
+        const double y = -sqrt(3.0) / 6.0 + yStep * (sqrt(3.0) / 2.0) / NO_OF_STEPS;
+        const double halfWidth = 0.5 * (1.0 - static_cast<double>(yStep) / NO_OF_STEPS);
+        for (unsigned short xStep = 0U; xStep <= NO_OF_STEPS; ++xStep)
+        {
+          const double x = -halfWidth + xStep * 2.0 * halfWidth / NO_OF_STEPS;
+          std::unique_ptr<ICell> cell = gridIndexer.GetCell(
+              FaceCoordinate(faceIndex, x, y, accuracy));
+          cellIds.insert(
+              gridIndexer.GetCell(
+                  neighbourhood.MoveOntoFace(gridIndexer.GetFaceCoordinate(*cell)))->GetCellId());
+        }
+      }
+    }
+
+    // Twelve pentagons are centred on the icosahedron vertices
+    const unsigned int noOfCells = static_cast<unsigned int>(std::lround(20.0 / accuracy)) + 2U;
+    EXPECT_EQ(noOfCells, cellIds.size());
+
+    std::map<std::size_t, unsigned int> noOfNeighbours = CheckNeighboursAreSymmetric(
+        neighbourhood,
+        gridIndexer,
+        cellIds);
+
+    EXPECT_EQ(2U, noOfNeighbours.size());
+    EXPECT_EQ(12U, noOfNeighbours[5U]);
+    EXPECT_EQ(noOfCells - 12U, noOfNeighbours[6U]);
+  }
+}
+
+UNIT_TEST(CellNeighbourhood, GetKRing)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+
+  Grid::OffsetGrid::Aperture3HexagonGrid hexagonGrid;
+  GridIndexer::OffsetGridIndexer hexagonIndexer(&hexagonGrid, icosahedron.GetNoOfFaces() - 1U);
+  CellNeighbourhood hexagonNeighbourhood(
+      &hexagonIndexer,
+      &projection,
+      icosahedron.GetNoOfFaces());
+
+  std::vector<std::unique_ptr<ICell> > cells;
+
+  // Rings of hexagons grow by six cells each time
+  std::unique_ptr<ICell> hexagon = hexagonIndexer.GetCell(FaceCoordinate(3U, 0.0, 0.0, 1e-4));
+  const unsigned int ringSizes[] =
+  { 1U, 7U, 19U, 37U };
+  for (unsigned short k = 0U; k < 4U; ++k)
+  {
+    hexagonNeighbourhood.GetKRing(*hexagon, k, cells);
+    EXPECT_EQ(ringSizes[k], cells.size());
+    EXPECT_EQ(hexagon->GetCellId(), cells.front()->GetCellId());
+  }
+
+  // A pentagon at the north pole, given on a face other than the lowest indexed face it lies on
+  std::unique_ptr<ICell> pentagon = hexagonIndexer.GetCell(
+      FaceCoordinate(2U, 0.0, sqrt(3.0) / 3.0, hexagonGrid.GetAccuracyFromResolution(5U)));
+  hexagonNeighbourhood.GetKRing(*pentagon, 1U, cells);
+  EXPECT_EQ(6U, cells.size());
+  EXPECT_EQ(0U, cells.front()->GetFaceIndex());
+
+  Grid::HierarchicalGrid::Aperture4TriangleGrid triangleGrid;
+  GridIndexer::HierarchicalGridIndexer triangleIndexer(
+      &triangleGrid,
+      icosahedron.GetNoOfFaces() - 1U);
+  CellNeighbourhood triangleNeighbourhood(
+      &triangleIndexer,
+      &projection,
+      icosahedron.GetNoOfFaces());
+
+  // Each triangle shares an edge or a vertex with twelve others
+  triangleNeighbourhood.GetKRing(*triangleIndexer.CreateCell("0700000"), 1U, cells);
+  ASSERT_EQ(13U, cells.size());
+  EXPECT_EQ("0700000", cells.front()->GetCellId());
+
+  // The rings around a triangle on the edge of a face extend onto the neighbouring face
+  triangleNeighbourhood.GetKRing(*triangleIndexer.CreateCell("0733333"), 2U, cells);
+  std::set<FaceIndex> faces;
+  for (std::vector<std::unique_ptr<ICell> >::const_iterator cell = cells.begin();
+      cell != cells.end(); ++cell)
+  {
+    faces.insert((*cell)->GetFaceIndex());
+  }
+  EXPECT_LT(1U, faces.size());
+}
+
+UNIT_TEST(CellNeighbourhood, MoveOntoFace)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
+  GridIndexer::HierarchicalGridIndexer gridIndexer(&grid, icosahedron.GetNoOfFaces() - 1U);
+  CellNeighbourhood neighbourhood(&gridIndexer, &projection, icosahedron.GetNoOfFaces());
+
+  static const double DISTANCE = 1e-3;
+  static const double ACCURACY = 1e-6;
+
+  // Points on a face are unchanged
+  const FaceCoordinate onFace = neighbourhood.MoveOntoFace(FaceCoordinate(4U, 0.1, 0.2, ACCURACY));
+  EXPECT_EQ(4U, onFace.GetFaceIndex());
+  EXPECT_DOUBLE_EQ(0.1, onFace.GetXOffset());
+  EXPECT_DOUBLE_EQ(0.2, onFace.GetYOffset());
+
+  // A point just beyond the base edge of each face is next to the point just inside it
+  for (FaceIndex faceIndex = 0U; faceIndex < icosahedron.GetNoOfFaces(); ++faceIndex)
+  {
+    const FaceCoordinate inside(faceIndex, 0.2, -sqrt(3.0) / 6.0 + DISTANCE, ACCURACY);
+    const FaceCoordinate further(faceIndex, 0.2, -sqrt(3.0) / 6.0 + 3.0 * DISTANCE, ACCURACY);
+    const FaceCoordinate beyond = neighbourhood.MoveOntoFace(
+        FaceCoordinate(faceIndex, 0.2, -sqrt(3.0) / 6.0 - DISTANCE, ACCURACY));
+
+    EXPECT_NE(faceIndex, beyond.GetFaceIndex());
+
+    const EAGGR::LatLong::SphericalAccuracyPoint insidePoint = projection.GetLatLongPoint(inside);
+    const double acrossEdge = insidePoint.GetDistanceToPoint(projection.GetLatLongPoint(beyond));
+    const double alongFace = insidePoint.GetDistanceToPoint(projection.GetLatLongPoint(further));
+    EXPECT_NEAR(alongFace, acrossEdge, 0.1 * alongFace);
+  }
+
+  // Points at a vertex are moved to the lowest indexed face that meets there, which for the
+  // north pole is face 0
+  const FaceCoordinate vertex = neighbourhood.MoveOntoFace(
+      FaceCoordinate(4U, 0.0, sqrt(3.0) / 3.0, ACCURACY));
+  EXPECT_EQ(0U, vertex.GetFaceIndex());
+
+  EXPECT_THROW(neighbourhood.MoveOntoFace(FaceCoordinate(0U, 10.0, 10.0, ACCURACY)),
+      EAGGR::EAGGRException);
+}
@@ -45,6 +45,10 @@ using namespace EAGGR::Model::Cell;
 static const unsigned short MAX_FACE_INDEX = 19U;
 const unsigned short MAX_CELL_INDEX = 4U;
 
+// Bulk conversions may use the vector kernels of the projection, which agree with the single point
+// conversions to within this many degrees
+static const double BULK_LAT_LONG_TOLERANCE = 1e-10;
+
 UNIT_TEST(DGGS, GetSiblingsISEA4T)
 {
   PolyhedralGlobe::Icosahedron icosahedron;
@@ -165,3 +169,283 @@ UNIT_TEST(DGGS, GetSiblingsISEA3H)
   EXPECT_EQ("01052,3", (*siblingCells.at(4)).GetCellId());
   EXPECT_EQ("01052,1", (*siblingCells.at(5)).GetCellId());
 }
+
+UNIT_TEST(DGGS, ConvertCellsToLatLongPoints)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid triangleGrid;
+  GridIndexer::HierarchicalGridIndexer gridIndexer(&triangleGrid, icosahedron.GetNoOfFaces() - 1U);
+  EAGGR::Model::DGGS instanceOfDGGS(&projection, &gridIndexer);
+
+  std::vector<std::unique_ptr<Cell::ICell> > cells;
+  cells.push_back(instanceOfDGGS.CreateCell("0123"));
+  cells.push_back(instanceOfDGGS.CreateCell("07"));
+  cells.push_back(instanceOfDGGS.CreateCell("1930120"));
+
+  std::vector<EAGGR::LatLong::SphericalAccuracyPoint> points;
+  instanceOfDGGS.ConvertCellsToLatLongPoints(cells, points);
+
+  EXPECT_EQ(cells.size(), points.size());
+  for (unsigned int cellIndex = 0; cellIndex < cells.size(); cellIndex++)
+  {
+    const EAGGR::LatLong::SphericalAccuracyPoint expected =
+        instanceOfDGGS.ConvertCellToLatLongPoint(*cells[cellIndex]);
+    EXPECT_NEAR(expected.GetLatitude(), points[cellIndex].GetLatitude(), BULK_LAT_LONG_TOLERANCE);
+    EXPECT_NEAR(
+        expected.GetLongitude(),
+        points[cellIndex].GetLongitude(),
+        BULK_LAT_LONG_TOLERANCE);
+    EXPECT_EQ(expected.GetAccuracy(), points[cellIndex].GetAccuracy());
+  }
+
+  // Converting no cells gives no points
+  cells.clear();
+  instanceOfDGGS.ConvertCellsToLatLongPoints(cells, points);
+  EXPECT_EQ(0U, points.size());
+}
+
+UNIT_TEST(DGGS, ConvertLatLongPointsToCells)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::OffsetGrid::Aperture3HexagonGrid hexagonGrid;
+  GridIndexer::OffsetGridIndexer gridIndexer(&hexagonGrid, icosahedron.GetNoOfFaces() - 1U);
+  EAGGR::Model::DGGS instanceOfDGGS(&projection, &gridIndexer);
+
+  // Enough points to be split into several chunks
+  std::vector<EAGGR::LatLong::SphericalAccuracyPoint> points;
+  for (double latitude = -89.5; latitude < 90.0; latitude += 3.0)
+  {
+    for (double longitude = -179.5; longitude < 180.0; longitude += 3.0)
+    {
+      points.push_back(EAGGR::LatLong::SphericalAccuracyPoint(latitude, longitude, 1.0e-3));
+    }
+  }
+  ASSERT_LT(DGGS::m_POINTS_PER_CHUNK * 3U, points.size());
+
+  std::vector<std::unique_ptr<Cell::ICell> > singleThreadCells(points.size());
+  instanceOfDGGS.ConvertLatLongPointsToCells(&points[0], points.size(), &singleThreadCells[0]);
+
+  std::vector<std::unique_ptr<Cell::ICell> > parallelCells(points.size());
+  const EAGGR::Utilities::WorkStealingPool pool(4U);
+  instanceOfDGGS.ConvertLatLongPointsToCells(&points[0], points.size(), &parallelCells[0], pool);
+
+  for (unsigned int pointIndex = 0; pointIndex < points.size(); pointIndex++)
+  {
+    const std::string expectedCellId =
+        instanceOfDGGS.ConvertLatLongPointToCell(points[pointIndex])->GetCellId();
+    EXPECT_EQ(expectedCellId, singleThreadCells[pointIndex]->GetCellId());
+    EXPECT_EQ(expectedCellId, parallelCells[pointIndex]->GetCellId());
+  }
+}
+
+UNIT_TEST(DGGS, ConvertFaceCoordinatesToCells)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid triangleGrid;
+  GridIndexer::HierarchicalGridIndexer triangleIndexer(
+      &triangleGrid,
+      icosahedron.GetNoOfFaces() - 1U);
+  Grid::OffsetGrid::Aperture3HexagonGrid hexagonGrid;
+  GridIndexer::OffsetGridIndexer hexagonIndexer(&hexagonGrid, icosahedron.GetNoOfFaces() - 1U);
+  const EAGGR::Model::DGGS triangleDggs(&projection, &triangleIndexer);
+  const EAGGR::Model::DGGS hexagonDggs(&projection, &hexagonIndexer);
+
+  std::vector<EAGGR::LatLong::SphericalAccuracyPoint> points;
+  for (double latitude = -89.5; latitude < 90.0; latitude += 7.0)
+  {
+    for (double longitude = -179.5; longitude < 180.0; longitude += 7.0)
+    {
+      points.push_back(EAGGR::LatLong::SphericalAccuracyPoint(latitude, longitude, 1.0));
+    }
+  }
+
+  // Project the points once
+  std::vector<FaceCoordinate> faceCoordinates;
+  triangleDggs.ConvertLatLongPointsToFaceCoordinates(&points[0], points.size(), faceCoordinates);
+  ASSERT_EQ(points.size(), faceCoordinates.size());
+
+  // Index the face coordinates at several accuracies in both grids
+  const double accuracies[] = { 10.0, 1.0, 1.0e-2, 1.0e-4, 1.0e-6 };
+  for (unsigned short accuracyIndex = 0U; accuracyIndex < 5U; ++accuracyIndex)
+  {
+    const double accuracy = accuracies[accuracyIndex];
+
+    std::vector<std::unique_ptr<Cell::ICell> > triangleCells(points.size());
+    triangleDggs.ConvertFaceCoordinatesToCells(
+        &faceCoordinates[0],
+        faceCoordinates.size(),
+        accuracy,
+        &triangleCells[0]);
+
+    std::vector<std::unique_ptr<Cell::ICell> > hexagonCells(points.size());
+    hexagonDggs.ConvertFaceCoordinatesToCells(
+        &faceCoordinates[0],
+        faceCoordinates.size(),
+        accuracy,
+        &hexagonCells[0]);
+
+    for (unsigned int pointIndex = 0; pointIndex < points.size(); pointIndex++)
+    {
+      const EAGGR::LatLong::SphericalAccuracyPoint point(
+          points[pointIndex].GetLatitude(),
+          points[pointIndex].GetLongitude(),
+          accuracy);
+      EXPECT_EQ(
+          triangleDggs.ConvertLatLongPointToCell(point)->GetCellId(),
+          triangleCells[pointIndex]->GetCellId());
+      EXPECT_EQ(
+          hexagonDggs.ConvertLatLongPointToCell(point)->GetCellId(),
+          hexagonCells[pointIndex]->GetCellId());
+    }
+  }
+}
+
+UNIT_TEST(DGGS, ConvertLatLongPointToCellsAtAllResolutions)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid triangleGrid;
+  GridIndexer::HierarchicalGridIndexer triangleIndexer(
+      &triangleGrid,
+      icosahedron.GetNoOfFaces() - 1U);
+  Grid::OffsetGrid::Aperture3HexagonGrid hexagonGrid;
+  GridIndexer::OffsetGridIndexer hexagonIndexer(&hexagonGrid, icosahedron.GetNoOfFaces() - 1U);
+  const EAGGR::Model::DGGS triangleDggs(&projection, &triangleIndexer);
+  const EAGGR::Model::DGGS hexagonDggs(&projection, &hexagonIndexer);
+
+  for (double latitude = -89.5; latitude < 90.0; latitude += 7.0)
+  {
+    for (double longitude = -179.5; longitude < 180.0; longitude += 7.0)
+    {
+      const EAGGR::LatLong::SphericalAccuracyPoint point(latitude, longitude, 1.0e-6);
+      const FaceCoordinate faceCoordinate = projection.GetFaceCoordinate(point);
+
+      std::vector<std::unique_ptr<Cell::ICell> > triangleCells;
+      triangleDggs.ConvertLatLongPointToCellsAtAllResolutions(point, triangleCells);
+
+      std::vector<std::unique_ptr<Cell::ICell> > hexagonCells;
+      hexagonDggs.ConvertLatLongPointToCellsAtAllResolutions(point, hexagonCells);
+
+      // The finest cells are those given by converting the point directly
+      ASSERT_FALSE(triangleCells.empty());
+      EXPECT_EQ(
+          triangleDggs.ConvertLatLongPointToCell(point)->GetCellId(),
+          triangleCells.back()->GetCellId());
+      ASSERT_FALSE(hexagonCells.empty());
+      EXPECT_EQ(
+          hexagonDggs.ConvertLatLongPointToCell(point)->GetCellId(),
+          hexagonCells.back()->GetCellId());
+
+      // Each cell is the one containing the point at its resolution
+      for (unsigned short resolution = 0U; resolution < triangleCells.size(); ++resolution)
+      {
+        EXPECT_EQ(resolution, triangleCells[resolution]->GetResolution());
+        const FaceCoordinate resolutionCoordinate(
+            faceCoordinate.GetFaceIndex(),
+            faceCoordinate.GetXOffset(),
+            faceCoordinate.GetYOffset(),
+            triangleGrid.GetAccuracyFromResolution(resolution));
+        EXPECT_EQ(
+            triangleIndexer.GetCell(resolutionCoordinate)->GetCellId(),
+            triangleCells[resolution]->GetCellId());
+      }
+
+      for (unsigned short resolution = 0U; resolution < hexagonCells.size(); ++resolution)
+      {
+        EXPECT_EQ(resolution, hexagonCells[resolution]->GetResolution());
+        const FaceCoordinate resolutionCoordinate(
+            faceCoordinate.GetFaceIndex(),
+            faceCoordinate.GetXOffset(),
+            faceCoordinate.GetYOffset(),
+            hexagonGrid.GetAccuracyFromResolution(resolution));
+        EXPECT_EQ(
+            hexagonIndexer.GetCell(resolutionCoordinate)->GetCellId(),
+            hexagonCells[resolution]->GetCellId());
+      }
+    }
+  }
+}
+
+UNIT_TEST(DGGS, ConvertLatLongPointsToCellsAtResolution)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid triangleGrid;
+  GridIndexer::HierarchicalGridIndexer triangleIndexer(
+      &triangleGrid,
+      icosahedron.GetNoOfFaces() - 1U);
+  Grid::OffsetGrid::Aperture3HexagonGrid hexagonGrid;
+  GridIndexer::OffsetGridIndexer hexagonIndexer(&hexagonGrid, icosahedron.GetNoOfFaces() - 1U);
+  const EAGGR::Model::DGGS triangleDggs(&projection, &triangleIndexer);
+  const EAGGR::Model::DGGS hexagonDggs(&projection, &hexagonIndexer);
+
+  // Points with an accuracy that does not match the resolutions being tested
+  std::vector<EAGGR::LatLong::SphericalAccuracyPoint> points;
+  for (double latitude = -89.5; latitude < 90.0; latitude += 7.0)
+  {
+    for (double longitude = -179.5; longitude < 180.0; longitude += 7.0)
+    {
+      points.push_back(EAGGR::LatLong::SphericalAccuracyPoint(latitude, longitude, 0.0));
+    }
+  }
+
+  std::vector<FaceCoordinate> faceCoordinates;
+  triangleDggs.ConvertLatLongPointsToFaceCoordinates(&points[0], points.size(), faceCoordinates);
+
+  const unsigned short resolutions[] = { 0U, 1U, 5U, 12U, 20U };
+  for (unsigned short resolutionIndex = 0U; resolutionIndex < 5U; ++resolutionIndex)
+  {
+    const unsigned short resolution = resolutions[resolutionIndex];
+
+    std::vector<std::unique_ptr<Cell::ICell> > triangleCells(points.size());
+    triangleDggs.ConvertLatLongPointsToCellsAtResolution(
+        &points[0],
+        points.size(),
+        resolution,
+        &triangleCells[0]);
+
+    std::vector<std::unique_ptr<Cell::ICell> > hexagonCells(points.size());
+    hexagonDggs.ConvertFaceCoordinatesToCellsAtResolution(
+        &faceCoordinates[0],
+        faceCoordinates.size(),
+        resolution,
+        &hexagonCells[0]);
+
+    for (unsigned int pointIndex = 0; pointIndex < points.size(); pointIndex++)
+    {
+      EXPECT_EQ(resolution, triangleCells[pointIndex]->GetResolution());
+      EXPECT_EQ(
+          triangleDggs.ConvertLatLongPointToCellAtResolution(points[pointIndex], resolution)
+              ->GetCellId(),
+          triangleCells[pointIndex]->GetCellId());
+
+      EXPECT_EQ(resolution, hexagonCells[pointIndex]->GetResolution());
+      EXPECT_EQ(
+          hexagonDggs.ConvertLatLongPointToCellAtResolution(points[pointIndex], resolution)
+              ->GetCellId(),
+          hexagonCells[pointIndex]->GetCellId());
+
+      // Gives the same cells as indexing with the accuracy of the resolution
+      const FaceCoordinate triangleCoordinate(
+          faceCoordinates[pointIndex].GetFaceIndex(),
+          faceCoordinates[pointIndex].GetXOffset(),
+          faceCoordinates[pointIndex].GetYOffset(),
+          triangleGrid.GetAccuracyFromResolution(resolution));
+      EXPECT_EQ(
+          triangleIndexer.GetCell(triangleCoordinate)->GetCellId(),
+          triangleCells[pointIndex]->GetCellId());
+
+      const FaceCoordinate hexagonCoordinate(
+          faceCoordinates[pointIndex].GetFaceIndex(),
+          faceCoordinates[pointIndex].GetXOffset(),
+          faceCoordinates[pointIndex].GetYOffset(),
+          hexagonGrid.GetAccuracyFromResolution(resolution));
+      EXPECT_EQ(
+          hexagonIndexer.GetCell(hexagonCoordinate)->GetCellId(),
+          hexagonCells[pointIndex]->GetCellId());
+    }
+  }
+}
@@ -0,0 +1,181 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGRTestHarness
+//
+// subsystem: Unit Tests
+//
+//------------------------------------------------------
+/// @file HierarchicalCellCompactorTest.cpp
+/// 
+/// Tests for the EAGGR::Model::HierarchicalCellCompactor class
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <algorithm>
+
+#include "TestMacros.hpp"
+
+#include "Src/Model/ICell/HierarchicalCell.hpp"
+#include "Src/Model/ICell/HierarchicalCellCompactor.hpp"
+#include "Src/Model/ICell/HierarchicalCellValue.hpp"
+#include "Src/EAGGRException.hpp"
+
+static const unsigned short MAX_FACE_INDEX = 19U;
+static const unsigned short MAX_CELL_INDEX = 3U;
+
+using namespace EAGGR::Model::Cell;
+
+static DggsPackedCellId GetPackedCellId(const char * a_cellId)
+{
+  return HierarchicalCell(a_cellId, MAX_FACE_INDEX, MAX_CELL_INDEX).GetPackedCellId();
+}
+
+static std::vector<DggsPackedCellId> GetSortedPackedCellIds(
+    const char * const * a_cellIds,
+    const std::size_t a_noOfCells)
+{
+  std::vector<DggsPackedCellId> packedCellIds;
+  for (std::size_t cellIndex = 0U; cellIndex < a_noOfCells; ++cellIndex)
+  {
+    packedCellIds.push_back(GetPackedCellId(a_cellIds[cellIndex]));
+  }
+  std::sort(packedCellIds.begin(), packedCellIds.end());
+
+  return packedCellIds;
+}
+
+UNIT_TEST(HierarchicalCellCompactor, Compact)
+{
+  // All 16 grandchildren of 0512 make it up, as do the four children of 0701 with a
+  // grandchild of 0701 that is removed as a duplicate of its parent. 0302 is missing a sibling.
+  const char * const cellIds[] =
+  {
+    "051200", "051201", "051202", "051203",
+    "051210", "051211", "051212", "051213",
+    "051220", "051221", "051222", "051223",
+    "051230", "051231", "051232", "051233",
+    "07010", "07011", "07012", "070120", "07013",
+    "03020", "03021", "03023"
+  };
+  const std::vector<DggsPackedCellId> cells = GetSortedPackedCellIds(
+      cellIds,
+      sizeof(cellIds) / sizeof(cellIds[0]));
+
+  std::vector<DggsPackedCellId> compactedCells;
+  HierarchicalCellCompactor::Compact(cells, compactedCells);
+
+  const char * const expectedCellIds[] =
+  { "0512", "0701", "03020", "03021", "03023" };
+  EXPECT_EQ(
+      GetSortedPackedCellIds(expectedCellIds, sizeof(expectedCellIds) / sizeof(expectedCellIds[0])),
+      compactedCells);
+
+  // Uncompacting to the original resolution gives the cells without the contained cell
+  std::vector<DggsPackedCellId> uncompactedCells;
+  HierarchicalCellCompactor::Uncompact(compactedCells, 4U, uncompactedCells);
+  ASSERT_EQ(16U + 16U + 12U, uncompactedCells.size());
+  EXPECT_TRUE(std::is_sorted(uncompactedCells.begin(), uncompactedCells.end()));
+
+  std::vector<DggsPackedCellId> recompactedCells;
+  HierarchicalCellCompactor::Compact(uncompactedCells, recompactedCells);
+  EXPECT_EQ(compactedCells, recompactedCells);
+}
+
+UNIT_TEST(HierarchicalCellCompactor, CompactToFace)
+{
+  // Compaction stops at the face cells
+  std::vector<DggsPackedCellId> cells;
+  cells.push_back(GetPackedCellId("00"));
+  cells.push_back(GetPackedCellId("01"));
+  cells.push_back(GetPackedCellId("02"));
+  HierarchicalCellValue face(3U, MAX_FACE_INDEX);
+  for (unsigned short cellIndex = 0U; cellIndex <= MAX_CELL_INDEX; ++cellIndex)
+  {
+    cells.push_back(face.GetChild(cellIndex).GetPackedCellId());
+  }
+
+  std::vector<DggsPackedCellId> compactedCells;
+  HierarchicalCellCompactor::Compact(cells, compactedCells);
+
+  ASSERT_EQ(4U, compactedCells.size());
+  EXPECT_EQ(face.GetPackedCellId(), compactedCells[3]);
+
+  // Empty sets are unchanged
+  HierarchicalCellCompactor::Compact(std::vector<DggsPackedCellId>(), compactedCells);
+  EXPECT_TRUE(compactedCells.empty());
+}
+
+UNIT_TEST(HierarchicalCellCompactor, Uncompact)
+{
+  std::vector<DggsPackedCellId> cells;
+  cells.push_back(GetPackedCellId("0312"));
+  cells.push_back(GetPackedCellId("03130"));
+
+  std::vector<DggsPackedCellId> uncompactedCells;
+  HierarchicalCellCompactor::Uncompact(cells, 5U, uncompactedCells);
+  ASSERT_EQ(64U + 16U, uncompactedCells.size());
+  EXPECT_TRUE(std::is_sorted(uncompactedCells.begin(), uncompactedCells.end()));
+
+  // Every output cell is a descendant at the requested resolution, and each appears once
+  for (std::size_t cellIndex = 0U; cellIndex < uncompactedCells.size(); ++cellIndex)
+  {
+    const HierarchicalCellValue cell(uncompactedCells[cellIndex]);
+    EXPECT_EQ(5U, cell.GetResolution());
+    EXPECT_TRUE(
+        HierarchicalCellValue(cells[cellIndex < 64U ? 0U : 1U]).Contains(cell));
+  }
+  EXPECT_TRUE(
+      std::adjacent_find(uncompactedCells.begin(), uncompactedCells.end())
+          == uncompactedCells.end());
+  EXPECT_EQ(GetPackedCellId("0312000"), uncompactedCells.front());
+  EXPECT_EQ(GetPackedCellId("0313033"), uncompactedCells.back());
+
+  // Cells already at the resolution are unchanged
+  HierarchicalCellCompactor::Uncompact(cells, 3U, uncompactedCells);
+  ASSERT_EQ(5U, uncompactedCells.size());
+  EXPECT_EQ(cells[1], uncompactedCells[4]);
+}
+
+UNIT_TEST(HierarchicalCellCompactor, InvalidCells)
+{
+  std::vector<DggsPackedCellId> cells;
+  cells.push_back(GetPackedCellId("0313"));
+  cells.push_back(GetPackedCellId("0312"));
+
+  // Cells out of order
+  std::vector<DggsPackedCellId> outputCells;
+  EXPECT_THROW(HierarchicalCellCompactor::Compact(cells, outputCells), EAGGR::EAGGRException);
+
+  // Cells finer than the requested resolution
+  EXPECT_THROW(
+      HierarchicalCellCompactor::Uncompact(cells, 1U, outputCells),
+      EAGGR::EAGGRException);
+
+  // Resolution too fine for a packed cell ID
+  EXPECT_THROW(
+      HierarchicalCellCompactor::Uncompact(
+          cells,
+          HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL + 1U,
+          outputCells),
+      EAGGR::EAGGRException);
+
+  // Invalid packed cell ID
+  cells.assign(1U, 0U);
+  EXPECT_THROW(HierarchicalCellCompactor::Compact(cells, outputCells), EAGGR::EAGGRException);
+}
@@ -0,0 +1,391 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGRTestHarness
+//
+// subsystem: Unit Tests
+//
+//------------------------------------------------------
+/// @file HierarchicalCellSetTest.cpp
+/// 
+/// Tests for the EAGGR::Model::Cell::HierarchicalCellSet class
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+
+#include "TestMacros.hpp"
+
+#include "Src/Model/ICell/HierarchicalCell.hpp"
+#include "Src/Model/ICell/HierarchicalCellCompactor.hpp"
+#include "Src/Model/ICell/HierarchicalCellSet.hpp"
+#include "Src/Model/ICell/HierarchicalCellSetSimd.hpp"
+#include "Src/Model/ICell/HierarchicalCellValue.hpp"
+#include "Src/EAGGRException.hpp"
+
+static const unsigned short MAX_FACE_INDEX = 19U;
+static const unsigned short MAX_CELL_INDEX = 3U;
+
+using namespace EAGGR::Model::Cell;
+
+static DggsPackedCellId GetPackedCellId(const char * a_cellId)
+{
+  return HierarchicalCell(a_cellId, MAX_FACE_INDEX, MAX_CELL_INDEX).GetPackedCellId();
+}
+
+static HierarchicalCellSet CreateCellSet(
+    const char * const * a_cellIds,
+    const std::size_t a_noOfCells)
+{
+  std::vector<DggsPackedCellId> packedCellIds;
+  for (std::size_t cellIndex = 0U; cellIndex < a_noOfCells; ++cellIndex)
+  {
+    packedCellIds.push_back(GetPackedCellId(a_cellIds[cellIndex]));
+  }
+
+  return HierarchicalCellSet(packedCellIds);
+}
+
+static std::vector<DggsPackedCellId> GetSortedPackedCellIds(
+    const char * const * a_cellIds,
+    const std::size_t a_noOfCells)
+{
+  return CreateCellSet(a_cellIds, a_noOfCells).GetCells();
+}
+
+static std::vector<DggsPackedCellId> Uncompact(
+    const HierarchicalCellSet & a_cellSet,
+    const unsigned short a_resolution)
+{
+  std::vector<DggsPackedCellId> uncompactedCells;
+  HierarchicalCellCompactor::Uncompact(a_cellSet.GetCells(), a_resolution, uncompactedCells);
+  return uncompactedCells;
+}
+
+UNIT_TEST(HierarchicalCellSet, Construct)
+{
+  // Cells in any order, with a duplicate, a cell inside another cell and a complete group of
+  // siblings
+  const char * const cellIds[] =
+  { "0703", "0512", "0701", "070120", "0702", "0512", "0700", "03021" };
+  const HierarchicalCellSet cellSet(CreateCellSet(cellIds, sizeof(cellIds) / sizeof(cellIds[0])));
+
+  ASSERT_EQ(3U, cellSet.GetCells().size());
+  EXPECT_EQ(GetPackedCellId("03021"), cellSet.GetCells()[0]);
+  EXPECT_EQ(GetPackedCellId("0512"), cellSet.GetCells()[1]);
+  EXPECT_EQ(GetPackedCellId("070"), cellSet.GetCells()[2]);
+  EXPECT_FALSE(cellSet.IsEmpty());
+
+  EXPECT_TRUE(HierarchicalCellSet().IsEmpty());
+  EXPECT_TRUE(HierarchicalCellSet(std::vector<DggsPackedCellId>()).IsEmpty());
+
+  // Invalid packed cell ID
+  EXPECT_THROW(
+      HierarchicalCellSet(std::vector<DggsPackedCellId>(1U, 0U)),
+      EAGGR::EAGGRException);
+}
+
+UNIT_TEST(HierarchicalCellSet, Contains)
+{
+  const char * const cellIds[] =
+  { "0512", "0700", "0701", "0702", "0703", "03021", "07133" };
+  const HierarchicalCellSet cellSet(CreateCellSet(cellIds, sizeof(cellIds) / sizeof(cellIds[0])));
+
+  // Cells in the set, descendants and the parent of a complete group are contained. Ancestors,
+  // siblings and cells on other faces are not.
+  const char * const testCellIds[] =
+  { "0512", "051233", "070", "07032", "0313", "03021", "0302", "05", "0513", "07133", "0713" };
+  const bool expectedResults[] =
+  { true, true, true, true, false, true, false, false, false, true, false };
+  const std::size_t noOfTestCells = sizeof(testCellIds) / sizeof(testCellIds[0]);
+
+  std::vector<DggsPackedCellId> testCells;
+  for (std::size_t cellIndex = 0U; cellIndex < noOfTestCells; ++cellIndex)
+  {
+    testCells.push_back(GetPackedCellId(testCellIds[cellIndex]));
+    EXPECT_EQ(expectedResults[cellIndex], cellSet.Contains(testCells.back()))
+        << testCellIds[cellIndex];
+  }
+
+  // The batch test gives the same results for unsorted and sorted batches
+  bool results[noOfTestCells];
+  cellSet.Contains(&testCells[0], noOfTestCells, results);
+  for (std::size_t cellIndex = 0U; cellIndex < noOfTestCells; ++cellIndex)
+  {
+    EXPECT_EQ(expectedResults[cellIndex], results[cellIndex]) << testCellIds[cellIndex];
+  }
+
+  std::vector<DggsPackedCellId> sortedTestCells(testCells);
+  std::sort(sortedTestCells.begin(), sortedTestCells.end());
+  cellSet.Contains(&sortedTestCells[0], noOfTestCells, results);
+  for (std::size_t cellIndex = 0U; cellIndex < noOfTestCells; ++cellIndex)
+  {
+    EXPECT_EQ(cellSet.Contains(sortedTestCells[cellIndex]), results[cellIndex]);
+  }
+
+  EXPECT_FALSE(HierarchicalCellSet().Contains(testCells[0]));
+  EXPECT_THROW(cellSet.Contains(0U), EAGGR::EAGGRException);
+}
+
+static DggsPackedCellId GetRandomCell(
+    std::mt19937 & a_generator,
+    const unsigned int a_maxResolution)
+{
+  HierarchicalCellValue cell(
+      static_cast<unsigned short>(a_generator() % (MAX_FACE_INDEX + 1U)),
+      MAX_FACE_INDEX);
+  const unsigned int resolution = a_generator() % (a_maxResolution + 1U);
+  for (unsigned int level = 0U; level < resolution; ++level)
+  {
+    cell = cell.GetChild(static_cast<unsigned short>(a_generator() % 4U));
+  }
+  return cell.GetPackedCellId();
+}
+
+UNIT_TEST(HierarchicalCellSet, ContainsKernels)
+{
+  std::vector<HierarchicalCellSetSimd::ContainsKernel> kernels;
+#if EAGGR_CELL_SET_SIMD
+  if (HierarchicalCellSetSimd::IsAvx2Supported())
+  {
+    kernels.push_back(&HierarchicalCellSetSimd::ContainsAvx2);
+  }
+  if (HierarchicalCellSetSimd::IsAvx512Supported())
+  {
+    kernels.push_back(&HierarchicalCellSetSimd::ContainsAvx512);
+  }
+#endif
+
+  std::mt19937 generator(16U);
+
+  // Sets from a single cell up to a few thousand cells, tested with batches that do not fill
+  // the last vector
+  const std::size_t noOfSetCells[] =
+  { 1U, 2U, 7U, 100U, 5000U };
+  for (std::size_t setIndex = 0U; setIndex < sizeof(noOfSetCells) / sizeof(noOfSetCells[0]);
+      ++setIndex)
+  {
+    std::vector<DggsPackedCellId> cells;
+    for (std::size_t cellIndex = 0U; cellIndex < noOfSetCells[setIndex]; ++cellIndex)
+    {
+      cells.push_back(GetRandomCell(generator, 6U));
+    }
+    const HierarchicalCellSet cellSet(cells);
+
+    // Descendants of the stored cells, the stored cells themselves and unrelated cells down to
+    // the finest resolution
+    std::vector<DggsPackedCellId> testCells;
+    for (std::size_t cellIndex = 0U; cellIndex < 1003U; ++cellIndex)
+    {
+      const HierarchicalCellValue storedCell(
+          cellSet.GetCells()[generator() % cellSet.GetCells().size()]);
+      switch (cellIndex % 3U)
+      {
+        case 0U:
+          testCells.push_back(storedCell.GetRangeMin());
+          break;
+        case 1U:
+          testCells.push_back(storedCell.GetPackedCellId());
+          break;
+        default:
+          testCells.push_back(
+              GetRandomCell(generator, HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL));
+          break;
+      }
+    }
+
+    std::vector<char> expectedResults;
+    for (std::size_t cellIndex = 0U; cellIndex < testCells.size(); ++cellIndex)
+    {
+      expectedResults.push_back(cellSet.Contains(testCells[cellIndex]));
+    }
+
+    // The unsorted batch gives the same results as testing one cell at a time
+    bool results[1003U];
+    cellSet.Contains(&testCells[0], testCells.size(), results);
+    for (std::size_t cellIndex = 0U; cellIndex < testCells.size(); ++cellIndex)
+    {
+      EXPECT_EQ(expectedResults[cellIndex] != 0, results[cellIndex]);
+    }
+
+    for (std::size_t kernelIndex = 0U; kernelIndex < kernels.size(); ++kernelIndex)
+    {
+      kernels[kernelIndex](
+          &cellSet.GetCells()[0],
+          cellSet.GetCells().size(),
+          &testCells[0],
+          testCells.size(),
+          results);
+      for (std::size_t cellIndex = 0U; cellIndex < testCells.size(); ++cellIndex)
+      {
+        EXPECT_EQ(expectedResults[cellIndex] != 0, results[cellIndex]) << kernelIndex;
+      }
+    }
+  }
+}
+
+UNIT_TEST(HierarchicalCellSet, Union)
+{
+  const char * const cellIds[] =
+  { "0700", "0701", "03021", "0512" };
+  const char * const otherCellIds[] =
+  { "0702", "0703", "051230", "0313" };
+  const HierarchicalCellSet cellSet(CreateCellSet(cellIds, sizeof(cellIds) / sizeof(cellIds[0])));
+  const HierarchicalCellSet otherCellSet(
+      CreateCellSet(otherCellIds, sizeof(otherCellIds) / sizeof(otherCellIds[0])));
+
+  // The sets complete a group of siblings and one set covers a cell of the other
+  const char * const expectedCellIds[] =
+  { "03021", "0313", "0512", "070" };
+  const std::vector<DggsPackedCellId> expectedCells(GetSortedPackedCellIds(
+      expectedCellIds,
+      sizeof(expectedCellIds) / sizeof(expectedCellIds[0])));
+  EXPECT_EQ(expectedCells, cellSet.Union(otherCellSet).GetCells());
+  EXPECT_EQ(expectedCells, otherCellSet.Union(cellSet).GetCells());
+
+  EXPECT_EQ(cellSet.GetCells(), cellSet.Union(HierarchicalCellSet()).GetCells());
+}
+
+UNIT_TEST(HierarchicalCellSet, Intersection)
+{
+  const char * const cellIds[] =
+  { "07", "0512", "03021" };
+  const char * const otherCellIds[] =
+  { "051", "07012", "0703", "0302" };
+  const HierarchicalCellSet cellSet(CreateCellSet(cellIds, sizeof(cellIds) / sizeof(cellIds[0])));
+  const HierarchicalCellSet otherCellSet(
+      CreateCellSet(otherCellIds, sizeof(otherCellIds) / sizeof(otherCellIds[0])));
+
+  // Each overlap is the smaller of the two cells
+  const char * const expectedCellIds[] =
+  { "03021", "0512", "07012", "0703" };
+  const std::vector<DggsPackedCellId> expectedCells(GetSortedPackedCellIds(
+      expectedCellIds,
+      sizeof(expectedCellIds) / sizeof(expectedCellIds[0])));
+  EXPECT_EQ(expectedCells, cellSet.Intersection(otherCellSet).GetCells());
+  EXPECT_EQ(expectedCells, otherCellSet.Intersection(cellSet).GetCells());
+
+  EXPECT_TRUE(cellSet.Intersection(HierarchicalCellSet()).IsEmpty());
+}
+
+UNIT_TEST(HierarchicalCellSet, Difference)
+{
+  const char * const cellIds[] =
+  { "07", "0512", "03021" };
+  const char * const otherCellIds[] =
+  { "051", "07012", "0703" };
+  const HierarchicalCellSet cellSet(CreateCellSet(cellIds, sizeof(cellIds) / sizeof(cellIds[0])));
+  const HierarchicalCellSet otherCellSet(
+      CreateCellSet(otherCellIds, sizeof(otherCellIds) / sizeof(otherCellIds[0])));
+
+  // Removing cells from inside a face splits it into the largest cells around them
+  const char * const expectedCellIds[] =
+  { "03021", "0700", "07010", "07011", "07013", "0702", "071", "072", "073" };
+  EXPECT_EQ(
+      GetSortedPackedCellIds(expectedCellIds, sizeof(expectedCellIds) / sizeof(expectedCellIds[0])),
+      cellSet.Difference(otherCellSet).GetCells());
+
+  // Only the part of 051 not covered by 0512 remains of the other set
+  const char * const expectedOtherCellIds[] =
+  { "0510", "0511", "0513" };
+  EXPECT_EQ(
+      GetSortedPackedCellIds(
+          expectedOtherCellIds,
+          sizeof(expectedOtherCellIds) / sizeof(expectedOtherCellIds[0])),
+      otherCellSet.Difference(cellSet).GetCells());
+
+  EXPECT_TRUE(otherCellSet.Difference(cellSet.Union(otherCellSet)).IsEmpty());
+  EXPECT_EQ(cellSet.GetCells(), cellSet.Difference(HierarchicalCellSet()).GetCells());
+}
+
+UNIT_TEST(HierarchicalCellSet, MatchesUncompactedSets)
+{
+  // Compare the set operations on random sets with the same operations on the cells uncompacted
+  // to a common resolution
+  static const unsigned short RESOLUTION = 4U;
+  std::mt19937 generator(15U);
+
+  for (unsigned int trial = 0U; trial < 50U; ++trial)
+  {
+    HierarchicalCellSet cellSets[2];
+    for (unsigned int setIndex = 0U; setIndex < 2U; ++setIndex)
+    {
+      std::vector<DggsPackedCellId> cells;
+      for (unsigned int cellIndex = 0U; cellIndex < 40U; ++cellIndex)
+      {
+        HierarchicalCellValue cell(static_cast<unsigned short>(generator() % 2U), MAX_FACE_INDEX);
+        const unsigned int resolution = generator() % (RESOLUTION + 1U);
+        for (unsigned int level = 0U; level < resolution; ++level)
+        {
+          cell = cell.GetChild(static_cast<unsigned short>(generator() % 4U));
+        }
+        cells.push_back(cell.GetPackedCellId());
+      }
+      cellSets[setIndex] = HierarchicalCellSet(cells);
+    }
+
+    const std::vector<DggsPackedCellId> cells = Uncompact(cellSets[0], RESOLUTION);
+    const std::vector<DggsPackedCellId> otherCells = Uncompact(cellSets[1], RESOLUTION);
+
+    std::vector<DggsPackedCellId> expectedCells;
+    std::set_union(
+        cells.begin(),
+        cells.end(),
+        otherCells.begin(),
+        otherCells.end(),
+        std::back_inserter(expectedCells));
+    const HierarchicalCellSet unionSet = cellSets[0].Union(cellSets[1]);
+    EXPECT_EQ(expectedCells, Uncompact(unionSet, RESOLUTION));
+    EXPECT_EQ(HierarchicalCellSet(expectedCells).GetCells(), unionSet.GetCells());
+
+    expectedCells.clear();
+    std::set_intersection(
+        cells.begin(),
+        cells.end(),
+        otherCells.begin(),
+        otherCells.end(),
+        std::back_inserter(expectedCells));
+    const HierarchicalCellSet intersectionSet = cellSets[0].Intersection(cellSets[1]);
+    EXPECT_EQ(expectedCells, Uncompact(intersectionSet, RESOLUTION));
+    EXPECT_EQ(HierarchicalCellSet(expectedCells).GetCells(), intersectionSet.GetCells());
+
+    expectedCells.clear();
+    std::set_difference(
+        cells.begin(),
+        cells.end(),
+        otherCells.begin(),
+        otherCells.end(),
+        std::back_inserter(expectedCells));
+    const HierarchicalCellSet differenceSet = cellSets[0].Difference(cellSets[1]);
+    EXPECT_EQ(expectedCells, Uncompact(differenceSet, RESOLUTION));
+    EXPECT_EQ(HierarchicalCellSet(expectedCells).GetCells(), differenceSet.GetCells());
+
+    // Every uncompacted cell of the first set is contained in it, and none of the difference
+    // is contained in the second set
+    for (std::size_t cellIndex = 0U; cellIndex < cells.size(); ++cellIndex)
+    {
+      EXPECT_TRUE(cellSets[0].Contains(cells[cellIndex]));
+    }
+    for (std::size_t cellIndex = 0U; cellIndex < expectedCells.size(); ++cellIndex)
+    {
+      EXPECT_FALSE(cellSets[1].Contains(expectedCells[cellIndex]));
+    }
+  }
+}
@@ -116,3 +116,81 @@ UNIT_TEST(HierarchicalCell, OutOfRangeIndices)
   EXPECT_THROW(HierarchicalCell cell("XXXXXXXXX", MAX_FACE_INDEX, 5), EAGGR::EAGGRException);
 }
 
+
+UNIT_TEST(HierarchicalCell, PackedCellId)
+{
+  HierarchicalCell cell("010123", MAX_FACE_INDEX, 3);
+  EXPECT_EQ(0x08DC000000000000ULL, cell.GetPackedCellId());
+
+  HierarchicalCell resolution0Cell("19", MAX_FACE_INDEX, 3);
+  EXPECT_EQ(0x9C00000000000000ULL, resolution0Cell.GetPackedCellId());
+}
+
+UNIT_TEST(HierarchicalCell, ConstructFromPackedCellId)
+{
+  HierarchicalCell cell(static_cast<DggsPackedCellId>(0x08DC000000000000ULL), MAX_FACE_INDEX, 3);
+
+  EXPECT_EQ("010123", cell.GetCellId());
+  EXPECT_EQ(1, cell.GetFaceIndex());
+  EXPECT_EQ(4, cell.GetResolution());
+  EXPECT_EQ(0, cell.GetCellIndex(1));
+  EXPECT_EQ(1, cell.GetCellIndex(2));
+  EXPECT_EQ(2, cell.GetCellIndex(3));
+  EXPECT_EQ(3, cell.GetCellIndex(4));
+
+  // Maximum packed resolution should survive a round trip
+  const std::string cellId = "1932103210321032103210321032103";
+  HierarchicalCell maximumResolutionCell(cellId, MAX_FACE_INDEX, 3);
+  HierarchicalCell unpackedCell(maximumResolutionCell.GetPackedCellId(), MAX_FACE_INDEX, 3);
+  EXPECT_EQ(29, unpackedCell.GetResolution());
+  EXPECT_EQ(cellId, unpackedCell.GetCellId());
+}
+
+UNIT_TEST(HierarchicalCell, PackedCellIdOrdering)
+{
+  // Packed IDs at the same resolution should sort in the same order as the string IDs
+  const char * cellIds[] =
+  { "0000", "0001", "0033", "0100", "0132", "1900", "1933" };
+  const unsigned short noOfCells = sizeof(cellIds) / sizeof(cellIds[0]);
+
+  for (unsigned short cellIndex = 1U; cellIndex < noOfCells; ++cellIndex)
+  {
+    HierarchicalCell previousCell(cellIds[cellIndex - 1U], MAX_FACE_INDEX, 3);
+    HierarchicalCell cell(cellIds[cellIndex], MAX_FACE_INDEX, 3);
+    EXPECT_LT(previousCell.GetPackedCellId(), cell.GetPackedCellId());
+  }
+
+  // Descendants of a cell should lie between the packed IDs of its neighbours
+  HierarchicalCell previousCell("0112", MAX_FACE_INDEX, 3);
+  HierarchicalCell nextCell("0120", MAX_FACE_INDEX, 3);
+  HierarchicalCell firstDescendant("011300000", MAX_FACE_INDEX, 3);
+  HierarchicalCell lastDescendant("011333333", MAX_FACE_INDEX, 3);
+  EXPECT_LT(previousCell.GetPackedCellId(), firstDescendant.GetPackedCellId());
+  EXPECT_LT(lastDescendant.GetPackedCellId(), nextCell.GetPackedCellId());
+}
+
+UNIT_TEST(HierarchicalCell, InvalidPackedCellId)
+{
+  // Resolution too large to pack
+  HierarchicalCell highResolutionCell("00012301230123012301230123012301", MAX_FACE_INDEX, 3);
+  EXPECT_THROW(highResolutionCell.GetPackedCellId(), EAGGR::EAGGRException);
+
+  // Cell indices that cannot be represented in 2 bits
+  HierarchicalCell wideIndexCell("0056", MAX_FACE_INDEX, 9);
+  EXPECT_THROW(wideIndexCell.GetPackedCellId(), EAGGR::EAGGRException);
+
+  // No resolution marker
+  EXPECT_THROW(
+      HierarchicalCell(static_cast<DggsPackedCellId>(0x0800000000000000ULL), MAX_FACE_INDEX, 3),
+      EAGGR::EAGGRException);
+
+  // Misaligned resolution marker
+  EXPECT_THROW(
+      HierarchicalCell(static_cast<DggsPackedCellId>(0x0A00000000000000ULL), MAX_FACE_INDEX, 3),
+      EAGGR::EAGGRException);
+
+  // Face index out of range
+  EXPECT_THROW(
+      HierarchicalCell(static_cast<DggsPackedCellId>(0xA400000000000000ULL), MAX_FACE_INDEX, 3),
+      EAGGR::EAGGRException);
+}
@@ -0,0 +1,158 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGRTestHarness
+//
+// subsystem: Unit Tests
+//
+//------------------------------------------------------
+/// @file HierarchicalCellValueTest.cpp
+/// 
+/// Tests for the EAGGR::Model::HierarchicalCellValue class
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include "TestMacros.hpp"
+
+#include "Src/Model/ICell/HierarchicalCell.hpp"
+#include "Src/Model/ICell/HierarchicalCellValue.hpp"
+#include "Src/EAGGRException.hpp"
+
+static const unsigned short MAX_FACE_INDEX = 19U;
+static const unsigned short MAX_CELL_INDEX = 3U;
+
+using namespace EAGGR::Model::Cell;
+
+UNIT_TEST(HierarchicalCellValue, FaceCell)
+{
+  HierarchicalCellValue cell(12U, MAX_FACE_INDEX);
+
+  EXPECT_EQ(12U, cell.GetFaceIndex());
+  EXPECT_EQ(0U, cell.GetResolution());
+  EXPECT_EQ(HierarchicalCell("12", MAX_FACE_INDEX, MAX_CELL_INDEX).GetPackedCellId(),
+      cell.GetPackedCellId());
+
+  HierarchicalCellValue defaultCell;
+  EXPECT_EQ(0U, defaultCell.GetFaceIndex());
+  EXPECT_EQ(0U, defaultCell.GetResolution());
+
+  EXPECT_THROW(HierarchicalCellValue(20U, MAX_FACE_INDEX), EAGGR::EAGGRException);
+}
+
+UNIT_TEST(HierarchicalCellValue, PackedCellId)
+{
+  HierarchicalCell hierarchicalCell("123012301", MAX_FACE_INDEX, MAX_CELL_INDEX);
+  HierarchicalCellValue cell(hierarchicalCell.GetPackedCellId());
+
+  EXPECT_EQ(hierarchicalCell.GetPackedCellId(), cell.GetPackedCellId());
+  EXPECT_EQ(12U, cell.GetFaceIndex());
+  EXPECT_EQ(7U, cell.GetResolution());
+
+  for (unsigned short resolution = 1U; resolution <= cell.GetResolution(); ++resolution)
+  {
+    EXPECT_EQ(hierarchicalCell.GetCellIndex(resolution), cell.GetCellIndex(resolution));
+  }
+
+  EXPECT_THROW(cell.GetCellIndex(0U), EAGGR::EAGGRException);
+  EXPECT_THROW(cell.GetCellIndex(8U), EAGGR::EAGGRException);
+
+  // Missing resolution marker
+  EXPECT_THROW(
+      HierarchicalCellValue(static_cast<DggsPackedCellId>(0x6000000000000000ULL)),
+      EAGGR::EAGGRException);
+
+  // Resolution marker not aligned to a cell index
+  EXPECT_THROW(
+      HierarchicalCellValue(static_cast<DggsPackedCellId>(0x6200000000000000ULL)),
+      EAGGR::EAGGRException);
+
+  // Face index beyond the last face of the icosahedron
+  EXPECT_THROW(
+      HierarchicalCellValue(static_cast<DggsPackedCellId>(0xA400000000000000ULL)),
+      EAGGR::EAGGRException);
+  EXPECT_NO_THROW(HierarchicalCellValue(static_cast<DggsPackedCellId>(0x9C00000000000000ULL)));
+}
+
+UNIT_TEST(HierarchicalCellValue, ParentAndChild)
+{
+  HierarchicalCellValue cell(
+      HierarchicalCell("0301", MAX_FACE_INDEX, MAX_CELL_INDEX).GetPackedCellId());
+
+  EXPECT_EQ(HierarchicalCell("030", MAX_FACE_INDEX, MAX_CELL_INDEX).GetPackedCellId(),
+      cell.GetParent().GetPackedCellId());
+  EXPECT_EQ(HierarchicalCell("03013", MAX_FACE_INDEX, MAX_CELL_INDEX).GetPackedCellId(),
+      cell.GetChild(3U).GetPackedCellId());
+
+  // Descending and then ascending returns the original cell
+  EXPECT_EQ(cell.GetPackedCellId(), cell.GetChild(2U).GetParent().GetPackedCellId());
+
+  // Test error cases
+  EXPECT_THROW(HierarchicalCellValue(3U, MAX_FACE_INDEX).GetParent(), EAGGR::EAGGRException);
+  EXPECT_THROW(cell.GetChild(4U), EAGGR::EAGGRException);
+
+  const unsigned short maxResolution = HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL;
+  HierarchicalCellValue maxResolutionCell(3U, MAX_FACE_INDEX);
+  for (unsigned short resolution = 0U; resolution < maxResolution; ++resolution)
+  {
+    maxResolutionCell = maxResolutionCell.GetChild(1U);
+  }
+  EXPECT_EQ(maxResolution, maxResolutionCell.GetResolution());
+  EXPECT_THROW(maxResolutionCell.GetChild(0U), EAGGR::EAGGRException);
+}
+
+UNIT_TEST(HierarchicalCellValue, GetCellIndexBits)
+{
+  // Cell indices 3, 0, 1 and 2 are packed two bits each from the most significant bit
+  HierarchicalCellValue cell(
+      HierarchicalCell("193012", MAX_FACE_INDEX, MAX_CELL_INDEX).GetPackedCellId());
+  EXPECT_EQ(static_cast<DggsPackedCellId>(0xC600000000000000ULL), cell.GetCellIndexBits());
+
+  // Resolution 0 cells have no cell indices
+  EXPECT_EQ(static_cast<DggsPackedCellId>(0U),
+      HierarchicalCellValue(19U, MAX_FACE_INDEX).GetCellIndexBits());
+}
+
+UNIT_TEST(HierarchicalCellValue, Contains)
+{
+  const HierarchicalCellValue cell(
+      HierarchicalCell("0312", MAX_FACE_INDEX, MAX_CELL_INDEX).GetPackedCellId());
+
+  // The cell contains itself and its descendants at every resolution
+  EXPECT_TRUE(cell.Contains(cell));
+  EXPECT_TRUE(cell.Contains(cell.GetChild(0U)));
+  EXPECT_TRUE(cell.Contains(cell.GetChild(3U).GetChild(3U).GetChild(3U)));
+  EXPECT_TRUE(cell.Contains(cell.GetChild(0U).GetChild(0U).GetChild(0U)));
+  EXPECT_EQ(cell.GetChild(0U).GetChild(0U).GetRangeMin(), cell.GetRangeMin());
+  EXPECT_EQ(cell.GetChild(3U).GetChild(3U).GetRangeMax(), cell.GetRangeMax());
+
+  // It does not contain its parent, siblings or their descendants
+  EXPECT_FALSE(cell.Contains(cell.GetParent()));
+  EXPECT_FALSE(cell.Contains(cell.GetParent().GetChild(1U)));
+  EXPECT_FALSE(cell.Contains(cell.GetParent().GetChild(3U).GetChild(0U)));
+  EXPECT_FALSE(cell.Contains(HierarchicalCellValue(4U, MAX_FACE_INDEX)));
+
+  // A cell at the maximum resolution only contains itself
+  HierarchicalCellValue finestCell(cell);
+  while (finestCell.GetResolution() < HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL)
+  {
+    finestCell = finestCell.GetChild(2U);
+  }
+  EXPECT_EQ(finestCell.GetPackedCellId(), finestCell.GetRangeMin());
+  EXPECT_EQ(finestCell.GetPackedCellId(), finestCell.GetRangeMax());
+  EXPECT_TRUE(cell.Contains(finestCell));
+}
@@ -101,3 +101,43 @@ UNIT_TEST(OffsetCell, ResolutionTooLarge)
 
   EXPECT_THROW(OffsetCell("00410,0", MAX_FACE_INDEX), EAGGR::EAGGRException);
 }
+
+UNIT_TEST(OffsetCell, PackedCellId)
+{
+  OffsetCell cell(1, 5, 123, 456, UNKNOWN, MAX_FACE_INDEX);
+  EXPECT_EQ(0x04500003D8000390ULL, cell.GetPackedCellId());
+
+  OffsetCell cellNegativeCoord(10, 5, -123, -456, UNKNOWN, MAX_FACE_INDEX);
+  EXPECT_EQ(0x28500003D400038FULL, cellNegativeCoord.GetPackedCellId());
+
+  // Coordinates too large to pack
+  OffsetCell largeCell(1, 40, 33554432L, 0, UNKNOWN, MAX_FACE_INDEX);
+  EXPECT_THROW(largeCell.GetPackedCellId(), EAGGR::EAGGRException);
+}
+
+UNIT_TEST(OffsetCell, ConstructFromPackedCellId)
+{
+  OffsetCell cell(static_cast<DggsPackedCellId>(0x28500003D400038FULL), MAX_FACE_INDEX);
+
+  EXPECT_EQ("1005-123,-456", cell.GetCellId());
+  EXPECT_EQ(10, cell.GetFaceIndex());
+  EXPECT_EQ(5, cell.GetResolution());
+  EXPECT_EQ(-123, cell.GetRow());
+  EXPECT_EQ(-456, cell.GetColumn());
+
+  // Largest coordinates that can be packed should survive a round trip
+  OffsetCell largeCell(19, 32, 33554431L, -33554432L, UNKNOWN, MAX_FACE_INDEX);
+  OffsetCell unpackedCell(largeCell.GetPackedCellId(), MAX_FACE_INDEX);
+  EXPECT_EQ(largeCell.GetCellId(), unpackedCell.GetCellId());
+
+  // Test handling of invalid packed cell IDs
+  EXPECT_THROW(
+      OffsetCell(static_cast<DggsPackedCellId>(0x8000000000000000ULL), MAX_FACE_INDEX),
+      EAGGR::EAGGRException);
+  EXPECT_THROW(
+      OffsetCell(static_cast<DggsPackedCellId>(0x5000000000000000ULL), MAX_FACE_INDEX),
+      EAGGR::EAGGRException);
+  EXPECT_THROW(
+      OffsetCell(static_cast<DggsPackedCellId>(0x0290000000000000ULL), MAX_FACE_INDEX),
+      EAGGR::EAGGRException);
+}
@@ -207,6 +207,59 @@ UNIT_TEST(Aperture4TriangleGrid, GetFacePartitionRightPartition)
   EXPECT_DOUBLE_EQ(-sqrt(3.0) / 12.0, partition.GetPartitionCentre().GetY());
 }
 
+UNIT_TEST(Aperture4TriangleGrid, GetCellIndicesResolution1)
+{
+  Aperture4TriangleGrid grid;
+
+  unsigned short cellIndex = 9U; // initialise to invalid value
+
+  grid.GetCellIndices(FaceCoordinate(0, 0.0, 0.0, 1.0), 1U, &cellIndex);
+  EXPECT_EQ(0U, cellIndex);
+
+  grid.GetCellIndices(FaceCoordinate(0, 0.1, 0.3, 1.0), 1U, &cellIndex);
+  EXPECT_EQ(1U, cellIndex);
+
+  grid.GetCellIndices(FaceCoordinate(0, -0.2, 0.0, 1.0), 1U, &cellIndex);
+  EXPECT_EQ(2U, cellIndex);
+
+  grid.GetCellIndices(FaceCoordinate(0, 0.2, 0.0, 1.0), 1U, &cellIndex);
+  EXPECT_EQ(3U, cellIndex);
+}
+
+UNIT_TEST(Aperture4TriangleGrid, GetCellIndicesMatchesFacePartition)
+{
+  Aperture4TriangleGrid grid;
+
+  const unsigned short resolution = 20U;
+  const unsigned short noOfSteps = 50U;
+  const double triangleHeight = ROOT_3 / 2.0;
+
+  // Sample points across the face, avoiding the sub-triangle edges where the two methods may
+  // legitimately resolve ties differently
+  for (unsigned short yStep = 0U; yStep < noOfSteps; ++yStep)
+  {
+    const double heightFraction = (yStep + 0.37) / noOfSteps;
+    const double halfWidth = 0.5 * (1.0 - heightFraction);
+
+    for (unsigned short xStep = 0U; xStep < noOfSteps; ++xStep)
+    {
+      const double xOffset = halfWidth * (2.0 * (xStep + 0.61) / noOfSteps - 1.0);
+      const double yOffset = heightFraction * triangleHeight - triangleHeight / 3.0;
+      const FaceCoordinate location(0, xOffset, yOffset, 1.0);
+
+      unsigned short cellIndices[resolution];
+      grid.GetCellIndices(location, resolution, cellIndices);
+
+      CellPartition partition(9U, CartesianPoint(0.0, 0.0), STANDARD);
+      for (unsigned short resolutionLevel = 1U; resolutionLevel <= resolution; ++resolutionLevel)
+      {
+        grid.GetFacePartition(partition, resolutionLevel, location, &partition);
+        EXPECT_EQ(partition.GetId(), cellIndices[resolutionLevel - 1]);
+      }
+    }
+  }
+}
+
 UNIT_TEST(Aperture4TriangleGrid, CornerPointsResolution1Partition0)
 {
   Aperture4TriangleGrid grid;
@@ -612,3 +665,162 @@ UNIT_TEST(Aperture4TriangleGrid, GetVertices)
   EXPECT_EQ(0.5, vertex->GetXOffset());
   EXPECT_EQ(-sqrt(3.0) / 6.0, vertex->GetYOffset());
 }
+
+UNIT_TEST(Aperture4TriangleGrid, CellValueMatchesCell)
+{
+  Aperture4TriangleGrid grid;
+
+  const char* cellIds[] =
+  { "00", "000", "001", "0002", "0103", "121320", "123012301" };
+  const size_t noOfCells = sizeof(cellIds) / sizeof(cellIds[0]);
+
+  for (size_t cellIndex = 0U; cellIndex < noOfCells; ++cellIndex)
+  {
+    Cell::HierarchicalCell cell(cellIds[cellIndex], MAX_FACE_INDEX, MAX_CELL_INDEX);
+    Cell::HierarchicalCellValue cellValue(cell.GetPackedCellId());
+
+    EXPECT_EQ(grid.GetOrientation(cell), grid.GetOrientation(cellValue));
+
+    double xOffset;
+    double yOffset;
+    grid.GetFaceOffset(cell, xOffset, yOffset);
+
+    double valueXOffset;
+    double valueYOffset;
+    grid.GetFaceOffset(cellValue, valueXOffset, valueYOffset);
+
+    EXPECT_DOUBLE_EQ(xOffset, valueXOffset);
+    EXPECT_DOUBLE_EQ(yOffset, valueYOffset);
+  }
+}
+
+UNIT_TEST(Aperture4TriangleGrid, GetFaceOffsetAndOrientation)
+{
+  Aperture4TriangleGrid grid;
+
+  double xOffset;
+  double yOffset;
+  ShapeOrientation orientation;
+
+  // Repeatedly moving to the top child approaches the top of the face
+  grid.GetFaceOffsetAndOrientation(
+      Cell::HierarchicalCell("0011111", MAX_FACE_INDEX, MAX_CELL_INDEX).GetCellValue(),
+      xOffset,
+      yOffset,
+      orientation);
+  EXPECT_DOUBLE_EQ(0.0, xOffset);
+  EXPECT_DOUBLE_EQ((ROOT_3 / 6.0) * (31.0 / 16.0), yOffset);
+  EXPECT_EQ(STANDARD, orientation);
+
+  // An odd number of middle triangles inverts the orientation
+  grid.GetFaceOffsetAndOrientation(
+      Cell::HierarchicalCell("00000000000", MAX_FACE_INDEX, MAX_CELL_INDEX).GetCellValue(),
+      xOffset,
+      yOffset,
+      orientation);
+  EXPECT_DOUBLE_EQ(0.0, xOffset);
+  EXPECT_DOUBLE_EQ(0.0, yOffset);
+  EXPECT_EQ(ROTATED, orientation);
+
+  // Left child of the right child (i.e. a complete group of cell indices followed by a
+  // partial group) within a rotated middle triangle
+  grid.GetFaceOffsetAndOrientation(
+      Cell::HierarchicalCell("000000032", MAX_FACE_INDEX, MAX_CELL_INDEX).GetCellValue(),
+      xOffset,
+      yOffset,
+      orientation);
+  EXPECT_NEAR(1.0 / 128.0 - 1.0 / 256.0, xOffset, TOLERANCE);
+  EXPECT_NEAR((ROOT_3 / 12.0) * (1.0 / 32.0 + 1.0 / 64.0), yOffset, TOLERANCE);
+  EXPECT_EQ(ROTATED, orientation);
+}
+
+UNIT_TEST(Aperture4TriangleGrid, GetVertexOffsets)
+{
+  Aperture4TriangleGrid grid;
+
+  const char* cellIds[] =
+  { "00", "000", "0102", "121320", "123012301", "0701230123012301230" };
+  const size_t noOfCells = sizeof(cellIds) / sizeof(cellIds[0]);
+
+  for (size_t cellIndex = 0U; cellIndex < noOfCells; ++cellIndex)
+  {
+    Cell::HierarchicalCell cell(cellIds[cellIndex], MAX_FACE_INDEX, MAX_CELL_INDEX);
+
+    std::list<FaceCoordinate> vertices;
+    grid.GetVertices(cell, vertices);
+
+    double xOffsets[IHierarchicalGrid::m_MAX_NUM_VERTICES];
+    double yOffsets[IHierarchicalGrid::m_MAX_NUM_VERTICES];
+    const unsigned short noOfVertices = grid.GetVertexOffsets(
+        cell.GetCellValue(),
+        xOffsets,
+        yOffsets);
+
+    EXPECT_EQ(vertices.size(), noOfVertices);
+
+    unsigned short vertexIndex = 0U;
+    for (std::list<FaceCoordinate>::const_iterator vertex = vertices.begin();
+        vertex != vertices.end(); ++vertex, ++vertexIndex)
+    {
+      EXPECT_DOUBLE_EQ(vertex->GetXOffset(), xOffsets[vertexIndex]);
+      EXPECT_DOUBLE_EQ(vertex->GetYOffset(), yOffsets[vertexIndex]);
+    }
+
+    // Vertices are one edge length apart
+    const double edgeLength = 1.0 / pow(2.0, cell.GetResolution());
+    EXPECT_NEAR(edgeLength, xOffsets[2] - xOffsets[1], TOLERANCE * edgeLength);
+  }
+}
+
+UNIT_TEST(Aperture4TriangleGrid, GetNeighbourOffsets)
+{
+  Aperture4TriangleGrid grid;
+
+  const char* cellIds[] =
+  { "0000", "0102", "121320", "123012301" };
+  const size_t noOfCells = sizeof(cellIds) / sizeof(cellIds[0]);
+
+  for (size_t cellIndex = 0U; cellIndex < noOfCells; ++cellIndex)
+  {
+    Cell::HierarchicalCell cell(cellIds[cellIndex], MAX_FACE_INDEX, MAX_CELL_INDEX);
+
+    double xOffset;
+    double yOffset;
+    grid.GetFaceOffset(cell, xOffset, yOffset);
+
+    double xOffsets[IHierarchicalGrid::m_MAX_NUM_NEIGHBOURS];
+    double yOffsets[IHierarchicalGrid::m_MAX_NUM_NEIGHBOURS];
+    const unsigned short noOfNeighbours = grid.GetNeighbourOffsets(cell, xOffsets, yOffsets);
+    ASSERT_EQ(12U, noOfNeighbours);
+
+    // Edge neighbours are reflections of the centre in each edge and the other neighbours are
+    // one or two edge lengths from the centre
+    const double edgeLength = 1.0 / pow(2.0, cell.GetResolution());
+    for (unsigned short neighbour = 0U; neighbour < noOfNeighbours; ++neighbour)
+    {
+      const double distance = sqrt(
+          pow(xOffsets[neighbour] - xOffset, 2) + pow(yOffsets[neighbour] - yOffset, 2));
+      const double expectedDistance =
+          (neighbour < 3U) ? edgeLength / ROOT_3 :
+          (distance < 1.1 * edgeLength) ? edgeLength : 2.0 * edgeLength / ROOT_3;
+      EXPECT_NEAR(expectedDistance, distance, TOLERANCE * edgeLength);
+    }
+
+    // The edge neighbours are the cells found at the neighbour centres
+    for (unsigned short neighbour = 0U; neighbour < 3U; ++neighbour)
+    {
+      unsigned short cellIndices[Cell::HierarchicalCellValue::m_MAX_RESOLUTION_LEVEL];
+      grid.GetCellIndices(
+          FaceCoordinate(0U, xOffsets[neighbour], yOffsets[neighbour], 1.0),
+          cell.GetResolution(),
+          cellIndices);
+
+      Cell::HierarchicalCell neighbourCell(
+          cell.GetFaceIndex(),
+          std::vector<unsigned short>(cellIndices, cellIndices + cell.GetResolution()),
+          MAX_FACE_INDEX,
+          MAX_CELL_INDEX);
+      EXPECT_NE(grid.GetOrientation(cell), grid.GetOrientation(neighbourCell));
+    }
+  }
+}
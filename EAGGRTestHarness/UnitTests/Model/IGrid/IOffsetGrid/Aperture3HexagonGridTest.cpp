@@ -830,6 +830,51 @@ UNIT_TEST(Aperture3HexagonGrid, GetChildrenVerticalCells)
   EXPECT_EQ(6, children.at(6).m_columnId);
 }
 
+UNIT_TEST(Aperture3HexagonGrid, GetChildrenNegativeCells)
+{
+  Aperture3HexagonGrid grid;
+
+  // Every child of a cell on either side of the origin has the cell as one of its parents, for
+  // both the horizontal and vertical cell resolutions
+  for (unsigned short resolution = 1U; resolution <= 2U; ++resolution)
+  {
+    for (long rowId = -3; rowId <= 3; ++rowId)
+    {
+      for (long columnId = -3; columnId <= 3; ++columnId)
+      {
+        Cell::OffsetCell cell(0U, resolution, rowId, columnId, Cell::FACE, MAX_FACE_INDEX);
+        std::vector<OffsetCoordinate> children;
+        grid.GetChildren(cell, children);
+        ASSERT_EQ(7U, children.size());
+
+        for (std::vector<OffsetCoordinate>::const_iterator child = children.begin();
+            child != children.end(); ++child)
+        {
+          Cell::OffsetCell childCell(
+              0U,
+              resolution + 1U,
+              child->m_rowId,
+              child->m_columnId,
+              Cell::FACE,
+              MAX_FACE_INDEX);
+          std::vector<OffsetCoordinate> parents;
+          grid.GetParents(childCell, parents);
+
+          bool isParent = false;
+          for (std::vector<OffsetCoordinate>::const_iterator parent = parents.begin();
+              parent != parents.end(); ++parent)
+          {
+            isParent = isParent || (parent->m_rowId == rowId && parent->m_columnId == columnId);
+          }
+          EXPECT_TRUE(isParent) << "Cell " << rowId << ", " << columnId << " at resolution "
+              << resolution << " is not a parent of its child " << child->m_rowId << ", "
+              << child->m_columnId;
+        }
+      }
+    }
+  }
+}
+
 UNIT_TEST(Aperture3HexagonGrid, GetVertices)
 {
   Aperture3HexagonGrid grid;
@@ -949,3 +994,52 @@ bool OffsetCoordinateSorter(OffsetCoordinate coordinate1, OffsetCoordinate coord
     return false;
   }
 }
+
+UNIT_TEST(Aperture3HexagonGrid, GetNeighbours)
+{
+  Aperture3HexagonGrid grid;
+
+  // Neighbours are one cell width from the centre, for both the horizontal and vertical cell
+  // resolutions and for cells on either side of the origin
+  for (unsigned short resolution = 1U; resolution <= 2U; ++resolution)
+  {
+    for (long rowId = -2; rowId <= 2; ++rowId)
+    {
+      for (long columnId = -2; columnId <= 2; ++columnId)
+      {
+        Cell::OffsetCell cell(0U, resolution, rowId, columnId, Cell::FACE, MAX_FACE_INDEX);
+        double xOffset;
+        double yOffset;
+        grid.GetFaceOffset(cell, xOffset, yOffset);
+
+        OffsetCoordinate neighbours[IOffsetGrid::m_MAX_NUM_NEIGHBOURS];
+        const unsigned short noOfNeighbours = grid.GetNeighbours(cell, neighbours);
+        ASSERT_EQ(6U, noOfNeighbours);
+
+        const double cellWidth = ROOT_3 / 3.0 / pow(ROOT_3, resolution - 1U);
+        for (unsigned short neighbour = 0U; neighbour < noOfNeighbours; ++neighbour)
+        {
+          Cell::OffsetCell neighbourCell(
+              0U,
+              resolution,
+              neighbours[neighbour].m_rowId,
+              neighbours[neighbour].m_columnId,
+              Cell::FACE,
+              MAX_FACE_INDEX);
+          double neighbourXOffset;
+          double neighbourYOffset;
+          grid.GetFaceOffset(neighbourCell, neighbourXOffset, neighbourYOffset);
+
+          const double distance = sqrt(
+              pow(neighbourXOffset - xOffset, 2) + pow(neighbourYOffset - yOffset, 2));
+          EXPECT_NEAR(cellWidth, distance, TOLERANCE);
+        }
+      }
+    }
+  }
+
+  // Resolution 0 cells cover the whole face
+  Cell::OffsetCell face(0U, 0U, 0, 0, Cell::FACE, MAX_FACE_INDEX);
+  OffsetCoordinate neighbours[IOffsetGrid::m_MAX_NUM_NEIGHBOURS];
+  EXPECT_THROW(grid.GetNeighbours(face, neighbours), EAGGR::EAGGRException);
+}
@@ -102,6 +102,25 @@ UNIT_TEST(HierarchicalGridIndexer, GetCellResolution4)
   EXPECT_EQ("121320", cell->GetCellId());
 }
 
+UNIT_TEST(HierarchicalGridIndexer, GetCellAtResolution)
+{
+  Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
+
+  GridIndexer::HierarchicalGridIndexer indexer(&grid, MAX_FACE_INDEX);
+
+  // The accuracy of the face coordinate is ignored
+  FaceCoordinate faceCoordinate(12, 0.0625, 0.17140086, 1.0);
+
+  std::unique_ptr<Cell::ICell> cell = indexer.GetCellAtResolution(faceCoordinate, 4U);
+  EXPECT_EQ("121320", cell->GetCellId());
+
+  cell = indexer.GetCellAtResolution(faceCoordinate, 2U);
+  EXPECT_EQ("1213", cell->GetCellId());
+
+  cell = indexer.GetCellAtResolution(faceCoordinate, 0U);
+  EXPECT_EQ("12", cell->GetCellId());
+}
+
 UNIT_TEST(HierarchicalGridIndexer, GetFaceCoordinateResolution4)
 {
   Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
@@ -139,6 +158,30 @@ UNIT_TEST(HierarchicalGridIndexer, CreateCell)
   EXPECT_THROW(indexer.CreateCell("XXXXX"), EAGGR::EAGGRException);
 }
 
+UNIT_TEST(HierarchicalGridIndexer, CreateCellFromPackedCellId)
+{
+  Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
+
+  GridIndexer::HierarchicalGridIndexer indexer(&grid, MAX_FACE_INDEX);
+
+  std::unique_ptr<Cell::ICell> cell = indexer.CreateCell("123012301");
+  std::unique_ptr<Cell::ICell> packedCell = indexer.CreateCell(cell->GetPackedCellId());
+
+  EXPECT_EQ("123012301", packedCell->GetCellId());
+  EXPECT_EQ(12, packedCell->GetFaceIndex());
+  EXPECT_EQ(7, packedCell->GetResolution());
+  EXPECT_EQ(Grid::STANDARD, packedCell->GetOrientation());
+
+  std::unique_ptr<Cell::ICell> invertedCell = indexer.CreateCell(
+      indexer.CreateCell("120123")->GetPackedCellId());
+  EXPECT_EQ(Grid::ROTATED, invertedCell->GetOrientation());
+
+  // Test error case (face index 20)
+  EXPECT_THROW(
+      indexer.CreateCell(static_cast<Cell::DggsPackedCellId>(0xA400000000000000ULL)),
+      EAGGR::EAGGRException);
+}
+
 UNIT_TEST(HierarchicalGridIndexer, GetParents)
 {
   Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
@@ -211,3 +254,77 @@ UNIT_TEST(HierarchicalGridIndexer, GetCellVertices)
   EXPECT_EQ(0.5, vertex->GetXOffset());
   EXPECT_EQ(-sqrt(3.0) / 6.0, vertex->GetYOffset());
 }
+
+UNIT_TEST(HierarchicalGridIndexer, GetCellValue)
+{
+  Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
+
+  GridIndexer::HierarchicalGridIndexer indexer(&grid, MAX_FACE_INDEX);
+
+  FaceCoordinate faceCoordinates[] =
+  {
+    FaceCoordinate(12, 0.0625, 0.17140086, 0.00390625),
+    FaceCoordinate(2, 0.2, -0.1, 0.25),
+    FaceCoordinate(2, 0.0, 0.0, 1.0) };
+  const size_t noOfCoordinates = sizeof(faceCoordinates) / sizeof(faceCoordinates[0]);
+
+  Cell::HierarchicalCellValue cells[noOfCoordinates];
+  indexer.GetCellValues(faceCoordinates, noOfCoordinates, cells);
+
+  for (size_t coordinateIndex = 0U; coordinateIndex < noOfCoordinates; ++coordinateIndex)
+  {
+    std::unique_ptr<Cell::ICell> cell = indexer.GetCell(faceCoordinates[coordinateIndex]);
+    EXPECT_EQ(cell->GetPackedCellId(), cells[coordinateIndex].GetPackedCellId());
+    EXPECT_EQ(
+        cell->GetPackedCellId(),
+        indexer.GetCellValue(faceCoordinates[coordinateIndex]).GetPackedCellId());
+  }
+
+  // Face coordinate on an invalid face
+  EXPECT_THROW(indexer.GetCellValue(FaceCoordinate(20, 0.0, 0.0, 1.0)), EAGGR::EAGGRException);
+}
+
+UNIT_TEST(HierarchicalGridIndexer, GetFaceCoordinateCellValue)
+{
+  Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
+
+  GridIndexer::HierarchicalGridIndexer indexer(&grid, MAX_FACE_INDEX);
+
+  FaceCoordinate faceCoordinate(12, 0.0625, 0.18042196, 0.00390625);
+  Cell::HierarchicalCellValue cell = indexer.GetCellValue(faceCoordinate);
+
+  // Convert back to the face coordinate
+  FaceCoordinate convertedFaceCoordinate = indexer.GetFaceCoordinate(cell);
+  EXPECT_EQ(12, convertedFaceCoordinate.GetFaceIndex());
+  EXPECT_NEAR(faceCoordinate.GetXOffset(), convertedFaceCoordinate.GetXOffset(), 1E-6);
+  EXPECT_NEAR(faceCoordinate.GetYOffset(), convertedFaceCoordinate.GetYOffset(), 1E-6);
+  EXPECT_DOUBLE_EQ(faceCoordinate.GetAccuracy(), convertedFaceCoordinate.GetAccuracy());
+}
+
+UNIT_TEST(HierarchicalGridIndexer, GetParentsAndChildrenCellValue)
+{
+  Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
+
+  GridIndexer::HierarchicalGridIndexer indexer(&grid, MAX_FACE_INDEX);
+
+  Cell::HierarchicalCellValue cell(
+      Cell::HierarchicalCell("123012301", MAX_FACE_INDEX, 3U).GetPackedCellId());
+
+  Cell::HierarchicalCellValue parents[1];
+  EXPECT_EQ(1U, indexer.GetParents(cell, parents));
+  EXPECT_EQ(
+      Cell::HierarchicalCell("12301230", MAX_FACE_INDEX, 3U).GetPackedCellId(),
+      parents[0].GetPackedCellId());
+
+  // Resolution 0 cells have no parents
+  EXPECT_EQ(0U, indexer.GetParents(Cell::HierarchicalCellValue(12U, MAX_FACE_INDEX), parents));
+
+  Cell::HierarchicalCellValue children[4];
+  EXPECT_EQ(4U, indexer.GetChildren(cell, children));
+  EXPECT_EQ(
+      Cell::HierarchicalCell("1230123010", MAX_FACE_INDEX, 3U).GetPackedCellId(),
+      children[0].GetPackedCellId());
+  EXPECT_EQ(
+      Cell::HierarchicalCell("1230123013", MAX_FACE_INDEX, 3U).GetPackedCellId(),
+      children[3].GetPackedCellId());
+}
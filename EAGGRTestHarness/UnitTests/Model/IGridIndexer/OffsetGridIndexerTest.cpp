@@ -143,6 +143,22 @@ UNIT_TEST(OffsetGridIndexer, GetCellResolution3)
   EXPECT_EQ("12031,-1", cell->GetCellId());
 }
 
+UNIT_TEST(OffsetGridIndexer, GetCellAtResolution)
+{
+  Aperture3HexagonGrid grid;
+
+  OffsetGridIndexer indexer(&grid, MAX_FACE_INDEX);
+
+  // The accuracy of the face coordinate is ignored
+  FaceCoordinate faceCoordinate(12, -0.2, 0.28, 1.0);
+
+  std::unique_ptr<ICell> cell = indexer.GetCellAtResolution(faceCoordinate, 3U);
+  EXPECT_EQ("12031,-1", cell->GetCellId());
+
+  cell = indexer.GetCellAtResolution(faceCoordinate, 0U);
+  EXPECT_EQ("12000,0", cell->GetCellId());
+}
+
 UNIT_TEST(OffsetGridIndexer, GetFaceCoordinateResolution2)
 {
   Aperture3HexagonGrid grid;
@@ -214,6 +230,20 @@ UNIT_TEST(OffsetGridIndexer, CreateCell)
   EXPECT_EQ(5, cell->GetResolution());
 }
 
+UNIT_TEST(OffsetGridIndexer, CreateCellFromPackedCellId)
+{
+  Aperture3HexagonGrid grid;
+
+  OffsetGridIndexer indexer(&grid, MAX_FACE_INDEX);
+
+  std::unique_ptr<ICell> cell = indexer.CreateCell("0105123,456");
+  std::unique_ptr<ICell> packedCell = indexer.CreateCell(cell->GetPackedCellId());
+
+  EXPECT_EQ("0105123,456", packedCell->GetCellId());
+  EXPECT_EQ(1, packedCell->GetFaceIndex());
+  EXPECT_EQ(5, packedCell->GetResolution());
+}
+
 UNIT_TEST(OffsetGridIndexer, GetParents)
 {
   Aperture3HexagonGrid grid;
@@ -315,3 +345,74 @@ UNIT_TEST(OffsetGridIndexer, GetCellVertices)
   EXPECT_NEAR(0.5, vertex->GetXOffset(), tolerance);
   EXPECT_NEAR(-0.09622504, vertex->GetYOffset(), tolerance);
 }
+
+UNIT_TEST(OffsetGridIndexer, GetCellValue)
+{
+  Aperture3HexagonGrid grid;
+
+  OffsetGridIndexer indexer(&grid, MAX_FACE_INDEX);
+
+  FaceCoordinate faceCoordinates[] =
+  {
+    FaceCoordinate(1, 0.1, 0.2, 0.001),
+    FaceCoordinate(3, -0.2, -0.1, 0.01) };
+  const size_t noOfCoordinates = sizeof(faceCoordinates) / sizeof(faceCoordinates[0]);
+
+  OffsetCellValue cells[noOfCoordinates];
+  indexer.GetCellValues(faceCoordinates, noOfCoordinates, cells);
+
+  for (size_t coordinateIndex = 0U; coordinateIndex < noOfCoordinates; ++coordinateIndex)
+  {
+    std::unique_ptr<Cell::ICell> cell = indexer.GetCell(faceCoordinates[coordinateIndex]);
+    const OffsetCell& offsetCell = dynamic_cast<const OffsetCell&>(*cell);
+
+    EXPECT_EQ(offsetCell.GetFaceIndex(), cells[coordinateIndex].m_faceIndex);
+    EXPECT_EQ(offsetCell.GetResolution(), cells[coordinateIndex].m_resolution);
+    EXPECT_EQ(offsetCell.GetRow(), cells[coordinateIndex].m_rowId);
+    EXPECT_EQ(offsetCell.GetColumn(), cells[coordinateIndex].m_columnId);
+    EXPECT_EQ(offsetCell.GetCellLocation(), cells[coordinateIndex].m_cellLocation);
+
+    FaceCoordinate expectedCentre = indexer.GetFaceCoordinate(*cell);
+    FaceCoordinate centre = indexer.GetFaceCoordinate(cells[coordinateIndex]);
+    EXPECT_DOUBLE_EQ(expectedCentre.GetXOffset(), centre.GetXOffset());
+    EXPECT_DOUBLE_EQ(expectedCentre.GetYOffset(), centre.GetYOffset());
+  }
+}
+
+UNIT_TEST(OffsetGridIndexer, GetParentsAndChildrenCellValue)
+{
+  Aperture3HexagonGrid grid;
+
+  OffsetGridIndexer indexer(&grid, MAX_FACE_INDEX);
+
+  // Cell with 3 parents
+  OffsetCellValue cell =
+  { 1U, 3U, 5L, 2L, FACE };
+
+  OffsetCellValue parents[Grid::IOffsetGrid::m_MAX_NUM_PARENTS];
+  EXPECT_EQ(3U, indexer.GetParents(cell, parents));
+  EXPECT_EQ(2U, parents[0].m_resolution);
+  EXPECT_EQ(3L, parents[0].m_rowId);
+  EXPECT_EQ(1L, parents[0].m_columnId);
+  EXPECT_EQ(4L, parents[1].m_rowId);
+  EXPECT_EQ(1L, parents[1].m_columnId);
+  EXPECT_EQ(3L, parents[2].m_rowId);
+  EXPECT_EQ(0L, parents[2].m_columnId);
+
+  // Resolution 0 cells are whole faces and have no parents
+  OffsetCellValue faceCell =
+  { 1U, 0U, 0L, 0L, FACE };
+  EXPECT_EQ(0U, indexer.GetParents(faceCell, parents));
+
+  // Cell away from origin
+  OffsetCellValue parentCell =
+  { 1U, 3U, 1L, 3L, FACE };
+
+  OffsetCellValue children[Grid::IOffsetGrid::m_MAX_NUM_CHILDREN];
+  EXPECT_EQ(7U, indexer.GetChildren(parentCell, children));
+  EXPECT_EQ(4U, children[0].m_resolution);
+  EXPECT_EQ(3L, children[0].m_rowId);
+  EXPECT_EQ(4L, children[0].m_columnId);
+  EXPECT_EQ(4L, children[6].m_rowId);
+  EXPECT_EQ(5L, children[6].m_columnId);
+}
@@ -27,6 +27,8 @@
 /// or can be found at <http://www.gnu.org/licenses/>.
 //------------------------------------------------------
 
+#include <cmath>
+
 #include "TestMacros.hpp"
 
 #include "Src/Model/IPolyhedralGlobe/Icosahedron.hpp"
@@ -142,3 +144,31 @@ UNIT_TEST(Icosahedron, FaceCentre)
 
   EXPECT_THROW(icosahedron.GetFaceCentre(20U), EAGGR::EAGGRException);
 }
+
+UNIT_TEST(Icosahedron, FaceGeometry)
+{
+  Icosahedron icosahedron;
+
+  for (FaceIndex faceIndex = 0U; faceIndex < icosahedron.GetNoOfFaces(); ++faceIndex)
+  {
+    const PolyhedralGlobe::FaceGeometry& geometry = icosahedron.GetFaceGeometry(faceIndex);
+    const EAGGR::LatLong::Point faceCentre = icosahedron.GetFaceCentre(faceIndex);
+
+    // Centre vector has unit length and points at the face centre
+    EXPECT_DOUBLE_EQ(
+        1.0,
+        (geometry.m_centreX * geometry.m_centreX) + (geometry.m_centreY * geometry.m_centreY)
+            + (geometry.m_centreZ * geometry.m_centreZ));
+    EXPECT_DOUBLE_EQ(sin(faceCentre.GetLatitudeInRadians()), geometry.m_centreZ);
+    EXPECT_DOUBLE_EQ(
+        faceCentre.GetLongitudeInRadians(),
+        atan2(geometry.m_centreY, geometry.m_centreX));
+
+    EXPECT_EQ(sin(faceCentre.GetLatitudeInRadians()), geometry.m_sinLatitude);
+    EXPECT_EQ(cos(faceCentre.GetLatitudeInRadians()), geometry.m_cosLatitude);
+    EXPECT_EQ(faceCentre.GetLongitudeInRadians(), geometry.m_longitude);
+    EXPECT_EQ(icosahedron.GetOrientationOfFace(faceIndex), geometry.m_orientation);
+  }
+
+  EXPECT_THROW(icosahedron.GetFaceGeometry(20U), EAGGR::EAGGRException);
+}
@@ -27,6 +27,9 @@
 /// or can be found at <http://www.gnu.org/licenses/>.
 //------------------------------------------------------
 
+#include <cmath>
+#include <vector>
+
 #include "TestMacros.hpp"
 
 #include "Src/LatLong/SphericalAccuracyPoint.hpp"
@@ -34,11 +37,14 @@
 #include "Src/Model/FaceCoordinate.hpp"
 #include "Src/Model/IPolyhedralGlobe/Icosahedron.hpp"
 #include "Src/Model/IProjection/Snyder.hpp"
+#include "Src/EAGGRException.hpp"
 
 static const double FACE_OFFSET_TOLERANCE = 1e-6;
 static const double LAT_LONG_TOLERANCE = 1e-6;
 
 static const double AREA_ACCURACY_TOLERANCE = 1e-11;
+static const double VECTOR_KERNEL_OFFSET_TOLERANCE = 1e-12;
+static const double VECTOR_KERNEL_LAT_LONG_TOLERANCE = 1e-10;
 static const double ANGLE_ACCURACY_TOLERANCE = 1e-6;
 
 using namespace EAGGR;
@@ -405,3 +411,302 @@ UNIT_TEST(Snyder_Icosahedron, Accuracy)
     }
   }
 }
+
+/// Tests that points across the whole globe are projected on to the face that contains them
+UNIT_TEST(Snyder_Icosahedron, FaceSelection)
+{
+  // Distance from the centre of a face to its vertices as a fraction of the edge length
+  static const double FACE_CIRCUMRADIUS = 1.0 / sqrt(3.0);
+
+  // Setup the model
+  Model::PolyhedralGlobe::Icosahedron globe;
+  Model::Projection::Snyder projection(&globe);
+
+  // Grid includes points on the face edges and vertices
+  for (double latitude = -90.0; latitude <= 90.0; latitude += 3.0)
+  {
+    for (double longitude = -180.0; longitude <= 180.0; longitude += 3.0)
+    {
+      const LatLong::SphericalAccuracyPoint point(latitude, longitude, 0.1);
+
+      const Model::FaceCoordinate output = projection.GetFaceCoordinate(point);
+
+      // Point must be within the face
+      EXPECT_LE(
+          sqrt(
+              (output.GetXOffset() * output.GetXOffset())
+                  + (output.GetYOffset() * output.GetYOffset())),
+          FACE_CIRCUMRADIUS + FACE_OFFSET_TOLERANCE);
+
+      // Converting back should give the original point
+      const LatLong::SphericalAccuracyPoint outputPoint = projection.GetLatLongPoint(output);
+      EXPECT_NEAR(latitude, outputPoint.GetLatitude(), LAT_LONG_TOLERANCE);
+      if (std::abs(latitude) != 90.0)
+      {
+        EXPECT_NEAR(
+            0.0,
+            LatLong::Point::WrapLongitude(longitude - outputPoint.GetLongitude()),
+            LAT_LONG_TOLERANCE);
+      }
+    }
+  }
+}
+
+/// Tests that converting points in bulk gives the same results as converting them one at a time
+UNIT_TEST(Snyder_Icosahedron, GetFaceCoordinates)
+{
+  // Enough points to span several processing blocks, including a partial block
+  static const size_t NO_OF_POINTS = 150U;
+
+  double latitudes[NO_OF_POINTS];
+  double longitudes[NO_OF_POINTS];
+  double accuracies[NO_OF_POINTS];
+  for (size_t point = 0U; point < NO_OF_POINTS; ++point)
+  {
+    latitudes[point] = -90.0 + (180.0 * point / (NO_OF_POINTS - 1U));
+    longitudes[point] = -180.0 + fmod(37.0 * point, 360.0);
+    accuracies[point] = 0.001 * (point + 1U);
+  }
+
+  // Include the face vertices and edges
+  latitudes[10] = 52.62263186;
+  longitudes[10] = -144.0;
+  latitudes[11] = 26.56505118;
+  longitudes[11] = 0.0;
+
+  // Setup the model, using the scalar path so the results match exactly
+  Model::PolyhedralGlobe::Icosahedron globe;
+  Model::Projection::Snyder projection(&globe, NULL, NULL);
+
+  Model::FaceIndex faceIndices[NO_OF_POINTS];
+  double xOffsets[NO_OF_POINTS];
+  double yOffsets[NO_OF_POINTS];
+  double accuracyAreas[NO_OF_POINTS];
+  projection.GetFaceCoordinates(
+      latitudes,
+      longitudes,
+      accuracies,
+      NO_OF_POINTS,
+      faceIndices,
+      xOffsets,
+      yOffsets,
+      accuracyAreas);
+
+  for (size_t point = 0U; point < NO_OF_POINTS; ++point)
+  {
+    const Model::FaceCoordinate expected = projection.GetFaceCoordinate(
+        LatLong::SphericalAccuracyPoint(latitudes[point], longitudes[point], accuracies[point]));
+
+    EXPECT_EQ(expected.GetFaceIndex(), faceIndices[point]);
+    EXPECT_EQ(expected.GetXOffset(), xOffsets[point]);
+    EXPECT_EQ(expected.GetYOffset(), yOffsets[point]);
+    EXPECT_EQ(expected.GetAccuracy(), accuracyAreas[point]);
+  }
+
+  // Invalid points are rejected
+  const double invalidLatitude = 91.0;
+  EXPECT_THROW(
+      projection.GetFaceCoordinates(
+          &invalidLatitude,
+          longitudes,
+          accuracies,
+          1U,
+          faceIndices,
+          xOffsets,
+          yOffsets,
+          accuracyAreas),
+      EAGGRException);
+}
+
+/// Tests that the vector kernels supported by the CPU give the same faces as the scalar path, and
+/// offsets and lat / long points within the stated error bounds, for points across every face
+UNIT_TEST(Snyder_Icosahedron, VectorKernels)
+{
+  std::vector<Model::Projection::SnyderSimd::ForwardKernel> forwardKernels;
+  std::vector<Model::Projection::SnyderSimd::InverseKernel> inverseKernels;
+#if EAGGR_SNYDER_SIMD
+  if (Model::Projection::SnyderSimd::IsAvx2Supported())
+  {
+    forwardKernels.push_back(&Model::Projection::SnyderSimd::GetFaceCoordinatesAvx2);
+    inverseKernels.push_back(&Model::Projection::SnyderSimd::GetLatLongPointsAvx2);
+  }
+  if (Model::Projection::SnyderSimd::IsAvx512Supported())
+  {
+    forwardKernels.push_back(&Model::Projection::SnyderSimd::GetFaceCoordinatesAvx512);
+    inverseKernels.push_back(&Model::Projection::SnyderSimd::GetLatLongPointsAvx512);
+  }
+#endif
+
+  // Setup the model
+  Model::PolyhedralGlobe::Icosahedron globe;
+  Model::Projection::Snyder scalarProjection(&globe, NULL, NULL);
+
+  // Points on a grid covering each face, including its edges and vertices, and beyond them
+  std::vector<double> latitudes;
+  std::vector<double> longitudes;
+  for (Model::FaceIndex faceIndex = 0U; faceIndex < globe.GetNoOfFaces(); ++faceIndex)
+  {
+    for (double xOffset = -0.5; xOffset <= 0.5; xOffset += 0.0125)
+    {
+      for (double yOffset = -0.5; yOffset <= 0.5; yOffset += 0.0125)
+      {
+        const LatLong::SphericalAccuracyPoint point = scalarProjection.GetLatLongPoint(
+            Model::FaceCoordinate(faceIndex, xOffset, yOffset, 0.0));
+        latitudes.push_back(point.GetLatitude());
+        longitudes.push_back(point.GetLongitude());
+      }
+    }
+  }
+  const size_t noOfPoints = latitudes.size();
+  const std::vector<double> accuracies(noOfPoints, 0.001);
+
+  std::vector<Model::FaceIndex> expectedFaceIndices(noOfPoints);
+  std::vector<double> expectedXOffsets(noOfPoints);
+  std::vector<double> expectedYOffsets(noOfPoints);
+  std::vector<double> expectedAccuracyAreas(noOfPoints);
+  scalarProjection.GetFaceCoordinates(
+      &latitudes[0],
+      &longitudes[0],
+      &accuracies[0],
+      noOfPoints,
+      &expectedFaceIndices[0],
+      &expectedXOffsets[0],
+      &expectedYOffsets[0],
+      &expectedAccuracyAreas[0]);
+
+  std::vector<double> expectedLatitudes(noOfPoints);
+  std::vector<double> expectedLongitudes(noOfPoints);
+  std::vector<double> expectedAccuracies(noOfPoints);
+  scalarProjection.GetLatLongPoints(
+      &expectedFaceIndices[0],
+      &expectedXOffsets[0],
+      &expectedYOffsets[0],
+      &expectedAccuracyAreas[0],
+      noOfPoints,
+      &expectedLatitudes[0],
+      &expectedLongitudes[0],
+      &expectedAccuracies[0]);
+
+  for (size_t kernel = 0U; kernel < forwardKernels.size(); ++kernel)
+  {
+    Model::Projection::Snyder vectorProjection(
+        &globe,
+        forwardKernels[kernel],
+        inverseKernels[kernel]);
+
+    std::vector<Model::FaceIndex> faceIndices(noOfPoints);
+    std::vector<double> xOffsets(noOfPoints);
+    std::vector<double> yOffsets(noOfPoints);
+    std::vector<double> accuracyAreas(noOfPoints);
+    vectorProjection.GetFaceCoordinates(
+        &latitudes[0],
+        &longitudes[0],
+        &accuracies[0],
+        noOfPoints,
+        &faceIndices[0],
+        &xOffsets[0],
+        &yOffsets[0],
+        &accuracyAreas[0]);
+
+    std::vector<bool> isFaceUsed(globe.GetNoOfFaces(), false);
+    for (size_t point = 0U; point < noOfPoints; ++point)
+    {
+      EXPECT_EQ(expectedFaceIndices[point], faceIndices[point]);
+      EXPECT_NEAR(expectedXOffsets[point], xOffsets[point], VECTOR_KERNEL_OFFSET_TOLERANCE);
+      EXPECT_NEAR(expectedYOffsets[point], yOffsets[point], VECTOR_KERNEL_OFFSET_TOLERANCE);
+      EXPECT_EQ(expectedAccuracyAreas[point], accuracyAreas[point]);
+      isFaceUsed[faceIndices[point]] = true;
+    }
+
+    for (Model::FaceIndex faceIndex = 0U; faceIndex < globe.GetNoOfFaces(); ++faceIndex)
+    {
+      EXPECT_TRUE(isFaceUsed[faceIndex]);
+    }
+
+    // Convert the face coordinates from the scalar path back to lat / long points
+    std::vector<double> latitudes(noOfPoints);
+    std::vector<double> longitudes(noOfPoints);
+    std::vector<double> outputAccuracies(noOfPoints);
+    vectorProjection.GetLatLongPoints(
+        &expectedFaceIndices[0],
+        &expectedXOffsets[0],
+        &expectedYOffsets[0],
+        &expectedAccuracyAreas[0],
+        noOfPoints,
+        &latitudes[0],
+        &longitudes[0],
+        &outputAccuracies[0]);
+
+    for (size_t point = 0U; point < noOfPoints; ++point)
+    {
+      EXPECT_NEAR(expectedLatitudes[point], latitudes[point], VECTOR_KERNEL_LAT_LONG_TOLERANCE);
+
+      // Longitude is undefined at the poles
+      if (std::abs(expectedLatitudes[point]) < 90.0 - VECTOR_KERNEL_LAT_LONG_TOLERANCE)
+      {
+        EXPECT_NEAR(
+            0.0,
+            LatLong::Point::WrapLongitude(expectedLongitudes[point] - longitudes[point]),
+            VECTOR_KERNEL_LAT_LONG_TOLERANCE);
+      }
+      EXPECT_EQ(expectedAccuracies[point], outputAccuracies[point]);
+    }
+  }
+}
+
+/// Tests that converting face coordinates in bulk gives the same results as converting them one at
+/// a time
+UNIT_TEST(Snyder_Icosahedron, GetLatLongPoints)
+{
+  // Enough points to span several processing blocks, including a partial block
+  static const size_t NO_OF_POINTS = 150U;
+
+  Model::FaceIndex faceIndices[NO_OF_POINTS];
+  double xOffsets[NO_OF_POINTS];
+  double yOffsets[NO_OF_POINTS];
+  double accuracyAreas[NO_OF_POINTS];
+  for (size_t point = 0U; point < NO_OF_POINTS; ++point)
+  {
+    faceIndices[point] = point % 20U;
+    xOffsets[point] = -0.25 + (0.5 * point / (NO_OF_POINTS - 1U));
+    yOffsets[point] = -0.25 + fmod(0.37 * point, 0.5);
+    accuracyAreas[point] = 1e-6 * (point + 1U);
+  }
+
+  // Include the face centre and a vertex
+  xOffsets[10] = 0.0;
+  yOffsets[10] = 0.0;
+  xOffsets[11] = 0.0;
+  yOffsets[11] = 1.0 / sqrt(3.0);
+
+  // Setup the model, using the scalar path so the results match exactly
+  Model::PolyhedralGlobe::Icosahedron globe;
+  Model::Projection::Snyder projection(&globe, NULL, NULL);
+
+  double latitudes[NO_OF_POINTS];
+  double longitudes[NO_OF_POINTS];
+  double accuracies[NO_OF_POINTS];
+  projection.GetLatLongPoints(
+      faceIndices,
+      xOffsets,
+      yOffsets,
+      accuracyAreas,
+      NO_OF_POINTS,
+      latitudes,
+      longitudes,
+      accuracies);
+
+  for (size_t point = 0U; point < NO_OF_POINTS; ++point)
+  {
+    const LatLong::SphericalAccuracyPoint expected = projection.GetLatLongPoint(
+        Model::FaceCoordinate(
+            faceIndices[point],
+            xOffsets[point],
+            yOffsets[point],
+            accuracyAreas[point]));
+
+    EXPECT_EQ(expected.GetLatitude(), latitudes[point]);
+    EXPECT_EQ(expected.GetLongitude(), longitudes[point]);
+    EXPECT_EQ(expected.GetAccuracy(), accuracies[point]);
+  }
+}
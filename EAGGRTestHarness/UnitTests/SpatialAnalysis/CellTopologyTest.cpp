@@ -0,0 +1,297 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGRTestHarness
+//
+// subsystem: Unit Tests
+//
+//------------------------------------------------------
+/// @file CellTopologyTest.cpp
+///
+/// Tests for the EAGGR::SpatialAnalysis::CellTopology class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <cmath>
+
+#include "TestMacros.hpp"
+
+#include "Src/SpatialAnalysis/CellTopology.hpp"
+#include "Src/SpatialAnalysis/SpatialAnalysis.hpp"
+#include "Src/Model/IGridIndexer/HierarchicalGridIndexer.hpp"
+#include "Src/Model/IGridIndexer/OffsetGridIndexer.hpp"
+#include "Src/Model/IGrid/IHierarchicalGrid/Aperture4TriangleGrid.hpp"
+#include "Src/Model/IGrid/IOffsetGrid/Aperture3HexagonGrid.hpp"
+#include "Src/Model/IProjection/Snyder.hpp"
+#include "Src/Model/IPolyhedralGlobe/Icosahedron.hpp"
+
+using namespace EAGGR::Model;
+using namespace EAGGR::Model::Cell;
+using namespace EAGGR::SpatialAnalysis;
+
+static const AnalysisType ANALYSIS_TYPES[] =
+{ CONTAINS, COVERED_BY, COVERS, CROSSES, DISJOINT, EQUALS, INTERSECTS, OVERLAPS, TOUCHES, WITHIN };
+static const std::size_t NO_OF_ANALYSIS_TYPES = sizeof(ANALYSIS_TYPES) / sizeof(ANALYSIS_TYPES[0]);
+
+/// Checks the result of every predicate between two cells against the expected relation. The
+/// expected flags give the result of CONTAINS, WITHIN, TOUCHES and DISJOINT, from which the
+/// other predicates follow.
+static void CheckRelation(
+    const CellTopology & a_cellTopology,
+    const ICell & a_baseCell,
+    const ICell & a_comparisonCell,
+    const bool a_contains,
+    const bool a_within,
+    const bool a_touches,
+    const bool a_disjoint)
+{
+  for (std::size_t analysisIndex = 0U; analysisIndex < NO_OF_ANALYSIS_TYPES; ++analysisIndex)
+  {
+    bool expectedResult = false;
+    switch (ANALYSIS_TYPES[analysisIndex])
+    {
+      case EQUALS:
+        expectedResult = a_contains && a_within;
+        break;
+      case CONTAINS:
+      case COVERS:
+        expectedResult = a_contains;
+        break;
+      case WITHIN:
+      case COVERED_BY:
+        expectedResult = a_within;
+        break;
+      case TOUCHES:
+        expectedResult = a_touches;
+        break;
+      case DISJOINT:
+        expectedResult = a_disjoint;
+        break;
+      case INTERSECTS:
+        expectedResult = !a_disjoint;
+        break;
+      default:
+        break;
+    }
+
+    bool result = !expectedResult;
+    const bool isAnswered = a_cellTopology.Analyse(
+        a_baseCell,
+        a_comparisonCell,
+        ANALYSIS_TYPES[analysisIndex],
+        result);
+
+    // Crossing is left to the geometry analysers
+    if (ANALYSIS_TYPES[analysisIndex] == CROSSES)
+    {
+      EXPECT_FALSE(isAnswered);
+    }
+    else
+    {
+      EXPECT_TRUE(isAnswered) << a_baseCell.GetCellId() << " " << a_comparisonCell.GetCellId();
+      EXPECT_EQ(expectedResult, result) << a_baseCell.GetCellId() << " "
+          << a_comparisonCell.GetCellId() << " " << ANALYSIS_TYPES[analysisIndex];
+    }
+  }
+}
+
+UNIT_TEST(CellTopology, AnalyseISEA4T)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
+  GridIndexer::HierarchicalGridIndexer gridIndexer(&grid, icosahedron.GetNoOfFaces() - 1U);
+  CellNeighbourhood neighbourhood(&gridIndexer, &projection, icosahedron.GetNoOfFaces());
+  CellTopology cellTopology(&gridIndexer, &neighbourhood);
+
+  // Same cell
+  CheckRelation(
+      cellTopology,
+      *gridIndexer.CreateCell("0012"),
+      *gridIndexer.CreateCell("0012"),
+      true,
+      true,
+      false,
+      false);
+
+  // Descendants are inside their ancestors
+  CheckRelation(
+      cellTopology,
+      *gridIndexer.CreateCell("001"),
+      *gridIndexer.CreateCell("00123"),
+      true,
+      false,
+      false,
+      false);
+  CheckRelation(
+      cellTopology,
+      *gridIndexer.CreateCell("00123"),
+      *gridIndexer.CreateCell("00"),
+      false,
+      true,
+      false,
+      false);
+
+  // Siblings and cells across a face edge touch
+  CheckRelation(
+      cellTopology,
+      *gridIndexer.CreateCell("0000"),
+      *gridIndexer.CreateCell("0001"),
+      false,
+      false,
+      true,
+      false);
+  std::vector<std::unique_ptr<ICell> > neighbours;
+  neighbourhood.GetNeighbours(*gridIndexer.CreateCell("0011"), neighbours);
+  bool isOtherFaceFound = false;
+  for (std::size_t neighbourIndex = 0U; neighbourIndex < neighbours.size(); ++neighbourIndex)
+  {
+    if (neighbours[neighbourIndex]->GetFaceIndex() != 0U)
+    {
+      isOtherFaceFound = true;
+      CheckRelation(
+          cellTopology,
+          *gridIndexer.CreateCell("0011"),
+          *neighbours[neighbourIndex],
+          false,
+          false,
+          true,
+          false);
+    }
+  }
+  EXPECT_TRUE(isOtherFaceFound);
+
+  // Cells apart at the same resolution and at different resolutions
+  CheckRelation(
+      cellTopology,
+      *gridIndexer.CreateCell("0012"),
+      *gridIndexer.CreateCell("0500"),
+      false,
+      false,
+      false,
+      true);
+  CheckRelation(
+      cellTopology,
+      *gridIndexer.CreateCell("0012"),
+      *gridIndexer.CreateCell("05123"),
+      false,
+      false,
+      false,
+      true);
+
+  // A finer cell inside a neighbour of a coarser cell may or may not touch it
+  bool result = false;
+  EXPECT_FALSE(
+      cellTopology.Analyse(
+          *gridIndexer.CreateCell("0001"),
+          *gridIndexer.CreateCell("00003"),
+          TOUCHES,
+          result));
+}
+
+UNIT_TEST(CellTopology, MatchesCellOutlinesISEA4T)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
+  GridIndexer::HierarchicalGridIndexer gridIndexer(&grid, icosahedron.GetNoOfFaces() - 1U);
+  CellNeighbourhood neighbourhood(&gridIndexer, &projection, icosahedron.GetNoOfFaces());
+  CellTopology cellTopology(&gridIndexer, &neighbourhood);
+
+  // Every pair of cells down to resolution 2 on one face, where the outlines are compared in the
+  // plane of the face
+  std::vector<DggsCellId> cellIds(1U, "01");
+  for (std::size_t cellIndex = 0U; cellIndex < cellIds.size(); ++cellIndex)
+  {
+    if (cellIds[cellIndex].size() < 4U)
+    {
+      for (char childIndex = '0'; childIndex <= '3'; ++childIndex)
+      {
+        cellIds.push_back(cellIds[cellIndex] + childIndex);
+      }
+    }
+  }
+
+  for (std::size_t baseIndex = 0U; baseIndex < cellIds.size(); ++baseIndex)
+  {
+    const SpatialAnalysis baseAnalysis(
+        gridIndexer.CreateCell(cellIds[baseIndex]),
+        &gridIndexer,
+        &projection);
+    for (std::size_t comparisonIndex = 0U; comparisonIndex < cellIds.size(); ++comparisonIndex)
+    {
+      for (std::size_t analysisIndex = 0U; analysisIndex < NO_OF_ANALYSIS_TYPES; ++analysisIndex)
+      {
+        bool result = false;
+        if (cellTopology.Analyse(
+            *gridIndexer.CreateCell(cellIds[baseIndex]),
+            *gridIndexer.CreateCell(cellIds[comparisonIndex]),
+            ANALYSIS_TYPES[analysisIndex],
+            result))
+        {
+          EXPECT_EQ(
+              baseAnalysis.Analyse(
+                  gridIndexer.CreateCell(cellIds[comparisonIndex]),
+                  ANALYSIS_TYPES[analysisIndex]),
+              result) << cellIds[baseIndex] << " " << cellIds[comparisonIndex] << " "
+              << ANALYSIS_TYPES[analysisIndex];
+        }
+      }
+    }
+  }
+}
+
+UNIT_TEST(CellTopology, AnalyseISEA3H)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::OffsetGrid::Aperture3HexagonGrid grid;
+  GridIndexer::OffsetGridIndexer gridIndexer(&grid, icosahedron.GetNoOfFaces() - 1U);
+  CellNeighbourhood neighbourhood(&gridIndexer, &projection, icosahedron.GetNoOfFaces());
+  CellTopology cellTopology(&gridIndexer, &neighbourhood);
+
+  const double accuracy = grid.GetAccuracyFromResolution(4U);
+  std::unique_ptr<ICell> cell = gridIndexer.GetCell(FaceCoordinate(3U, 0.0, 0.0, accuracy));
+
+  CheckRelation(cellTopology, *cell, *cell, true, true, false, false);
+
+  std::vector<std::unique_ptr<ICell> > kRing;
+  neighbourhood.GetKRing(*cell, 2U, kRing);
+  ASSERT_EQ(19U, kRing.size());
+  for (std::size_t cellIndex = 1U; cellIndex < kRing.size(); ++cellIndex)
+  {
+    const bool isNeighbour = cellIndex < 7U;
+    CheckRelation(cellTopology, *cell, *kRing[cellIndex], false, false, isNeighbour, !isNeighbour);
+  }
+
+  // The pentagon at the top vertex of face 4 has an id on each face around the vertex, which
+  // are all the same cell
+  std::unique_ptr<ICell> vertexCell =
+      gridIndexer.GetCell(FaceCoordinate(4U, 0.0, sqrt(3.0) / 3.0, accuracy));
+  std::unique_ptr<ICell> canonicalVertexCell = neighbourhood.GetCanonicalCell(*vertexCell);
+  EXPECT_EQ(0U, canonicalVertexCell->GetFaceIndex());
+  EXPECT_NE(vertexCell->GetCellId(), canonicalVertexCell->GetCellId());
+  CheckRelation(cellTopology, *vertexCell, *canonicalVertexCell, true, true, false, false);
+
+  // The children of a hexagon are not nested inside it
+  std::vector<std::unique_ptr<ICell> > children;
+  gridIndexer.GetChildren(*cell, children);
+  ASSERT_FALSE(children.empty());
+  bool result = false;
+  EXPECT_FALSE(cellTopology.Analyse(*cell, *children.front(), CONTAINS, result));
+}
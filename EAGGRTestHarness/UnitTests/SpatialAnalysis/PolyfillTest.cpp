@@ -0,0 +1,255 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2016
+//------------------------------------------------------
+//
+// system: EAGGRTestHarness
+//
+// subsystem: Unit Tests
+//
+//------------------------------------------------------
+/// @file PolyfillTest.cpp
+///
+/// Tests for the EAGGR::SpatialAnalysis::Polyfill class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <set>
+
+#include "TestMacros.hpp"
+
+#include "Src/SpatialAnalysis/Polyfill.hpp"
+#include "Src/Model/IPolyhedralGlobe/Icosahedron.hpp"
+#include "Src/Model/IProjection/Snyder.hpp"
+#include "Src/Model/IGrid/IHierarchicalGrid/Aperture4TriangleGrid.hpp"
+#include "Src/Model/IGrid/IOffsetGrid/Aperture3HexagonGrid.hpp"
+#include "Src/Model/IGridIndexer/HierarchicalGridIndexer.hpp"
+#include "Src/Model/IGridIndexer/OffsetGridIndexer.hpp"
+#include "Src/EAGGRException.hpp"
+
+using namespace EAGGR::Model;
+using namespace EAGGR::SpatialAnalysis;
+using EAGGR::CoordinateConversion::CoordinateConverter;
+using EAGGR::LatLong::Wgs84Polygon;
+
+static void AddRectangleToOuterRing(
+    Wgs84Polygon & a_polygon,
+    const double a_minLongitude,
+    const double a_minLatitude,
+    const double a_maxLongitude,
+    const double a_maxLatitude)
+{
+  a_polygon.AddAccuracyPointToOuterRing(a_minLatitude, a_minLongitude, 0.0);
+  a_polygon.AddAccuracyPointToOuterRing(a_maxLatitude, a_minLongitude, 0.0);
+  a_polygon.AddAccuracyPointToOuterRing(a_maxLatitude, a_maxLongitude, 0.0);
+  a_polygon.AddAccuracyPointToOuterRing(a_minLatitude, a_maxLongitude, 0.0);
+  a_polygon.AddAccuracyPointToOuterRing(a_minLatitude, a_minLongitude, 0.0);
+}
+
+// Gets the id of the cell at the requested resolution that contains a WGS84 point
+static Cell::DggsCellId GetCellId(
+    const Projection::IProjection & a_projection,
+    const Grid::IGrid & a_grid,
+    const GridIndexer::IGridIndexer & a_gridIndexer,
+    const CoordinateConverter & a_converter,
+    const double a_latitude,
+    const double a_longitude,
+    const unsigned short a_resolution)
+{
+  const FaceCoordinate faceCoordinate = a_projection.GetFaceCoordinate(
+      a_converter.ConvertWGS84ToSphere(
+          EAGGR::LatLong::Wgs84AccuracyPoint(a_latitude, a_longitude, 0.0)));
+
+  return a_gridIndexer.GetCell(
+      FaceCoordinate(
+          faceCoordinate.GetFaceIndex(),
+          faceCoordinate.GetXOffset(),
+          faceCoordinate.GetYOffset(),
+          a_grid.GetAccuracyFromResolution(a_resolution)))->GetCellId();
+}
+
+// Checks that the cells are unique and include the cell containing each point sampled from the
+// rectangle, excluding any points in the hole
+static void CheckPolyfill(
+    const Projection::IProjection & a_projection,
+    const Grid::IGrid & a_grid,
+    const GridIndexer::IGridIndexer & a_gridIndexer,
+    const unsigned short a_resolution,
+    const double a_minLongitude,
+    const double a_minLatitude,
+    const double a_maxLongitude,
+    const double a_maxLatitude,
+    const double a_holeMinLongitude,
+    const double a_holeMinLatitude,
+    const double a_holeMaxLongitude,
+    const double a_holeMaxLatitude)
+{
+  const CoordinateConverter converter;
+  const Polyfill polyfill(&a_gridIndexer, &a_projection, &converter, 20U);
+
+  Wgs84Polygon polygon;
+  AddRectangleToOuterRing(polygon, a_minLongitude, a_minLatitude, a_maxLongitude, a_maxLatitude);
+  polygon.CreateInnerRing();
+  polygon.AddAccuracyPointToInnerRing(0U, a_holeMinLatitude, a_holeMinLongitude, 0.0);
+  polygon.AddAccuracyPointToInnerRing(0U, a_holeMaxLatitude, a_holeMinLongitude, 0.0);
+  polygon.AddAccuracyPointToInnerRing(0U, a_holeMaxLatitude, a_holeMaxLongitude, 0.0);
+  polygon.AddAccuracyPointToInnerRing(0U, a_holeMinLatitude, a_holeMaxLongitude, 0.0);
+  polygon.AddAccuracyPointToInnerRing(0U, a_holeMinLatitude, a_holeMinLongitude, 0.0);
+
+  std::vector<std::unique_ptr<Cell::ICell> > cells;
+  polyfill.GetCells(polygon, a_resolution, cells);
+
+  std::set<Cell::DggsCellId> cellIds;
+  for (std::vector<std::unique_ptr<Cell::ICell> >::const_iterator cell = cells.begin();
+      cell != cells.end(); ++cell)
+  {
+    EXPECT_EQ(a_resolution, (*cell)->GetResolution());
+    EXPECT_TRUE(cellIds.insert((*cell)->GetCellId()).second) << (*cell)->GetCellId();
+  }
+
+  const double step = (a_maxLatitude - a_minLatitude) / 64.0;
+  for (double latitude = a_minLatitude + step / 2.0; latitude < a_maxLatitude; latitude += step)
+  {
+    for (double longitude = a_minLongitude + step / 2.0; longitude < a_maxLongitude;
+        longitude += step)
+    {
+      if (latitude > a_holeMinLatitude && latitude < a_holeMaxLatitude
+          && longitude > a_holeMinLongitude && longitude < a_holeMaxLongitude)
+      {
+        continue;
+      }
+
+      const Cell::DggsCellId cellId = GetCellId(
+          a_projection, a_grid, a_gridIndexer, converter, latitude, longitude, a_resolution);
+      EXPECT_EQ(1U, cellIds.count(cellId)) << latitude << ", " << longitude;
+    }
+  }
+
+  // The cells containing the centre of the hole and a point well outside the polygon are excluded
+  EXPECT_EQ(
+      0U,
+      cellIds.count(
+          GetCellId(
+              a_projection,
+              a_grid,
+              a_gridIndexer,
+              converter,
+              (a_holeMinLatitude + a_holeMaxLatitude) / 2.0,
+              (a_holeMinLongitude + a_holeMaxLongitude) / 2.0,
+              a_resolution)));
+  EXPECT_EQ(
+      0U,
+      cellIds.count(
+          GetCellId(
+              a_projection,
+              a_grid,
+              a_gridIndexer,
+              converter,
+              a_minLatitude - 10.0,
+              a_minLongitude - 10.0,
+              a_resolution)));
+}
+
+UNIT_TEST(Polyfill, ISEA4T)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid triangleGrid;
+  GridIndexer::HierarchicalGridIndexer gridIndexer(&triangleGrid, icosahedron.GetNoOfFaces() - 1U);
+
+  // A large polygon with a hole
+  CheckPolyfill(
+      projection,
+      triangleGrid,
+      gridIndexer,
+      6U,
+      -20.0, 20.0, 20.0, 60.0,
+      -5.0, 35.0, 5.0, 45.0);
+
+  // Near the north pole
+  CheckPolyfill(
+      projection,
+      triangleGrid,
+      gridIndexer,
+      5U,
+      -40.0, 70.0, 40.0, 88.0,
+      -10.0, 76.0, 10.0, 82.0);
+}
+
+UNIT_TEST(Polyfill, ISEA3H)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::OffsetGrid::Aperture3HexagonGrid hexagonGrid;
+  GridIndexer::OffsetGridIndexer gridIndexer(&hexagonGrid, icosahedron.GetNoOfFaces() - 1U);
+
+  // A large polygon with a hole
+  CheckPolyfill(
+      projection,
+      hexagonGrid,
+      gridIndexer,
+      8U,
+      -20.0, 20.0, 20.0, 60.0,
+      -5.0, 35.0, 5.0, 45.0);
+
+  // Near the north pole
+  CheckPolyfill(
+      projection,
+      hexagonGrid,
+      gridIndexer,
+      7U,
+      -40.0, 70.0, 40.0, 88.0,
+      -10.0, 76.0, 10.0, 82.0);
+}
+
+UNIT_TEST(Polyfill, ResolutionZero)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid triangleGrid;
+  GridIndexer::HierarchicalGridIndexer gridIndexer(&triangleGrid, icosahedron.GetNoOfFaces() - 1U);
+  const CoordinateConverter converter;
+  const Polyfill polyfill(&gridIndexer, &projection, &converter, icosahedron.GetNoOfFaces());
+
+  // A small polygon inside a single face
+  Wgs84Polygon polygon;
+  AddRectangleToOuterRing(polygon, 1.0, 51.0, 2.0, 52.0);
+
+  std::vector<std::unique_ptr<Cell::ICell> > cells;
+  polyfill.GetCells(polygon, 0U, cells);
+
+  ASSERT_EQ(1U, cells.size());
+  EXPECT_EQ(
+      GetCellId(projection, triangleGrid, gridIndexer, converter, 51.5, 1.5, 0U),
+      cells[0]->GetCellId());
+}
+
+UNIT_TEST(Polyfill, InvalidPolygon)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid triangleGrid;
+  GridIndexer::HierarchicalGridIndexer gridIndexer(&triangleGrid, icosahedron.GetNoOfFaces() - 1U);
+  const CoordinateConverter converter;
+  const Polyfill polyfill(&gridIndexer, &projection, &converter, icosahedron.GetNoOfFaces());
+
+  Wgs84Polygon polygon;
+  polygon.AddAccuracyPointToOuterRing(51.0, 1.0, 0.0);
+  polygon.AddAccuracyPointToOuterRing(52.0, 2.0, 0.0);
+
+  std::vector<std::unique_ptr<Cell::ICell> > cells;
+  EXPECT_THROW(polyfill.GetCells(polygon, 3U, cells), EAGGR::EAGGRException);
+}
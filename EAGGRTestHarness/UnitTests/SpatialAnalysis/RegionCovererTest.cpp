@@ -0,0 +1,443 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2016
+//------------------------------------------------------
+//
+// system: EAGGRTestHarness
+//
+// subsystem: Unit Tests
+//
+//------------------------------------------------------
+/// @file RegionCovererTest.cpp
+///
+/// Tests for the EAGGR::SpatialAnalysis::RegionCoverer class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <cmath>
+#include <list>
+#include <set>
+
+#include "TestMacros.hpp"
+
+#include "Src/SpatialAnalysis/RegionCoverer.hpp"
+#include "Src/SpatialAnalysis/Polyfill.hpp"
+#include "Src/Model/IPolyhedralGlobe/Icosahedron.hpp"
+#include "Src/Model/IProjection/Snyder.hpp"
+#include "Src/Model/IGrid/IHierarchicalGrid/Aperture4TriangleGrid.hpp"
+#include "Src/Model/IGrid/IOffsetGrid/Aperture3HexagonGrid.hpp"
+#include "Src/Model/IGridIndexer/HierarchicalGridIndexer.hpp"
+#include "Src/Model/IGridIndexer/OffsetGridIndexer.hpp"
+#include "Src/EAGGRException.hpp"
+
+using namespace EAGGR::Model;
+using namespace EAGGR::SpatialAnalysis;
+using EAGGR::CoordinateConversion::CoordinateConverter;
+using EAGGR::LatLong::Wgs84AccuracyPoint;
+using EAGGR::LatLong::Wgs84Linestring;
+using EAGGR::LatLong::Wgs84Polygon;
+
+static const double MIN_LATITUDE = 20.0;
+static const double MIN_LONGITUDE = -20.0;
+static const double MAX_LATITUDE = 50.0;
+static const double MAX_LONGITUDE = 10.0;
+
+static void CreateRectangle(Wgs84Polygon & a_polygon)
+{
+  a_polygon.AddAccuracyPointToOuterRing(MIN_LATITUDE, MIN_LONGITUDE, 0.0);
+  a_polygon.AddAccuracyPointToOuterRing(MAX_LATITUDE, MIN_LONGITUDE, 0.0);
+  a_polygon.AddAccuracyPointToOuterRing(MAX_LATITUDE, MAX_LONGITUDE, 0.0);
+  a_polygon.AddAccuracyPointToOuterRing(MIN_LATITUDE, MAX_LONGITUDE, 0.0);
+  a_polygon.AddAccuracyPointToOuterRing(MIN_LATITUDE, MIN_LONGITUDE, 0.0);
+}
+
+// Gets the id of the cell at the requested resolution that contains a WGS84 point
+static Cell::DggsCellId GetCellId(
+    const Projection::IProjection & a_projection,
+    const Grid::IGrid & a_grid,
+    const GridIndexer::IGridIndexer & a_gridIndexer,
+    const CoordinateConverter & a_converter,
+    const double a_latitude,
+    const double a_longitude,
+    const unsigned short a_resolution)
+{
+  const FaceCoordinate faceCoordinate = a_projection.GetFaceCoordinate(
+      a_converter.ConvertWGS84ToSphere(Wgs84AccuracyPoint(a_latitude, a_longitude, 0.0)));
+
+  return a_gridIndexer.GetCell(
+      FaceCoordinate(
+          faceCoordinate.GetFaceIndex(),
+          faceCoordinate.GetXOffset(),
+          faceCoordinate.GetYOffset(),
+          a_grid.GetAccuracyFromResolution(a_resolution)))->GetCellId();
+}
+
+// Checks that the cells are unique, within the resolution range and do not exceed the budget
+static std::set<Cell::DggsCellId> CheckCells(
+    const std::vector<std::unique_ptr<Cell::ICell> >& a_cells,
+    const unsigned short a_minResolution,
+    const unsigned short a_maxResolution,
+    const unsigned int a_maxCells)
+{
+  EXPECT_LE(a_cells.size(), a_maxCells);
+
+  std::set<Cell::DggsCellId> cellIds;
+  for (std::vector<std::unique_ptr<Cell::ICell> >::const_iterator cell = a_cells.begin();
+      cell != a_cells.end(); ++cell)
+  {
+    EXPECT_LE(a_minResolution, (*cell)->GetResolution());
+    EXPECT_GE(a_maxResolution, (*cell)->GetResolution());
+    EXPECT_TRUE(cellIds.insert((*cell)->GetCellId()).second) << (*cell)->GetCellId();
+  }
+
+  return cellIds;
+}
+
+// Checks that a point is inside one of the cells
+static void CheckPointIsCovered(
+    const Projection::IProjection & a_projection,
+    const Grid::IGrid & a_grid,
+    const GridIndexer::IGridIndexer & a_gridIndexer,
+    const std::set<Cell::DggsCellId> & a_cellIds,
+    const unsigned short a_minResolution,
+    const unsigned short a_maxResolution,
+    const double a_latitude,
+    const double a_longitude)
+{
+  const CoordinateConverter converter;
+  for (unsigned short resolution = a_minResolution; resolution <= a_maxResolution; ++resolution)
+  {
+    if (a_cellIds.count(
+        GetCellId(
+            a_projection,
+            a_grid,
+            a_gridIndexer,
+            converter,
+            a_latitude,
+            a_longitude,
+            resolution)) != 0U)
+    {
+      return;
+    }
+  }
+
+  ADD_FAILURE() << a_latitude << ", " << a_longitude << " is not covered";
+}
+
+// Checks the exterior and interior coverings of the rectangle
+static void CheckRectangleCoverings(
+    const Projection::IProjection & a_projection,
+    const Grid::IGrid & a_grid,
+    const GridIndexer::IGridIndexer & a_gridIndexer,
+    const unsigned short a_minResolution,
+    const unsigned short a_maxResolution,
+    const unsigned int a_maxCells)
+{
+  const CoordinateConverter converter;
+  const RegionCoverer coverer(
+      &a_gridIndexer,
+      &a_projection,
+      &converter,
+      20U,
+      a_minResolution,
+      a_maxResolution,
+      a_maxCells);
+
+  Wgs84Polygon polygon;
+  CreateRectangle(polygon);
+
+  // Every point in the rectangle is inside a cell of the exterior covering
+  std::vector<std::unique_ptr<Cell::ICell> > exteriorCells;
+  coverer.GetCovering(polygon, EXTERIOR_COVERING, exteriorCells);
+  const std::set<Cell::DggsCellId> exteriorCellIds = CheckCells(
+      exteriorCells,
+      a_minResolution,
+      a_maxResolution,
+      a_maxCells);
+
+  const double step = (MAX_LATITUDE - MIN_LATITUDE) / 32.0;
+  for (double latitude = MIN_LATITUDE + step / 2.0; latitude < MAX_LATITUDE; latitude += step)
+  {
+    for (double longitude = MIN_LONGITUDE + step / 2.0; longitude < MAX_LONGITUDE;
+        longitude += step)
+    {
+      CheckPointIsCovered(
+          a_projection,
+          a_grid,
+          a_gridIndexer,
+          exteriorCellIds,
+          a_minResolution,
+          a_maxResolution,
+          latitude,
+          longitude);
+    }
+  }
+
+  // The same covering is found for the rectangle as a bounding box
+  std::vector<std::unique_ptr<Cell::ICell> > boxCells;
+  coverer.GetCovering(
+      MIN_LATITUDE,
+      MIN_LONGITUDE,
+      MAX_LATITUDE,
+      MAX_LONGITUDE,
+      EXTERIOR_COVERING,
+      boxCells);
+  EXPECT_EQ(
+      exteriorCellIds,
+      CheckCells(boxCells, a_minResolution, a_maxResolution, a_maxCells));
+
+  // Every vertex of a cell in the interior covering is inside the rectangle
+  std::vector<std::unique_ptr<Cell::ICell> > interiorCells;
+  coverer.GetCovering(polygon, INTERIOR_COVERING, interiorCells);
+  static_cast<void>(CheckCells(interiorCells, a_minResolution, a_maxResolution, a_maxCells));
+  EXPECT_FALSE(interiorCells.empty());
+
+  for (std::vector<std::unique_ptr<Cell::ICell> >::const_iterator cell = interiorCells.begin();
+      cell != interiorCells.end(); ++cell)
+  {
+    std::list<FaceCoordinate> vertices;
+    a_gridIndexer.GetCellVertices(**cell, vertices);
+    for (std::list<FaceCoordinate>::const_iterator vertex = vertices.begin();
+        vertex != vertices.end(); ++vertex)
+    {
+      const Wgs84AccuracyPoint point = converter.ConvertSphereToWGS84(
+          a_projection.GetLatLongPoint(*vertex));
+      EXPECT_LE(MIN_LATITUDE - 1E-9, point.GetLatitude()) << (*cell)->GetCellId();
+      EXPECT_GE(MAX_LATITUDE + 1E-9, point.GetLatitude()) << (*cell)->GetCellId();
+      EXPECT_LE(MIN_LONGITUDE - 1E-9, point.GetLongitude()) << (*cell)->GetCellId();
+      EXPECT_GE(MAX_LONGITUDE + 1E-9, point.GetLongitude()) << (*cell)->GetCellId();
+    }
+  }
+}
+
+UNIT_TEST(RegionCoverer, ISEA4T)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid triangleGrid;
+  GridIndexer::HierarchicalGridIndexer gridIndexer(&triangleGrid, icosahedron.GetNoOfFaces() - 1U);
+
+  CheckRectangleCoverings(projection, triangleGrid, gridIndexer, 0U, 8U, 50U);
+  CheckRectangleCoverings(projection, triangleGrid, gridIndexer, 2U, 6U, 200U);
+}
+
+UNIT_TEST(RegionCoverer, ISEA3H)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::OffsetGrid::Aperture3HexagonGrid hexagonGrid;
+  GridIndexer::OffsetGridIndexer gridIndexer(&hexagonGrid, icosahedron.GetNoOfFaces() - 1U);
+
+  CheckRectangleCoverings(projection, hexagonGrid, gridIndexer, 0U, 10U, 50U);
+  CheckRectangleCoverings(projection, hexagonGrid, gridIndexer, 3U, 8U, 200U);
+}
+
+UNIT_TEST(RegionCoverer, SingleResolution)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid triangleGrid;
+  GridIndexer::HierarchicalGridIndexer gridIndexer(&triangleGrid, icosahedron.GetNoOfFaces() - 1U);
+  const CoordinateConverter converter;
+
+  Wgs84Polygon polygon;
+  CreateRectangle(polygon);
+
+  // With a large enough budget the exterior covering at one resolution is the polyfill
+  const RegionCoverer coverer(
+      &gridIndexer,
+      &projection,
+      &converter,
+      icosahedron.GetNoOfFaces(),
+      5U,
+      5U,
+      100000U);
+  std::vector<std::unique_ptr<Cell::ICell> > coveringCells;
+  coverer.GetCovering(polygon, EXTERIOR_COVERING, coveringCells);
+
+  const Polyfill polyfill(&gridIndexer, &projection, &converter, icosahedron.GetNoOfFaces());
+  std::vector<std::unique_ptr<Cell::ICell> > polyfillCells;
+  polyfill.GetCells(polygon, 5U, polyfillCells);
+
+  EXPECT_EQ(
+      CheckCells(polyfillCells, 5U, 5U, 100000U),
+      CheckCells(coveringCells, 5U, 5U, 100000U));
+
+  // The minimum resolution takes priority over the budget
+  const RegionCoverer smallBudgetCoverer(
+      &gridIndexer,
+      &projection,
+      &converter,
+      icosahedron.GetNoOfFaces(),
+      5U,
+      5U,
+      1U);
+  std::vector<std::unique_ptr<Cell::ICell> > smallBudgetCells;
+  smallBudgetCoverer.GetCovering(polygon, EXTERIOR_COVERING, smallBudgetCells);
+  EXPECT_EQ(coveringCells.size(), smallBudgetCells.size());
+}
+
+UNIT_TEST(RegionCoverer, Linestring)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::OffsetGrid::Aperture3HexagonGrid hexagonGrid;
+  GridIndexer::OffsetGridIndexer gridIndexer(&hexagonGrid, icosahedron.GetNoOfFaces() - 1U);
+  const CoordinateConverter converter;
+  const RegionCoverer coverer(
+      &gridIndexer,
+      &projection,
+      &converter,
+      icosahedron.GetNoOfFaces(),
+      2U,
+      9U,
+      30U);
+
+  Wgs84Linestring linestring;
+  linestring.AddAccuracyPoint(51.0, -3.0, 0.0);
+  linestring.AddAccuracyPoint(52.0, 1.0, 0.0);
+  linestring.AddAccuracyPoint(55.0, 2.0, 0.0);
+
+  std::vector<std::unique_ptr<Cell::ICell> > cells;
+  coverer.GetCovering(linestring, EXTERIOR_COVERING, cells);
+  const std::set<Cell::DggsCellId> cellIds = CheckCells(cells, 2U, 9U, 30U);
+
+  for (double fraction = 0.0; fraction <= 1.0; fraction += 0.125)
+  {
+    CheckPointIsCovered(
+        projection,
+        hexagonGrid,
+        gridIndexer,
+        cellIds,
+        2U,
+        9U,
+        51.0 + fraction,
+        -3.0 + 4.0 * fraction);
+    CheckPointIsCovered(
+        projection,
+        hexagonGrid,
+        gridIndexer,
+        cellIds,
+        2U,
+        9U,
+        52.0 + 3.0 * fraction,
+        1.0 + fraction);
+  }
+
+  // No cell is inside a line
+  cells.clear();
+  coverer.GetCovering(linestring, INTERIOR_COVERING, cells);
+  EXPECT_TRUE(cells.empty());
+}
+
+UNIT_TEST(RegionCoverer, Antimeridian)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid triangleGrid;
+  GridIndexer::HierarchicalGridIndexer gridIndexer(&triangleGrid, icosahedron.GetNoOfFaces() - 1U);
+  const CoordinateConverter converter;
+  const RegionCoverer coverer(
+      &gridIndexer,
+      &projection,
+      &converter,
+      icosahedron.GetNoOfFaces(),
+      2U,
+      8U,
+      100U);
+
+  // The box from 170 degrees east to 170 degrees west crosses the antimeridian
+  std::vector<std::unique_ptr<Cell::ICell> > exteriorCells;
+  coverer.GetCovering(-10.0, 170.0, 10.0, -170.0, EXTERIOR_COVERING, exteriorCells);
+  const std::set<Cell::DggsCellId> exteriorCellIds = CheckCells(exteriorCells, 2U, 8U, 100U);
+
+  for (double latitude = -9.5; latitude < 10.0; latitude += 1.0)
+  {
+    for (double longitude = 170.5; longitude < 190.0; longitude += 1.0)
+    {
+      CheckPointIsCovered(
+          projection,
+          triangleGrid,
+          gridIndexer,
+          exteriorCellIds,
+          2U,
+          8U,
+          latitude,
+          longitude > 180.0 ? longitude - 360.0 : longitude);
+    }
+  }
+
+  // The interior covering has cells on both sides of the antimeridian and none outside the box
+  std::vector<std::unique_ptr<Cell::ICell> > interiorCells;
+  coverer.GetCovering(-10.0, 170.0, 10.0, -170.0, INTERIOR_COVERING, interiorCells);
+  static_cast<void>(CheckCells(interiorCells, 2U, 8U, 100U));
+
+  bool isEastCovered = false;
+  bool isWestCovered = false;
+  for (std::vector<std::unique_ptr<Cell::ICell> >::const_iterator cell = interiorCells.begin();
+      cell != interiorCells.end(); ++cell)
+  {
+    std::list<FaceCoordinate> vertices;
+    gridIndexer.GetCellVertices(**cell, vertices);
+    for (std::list<FaceCoordinate>::const_iterator vertex = vertices.begin();
+        vertex != vertices.end(); ++vertex)
+    {
+      const Wgs84AccuracyPoint point = converter.ConvertSphereToWGS84(
+          projection.GetLatLongPoint(*vertex));
+      EXPECT_LE(-10.0 - 1E-9, point.GetLatitude()) << (*cell)->GetCellId();
+      EXPECT_GE(10.0 + 1E-9, point.GetLatitude()) << (*cell)->GetCellId();
+      EXPECT_LE(170.0 - 1E-9, fabs(point.GetLongitude())) << (*cell)->GetCellId();
+      isEastCovered = isEastCovered || point.GetLongitude() > 0.0;
+      isWestCovered = isWestCovered || point.GetLongitude() < 0.0;
+    }
+  }
+  EXPECT_TRUE(isEastCovered);
+  EXPECT_TRUE(isWestCovered);
+}
+
+UNIT_TEST(RegionCoverer, InvalidParameters)
+{
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+  Grid::HierarchicalGrid::Aperture4TriangleGrid triangleGrid;
+  GridIndexer::HierarchicalGridIndexer gridIndexer(&triangleGrid, icosahedron.GetNoOfFaces() - 1U);
+  const CoordinateConverter converter;
+
+  EXPECT_THROW(
+      RegionCoverer(&gridIndexer, &projection, &converter, icosahedron.GetNoOfFaces(), 5U, 4U, 10U),
+      EAGGR::EAGGRException);
+  EXPECT_THROW(
+      RegionCoverer(&gridIndexer, &projection, &converter, icosahedron.GetNoOfFaces(), 1U, 4U, 0U),
+      EAGGR::EAGGRException);
+
+  const RegionCoverer coverer(
+      &gridIndexer,
+      &projection,
+      &converter,
+      icosahedron.GetNoOfFaces(),
+      1U,
+      4U,
+      10U);
+  std::vector<std::unique_ptr<Cell::ICell> > cells;
+
+  Wgs84Linestring linestring;
+  linestring.AddAccuracyPoint(51.0, 1.0, 0.0);
+  EXPECT_THROW(coverer.GetCovering(linestring, EXTERIOR_COVERING, cells), EAGGR::EAGGRException);
+
+  EXPECT_THROW(
+      coverer.GetCovering(52.0, 1.0, 51.0, 2.0, EXTERIOR_COVERING, cells),
+      EAGGR::EAGGRException);
+}
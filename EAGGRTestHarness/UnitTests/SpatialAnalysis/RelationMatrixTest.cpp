@@ -0,0 +1,119 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGRTestHarness
+//
+// subsystem: Unit Tests
+//
+//------------------------------------------------------
+/// @file RelationMatrixTest.cpp
+///
+/// Tests for the EAGGR::SpatialAnalysis::RelationMatrix class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include "TestMacros.hpp"
+
+#include "Src/SpatialAnalysis/RelationMatrix.hpp"
+#include "Src/EAGGRException.hpp"
+
+using namespace EAGGR;
+using namespace EAGGR::SpatialAnalysis;
+
+UNIT_TEST(RelationMatrix, Constructor)
+{
+  const RelationMatrix relationMatrix("212101212");
+  EXPECT_EQ("212101212", relationMatrix.GetMatrix());
+
+  // Matrices must have nine entries, each a dimension or 'F'
+  EXPECT_THROW(RelationMatrix(""), EAGGRException);
+  EXPECT_THROW(RelationMatrix("21210121"), EAGGRException);
+  EXPECT_THROW(RelationMatrix("2121012122"), EAGGRException);
+  EXPECT_THROW(RelationMatrix("T12101212"), EAGGRException);
+  EXPECT_THROW(RelationMatrix("*12101212"), EAGGRException);
+  EXPECT_THROW(RelationMatrix("312101212"), EAGGRException);
+}
+
+UNIT_TEST(RelationMatrix, MatchesPattern)
+{
+  const RelationMatrix relationMatrix("1F20F1102");
+
+  EXPECT_TRUE(relationMatrix.Matches("*********"));
+  EXPECT_TRUE(relationMatrix.Matches("1F20F1102"));
+  EXPECT_TRUE(relationMatrix.Matches("TFTTFTTTT"));
+  EXPECT_TRUE(relationMatrix.Matches("T*T***T**"));
+  EXPECT_FALSE(relationMatrix.Matches("F********"));
+  EXPECT_FALSE(relationMatrix.Matches("*T*******"));
+  EXPECT_FALSE(relationMatrix.Matches("2********"));
+  EXPECT_FALSE(relationMatrix.Matches("********1"));
+
+  EXPECT_THROW(relationMatrix.Matches("********"), EAGGRException);
+  EXPECT_THROW(relationMatrix.Matches("********X"), EAGGRException);
+}
+
+UNIT_TEST(RelationMatrix, MatchesAnalysisType)
+{
+  // Each matrix is that of two geometries with a known relation. The expected results are in the
+  // order of the analysis types.
+  const AnalysisType analysisTypes[] =
+  {
+    CONTAINS, COVERED_BY, COVERS, CROSSES, DISJOINT, EQUALS, INTERSECTS, OVERLAPS, TOUCHES, WITHIN
+  };
+
+  const struct
+  {
+    const char * m_matrix;
+    bool m_expected[10];
+  } testCases[] =
+  {
+    // Equal polygons
+    { "2FFF1FFF2", { true, true, true, false, false, true, true, false, false, true } },
+    // Polygon containing a polygon that shares part of its boundary
+    { "212F11FF2", { true, false, true, false, false, false, true, false, false, false } },
+    // Polygon inside a polygon, away from its boundary
+    { "2FF1FF212", { false, true, false, false, false, false, true, false, false, true } },
+    // Overlapping polygons
+    { "212101212", { false, false, false, false, false, false, true, true, false, false } },
+    // Polygons sharing an edge
+    { "FF2F11212", { false, false, false, false, false, false, true, false, true, false } },
+    // Disjoint polygons
+    { "FF2FF1212", { false, false, false, false, true, false, false, false, false, false } },
+    // Linestring crossing a polygon
+    { "101FF0212", { false, false, false, true, false, false, true, false, false, false } },
+    // Polygon crossed by a linestring
+    { "1F20F1102", { false, false, false, true, false, false, true, false, false, false } },
+    // Linestring lying along the boundary of a polygon
+    { "F1FF0F212", { false, true, false, false, false, false, true, false, true, false } },
+    // Linestrings crossing at a point
+    { "0F1FF0102", { false, false, false, true, false, false, true, false, false, false } },
+    // Overlapping linestrings
+    { "1010F0102", { false, false, false, false, false, false, true, true, false, false } },
+    // Linestrings meeting at their ends
+    { "FF1F00102", { false, false, false, false, false, false, true, false, true, false } }
+  };
+
+  for (const auto & testCase : testCases)
+  {
+    const RelationMatrix relationMatrix(testCase.m_matrix);
+    for (unsigned int index = 0U; index < 10U; ++index)
+    {
+      EXPECT_EQ(testCase.m_expected[index], relationMatrix.Matches(analysisTypes[index]))
+          << "Matrix " << testCase.m_matrix << ", analysis type " << analysisTypes[index];
+    }
+  }
+}
@@ -12618,3 +12618,119 @@ UNIT_TEST(SpatialAnalysis, AnalyseOverlaps)
           testDataTriangleMultiFace.emptyInnerRings,
           AnalysisType::OVERLAPS));
 }
+
+UNIT_TEST(SpatialAnalysis, RelateMatchesAnalyse)
+{
+  HierarchicalGrid::Aperture4TriangleGrid grid;
+
+  HierarchicalGridIndexer indexer(&grid, MAX_FACE_INDEX);
+  Icosahedron icosahedron;
+  Snyder projection(&icosahedron);
+
+  TestDataTriangle testData(indexer);
+  TestDataTriangleMultiFace testDataMultiFace(indexer);
+
+  typedef std::vector<std::unique_ptr<ICell> > Ring;
+  typedef std::vector<Ring> Rings;
+
+  const std::vector<const Ring *> linestrings =
+  {
+    &testData.linestring,
+    &testData.touchingCellVertexLinestring,
+    &testData.linestringWithinCell,
+    &testData.linestringCrossesCell,
+    &testData.linestringTouchesCellVertex,
+    &testData.subLinestring,
+    &testData.coversLinestring,
+    &testData.endTouchLinestring,
+    &testData.partialOverlapLinestring,
+    &testData.disjointLinestring,
+    &testData.withInnerRingsOuterBoundaryLinestring,
+    &testData.noInnerRingsExteriorToInteriorViaOuterLinestring,
+    &testDataMultiFace.multiFaceLinestring,
+    &testDataMultiFace.multiFaceSubstring
+  };
+
+  const std::vector<std::pair<const Ring *, const Rings *> > polygons =
+  {
+    std::make_pair(&testData.outerLinestring, &testData.innerRings),
+    std::make_pair(&testData.outerLinestring, &testData.emptyInnerRings),
+    std::make_pair(
+        &testData.polygonCoversCellWithInnerRingOuterLinestring,
+        &testData.polygonCoversCellWithInnerInnerRings),
+    std::make_pair(&testData.polygonWithinCellNoInnerRingOuterLinestring, &testData.emptyInnerRings),
+    std::make_pair(&testData.polygonDisjointFromCellOuterLinestring, &testData.emptyInnerRings),
+    std::make_pair(
+        &testData.polygonNoInnerRingsInteriorOverlapOuterLinestring,
+        &testData.emptyInnerRings),
+    std::make_pair(
+        &testDataMultiFace.multiFaceOuterLinestring,
+        &testDataMultiFace.emptyInnerRings),
+    std::make_pair(
+        &testDataMultiFace.multiFaceCoveredByPolygonOuterLinestring,
+        &testDataMultiFace.emptyInnerRings)
+  };
+
+  const char * const cellIds[] = { "00", "0000", "0001", "0003", "0012", "01", "0111" };
+
+  std::vector<std::unique_ptr<SpatialAnalysis> > baseShapes;
+  for (const Ring * linestring : linestrings)
+  {
+    baseShapes.emplace_back(new SpatialAnalysis(*linestring, &indexer, &projection));
+  }
+  for (const std::pair<const Ring *, const Rings *> & polygon : polygons)
+  {
+    baseShapes.emplace_back(
+        new SpatialAnalysis(*polygon.first, *polygon.second, &indexer, &projection));
+  }
+  for (const char * cellId : cellIds)
+  {
+    baseShapes.emplace_back(new SpatialAnalysis(indexer.CreateCell(cellId), &indexer, &projection));
+  }
+
+  const AnalysisType analysisTypes[] =
+  {
+    CONTAINS, COVERED_BY, COVERS, CROSSES, DISJOINT, EQUALS, INTERSECTS, OVERLAPS, TOUCHES, WITHIN
+  };
+
+  // Every predicate found from the relation matrix must match the result of comparing the shapes
+  for (const std::unique_ptr<SpatialAnalysis> & baseShape : baseShapes)
+  {
+    for (const Ring * linestring : linestrings)
+    {
+      const RelationMatrix relationMatrix = baseShape->Relate(*linestring);
+      for (const AnalysisType analysisType : analysisTypes)
+      {
+        EXPECT_EQ(baseShape->Analyse(*linestring, analysisType), relationMatrix.Matches(analysisType))
+            << "Linestring, analysis type " << analysisType << ", matrix "
+            << relationMatrix.GetMatrix();
+      }
+    }
+
+    for (const std::pair<const Ring *, const Rings *> & polygon : polygons)
+    {
+      const RelationMatrix relationMatrix = baseShape->Relate(*polygon.first, *polygon.second);
+      for (const AnalysisType analysisType : analysisTypes)
+      {
+        EXPECT_EQ(
+            baseShape->Analyse(*polygon.first, *polygon.second, analysisType),
+            relationMatrix.Matches(analysisType))
+            << "Polygon, analysis type " << analysisType << ", matrix "
+            << relationMatrix.GetMatrix();
+      }
+    }
+
+    for (const char * cellId : cellIds)
+    {
+      const RelationMatrix relationMatrix = baseShape->Relate(indexer.CreateCell(cellId));
+      for (const AnalysisType analysisType : analysisTypes)
+      {
+        EXPECT_EQ(
+            baseShape->Analyse(indexer.CreateCell(cellId), analysisType),
+            relationMatrix.Matches(analysisType))
+            << "Cell " << cellId << ", analysis type " << analysisType << ", matrix "
+            << relationMatrix.GetMatrix();
+      }
+    }
+  }
+}
@@ -0,0 +1,248 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGRTestHarness
+//
+// subsystem: Unit Tests
+//
+//------------------------------------------------------
+/// @file SpatialJoinTest.cpp
+///
+/// Tests for the EAGGR::SpatialAnalysis::SpatialJoin class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <algorithm>
+#include <string>
+
+#include "TestMacros.hpp"
+
+#include "Src/SpatialAnalysis/SpatialJoin.hpp"
+#include "Src/Model/IGridIndexer/HierarchicalGridIndexer.hpp"
+#include "Src/Model/IGrid/IHierarchicalGrid/Aperture4TriangleGrid.hpp"
+#include "Src/Model/IProjection/Snyder.hpp"
+#include "Src/Model/IPolyhedralGlobe/Icosahedron.hpp"
+
+using namespace EAGGR::Model;
+using namespace EAGGR::Model::Cell;
+using namespace EAGGR::SpatialAnalysis;
+
+static const unsigned short MAX_FACE_INDEX = 19U;
+
+/// A shape described by the ids of its cells.
+struct TestShape
+{
+  enum ShapeType
+  {
+    CELL, LINESTRING, POLYGON
+  };
+
+  ShapeType m_type;
+  std::vector<std::string> m_cellIds;
+};
+
+static std::vector<std::unique_ptr<ICell> > CreateCells(
+    const GridIndexer::IGridIndexer & a_indexer,
+    const std::vector<std::string> & a_cellIds)
+{
+  std::vector<std::unique_ptr<ICell> > cells;
+  for (const std::string & cellId : a_cellIds)
+  {
+    cells.push_back(a_indexer.CreateCell(cellId));
+  }
+  return cells;
+}
+
+static SpatialAnalysis * CreateAnalysis(
+    const TestShape & a_shape,
+    const GridIndexer::IGridIndexer & a_indexer,
+    const Projection::IProjection & a_projection)
+{
+  const std::vector<std::vector<std::unique_ptr<ICell> > > noInnerRings;
+  switch (a_shape.m_type)
+  {
+    case TestShape::CELL:
+      return new SpatialAnalysis(
+          a_indexer.CreateCell(a_shape.m_cellIds.front()),
+          &a_indexer,
+          &a_projection);
+    case TestShape::LINESTRING:
+      return new SpatialAnalysis(
+          CreateCells(a_indexer, a_shape.m_cellIds),
+          &a_indexer,
+          &a_projection);
+    default:
+      return new SpatialAnalysis(
+          CreateCells(a_indexer, a_shape.m_cellIds),
+          noInnerRings,
+          &a_indexer,
+          &a_projection);
+  }
+}
+
+/// Compares a shape with a base shape without using the join.
+static bool Analyse(
+    const SpatialAnalysis & a_baseShape,
+    const TestShape & a_shape,
+    const GridIndexer::IGridIndexer & a_indexer,
+    const AnalysisType a_analysisType)
+{
+  const std::vector<std::vector<std::unique_ptr<ICell> > > noInnerRings;
+  switch (a_shape.m_type)
+  {
+    case TestShape::CELL:
+      return a_baseShape.Analyse(a_indexer.CreateCell(a_shape.m_cellIds.front()), a_analysisType);
+    case TestShape::LINESTRING:
+      return a_baseShape.Analyse(CreateCells(a_indexer, a_shape.m_cellIds), a_analysisType);
+    default:
+      return a_baseShape.Analyse(
+          CreateCells(a_indexer, a_shape.m_cellIds),
+          noInnerRings,
+          a_analysisType);
+  }
+}
+
+UNIT_TEST(SpatialJoin, FindPairs)
+{
+  Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
+  GridIndexer::HierarchicalGridIndexer indexer(&grid, MAX_FACE_INDEX);
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+
+  // Base shapes are the cells at resolution 2 on two neighbouring faces and shapes across them
+  std::vector<TestShape> baseTestShapes;
+  for (const std::string face : { "00", "01" })
+  {
+    for (const char firstChild : { '0', '1', '2', '3' })
+    {
+      for (const char secondChild : { '0', '1', '2', '3' })
+      {
+        baseTestShapes.push_back({ TestShape::CELL, { face + firstChild + secondChild } });
+      }
+    }
+  }
+  baseTestShapes.push_back({ TestShape::LINESTRING, { "0022", "0033", "0122", "0133" } });
+  baseTestShapes.push_back(
+      { TestShape::POLYGON, { "00111", "01111", "01313", "01212", "00313", "00212" } });
+
+  // Comparison shapes are coarser cells on the same faces and others, and shapes on one face and
+  // across faces
+  std::vector<TestShape> comparisonTestShapes;
+  for (const std::string face : { "00", "01", "02", "05" })
+  {
+    for (const char child : { '0', '1', '2', '3' })
+    {
+      comparisonTestShapes.push_back({ TestShape::CELL, { face + child } });
+    }
+  }
+  comparisonTestShapes.push_back({ TestShape::CELL, { "0011" } });
+  comparisonTestShapes.push_back({ TestShape::CELL, { "01230" } });
+  comparisonTestShapes.push_back({ TestShape::LINESTRING, { "0001", "0002", "0003" } });
+  comparisonTestShapes.push_back({ TestShape::LINESTRING, { "0003", "0012" } });
+  comparisonTestShapes.push_back({ TestShape::LINESTRING, { "0022", "0033", "0122", "0133" } });
+  comparisonTestShapes.push_back({ TestShape::POLYGON, { "00111", "00022", "00011", "00333" } });
+  comparisonTestShapes.push_back({ TestShape::POLYGON, { "0000", "0010", "0110", "0100" } });
+
+  std::vector<std::unique_ptr<SpatialAnalysis> > baseShapes;
+  std::vector<const SpatialAnalysis *> baseAnalyses;
+  for (const TestShape & shape : baseTestShapes)
+  {
+    baseShapes.emplace_back(CreateAnalysis(shape, indexer, projection));
+    baseAnalyses.push_back(baseShapes.back().get());
+  }
+
+  std::vector<std::unique_ptr<SpatialAnalysis> > comparisonShapes;
+  std::vector<const SpatialAnalysis *> comparisonAnalyses;
+  for (const TestShape & shape : comparisonTestShapes)
+  {
+    comparisonShapes.emplace_back(CreateAnalysis(shape, indexer, projection));
+    comparisonAnalyses.push_back(comparisonShapes.back().get());
+  }
+
+  const AnalysisType analysisTypes[] =
+  {
+    CONTAINS, COVERED_BY, COVERS, CROSSES, DISJOINT, EQUALS, INTERSECTS, OVERLAPS, TOUCHES, WITHIN
+  };
+
+  const EAGGR::Utilities::WorkStealingPool pool(4U);
+  const SpatialJoin spatialJoin(baseAnalyses, comparisonAnalyses, pool);
+
+  // The join must find the same pairs as comparing every pair of shapes
+  for (const AnalysisType analysisType : analysisTypes)
+  {
+    std::vector<SpatialJoin::ShapePair> expectedPairs;
+    for (std::size_t baseIndex = 0U; baseIndex < baseTestShapes.size(); ++baseIndex)
+    {
+      for (std::size_t comparisonIndex = 0U; comparisonIndex < comparisonTestShapes.size();
+          ++comparisonIndex)
+      {
+        if (Analyse(
+            *baseShapes[baseIndex],
+            comparisonTestShapes[comparisonIndex],
+            indexer,
+            analysisType))
+        {
+          expectedPairs.push_back(SpatialJoin::ShapePair(baseIndex, comparisonIndex));
+        }
+      }
+    }
+
+    std::vector<SpatialJoin::ShapePair> pairs;
+    spatialJoin.FindPairs(analysisType, pairs);
+    EXPECT_EQ(expectedPairs, pairs) << "Analysis type " << analysisType;
+  }
+
+  // Check some of the pairs directly
+  std::vector<SpatialJoin::ShapePair> pairs;
+  spatialJoin.FindPairs(WITHIN, pairs);
+
+  // Each cell at resolution 2 on face 00 is within a parent cell (comparison shapes 0 to 3)
+  for (std::size_t baseIndex = 0U; baseIndex < 16U; ++baseIndex)
+  {
+    EXPECT_NE(
+        pairs.end(),
+        std::find(pairs.begin(), pairs.end(), SpatialJoin::ShapePair(baseIndex, baseIndex / 4U)));
+  }
+}
+
+UNIT_TEST(SpatialJoin, EmptySets)
+{
+  Grid::HierarchicalGrid::Aperture4TriangleGrid grid;
+  GridIndexer::HierarchicalGridIndexer indexer(&grid, MAX_FACE_INDEX);
+  PolyhedralGlobe::Icosahedron icosahedron;
+  Projection::Snyder projection(&icosahedron);
+
+  const SpatialAnalysis cell(indexer.CreateCell("0000"), &indexer, &projection);
+
+  const std::vector<const SpatialAnalysis *> noShapes;
+  const std::vector<const SpatialAnalysis *> shapes(1U, &cell);
+
+  const EAGGR::Utilities::WorkStealingPool pool(1U);
+
+  std::vector<SpatialJoin::ShapePair> pairs(1U);
+  SpatialJoin(noShapes, shapes, pool).FindPairs(DISJOINT, pairs);
+  EXPECT_TRUE(pairs.empty());
+
+  pairs.resize(1U);
+  SpatialJoin(shapes, noShapes, pool).FindPairs(DISJOINT, pairs);
+  EXPECT_TRUE(pairs.empty());
+
+  SpatialJoin(shapes, shapes, pool).FindPairs(EQUALS, pairs);
+  ASSERT_EQ(1U, pairs.size());
+  EXPECT_EQ(SpatialJoin::ShapePair(0U, 0U), pairs.front());
+}
@@ -0,0 +1,143 @@
+//------------------------------------------------------
+// Copyright (c) Riskaware 2015
+//------------------------------------------------------
+//
+// system: EAGGRTestHarness
+//
+// subsystem: Unit Tests
+//
+//------------------------------------------------------
+/// @file WorkStealingPoolTest.cpp
+///
+/// Tests for the EAGGR::Utilities::WorkStealingPool class.
+///
+/// This file is part of OpenEAGGR.
+///
+/// OpenEAGGR is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Lesser General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// OpenEAGGR is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Lesser General Public License for more details.
+///
+/// A copy of the GNU Lesser General Public License is available in COPYING.LESSER
+/// or can be found at <http://www.gnu.org/licenses/>.
+//------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "TestMacros.hpp"
+
+#include "Src/Utilities/WorkStealingPool.hpp"
+#include "Src/EAGGRException.hpp"
+
+using namespace EAGGR::Utilities;
+
+UNIT_TEST(WorkStealingPool, NoOfThreads)
+{
+  EXPECT_EQ(3U, WorkStealingPool(3U).GetNoOfThreads());
+
+  // Zero uses the hardware threads, of which there is always at least one
+  EXPECT_LE(1U, WorkStealingPool(0U).GetNoOfThreads());
+}
+
+UNIT_TEST(WorkStealingPool, EachItemProcessedOnce)
+{
+  static const std::size_t NO_OF_ITEMS = 10007U;
+
+  for (unsigned short noOfThreads = 1U; noOfThreads <= 8U; ++noOfThreads)
+  {
+    std::vector<unsigned int> timesProcessed(NO_OF_ITEMS, 0U);
+
+    const WorkStealingPool pool(noOfThreads);
+    pool.ParallelFor(
+        NO_OF_ITEMS,
+        13U,
+        [&timesProcessed](const std::size_t a_begin, const std::size_t a_end)
+        {
+          ASSERT_LT(a_begin, a_end);
+          ASSERT_LE(a_end - a_begin, 13U);
+          for (std::size_t item = a_begin; item < a_end; ++item)
+          {
+            ++timesProcessed[item];
+          }
+        });
+
+    for (std::size_t item = 0U; item < NO_OF_ITEMS; ++item)
+    {
+      ASSERT_EQ(1U, timesProcessed[item]) << "Item " << item << ", threads " << noOfThreads;
+    }
+  }
+}
+
+UNIT_TEST(WorkStealingPool, IdleThreadsStealWork)
+{
+  const WorkStealingPool pool(4U);
+
+  // The chunks in the first worker's share are slow, so the other workers must steal them
+  std::atomic<unsigned int> noOfChunks(0U);
+  std::vector<std::thread::id> threadIds(64U);
+  pool.ParallelFor(64U, 1U, [&](const std::size_t a_begin, const std::size_t a_end)
+  {
+    if (a_begin < 16U)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    threadIds[a_begin] = std::this_thread::get_id();
+    ++noOfChunks;
+  });
+
+  EXPECT_EQ(64U, noOfChunks);
+
+  // The calling thread owns the first share but does not process all of it
+  unsigned int noOfSlowChunksOnCaller = 0U;
+  for (std::size_t item = 0U; item < 16U; ++item)
+  {
+    if (threadIds[item] == std::this_thread::get_id())
+    {
+      ++noOfSlowChunksOnCaller;
+    }
+  }
+  EXPECT_LT(noOfSlowChunksOnCaller, 16U);
+}
+
+UNIT_TEST(WorkStealingPool, NoItems)
+{
+  const WorkStealingPool pool(4U);
+
+  bool isCalled = false;
+  pool.ParallelFor(0U, 10U, [&isCalled](const std::size_t, const std::size_t)
+  {
+    isCalled = true;
+  });
+
+  EXPECT_FALSE(isCalled);
+}
+
+UNIT_TEST(WorkStealingPool, ExceptionIsRethrown)
+{
+  const WorkStealingPool pool(4U);
+
+  EXPECT_THROW(
+      pool.ParallelFor(1000U, 10U, [](const std::size_t a_begin, const std::size_t)
+      {
+        if (a_begin == 500U)
+        {
+          throw EAGGR::EAGGRException("Failed");
+        }
+      }),
+      EAGGR::EAGGRException);
+
+  // A chunk size of zero is rejected
+  EXPECT_THROW(
+      pool.ParallelFor(10U, 0U, [](const std::size_t, const std::size_t)
+      {
+      }),
+      EAGGR::EAGGRException);
+}